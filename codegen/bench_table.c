@@ -0,0 +1,474 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/dirent.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/string.h>
+
+#include <libexplain/closedir.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fopen.h>
+#include <libexplain/opendir.h>
+#include <libexplain/output.h>
+#include <libexplain/readdir.h>
+#include <libexplain/string_list.h>
+
+#include <codegen/bench_table.h>
+#include <codegen/catalogue.h>
+#include <codegen/header.h>
+
+
+static int
+file_contains(const char *filename, const char *text)
+{
+    FILE            *fp;
+    char            line[1000];
+    int             result;
+
+    fp = fopen(filename, "r");
+    if (!fp)
+        return 0;
+    result = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (strstr(line, text))
+        {
+            result = 1;
+            break;
+        }
+    }
+    explain_fclose_or_die(fp);
+    return result;
+}
+
+
+static void
+list_functions(explain_string_list_t *names)
+{
+    DIR             *dp;
+
+    dp = explain_opendir_or_die("catalogue");
+    for (;;)
+    {
+        struct dirent   *dep;
+        char            filename[300];
+        char            text[300];
+
+        dep = explain_readdir_or_die(dp);
+        if (!dep)
+            break;
+        if (dep->d_name[0] == '.')
+            continue;
+
+        /*
+         * Only catalogue entries that have been turned into a
+         * libexplain function can be measured.
+         */
+        snprintf(filename, sizeof(filename), "libexplain/%s.h", dep->d_name);
+        snprintf(text, sizeof(text), "explain_message_errno_%s(", dep->d_name);
+        if (!file_contains(filename, text))
+            continue;
+        explain_string_list_append(names, dep->d_name);
+    }
+    explain_closedir_or_die(dp);
+    explain_string_list_sort(names);
+}
+
+
+static void
+list_errnos(const char *name, explain_string_list_t *errnos)
+{
+    char            filename[300];
+    char            line[1000];
+    FILE            *fp;
+
+    snprintf(filename, sizeof(filename), "libexplain/buffer/errno/%s.c", name);
+    fp = fopen(filename, "r");
+    if (!fp)
+        return;
+    while (fgets(line, sizeof(line), fp))
+    {
+        char            *cp;
+        char            *end;
+
+        cp = line + strspn(line, " \t");
+        if (0 != memcmp(cp, "case E", 6))
+            continue;
+        cp += 5;
+        end = cp;
+        while (isupper((unsigned char)*end) || isdigit((unsigned char)*end))
+            ++end;
+        if (*end != ':')
+            continue;
+        *end = '\0';
+        explain_string_list_append_unique(errnos, cp);
+    }
+    explain_fclose_or_die(fp);
+}
+
+
+static int
+name_is(const char *name, const char *const *list)
+{
+    for (; *list; ++list)
+        if (0 == strcmp(name, *list))
+            return 1;
+    return 0;
+}
+
+
+/**
+  * The argument function is used to choose the benchmark argument
+  * expression for one parameter of a catalogue prototype.
+  *
+  * @param param
+  *     The parameter declaration, e.g. "const char *pathname".
+  * @returns
+  *     the C expression, or NULL if the function can not be measured
+  */
+static const char *
+argument(const char *param)
+{
+    static const char *const fildes_names[] =
+    {
+        "fildes", "fd", "dirfd", "oldfd", "newfd", "old_fildes",
+        "new_fildes", 0
+    };
+    static const char *const path_names[] =
+    {
+        "pathname", "oldpath", "old_path", "source", "dir", "templat", 0
+    };
+    static const char *const path2_names[] =
+    {
+        "newpath", "new_path", "target", 0
+    };
+    static const char *const size_names[] =
+    {
+        "data_size", "size", "name_size", "sock_addr_size",
+        "serv_addr_size", 0
+    };
+    char            name[100];
+    const char      *end;
+    const char      *start;
+    int             pointer;
+    size_t          len;
+
+    if (strstr(param, "va_list"))
+        return 0;
+    if (strstr(param, "char *const *"))
+        return "a->argv";
+    pointer = !!strchr(param, '*');
+
+    /*
+     * The name is the trailing identifier, provided that something
+     * (the type) precedes it.
+     */
+    end = param + strlen(param);
+    start = end;
+    while (start > param && (isalnum((unsigned char)start[-1]) ||
+        start[-1] == '_'))
+        --start;
+    name[0] = '\0';
+    if (start > param && start < end)
+    {
+        len = end - start;
+        if (len >= sizeof(name))
+            len = sizeof(name) - 1;
+        memcpy(name, start, len);
+        name[len] = '\0';
+    }
+
+    if (pointer && strstr(param, "FILE"))
+        return "a->fp";
+    if (pointer && strstr(param, "DIR"))
+        return "a->dir";
+    if (pointer && strstr(param, "char *") && !strstr(param, "char **"))
+    {
+        if (name_is(name, path_names))
+        {
+            return
+                (
+                    0 == memcmp(param, "const ", 6)
+                ?
+                    "a->path"
+                :
+                    "(char *)a->path"
+                );
+        }
+        if (name_is(name, path2_names))
+            return "a->path2";
+        if (0 == strcmp(name, "flags"))
+            return "\"r\"";
+        if (0 == strcmp(name, "tocode") || 0 == strcmp(name, "fromcode"))
+            return "\"UTF-8\"";
+
+        /*
+         * Other strings use the zeroed buffer, an empty string
+         * that is also large enough for any size argument.
+         */
+        return "a->data";
+    }
+    if (pointer)
+        return "a->data";
+    if (name_is(name, fildes_names))
+        return "a->fildes";
+    if (name_is(name, size_names))
+        return "a->data_size";
+    return "0";
+}
+
+
+static int
+uses_args(const explain_string_list_t *args)
+{
+    size_t          j;
+
+    for (j = 0; j < args->length; ++j)
+        if (strstr(args->string[j], "a->"))
+            return 1;
+    return 0;
+}
+
+
+static void
+emit_list(FILE *fp, const char *first, const explain_string_list_t *args)
+{
+    size_t          column;
+    size_t          j;
+
+    fprintf(fp, "%s", first);
+    column = strlen(first);
+    for (j = 0; j < args->length; ++j)
+    {
+        const char      *arg;
+
+        arg = args->string[j];
+        if (column + 2 + strlen(arg) + 2 > 79)
+        {
+            fprintf(fp, ",\n        %s", arg);
+            column = 8 + strlen(arg);
+        }
+        else
+        {
+            fprintf(fp, ", %s", arg);
+            column += 2 + strlen(arg);
+        }
+    }
+    fprintf(fp, ");\n");
+}
+
+
+/**
+  * The emit_invoker function is used to write the function that calls
+  * explain_message_errno_<name> with the benchmark arguments.
+  *
+  * @returns
+  *     non-zero on success, zero if the function can not be measured
+  */
+static int
+emit_invoker(FILE *fp, const char *name)
+{
+    char            catpath[300];
+    char            first[300];
+    catalogue_t     *cp;
+    const char      *proto;
+    const char      *lparen;
+    const char      *rparen;
+    const char      *p;
+    explain_string_list_t args;
+    int             ok;
+
+    snprintf(catpath, sizeof(catpath), "catalogue/%s", name);
+    cp = catalogue_open(catpath);
+    proto = catalogue_get(cp, "Prototype");
+    if (!proto)
+        explain_output_error_and_die("%s: catalogue has no Prototype", name);
+    lparen = strchr(proto, '(');
+    rparen = strrchr(proto, ')');
+    if (!lparen || !rparen || rparen < lparen)
+        explain_output_error_and_die("%s: malformed Prototype", name);
+
+    explain_string_list_constructor(&args);
+    ok = 1;
+    p = lparen + 1;
+    while (p < rparen)
+    {
+        char            param[300];
+        const char      *comma;
+        const char      *arg;
+        size_t          len;
+
+        comma = p + strcspn(p, ",)");
+        if (comma > rparen)
+            comma = rparen;
+        while (p < comma && isspace((unsigned char)*p))
+            ++p;
+        len = comma - p;
+        while (len > 0 && isspace((unsigned char)p[len - 1]))
+            --len;
+        if (len >= sizeof(param))
+            len = sizeof(param) - 1;
+        memcpy(param, p, len);
+        param[len] = '\0';
+        p = comma + 1;
+
+        if (0 == strcmp(param, "...") || 0 == strcmp(param, "void"))
+            break;
+        if (!param[0])
+            continue;
+        arg = argument(param);
+        if (!arg)
+        {
+            ok = 0;
+            break;
+        }
+        explain_string_list_append(&args, arg);
+    }
+    catalogue_close(cp);
+
+    if (ok)
+    {
+        fprintf(fp, "\n");
+        fprintf(fp, "static void\n");
+        fprintf
+        (
+            fp,
+            "invoke_%s(char *message, int message_size, int errnum,\n",
+            name
+        );
+        fprintf(fp, "    const bench_args_t *a)\n");
+        fprintf(fp, "{\n");
+        if (!uses_args(&args))
+            fprintf(fp, "    (void)a;\n");
+        snprintf
+        (
+            first,
+            sizeof(first),
+            "    explain_message_errno_%s(message, message_size, errnum",
+            name
+        );
+        emit_list(fp, first, &args);
+        fprintf(fp, "}\n");
+        fprintf(fp, "\n");
+    }
+    explain_string_list_destructor(&args);
+    return ok;
+}
+
+
+static void
+emit_errnos(FILE *fp, const char *name)
+{
+    explain_string_list_t errnos;
+    size_t          column;
+    size_t          j;
+
+    explain_string_list_constructor(&errnos);
+    list_errnos(name, &errnos);
+    fprintf(fp, "        \"");
+    column = 9;
+    for (j = 0; j < errnos.length; ++j)
+    {
+        const char      *e;
+
+        e = errnos.string[j];
+        if (column + strlen(e) + 3 > 79)
+        {
+            fprintf(fp, " \"\n        \"");
+            column = 9;
+        }
+        else if (j)
+        {
+            fprintf(fp, " ");
+            ++column;
+        }
+        fprintf(fp, "%s", e);
+        column += strlen(e);
+    }
+    fprintf(fp, "\"\n");
+    explain_string_list_destructor(&errnos);
+}
+
+
+void
+bench_table_generate(const char *filename)
+{
+    explain_string_list_t names;
+    explain_string_list_t ok;
+    FILE            *fp;
+    size_t          j;
+
+    explain_string_list_constructor(&names);
+    list_functions(&names);
+
+    fp = explain_fopen_or_die(filename, "w");
+    gpl_header(fp, " * ");
+    fprintf(fp, "\n");
+    fprintf(fp, "/*\n");
+    fprintf(fp, " * This file is generated from the catalogue/ entries\n");
+    fprintf(fp, " * by \"codegen --bench-table\".  Do not edit it, "
+        "regenerate it.\n");
+    fprintf(fp, " */\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <libexplain/ac/stddef.h>\n");
+    fprintf(fp, "\n");
+    for (j = 0; j < names.length; ++j)
+        fprintf(fp, "#include <libexplain/%s.h>\n", names.string[j]);
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <test/bench/bench.h>\n");
+    fprintf(fp, "\n");
+
+    explain_string_list_constructor(&ok);
+    for (j = 0; j < names.length; ++j)
+    {
+        if (emit_invoker(fp, names.string[j]))
+            explain_string_list_append(&ok, names.string[j]);
+    }
+
+    fprintf(fp, "\n");
+    fprintf(fp, "const bench_table_t bench_table[] =\n");
+    fprintf(fp, "{\n");
+    for (j = 0; j < ok.length; ++j)
+    {
+        fprintf(fp, "    {\n");
+        fprintf(fp, "        \"%s\",\n", ok.string[j]);
+        fprintf(fp, "        invoke_%s,\n", ok.string[j]);
+        emit_errnos(fp, ok.string[j]);
+        fprintf(fp, "    },\n");
+    }
+    fprintf(fp, "};\n");
+    fprintf(fp, "\n");
+    fprintf
+    (
+        fp,
+        "const size_t bench_table_size = "
+            "sizeof(bench_table) / sizeof(bench_table[0]);\n"
+    );
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "/* vim: set ts=8 sw=4 et : */\n");
+    explain_fclose_or_die(fp);
+
+    explain_string_list_destructor(&ok);
+    explain_string_list_destructor(&names);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
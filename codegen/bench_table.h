@@ -0,0 +1,39 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CODEGEN_BENCH_TABLE_H
+#define CODEGEN_BENCH_TABLE_H
+
+/**
+  * The bench_table_generate function may be used to write the function
+  * table for the latency benchmark (test/bench).  There is one entry
+  * for each catalogue entry that has an explain_message_errno_<name>
+  * function, the arguments are chosen from the parameter types and
+  * names of the catalogue Prototype, and the errno values are those
+  * with a case in libexplain/buffer/errno/<name>.c
+  *
+  * Functions taking a va_list are omitted.
+  *
+  * @param filename
+  *     The path of the C file to write, usually test/bench/table.c
+  */
+void bench_table_generate(const char *filename);
+
+#endif /* CODEGEN_BENCH_TABLE_H */
+/* vim: set ts=8 sw=4 et : */
@@ -1662,6 +1662,32 @@ man_man3_explain_fubar_or_die_3(node_t *declaration)
 }
 
 
+/**
+  * The suppress_fildes function is used to determine the file
+  * descriptor argument to pass to explain_output_suppress: the first
+  * argument, if it is an int called fildes, otherwise -1.
+  */
+static const char *
+suppress_fildes(void)
+{
+    char            fmt[40];
+
+    if (call_args->nchild < 1)
+        return "-1";
+    if (!node_is_literal(call_args->child[0], "fildes"))
+        return "-1";
+    if
+    (
+        !node_parameter_is_formatable(args->child[0]->child[0], fmt,
+            sizeof(fmt))
+    )
+        return "-1";
+    if (0 != strcmp(fmt, "explain_buffer_int"))
+        return "-1";
+    return "fildes";
+}
+
+
 static void
 libexplain_fubar_or_die_c(node_t *declaration)
 {
@@ -1713,7 +1739,17 @@ libexplain_fubar_or_die_c(node_t *declaration)
         char            line[256];
 
         explain_string_list_constructor(&incls);
+        explain_string_list_append
+        (
+            &incls,
+            "#include <libexplain/explanation.h>\n"
+        );
         explain_string_list_append(&incls, "#include <libexplain/output.h>\n");
+        explain_string_list_append
+        (
+            &incls,
+            "#include <libexplain/output/or_die.h>\n"
+        );
         snprintf
         (
             line,
@@ -1744,6 +1780,7 @@ libexplain_fubar_or_die_c(node_t *declaration)
     {
         if (reset_errno)
             fprintf(fp, "    errno = 0;\n");
+        fprintf(fp, "    explain_output_or_die_begin();\n");
         elastic_buffer_rewind(&sb);
         elastic_buffer_puts(&sb, "if (");
         if (ret_ptr)
@@ -1773,6 +1810,7 @@ libexplain_fubar_or_die_c(node_t *declaration)
         fprintf(fp, "\n");
         if (reset_errno)
             fprintf(fp, "    errno = 0;\n");
+        fprintf(fp, "    explain_output_or_die_begin();\n");
         elastic_buffer_rewind(&sb);
         elastic_buffer_puts(&sb, "result = explain_");
         elastic_buffer_puts(&sb, function_name);
@@ -1780,6 +1818,7 @@ libexplain_fubar_or_die_c(node_t *declaration)
         node_print_sb(call_args, &sb, node_print_style_normal);
         elastic_buffer_puts(&sb, ");");
         wrapper_hang(fp, "    ", elastic_buffer_get(&sb));
+        fprintf(fp, "    explain_output_or_die_end();\n");
 
         fprintf(fp, "    if (");
         if (ret_ptr)
@@ -1793,6 +1832,8 @@ libexplain_fubar_or_die_c(node_t *declaration)
     fprintf(fp, "    {\n");
     fprintf(fp, "        explain_output_exit_failure();\n");
     fprintf(fp, "    }\n");
+    if (ret_int && !use_return_value)
+        fprintf(fp, "    explain_output_or_die_end();\n");
     if (use_return_value)
         fprintf(fp, "    return result;\n");
     fprintf(fp, "}\n");
@@ -1837,7 +1878,9 @@ libexplain_fubar_or_die_c(node_t *declaration)
     elastic_buffer_putc(&sb, '(');
     node_print_sb(call_args, &sb, node_print_style_normal);
     elastic_buffer_puts(&sb, ");");
+    fprintf(fp, "    explain_explanation_call_begin();\n");
     wrapper_hang(fp, "    ", elastic_buffer_get(&sb));
+    fprintf(fp, "    explain_explanation_call_end();\n");
     fprintf(fp, "#else\n");
     fprintf(fp, "    errno = ENOSYS;\n");
     if (ret_ptr)
@@ -1856,12 +1899,25 @@ libexplain_fubar_or_die_c(node_t *declaration)
     fprintf(fp, "    {\n");
     if (!reset_errno)
         fprintf(fp, "        int             hold_errno;\n\n");
+    fprintf(fp, "        hold_errno = errno;\n");
+
+    /*
+     * The sampling policy and output filter get to say no before the
+     * explanation is built.
+     */
+    fprintf
+    (
+        fp,
+        "        if (!explain_output_suppress(\"%s\", hold_errno, %s))\n",
+        function_name,
+        suppress_fildes()
+    );
     fputs
     (
-        "        hold_errno = errno;\n"
-        "        explain_output_error\n"
-        "        (\n"
-        "            \"%s\",\n",
+        "        {\n"
+        "            explain_output_error\n"
+        "            (\n"
+        "                \"%s\",\n",
         fp
     );
     elastic_buffer_rewind(&sb);
@@ -1870,8 +1926,9 @@ libexplain_fubar_or_die_c(node_t *declaration)
     elastic_buffer_puts(&sb, "(hold_errno, ");
     node_print_sb(call_args, &sb, node_print_style_normal);
     elastic_buffer_puts(&sb, ")");
-    wrapper_hang(fp, "            ", elastic_buffer_get(&sb));
-    fprintf(fp, "        );\n");
+    wrapper_hang(fp, "                ", elastic_buffer_get(&sb));
+    fprintf(fp, "            );\n");
+    fprintf(fp, "        }\n");
     if (!reset_errno)
         fprintf(fp, "        errno = hold_errno;\n");
     fprintf(fp, "    }\n");
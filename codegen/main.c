@@ -27,11 +27,14 @@
 #include <libexplain/output.h>
 #include <libexplain/version_print.h>
 
+#include <codegen/bench_table.h>
 #include <codegen/catalogue.h>
 #include <codegen/elastic_buffer.h>
 #include <codegen/generate.h>
 #include <codegen/gram.h>
 #include <codegen/ioctl_scan.h>
+#include <codegen/perfect_hash.h>
+#include <codegen/preload.h>
 
 
 static void
@@ -39,6 +42,9 @@ usage(void)
 {
     fprintf(stderr, "Usage: codegen <declaration>\n");
     fprintf(stderr, "       codegen -i <include-file>\n");
+    fprintf(stderr, "       codegen --perfect-hash <description>\n");
+    fprintf(stderr, "       codegen --bench-table <file.c>\n");
+    fprintf(stderr, "       codegen --preload <file.c>\n");
     fprintf(stderr, "       codegen -V\n");
     exit(EXIT_FAILURE);
 }
@@ -48,10 +54,13 @@ usage(void)
 
 static const struct option options[] =
 {
+    { "bench-table", 1, 0, 'B' },
     { "ioctl-scan-include", 1, 0, 'i' },
     { "ioctl-scan-generate", 1, 0, 'I' },
     { "ioctl-scan-dir", 1, 0, 'S' },
     { "lisp", 0, 0, 'l' },
+    { "perfect-hash", 1, 0, 'H' },
+    { "preload", 1, 0, 'P' },
     { "specific", 1, 0, 'g' },
     { "version", 0, 0, 'V' },
     { 0, 0, 0, 0 }
@@ -73,18 +82,26 @@ main(int argc, char **argv)
     for (;;)
     {
 #ifdef HAVE_GETOPT_LONG
-        int c = getopt_long(argc, argv, "g:I:i:lS:V", options, 0);
+        int c = getopt_long(argc, argv, "B:g:H:I:i:lP:S:V", options, 0);
 #else
-        int c = getopt(argc, argv, "g:I:i:lS:V");
+        int c = getopt(argc, argv, "B:g:H:I:i:lP:S:V");
 #endif
         if (c < 0)
             break;
         switch (c)
         {
+        case 'B':
+            bench_table_generate(optarg);
+            return 0;
+
         case 'g':
             generate_specific(optarg);
             break;
 
+        case 'H':
+            perfect_hash_generate(optarg);
+            return 0;
+
         case 'I':
             ioctl_scan_generate(optarg);
             return 0;
@@ -101,6 +118,10 @@ main(int argc, char **argv)
             lisp = 1;
             break;
 
+        case 'P':
+            preload_generate(optarg);
+            return 0;
+
         case 'V':
             explain_version_print();
             return 0;
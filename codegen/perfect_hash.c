@@ -0,0 +1,655 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/regex.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+
+#include <libexplain/fclose.h>
+#include <libexplain/fopen.h>
+#include <libexplain/malloc.h>
+#include <libexplain/output.h>
+#include <libexplain/string_list.h>
+
+#include <codegen/header.h>
+#include <codegen/perfect_hash.h>
+
+
+typedef struct description_t description_t;
+struct description_t
+{
+    const char      *filename;
+    char            prefix[100];
+    char            output[PATH_MAX];
+    int             nocase;
+    int             have_pattern;
+    regex_t         pattern;
+    explain_string_list_t keys;
+};
+
+
+/**
+  * The hash function is used to hash a key.  It is FNV-1a, seeded,
+  * with a final avalanche so that the remainder of small divisors is
+  * well distributed.  It must give exactly the same results as the
+  * function written by #emit_hash, below.
+  */
+static unsigned long
+hash(const char *key, unsigned long seed, int nocase)
+{
+    unsigned long   h;
+
+    h = (2166136261UL ^ seed) & 0xFFFFFFFFUL;
+    for (; *key; ++key)
+    {
+        unsigned char   c;
+
+        c = *key;
+        if (nocase && c >= 'a' && c <= 'z')
+            c += 'A' - 'a';
+        h ^= c;
+        h = (h * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    h ^= h >> 16;
+    h = (h * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+    h ^= h >> 13;
+    h = (h * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+    h ^= h >> 16;
+    return h;
+}
+
+
+static void
+emit_hash(FILE *fp, int nocase)
+{
+    fprintf(fp, "static unsigned long\n");
+    fprintf(fp, "hash(const char *key, unsigned long seed)\n");
+    fprintf(fp, "{\n");
+    fprintf(fp, "    unsigned long   h;\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "    h = (2166136261UL ^ seed) & 0xFFFFFFFFUL;\n");
+    fprintf(fp, "    for (; *key; ++key)\n");
+    fprintf(fp, "    {\n");
+    fprintf(fp, "        unsigned char   c;\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "        c = *key;\n");
+    if (nocase)
+    {
+        fprintf(fp, "        if (c >= 'a' && c <= 'z')\n");
+        fprintf(fp, "            c += 'A' - 'a';\n");
+    }
+    fprintf(fp, "        h ^= c;\n");
+    fprintf(fp, "        h = (h * 16777619UL) & 0xFFFFFFFFUL;\n");
+    fprintf(fp, "    }\n");
+    fprintf(fp, "    h ^= h >> 16;\n");
+    fprintf(fp, "    h = (h * 0x85EBCA6BUL) & 0xFFFFFFFFUL;\n");
+    fprintf(fp, "    h ^= h >> 13;\n");
+    fprintf(fp, "    h = (h * 0xC2B2AE35UL) & 0xFFFFFFFFUL;\n");
+    fprintf(fp, "    h ^= h >> 16;\n");
+    fprintf(fp, "    return h;\n");
+    fprintf(fp, "}\n");
+}
+
+
+static int
+key_compare(const description_t *dp, const char *a, const char *b)
+{
+    return (dp->nocase ? strcasecmp(a, b) : strcmp(a, b));
+}
+
+
+static void
+add_key(description_t *dp, const char *key)
+{
+    size_t          j;
+
+    if (!*key)
+        return;
+    for (j = 0; j < dp->keys.length; ++j)
+    {
+        if (0 == key_compare(dp, dp->keys.string[j], key))
+            return;
+    }
+    explain_string_list_append(&dp->keys, key);
+}
+
+
+static void
+read_source(description_t *dp, const char *filename)
+{
+    FILE            *fp;
+    char            line[1000];
+
+    if (!dp->have_pattern)
+    {
+        explain_output_error_and_die
+        (
+            "%s: source %s: no pattern given",
+            dp->filename,
+            filename
+        );
+    }
+    fp = explain_fopen_or_die(filename, "r");
+    while (fgets(line, sizeof(line), fp))
+    {
+        regmatch_t      match[2];
+        size_t          len;
+
+        len = strlen(line);
+        if (len > 0 && line[len - 1] == '\n')
+            line[--len] = '\0';
+        if (regexec(&dp->pattern, line, 2, match, 0) != 0)
+            continue;
+        if (match[1].rm_so < 0)
+            continue;
+        line[match[1].rm_eo] = '\0';
+        add_key(dp, line + match[1].rm_so);
+    }
+    explain_fclose_or_die(fp);
+}
+
+
+static void
+read_description(description_t *dp, const char *filename)
+{
+    FILE            *fp;
+    char            line[1000];
+    int             linum;
+
+    memset(dp, 0, sizeof(*dp));
+    dp->filename = filename;
+    explain_string_list_constructor(&dp->keys);
+    fp = explain_fopen_or_die(filename, "r");
+    linum = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        char            *directive;
+        char            *arg;
+        size_t          len;
+
+        ++linum;
+        len = strlen(line);
+        while (len > 0 && isspace((unsigned char)line[len - 1]))
+            line[--len] = '\0';
+        directive = line + strspn(line, " \t");
+        if (!*directive || *directive == '#')
+            continue;
+        arg = directive + strcspn(directive, " \t");
+        if (*arg)
+        {
+            *arg++ = '\0';
+            arg += strspn(arg, " \t");
+        }
+
+        if (0 == strcmp(directive, "prefix"))
+            snprintf(dp->prefix, sizeof(dp->prefix), "%s", arg);
+        else if (0 == strcmp(directive, "output"))
+            snprintf(dp->output, sizeof(dp->output), "%s", arg);
+        else if (0 == strcmp(directive, "case-insensitive"))
+            dp->nocase = 1;
+        else if (0 == strcmp(directive, "key"))
+            add_key(dp, arg);
+        else if (0 == strcmp(directive, "pattern"))
+        {
+            if (dp->have_pattern)
+                regfree(&dp->pattern);
+            if (regcomp(&dp->pattern, arg, REG_EXTENDED) != 0)
+            {
+                explain_output_error_and_die
+                (
+                    "%s: %d: pattern \"%s\" invalid",
+                    filename,
+                    linum,
+                    arg
+                );
+            }
+            dp->have_pattern = 1;
+        }
+        else if (0 == strcmp(directive, "source"))
+            read_source(dp, arg);
+        else
+        {
+            explain_output_error_and_die
+            (
+                "%s: %d: directive \"%s\" unknown",
+                filename,
+                linum,
+                directive
+            );
+        }
+    }
+    explain_fclose_or_die(fp);
+
+    if (!dp->prefix[0])
+        explain_output_error_and_die("%s: no prefix given", filename);
+    if (dp->keys.length == 0 || dp->keys.length > 0xFFFF)
+    {
+        explain_output_error_and_die
+        (
+            "%s: %d keys, must be 1..65535",
+            filename,
+            (int)dp->keys.length
+        );
+    }
+    if (!dp->output[0])
+    {
+        char            *dot;
+        char            *slash;
+
+        snprintf(dp->output, sizeof(dp->output), "%s", filename);
+        dot = strrchr(dp->output, '.');
+        slash = strrchr(dp->output, '/');
+        if (dot && (!slash || dot > slash))
+            *dot = '\0';
+    }
+}
+
+
+static const size_t *sort_bucket_size;
+
+
+static int
+bucket_cmp(const void *va, const void *vb)
+{
+    size_t          a;
+    size_t          b;
+
+    a = *(const size_t *)va;
+    b = *(const size_t *)vb;
+    if (sort_bucket_size[a] != sort_bucket_size[b])
+        return (sort_bucket_size[a] < sort_bucket_size[b] ? 1 : -1);
+    return (a < b ? -1 : a > b);
+}
+
+
+static const description_t *sort_dp;
+static const size_t *sort_key_of_slot;
+
+
+static int
+slot_cmp(const void *va, const void *vb)
+{
+    size_t          a;
+    size_t          b;
+
+    a = sort_key_of_slot[*(const unsigned *)va];
+    b = sort_key_of_slot[*(const unsigned *)vb];
+    return
+        key_compare
+        (
+            sort_dp,
+            sort_dp->keys.string[a],
+            sort_dp->keys.string[b]
+        );
+}
+
+
+/**
+  * The build function is used to find a displacement for each bucket,
+  * so that every key has a slot of its own.  Buckets are placed
+  * largest first, while there are plenty of free slots, in the manner
+  * of "hash, displace and compress".
+  */
+static void
+build(const description_t *dp, size_t nbuckets, unsigned *displacement,
+    size_t *key_of_slot)
+{
+    size_t          nkeys;
+    size_t          *bucket_of_key;
+    size_t          *bucket_size;
+    size_t          *order;
+    unsigned char   *used;
+    size_t          *trial;
+    size_t          j;
+
+    nkeys = dp->keys.length;
+    bucket_of_key = explain_malloc_or_die(nkeys * sizeof(size_t));
+    bucket_size = explain_malloc_or_die(nbuckets * sizeof(size_t));
+    order = explain_malloc_or_die(nbuckets * sizeof(size_t));
+    used = explain_malloc_or_die(nkeys);
+    trial = explain_malloc_or_die(nkeys * sizeof(size_t));
+    memset(bucket_size, 0, nbuckets * sizeof(size_t));
+    memset(used, 0, nkeys);
+    for (j = 0; j < nkeys; ++j)
+    {
+        bucket_of_key[j] = hash(dp->keys.string[j], 0, dp->nocase) % nbuckets;
+        ++bucket_size[bucket_of_key[j]];
+    }
+    for (j = 0; j < nbuckets; ++j)
+    {
+        order[j] = j;
+        displacement[j] = 0;
+    }
+    sort_bucket_size = bucket_size;
+    qsort(order, nbuckets, sizeof(order[0]), bucket_cmp);
+
+    for (j = 0; j < nbuckets && bucket_size[order[j]]; ++j)
+    {
+        size_t          b;
+        unsigned long   d;
+
+        b = order[j];
+        for (d = 1; d <= 0xFFFF; ++d)
+        {
+            size_t          ntrial;
+            size_t          k;
+            size_t          t;
+
+            ntrial = 0;
+            for (k = 0; k < nkeys; ++k)
+            {
+                size_t          slot;
+
+                if (bucket_of_key[k] != b)
+                    continue;
+                slot = hash(dp->keys.string[k], d, dp->nocase) % nkeys;
+                if (used[slot])
+                    break;
+                used[slot] = 1;
+                key_of_slot[slot] = k;
+                trial[ntrial++] = slot;
+            }
+            if (k >= nkeys)
+            {
+                displacement[b] = d;
+                break;
+            }
+            for (t = 0; t < ntrial; ++t)
+                used[trial[t]] = 0;
+        }
+        if (d > 0xFFFF)
+        {
+            explain_output_error_and_die
+            (
+                "%s: unable to find a perfect hash",
+                dp->filename
+            );
+        }
+    }
+
+    free(bucket_of_key);
+    free(bucket_size);
+    free(order);
+    free(used);
+    free(trial);
+}
+
+
+static void
+emit_header(FILE *fp, const description_t *dp)
+{
+    if (0 == memcmp(dp->output, "libexplain/", 11))
+        lgpl_header(fp, " * ");
+    else
+        gpl_header(fp, " * ");
+    fprintf(fp, "\n");
+    fprintf(fp, "/*\n");
+    fprintf(fp, " * This file is generated from %s\n", dp->filename);
+    fprintf(fp, " * by \"codegen --perfect-hash\".\n");
+    fprintf(fp, " * Edit the description, not this file, and regenerate.\n");
+    fprintf(fp, " */\n");
+    fprintf(fp, "\n");
+}
+
+
+static void
+upcase(char *dst, size_t dst_size, const char *src)
+{
+    char            *end;
+
+    end = dst + dst_size - 1;
+    for (; *src && dst < end; ++src)
+    {
+        unsigned char   c;
+
+        c = *src;
+        *dst++ = (isalnum(c) ? toupper(c) : '_');
+    }
+    *dst = '\0';
+}
+
+
+static void
+write_h(const description_t *dp)
+{
+    char            filename[PATH_MAX + 3];
+    char            guard[PATH_MAX + 3];
+    char            size_macro[110];
+    FILE            *fp;
+
+    snprintf(filename, sizeof(filename), "%s.h", dp->output);
+    upcase(guard, sizeof(guard), filename);
+    upcase(size_macro, sizeof(size_macro), dp->prefix);
+    fp = explain_fopen_or_die(filename, "w");
+    emit_header(fp, dp);
+    fprintf(fp, "#ifndef %s\n", guard);
+    fprintf(fp, "#define %s\n", guard);
+    fprintf(fp, "\n");
+    fprintf(fp, "/**\n");
+    fprintf(fp, "  * The %s_SIZE macro is the number of keys,\n", size_macro);
+    fprintf(fp, "  * and so the number of slots.\n");
+    fprintf(fp, "  */\n");
+    fprintf
+    (
+        fp,
+        "#define %s_SIZE %d\n",
+        size_macro,
+        (int)dp->keys.length
+    );
+    fprintf(fp, "\n");
+    fprintf(fp, "/**\n");
+    fprintf(fp, "  * The %s_slot function may be used to\n", dp->prefix);
+    fprintf(fp, "  * find the slot of a key, using a minimal perfect hash.\n");
+    fprintf(fp, "  *\n");
+    fprintf(fp, "  * @param key\n");
+    fprintf(fp, "  *     The key to look for%s.\n",
+        (dp->nocase ? ", case is ignored" : ""));
+    fprintf(fp, "  * @returns\n");
+    fprintf(fp, "  *     the slot, from 0 to %s_SIZE - 1,\n", size_macro);
+    fprintf(fp, "  *     or -1 if it is not one of the keys.\n");
+    fprintf(fp, "  */\n");
+    fprintf(fp, "int %s_slot(const char *key);\n", dp->prefix);
+    fprintf(fp, "\n");
+    fprintf(fp, "/**\n");
+    fprintf(fp, "  * The %s_key array holds\n", dp->prefix);
+    fprintf(fp, "  * the keys, in slot order.\n");
+    fprintf(fp, "  */\n");
+    fprintf(fp, "extern const char *const %s_key[];\n", dp->prefix);
+    fprintf(fp, "\n");
+    fprintf(fp, "/**\n");
+    fprintf(fp, "  * The %s_sorted array holds\n", dp->prefix);
+    fprintf(fp, "  * the slots, in the sorted order of their keys.\n");
+    fprintf(fp, "  */\n");
+    fprintf(fp, "extern const unsigned short %s_sorted[];\n", dp->prefix);
+    fprintf(fp, "\n");
+    fprintf(fp, "#endif /* %s */\n", guard);
+    fprintf(fp, "/* vim: set ts=8 sw=4 et : */\n");
+    explain_fclose_or_die(fp);
+}
+
+
+static void
+emit_numbers(FILE *fp, const unsigned *value, size_t n)
+{
+    size_t          j;
+
+    for (j = 0; j < n; ++j)
+    {
+        if (j % 10 == 0)
+            fprintf(fp, "   ");
+        fprintf(fp, " %u,", value[j]);
+        if (j % 10 == 9 || j + 1 == n)
+            fprintf(fp, "\n");
+    }
+}
+
+
+static void
+write_c(const description_t *dp, size_t nbuckets,
+    const unsigned *displacement, const size_t *key_of_slot)
+{
+    char            filename[PATH_MAX + 3];
+    FILE            *fp;
+    size_t          nkeys;
+    unsigned        *sorted;
+    size_t          j;
+
+    nkeys = dp->keys.length;
+    snprintf(filename, sizeof(filename), "%s.c", dp->output);
+    fp = explain_fopen_or_die(filename, "w");
+    emit_header(fp, dp);
+    fprintf(fp, "#include <libexplain/ac/string.h>\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <%s.h>\n", dp->output);
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+
+    fprintf(fp, "/*\n");
+    fprintf(fp, " * The displacement of each bucket, chosen so that the\n");
+    fprintf(fp, " * second hash sends every key to a slot of its own.\n");
+    fprintf(fp, " */\n");
+    fprintf
+    (
+        fp,
+        "static const unsigned short displacement[%d] =\n",
+        (int)nbuckets
+    );
+    fprintf(fp, "{\n");
+    emit_numbers(fp, displacement, nbuckets);
+    fprintf(fp, "};\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+
+    fprintf(fp, "const char *const %s_key[] =\n", dp->prefix);
+    fprintf(fp, "{\n");
+    for (j = 0; j < nkeys; ++j)
+        fprintf(fp, "    \"%s\",\n", dp->keys.string[key_of_slot[j]]);
+    fprintf(fp, "};\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+
+    sorted = explain_malloc_or_die(nkeys * sizeof(sorted[0]));
+    for (j = 0; j < nkeys; ++j)
+        sorted[j] = j;
+    sort_dp = dp;
+    sort_key_of_slot = key_of_slot;
+    qsort(sorted, nkeys, sizeof(sorted[0]), slot_cmp);
+    fprintf(fp, "const unsigned short %s_sorted[] =\n", dp->prefix);
+    fprintf(fp, "{\n");
+    emit_numbers(fp, sorted, nkeys);
+    fprintf(fp, "};\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    free(sorted);
+
+    emit_hash(fp, dp->nocase);
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+
+    fprintf(fp, "int\n");
+    fprintf(fp, "%s_slot(const char *key)\n", dp->prefix);
+    fprintf(fp, "{\n");
+    fprintf(fp, "    unsigned long   bucket;\n");
+    fprintf(fp, "    int             slot;\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "    bucket = hash(key, 0) %% %d;\n", (int)nbuckets);
+    fprintf
+    (
+        fp,
+        "    slot = hash(key, displacement[bucket]) %% %d;\n",
+        (int)nkeys
+    );
+    fprintf
+    (
+        fp,
+        "    if (0 != %s(key, %s_key[slot]))\n",
+        (dp->nocase ? "strcasecmp" : "strcmp"),
+        dp->prefix
+    );
+    fprintf(fp, "        return -1;\n");
+    fprintf(fp, "    return slot;\n");
+    fprintf(fp, "}\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "/* vim: set ts=8 sw=4 et : */\n");
+    explain_fclose_or_die(fp);
+}
+
+
+void
+perfect_hash_generate(const char *filename)
+{
+    description_t   d;
+    size_t          nkeys;
+    size_t          nbuckets;
+    unsigned        *displacement;
+    size_t          *key_of_slot;
+    size_t          j;
+
+    read_description(&d, filename);
+    nkeys = d.keys.length;
+
+    /*
+     * About three keys per bucket keeps the displacement table small,
+     * and the search for displacements quick.
+     */
+    nbuckets = (nkeys + 2) / 3;
+    displacement = explain_malloc_or_die(nbuckets * sizeof(displacement[0]));
+    key_of_slot = explain_malloc_or_die(nkeys * sizeof(key_of_slot[0]));
+    build(&d, nbuckets, displacement, key_of_slot);
+
+    /*
+     * Check the result, the way the generated code will use it.
+     */
+    for (j = 0; j < nkeys; ++j)
+    {
+        const char      *key;
+        size_t          b;
+        size_t          slot;
+
+        key = d.keys.string[j];
+        b = hash(key, 0, d.nocase) % nbuckets;
+        slot = hash(key, displacement[b], d.nocase) % nkeys;
+        if (key_of_slot[slot] != j)
+        {
+            explain_output_error_and_die
+            (
+                "%s: key \"%s\" is not in its slot",
+                filename,
+                key
+            );
+        }
+    }
+
+    write_h(&d);
+    write_c(&d, nbuckets, displacement, key_of_slot);
+
+    free(displacement);
+    free(key_of_slot);
+    if (d.have_pattern)
+        regfree(&d.pattern);
+    explain_string_list_destructor(&d.keys);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
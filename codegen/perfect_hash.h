@@ -0,0 +1,53 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CODEGEN_PERFECT_HASH_H
+#define CODEGEN_PERFECT_HASH_H
+
+/**
+  * The perfect_hash_generate function may be used to read a table
+  * description, and write C source for a minimal perfect hash of its
+  * keys, together with the keys in slot order and a sorted index.
+  *
+  * The description is a text file.  Blank lines, and lines starting
+  * with "#", are ignored.  The other lines are directives:
+  *
+  * prefix <name>
+  *     The prefix of the generated identifiers (required).
+  * output <path>
+  *     The generated files are <path>.c and <path>.h; the default is
+  *     the description's path, less its extension.
+  * case-insensitive
+  *     Keys are compared ignoring (ASCII) case.
+  * key <text>
+  *     Add one key.
+  * pattern <regex>
+  *     An extended regular expression, its first sub-expression is
+  *     the key; used by subsequent source directives.
+  * source <path>
+  *     Add a key for each line of the file matching the pattern, so
+  *     that the keys need not be maintained by hand.
+  *
+  * @param description
+  *     The path of the table description file.
+  */
+void perfect_hash_generate(const char *description);
+
+#endif /* CODEGEN_PERFECT_HASH_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,782 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/dirent.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/string.h>
+
+#include <libexplain/closedir.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fopen.h>
+#include <libexplain/opendir.h>
+#include <libexplain/output.h>
+#include <libexplain/readdir.h>
+#include <libexplain/string_list.h>
+
+#include <codegen/catalogue.h>
+#include <codegen/header.h>
+#include <codegen/preload.h>
+
+
+typedef struct proto_t proto_t;
+struct proto_t
+{
+    char            name[100];
+    char            ret[100];
+    int             ret_pointer;
+
+    /* the parameter declarations, e.g. "const char *pathname" */
+    explain_string_list_t decl;
+
+    /* the parameter names, e.g. "pathname" */
+    explain_string_list_t names;
+
+    /* the parameter types, e.g. "const char *" */
+    explain_string_list_t types;
+
+    /* the last parameter is passed through "..." */
+    int             variadic;
+};
+
+
+static int
+name_is(const char *name, const char *const *list)
+{
+    for (; *list; ++list)
+        if (0 == strcmp(name, *list))
+            return 1;
+    return 0;
+}
+
+
+/**
+  * The first_test function is used to read the failure test of the
+  * explain_<name>_on_error function, that is, the first if statement.
+  */
+static void
+first_test(const char *name, char *text, size_t text_size)
+{
+    char            filename[300];
+    char            line[1000];
+    FILE            *fp;
+
+    text[0] = '\0';
+    snprintf(filename, sizeof(filename), "libexplain/%s_on_error.c", name);
+    fp = fopen(filename, "r");
+    if (!fp)
+        return;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (0 == memcmp(line, "    if (", 8))
+        {
+            size_t          len;
+
+            len = strlen(line);
+            while (len > 0 && isspace((unsigned char)line[len - 1]))
+                --len;
+            line[len] = '\0';
+            snprintf(text, text_size, "%s", line + 4);
+            break;
+        }
+    }
+    explain_fclose_or_die(fp);
+}
+
+
+static int
+header_has_message(const char *name)
+{
+    char            filename[300];
+    char            text[300];
+    char            line[1000];
+    FILE            *fp;
+    int             result;
+
+    snprintf(filename, sizeof(filename), "libexplain/%s.h", name);
+    snprintf(text, sizeof(text), "explain_message_errno_%s(", name);
+    fp = fopen(filename, "r");
+    if (!fp)
+        return 0;
+    result = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (strstr(line, text))
+        {
+            result = 1;
+            break;
+        }
+    }
+    explain_fclose_or_die(fp);
+    return result;
+}
+
+
+/**
+  * The trailing_name function is used to split a declaration into its
+  * type and its name, e.g. "const char *pathname" into "const char *"
+  * and "pathname".  Array bounds are folded into the type as a pointer.
+  */
+static void
+trailing_name(const char *decl, char *type, size_t type_size, char *name,
+    size_t name_size)
+{
+    char            work[300];
+    size_t          len;
+    size_t          start;
+    int             array;
+
+    snprintf(work, sizeof(work), "%s", decl);
+    len = strlen(work);
+    array = 0;
+    if (len > 0 && work[len - 1] == ']')
+    {
+        char            *bracket;
+
+        bracket = strchr(work, '[');
+        if (bracket)
+        {
+            *bracket = '\0';
+            len = bracket - work;
+            array = 1;
+        }
+    }
+    while (len > 0 && isspace((unsigned char)work[len - 1]))
+        --len;
+    work[len] = '\0';
+    start = len;
+    while
+    (
+        start > 0
+    &&
+        (isalnum((unsigned char)work[start - 1]) || work[start - 1] == '_')
+    )
+        --start;
+    snprintf(name, name_size, "%s", work + start);
+    work[start] = '\0';
+    while (start > 0 && isspace((unsigned char)work[start - 1]))
+        work[--start] = '\0';
+    if (array)
+        snprintf(type, type_size, "%s *", work);
+    else if (start > 0 && work[start - 1] == '*')
+        snprintf(type, type_size, "%s", work);
+    else
+        snprintf(type, type_size, "%s ", work);
+}
+
+
+/**
+  * The proto_read function is used to read and dissect the Prototype of
+  * a catalogue entry.
+  *
+  * @returns
+  *     non-zero on success, zero if the prototype is unsuitable
+  */
+static int
+proto_read(proto_t *pp, const char *name)
+{
+    static const char *const variadic_names[] =
+    {
+        "fcntl", "ioctl", "open", "openat", 0
+    };
+    char            catpath[300];
+    char            head[300];
+    char            type[300];
+    char            pname[100];
+    catalogue_t     *cp;
+    const char      *proto;
+    const char      *lparen;
+    const char      *rparen;
+    const char      *p;
+    const char      *reset;
+    int             ok;
+    size_t          len;
+
+    snprintf(catpath, sizeof(catpath), "catalogue/%s", name);
+    cp = catalogue_open(catpath);
+    proto = catalogue_get(cp, "Prototype");
+    reset = catalogue_get(cp, "Reset-Errno");
+    ok = 1;
+    if (!proto || (reset && 0 == strcmp(reset, "true")))
+    {
+        catalogue_close(cp);
+        return 0;
+    }
+    lparen = strchr(proto, '(');
+    rparen = strrchr(proto, ')');
+    if (!lparen || !rparen || rparen < lparen)
+        explain_output_error_and_die("%s: malformed Prototype", name);
+
+    len = lparen - proto;
+    if (len >= sizeof(head))
+        len = sizeof(head) - 1;
+    memcpy(head, proto, len);
+    head[len] = '\0';
+    trailing_name(head, pp->ret, sizeof(pp->ret), pp->name, sizeof(pp->name));
+    len = strlen(pp->ret);
+    while (len > 0 && pp->ret[len - 1] == ' ')
+        pp->ret[--len] = '\0';
+    pp->ret_pointer = !!strchr(pp->ret, '*');
+    if (0 != strcmp(pp->name, name))
+        ok = 0;
+
+    p = lparen + 1;
+    while (ok && p < rparen)
+    {
+        char            param[300];
+        const char      *comma;
+
+        comma = p + strcspn(p, ",)");
+        if (comma > rparen)
+            comma = rparen;
+        while (p < comma && isspace((unsigned char)*p))
+            ++p;
+        len = comma - p;
+        while (len > 0 && isspace((unsigned char)p[len - 1]))
+            --len;
+        if (len >= sizeof(param))
+            len = sizeof(param) - 1;
+        memcpy(param, p, len);
+        param[len] = '\0';
+        p = comma + 1;
+
+        if (0 == strcmp(param, "void") || !param[0])
+            continue;
+        if (0 == strcmp(param, "...") || strstr(param, "va_list"))
+        {
+            ok = 0;
+            break;
+        }
+        trailing_name(param, type, sizeof(type), pname, sizeof(pname));
+        explain_string_list_append(&pp->decl, param);
+        explain_string_list_append(&pp->types, type);
+        explain_string_list_append(&pp->names, pname);
+    }
+    catalogue_close(cp);
+    pp->variadic =
+        (ok && pp->names.length >= 2 && name_is(name, variadic_names));
+    return ok;
+}
+
+
+/**
+  * The suitable function is used to decide whether a catalogue entry
+  * can be wrapped.
+  */
+static int
+suitable(proto_t *pp, const char *name)
+{
+    /*
+     * The allocators are called by the explanations themselves, and
+     * vfork can not return through a wrapper.  The others are
+     * obsolete, and provoke link-time warnings or are missing from
+     * recent libc versions.
+     */
+    static const char *const excluded[] =
+    {
+        "calloc", "malloc", "realloc", "stime", "strdup", "strndup",
+        "tempnam", "tmpnam", "ustat", "vfork", 0
+    };
+    char            test[1000];
+
+    if (name_is(name, excluded))
+        return 0;
+    if (!header_has_message(name))
+        return 0;
+    if (!proto_read(pp, name))
+        return 0;
+    first_test(name, test, sizeof(test));
+    if (pp->ret_pointer)
+        return (0 == strcmp(test, "if (!result)"));
+    return (0 == strcmp(test, "if (result < 0)"));
+}
+
+
+static void
+emit_list(FILE *fp, const char *prefix, const explain_string_list_t *list,
+    const char *empty, const char *suffix)
+{
+    size_t          column;
+    size_t          indent;
+    size_t          j;
+
+    indent = strspn(prefix, " ") + 4;
+    fprintf(fp, "%s(", prefix);
+    column = strlen(prefix) + 1;
+    if (!list->length)
+    {
+        fprintf(fp, "%s", empty);
+        column += strlen(empty);
+    }
+    for (j = 0; j < list->length; ++j)
+    {
+        const char      *s;
+        size_t          more;
+
+        s = list->string[j];
+        more = strlen(s) + (j + 1 < list->length ? 1 : 1 + strlen(suffix));
+        if (j)
+        {
+            if (column + 2 + more > 79)
+            {
+                fprintf(fp, ",\n%*s", (int)indent, "");
+                column = indent;
+            }
+            else
+            {
+                fprintf(fp, ", ");
+                column += 2;
+            }
+        }
+        fprintf(fp, "%s", s);
+        column += strlen(s);
+    }
+    fprintf(fp, ")%s\n", suffix);
+}
+
+
+static void
+emit_variable(FILE *fp, const char *type, const char *name)
+{
+    char            base[100];
+    size_t          len;
+    size_t          stars;
+
+    len = strlen(type);
+    stars = 0;
+    while (len > 0 && (type[len - 1] == '*' || type[len - 1] == ' '))
+    {
+        if (type[len - 1] == '*')
+            ++stars;
+        --len;
+    }
+    if (len >= sizeof(base))
+        len = sizeof(base) - 1;
+    memcpy(base, type, len);
+    base[len] = '\0';
+    fprintf(fp, "    %-15s ", base);
+    while (stars-- > 0)
+        fputc('*', fp);
+    fprintf(fp, "%s;\n", name);
+}
+
+
+/**
+  * The emit_va_start function is used to fetch the last argument of a
+  * variadic function from its "..." and into a variable of the same
+  * name.
+  */
+static void
+emit_va_start(FILE *fp, const proto_t *pp)
+{
+    size_t          n;
+    const char      *type;
+    int             len;
+
+    n = pp->names.length;
+    type = pp->types.string[n - 1];
+    len = strlen(type);
+    while (len > 0 && type[len - 1] == ' ')
+        --len;
+    fprintf(fp, "    va_start(ap, %s);\n", pp->names.string[n - 2]);
+    fprintf
+    (
+        fp,
+        "    %s = va_arg(ap, %.*s);\n",
+        pp->names.string[n - 1],
+        len,
+        type
+    );
+    fprintf(fp, "    va_end(ap);\n");
+}
+
+
+static void
+emit_resolve_decl(FILE *fp, const proto_t *pp,
+    const explain_string_list_t *decl)
+{
+    char            prefix[300];
+
+    snprintf
+    (
+        prefix,
+        sizeof(prefix),
+        "static %s%sresolve_%s",
+        pp->ret,
+        (pp->ret_pointer ? "" : " "),
+        pp->name
+    );
+    emit_list(fp, prefix, decl, "void", ";");
+    snprintf
+    (
+        prefix,
+        sizeof(prefix),
+        "static %s%s(*real_%s)",
+        pp->ret,
+        (pp->ret_pointer ? "" : " "),
+        pp->name
+    );
+    emit_list(fp, prefix, decl, "void", " =");
+    fprintf(fp, "    resolve_%s;\n", pp->name);
+}
+
+
+static void
+emit_resolve(FILE *fp, const proto_t *pp, const explain_string_list_t *decl)
+{
+    char            prefix[300];
+
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "static %s\n", pp->ret);
+    snprintf(prefix, sizeof(prefix), "resolve_%s", pp->name);
+    emit_list(fp, prefix, decl, "void", "");
+    fprintf(fp, "{\n");
+    if (pp->variadic)
+    {
+        size_t          n;
+
+        n = pp->names.length;
+        emit_variable(fp, pp->types.string[n - 1], pp->names.string[n - 1]);
+        emit_variable(fp, "va_list", "ap");
+        fprintf(fp, "\n");
+        emit_va_start(fp, pp);
+    }
+    fprintf
+    (
+        fp,
+        "    *(void **)&real_%s = explain_preload_resolve(\"%s\");\n",
+        pp->name,
+        pp->name
+    );
+    snprintf(prefix, sizeof(prefix), "    return real_%s", pp->name);
+    emit_list(fp, prefix, &pp->names, "", ";");
+    fprintf(fp, "}\n");
+}
+
+
+static const char *
+fildes_argument(const proto_t *pp)
+{
+    static const char *const fildes_names[] =
+    {
+        "fildes", "fd", "dirfd", "oldfd", "old_fildes", 0
+    };
+    size_t          j;
+
+    for (j = 0; j < pp->names.length; ++j)
+    {
+        if
+        (
+            name_is(pp->names.string[j], fildes_names)
+        &&
+            0 == strcmp(pp->types.string[j], "int ")
+        )
+            return pp->names.string[j];
+    }
+    return "-1";
+}
+
+
+static void
+emit_wrapper(FILE *fp, const proto_t *pp, const explain_string_list_t *decl)
+{
+    char            prefix[300];
+    explain_string_list_t args;
+    size_t          j;
+
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    snprintf
+    (
+        prefix,
+        sizeof(prefix),
+        "%s%sexplain_preload_%s",
+        pp->ret,
+        (pp->ret_pointer ? "" : " "),
+        pp->name
+    );
+    emit_list(fp, prefix, decl, "void", "");
+    fprintf(fp, "    EXPLAIN_PRELOAD_SYMBOL(\"%s\");\n", pp->name);
+    fprintf(fp, "\n");
+    fprintf(fp, "%s\n", pp->ret);
+    snprintf(prefix, sizeof(prefix), "explain_preload_%s", pp->name);
+    emit_list(fp, prefix, decl, "void", "");
+    fprintf(fp, "{\n");
+    if (pp->variadic)
+    {
+        size_t          n;
+
+        n = pp->names.length;
+        emit_variable(fp, pp->types.string[n - 1], pp->names.string[n - 1]);
+        emit_variable(fp, "va_list", "ap");
+    }
+    emit_variable(fp, pp->ret, "result");
+    fprintf(fp, "\n");
+    if (pp->variadic)
+        emit_va_start(fp, pp);
+    snprintf(prefix, sizeof(prefix), "    result = real_%s", pp->name);
+    emit_list(fp, prefix, &pp->names, "", ";");
+    fprintf(fp, "    if (%s)\n", pp->ret_pointer ? "!result" : "result < 0");
+    fprintf(fp, "    {\n");
+    fprintf(fp, "        int             hold_errno;\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "        hold_errno = errno;\n");
+    fprintf
+    (
+        fp,
+        "        if (explain_preload_begin(\"%s\", hold_errno, %s))\n",
+        pp->name,
+        fildes_argument(pp)
+    );
+    fprintf(fp, "        {\n");
+    fprintf(fp, "            char            message[3000];\n");
+    fprintf(fp, "\n");
+    explain_string_list_constructor(&args);
+    explain_string_list_append(&args, "message");
+    explain_string_list_append(&args, "sizeof(message)");
+    explain_string_list_append(&args, "hold_errno");
+    for (j = 0; j < pp->names.length; ++j)
+        explain_string_list_append(&args, pp->names.string[j]);
+    snprintf
+    (
+        prefix,
+        sizeof(prefix),
+        "            explain_message_errno_%s",
+        pp->name
+    );
+    emit_list(fp, prefix, &args, "", ";");
+    explain_string_list_destructor(&args);
+    fprintf(fp, "            explain_output_error(\"%%s\", message);\n");
+    fprintf(fp, "            explain_preload_end();\n");
+    fprintf(fp, "        }\n");
+    fprintf(fp, "        errno = hold_errno;\n");
+    fprintf(fp, "    }\n");
+    fprintf(fp, "    return result;\n");
+    fprintf(fp, "}\n");
+}
+
+
+static int
+needs_lfs(const proto_t *pp)
+{
+    size_t          j;
+
+    for (j = 0; j < pp->decl.length; ++j)
+    {
+        const char      *s;
+
+        s = pp->decl.string[j];
+        if (strstr(s, "off_t") || strstr(s, "struct stat"))
+            return 1;
+    }
+    return 0;
+}
+
+
+/**
+  * The emit_lfs_alias function is used to give a wrapper the name of
+  * its large file support variant as well, if it has one.
+  *
+  * @returns
+  *     non-zero if an alias was written
+  */
+static int
+emit_lfs_alias(FILE *fp, const proto_t *pp, const explain_string_list_t *decl,
+    int guarded)
+{
+    static const char *const lfs_names[] =
+    {
+        "creat", "fcntl", "fstat", "fstatfs", "fstatvfs", "ftruncate",
+        "lstat", "mkostemp", "mkstemp", "open", "openat", "pread", "pwrite",
+        "stat", "statfs", "statvfs", "tmpfile", "truncate", 0
+    };
+    char            prefix[300];
+
+    if (!name_is(pp->name, lfs_names))
+        return 0;
+    fprintf(fp, "\n");
+    if (!guarded)
+    {
+        fprintf(fp, "#if EXPLAIN_PRELOAD_LFS\n");
+        fprintf(fp, "\n");
+    }
+    snprintf
+    (
+        prefix,
+        sizeof(prefix),
+        "%s%sexplain_preload_%s64",
+        pp->ret,
+        (pp->ret_pointer ? "" : " "),
+        pp->name
+    );
+    emit_list(fp, prefix, decl, "void", "");
+    fprintf
+    (
+        fp,
+        "    EXPLAIN_PRELOAD_ALIAS(\"%s64\", \"%s\");\n",
+        pp->name,
+        pp->name
+    );
+    if (!guarded)
+    {
+        fprintf(fp, "\n");
+        fprintf(fp, "#endif\n");
+    }
+    return 1;
+}
+
+
+static void
+emit(FILE *fp, const proto_t *pp)
+{
+    explain_string_list_t decl;
+    size_t          j;
+    int             lfs;
+
+    /*
+     * The declarations of variadic functions end with "..." in place
+     * of the last parameter, the same as libc.
+     */
+    explain_string_list_constructor(&decl);
+    for (j = 0; j < pp->decl.length; ++j)
+    {
+        if (pp->variadic && j + 1 == pp->decl.length)
+            explain_string_list_append(&decl, "...");
+        else
+            explain_string_list_append(&decl, pp->decl.string[j]);
+    }
+
+    lfs = needs_lfs(pp);
+    fprintf(fp, "\n");
+    if (lfs)
+        fprintf(fp, "#if EXPLAIN_PRELOAD_LFS\n");
+    fprintf(fp, "\n");
+    emit_resolve_decl(fp, pp, &decl);
+    emit_resolve(fp, pp, &decl);
+    emit_wrapper(fp, pp, &decl);
+    emit_lfs_alias(fp, pp, &decl, lfs);
+    if (lfs)
+    {
+        fprintf(fp, "\n");
+        fprintf(fp, "#endif\n");
+    }
+    explain_string_list_destructor(&decl);
+}
+
+
+static void
+proto_constructor(proto_t *pp)
+{
+    pp->name[0] = '\0';
+    pp->ret[0] = '\0';
+    pp->ret_pointer = 0;
+    pp->variadic = 0;
+    explain_string_list_constructor(&pp->decl);
+    explain_string_list_constructor(&pp->names);
+    explain_string_list_constructor(&pp->types);
+}
+
+
+static void
+proto_destructor(proto_t *pp)
+{
+    explain_string_list_destructor(&pp->decl);
+    explain_string_list_destructor(&pp->names);
+    explain_string_list_destructor(&pp->types);
+}
+
+
+void
+preload_generate(const char *filename)
+{
+    explain_string_list_t names;
+    explain_string_list_t ok;
+    DIR             *dp;
+    FILE            *fp;
+    size_t          j;
+
+    explain_string_list_constructor(&names);
+    dp = explain_opendir_or_die("catalogue");
+    for (;;)
+    {
+        struct dirent   *dep;
+
+        dep = explain_readdir_or_die(dp);
+        if (!dep)
+            break;
+        if (dep->d_name[0] == '.')
+            continue;
+        explain_string_list_append(&names, dep->d_name);
+    }
+    explain_closedir_or_die(dp);
+    explain_string_list_sort(&names);
+
+    explain_string_list_constructor(&ok);
+    for (j = 0; j < names.length; ++j)
+    {
+        proto_t         proto;
+
+        proto_constructor(&proto);
+        if (suitable(&proto, names.string[j]))
+            explain_string_list_append(&ok, names.string[j]);
+        proto_destructor(&proto);
+    }
+
+    fp = explain_fopen_or_die(filename, "w");
+    lgpl_header(fp, " * ");
+    fprintf(fp, "\n");
+    fprintf(fp, "/*\n");
+    fprintf(fp, " * This file is generated from the catalogue/ entries\n");
+    fprintf(fp, " * by \"codegen --preload\".  Do not edit it, "
+        "regenerate it.\n");
+    fprintf(fp, " */\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <libexplain/ac/errno.h>\n");
+    fprintf(fp, "#include <libexplain/ac/stdarg.h>\n");
+    fprintf(fp, "\n");
+    for (j = 0; j < ok.length; ++j)
+        fprintf(fp, "#include <libexplain/%s.h>\n", ok.string[j]);
+    fprintf(fp, "#include <libexplain/output.h>\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#include <libexplain_preload/preload.h>\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#if EXPLAIN_PRELOAD_SUPPORTED\n");
+    for (j = 0; j < ok.length; ++j)
+    {
+        proto_t         proto;
+
+        proto_constructor(&proto);
+        suitable(&proto, ok.string[j]);
+        emit(fp, &proto);
+        proto_destructor(&proto);
+    }
+    fprintf(fp, "\n");
+    fprintf(fp, "#endif\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "/* vim: set ts=8 sw=4 et : */\n");
+    explain_fclose_or_die(fp);
+
+    explain_string_list_destructor(&ok);
+    explain_string_list_destructor(&names);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,39 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CODEGEN_PRELOAD_H
+#define CODEGEN_PRELOAD_H
+
+/**
+  * The preload_generate function may be used to write the wrapper
+  * functions of the LD_PRELOAD library (libexplain_preload).  There is
+  * one wrapper for each catalogue entry that has an
+  * explain_message_errno_<name> function and an
+  * explain_<name>_on_error function that tests for failure with a
+  * plain "result < 0" (or "!result" for pointers).  The rest need
+  * more context than the return value to know they failed.
+  *
+  * @param filename
+  *     The path of the C file to write, usually
+  *     libexplain_preload/wrappers.c
+  */
+void preload_generate(const char *filename);
+
+#endif /* CODEGEN_PRELOAD_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+#
+# usage: sh etc/check-name-hash.sh <codegen> <name_hash.def> <source>
+#                                  <name_hash.c> <name_hash.h>
+#
+# Regenerate the errno name hash, and compare it with the copy that is
+# checked in, so that a change to the errno table can't leave the hash
+# out of date.  Only the copyright notice is expected to differ.
+#
+case $# in
+5)
+    ;;
+*)
+    echo "usage: $0 <codegen> <def> <source> <c> <h>" 1>&2
+    exit 1
+    ;;
+esac
+codegen=$1
+def=$2
+source=$3
+c_file=$4
+h_file=$5
+case "$codegen" in
+/*)
+    ;;
+*)
+    codegen=`pwd`/$codegen
+    ;;
+esac
+
+tmp=${TMPDIR:-/tmp}/check-name-hash-$$
+trap "rm -rf $tmp" 0 1 2 15
+
+mkdir -p $tmp/libexplain/errno_info || exit 1
+cp $def $tmp/libexplain/errno_info/name_hash.def || exit 1
+cp $source $tmp/libexplain/errno_info.c || exit 1
+( cd $tmp && $codegen --perfect-hash libexplain/errno_info/name_hash.def ) ||
+    exit 1
+
+status=0
+for pair in "$c_file name_hash.c" "$h_file name_hash.h"
+do
+    set $pair
+    sed '/Copyright (C)/d' $1 > $tmp/old
+    sed '/Copyright (C)/d' $tmp/libexplain/errno_info/$2 > $tmp/new
+    if diff $tmp/old $tmp/new
+    then
+        :
+    else
+        echo "$1: out of date, regenerate with" 1>&2
+        echo "    codegen --perfect-hash libexplain/errno_info/name_hash.def" \
+            1>&2
+        status=1
+    fi
+done
+exit $status
+# vim: set ts=8 sw=4 et :
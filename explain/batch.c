@@ -0,0 +1,636 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/limits.h>
+#include <libexplain/ac/signal.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/wait.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/dup2.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fdopen.h>
+#include <libexplain/fflush.h>
+#include <libexplain/fopen.h>
+#include <libexplain/fork.h>
+#include <libexplain/malloc.h>
+#include <libexplain/pipe.h>
+#include <libexplain/realloc.h>
+#include <libexplain/waitpid.h>
+
+#include <explain/batch.h>
+#include <explain/strace.h>
+#include <explain/syscall.h>
+
+
+/*
+ * The most record text handed to a worker at once.  POSIX promises
+ * that a pipe can hold at least PIPE_BUF bytes.
+ */
+#ifdef PIPE_BUF
+#define BATCH_PIPE_SIZE PIPE_BUF
+#else
+#define BATCH_PIPE_SIZE 512
+#endif
+
+typedef struct worker_t worker_t;
+struct worker_t
+{
+    int             pid;
+    FILE            *to;
+    FILE            *from;
+};
+
+static FILE     *input;
+static int      strace_mode;
+static long     not_understood;
+static long     not_supported;
+static long     not_explained;
+static worker_t *worker;
+static int      nworkers;
+static int      (*get_errno)(const char *text);
+
+
+void
+batch_buffer_putc(batch_buffer_t *bp, int c)
+{
+    if (bp->length >= bp->maximum)
+    {
+        bp->maximum = bp->maximum * 2 + 200;
+        bp->text = explain_realloc_or_die(bp->text, bp->maximum);
+    }
+    bp->text[bp->length++] = c;
+}
+
+
+void
+batch_buffer_write(batch_buffer_t *bp, const char *text, size_t text_size)
+{
+    while (text_size > 0)
+    {
+        batch_buffer_putc(bp, *text++);
+        --text_size;
+    }
+}
+
+
+/**
+  * The read_line function is used to read the next line (or record)
+  * from the input, without its delimiter.
+  *
+  * @returns
+  *     1 if a line was read, 0 at end of input
+  */
+
+static int
+read_line(FILE *fp, int delimiter, long *lineno, batch_buffer_t *bp)
+{
+    int             c;
+
+    bp->length = 0;
+    ++*lineno;
+    bp->lineno = *lineno;
+    for (;;)
+    {
+        c = getc(fp);
+        if (c == EOF || c == delimiter)
+            break;
+        batch_buffer_putc(bp, c);
+    }
+    if (c == EOF && bp->length == 0)
+        return 0;
+    batch_buffer_putc(bp, '\0');
+    return 1;
+}
+
+
+/**
+  * The read_record function is used to read the next record from the
+  * input, skipping empty records and comments.  For strace input, the
+  * failed system calls are turned into records, and everything else is
+  * skipped (and counted, if it wasn't understood).
+  *
+  * @returns
+  *     1 if a record was read, 0 at end of input
+  */
+
+static int
+read_record(FILE *fp, int delimiter, long *lineno, batch_buffer_t *bp)
+{
+    static batch_buffer_t line;
+
+    for (;;)
+    {
+        size_t          j;
+
+        if (!strace_mode)
+        {
+            if (!read_line(fp, delimiter, lineno, bp))
+                return 0;
+
+            /* skip leading white space, and ignore empty records */
+            j = 0;
+            while (bp->text[j] && strchr(" \t\r\n", bp->text[j]))
+                ++j;
+            if (bp->text[j] && bp->text[j] != '#')
+                return 1;
+            continue;
+        }
+
+        if (!read_line(fp, delimiter, lineno, &line))
+            return 0;
+        bp->length = 0;
+        bp->lineno = line.lineno;
+        switch (strace_record(line.text, bp))
+        {
+        case strace_result_record:
+            batch_buffer_putc(bp, '\0');
+            return 1;
+
+        case strace_result_unparseable:
+            ++not_understood;
+            break;
+
+        case strace_result_unsupported:
+            ++not_supported;
+            break;
+
+        case strace_result_ignore:
+        default:
+            break;
+        }
+    }
+}
+
+
+/**
+  * The split function is used to break a record into white space
+  * separated fields, in place, honouring quotes and backslash.
+  *
+  * @returns
+  *     the number of fields
+  */
+
+static int
+split(char *text, char ***argv_p, int *argv_max_p)
+{
+    char            *ip;
+    char            *op;
+    int             argc;
+
+    argc = 0;
+    ip = text;
+    for (;;)
+    {
+        int             quote;
+
+        while (*ip && strchr(" \t\r\n", *ip))
+            ++ip;
+        if (!*ip)
+            break;
+        if (argc + 1 >= *argv_max_p)
+        {
+            *argv_max_p = *argv_max_p * 2 + 8;
+            *argv_p =
+                explain_realloc_or_die
+                (
+                    *argv_p,
+                    *argv_max_p * sizeof((*argv_p)[0])
+                );
+        }
+        (*argv_p)[argc++] = ip;
+        op = ip;
+        quote = 0;
+        for (;;)
+        {
+            int             c;
+
+            c = *ip;
+            if (!c)
+                break;
+            ++ip;
+            if (quote)
+            {
+                if (c == quote)
+                {
+                    quote = 0;
+                    continue;
+                }
+                if (c == '\\' && quote == '"' && *ip)
+                    c = *ip++;
+            }
+            else if (strchr(" \t\r\n", c))
+                break;
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+                continue;
+            }
+            else if (c == '\\' && *ip)
+                c = *ip++;
+            *op++ = c;
+        }
+        *op = '\0';
+    }
+    (*argv_p)[argc] = 0;
+    return argc;
+}
+
+
+int
+batch_read_string(FILE *fp, batch_buffer_t *bp)
+{
+    int             c;
+
+    bp->length = 0;
+    for (;;)
+    {
+        c = getc(fp);
+        if (c == EOF)
+            return 0;
+        if (c == '\0')
+            break;
+        batch_buffer_putc(bp, c);
+    }
+    batch_buffer_putc(bp, '\0');
+    return 1;
+}
+
+
+void
+batch_explain(char *record, int (*figure_out_error)(const char *text))
+{
+    static char     **argv;
+    static int      argv_max;
+    int             argc;
+    int             err;
+    func_t          func;
+
+    argc = split(record, &argv, &argv_max);
+    if (argc < 2)
+    {
+        fprintf(stderr, "please specify an error number and a function\n");
+        exit(EXIT_FAILURE);
+    }
+    err = figure_out_error(argv[0]);
+    func = find_function(argv[1]);
+    func(err, argc - 2, argv + 2);
+}
+
+
+/**
+  * The worker_main function is the body of each worker process.
+  * It reads NUL terminated records from its input, explains each one
+  * on the standard output, and follows each explanation with a NUL
+  * so that the parent knows where it ends.
+  *
+  * Anything wrong with a record results in the usual diagnostic and
+  * exit, exactly as if the record had been given on the command line.
+  * The parent notices, and starts a fresh worker.
+  */
+
+static void
+worker_main(FILE *fp)
+{
+    batch_buffer_t  record;
+
+    memset(&record, 0, sizeof(record));
+    while (batch_read_string(fp, &record))
+    {
+        batch_explain(record.text, get_errno);
+        putchar('\0');
+        explain_fflush_or_die(stdout);
+    }
+    exit(EXIT_SUCCESS);
+}
+
+
+static void
+worker_start(int n)
+{
+    int             to_child[2];
+    int             from_child[2];
+    int             pid;
+
+    /* don't let the child inherit (and repeat) our pending output */
+    explain_fflush_or_die(stdout);
+
+    explain_pipe_or_die(to_child);
+    explain_pipe_or_die(from_child);
+    pid = explain_fork_or_die();
+    if (pid == 0)
+    {
+        int             j;
+        FILE            *fp;
+
+        /*
+         * Close the other workers' pipes, otherwise they would not
+         * see end-of-file on their input when the parent is done.
+         */
+        for (j = 0; j < nworkers; ++j)
+        {
+            if (j == n || !worker[j].to)
+                continue;
+            close(fileno(worker[j].to));
+            close(fileno(worker[j].from));
+        }
+
+        /*
+         * The records arrive on the standard input, and the
+         * explanations leave on the standard output, so that the
+         * worker has no other file descriptors open.  This matters,
+         * because explanations of EBADF look at which file descriptors
+         * are open.  The parent's input is not inherited, and the
+         * stdin stream is not used, because it may have some of the
+         * parent's input buffered.
+         */
+        if (input != stdin)
+            close(fileno(input));
+        close(to_child[1]);
+        close(from_child[0]);
+        explain_dup2_or_die(to_child[0], 0);
+        explain_dup2_or_die(from_child[1], 1);
+        if (to_child[0] != 0)
+            close(to_child[0]);
+        if (from_child[1] != 1)
+            close(from_child[1]);
+        fp = explain_fdopen_or_die(0, "r");
+
+        /*
+         * With strace input, failures are only counted, the workers'
+         * complaints about individual calls would just be noise.
+         */
+        if (strace_mode)
+        {
+            int             fd;
+
+            fd = open("/dev/null", O_WRONLY);
+            if (fd >= 0 && fd != 2)
+            {
+                explain_dup2_or_die(fd, 2);
+                close(fd);
+            }
+        }
+        worker_main(fp);
+        /* NOTREACHED */
+    }
+    close(to_child[0]);
+    close(from_child[1]);
+    worker[n].pid = pid;
+    worker[n].to = explain_fdopen_or_die(to_child[1], "w");
+    worker[n].from = explain_fdopen_or_die(from_child[0], "r");
+}
+
+
+static void
+worker_stop(int n)
+{
+    int             status;
+
+    fclose(worker[n].to);
+    fclose(worker[n].from);
+    explain_waitpid_or_die(worker[n].pid, &status, 0);
+    worker[n].pid = 0;
+    worker[n].to = 0;
+    worker[n].from = 0;
+}
+
+
+static void
+send(int n, const batch_buffer_t *bp)
+{
+    fwrite(bp->text, 1, bp->length, worker[n].to);
+}
+
+
+/**
+  * The receive function is used to read the explanation of one record
+  * from a worker, and copy it to the standard output.
+  *
+  * @returns
+  *     0 on success, -1 if the worker died instead
+  */
+
+static int
+receive(int n, batch_buffer_t *result)
+{
+    int             c;
+
+    result->length = 0;
+    for (;;)
+    {
+        c = getc(worker[n].from);
+        if (c == EOF)
+            return -1;
+        if (c == '\0')
+            break;
+        batch_buffer_putc(result, c);
+    }
+    fwrite(result->text, 1, result->length, stdout);
+    return 0;
+}
+
+
+int
+batch(const char *filename, int jobs, int delimiter, int strace_format,
+    int (*figure_out_error)(const char *text))
+{
+    FILE            *fp;
+    const char      *name;
+    batch_buffer_t  *record;
+    size_t          record_max;
+    size_t          *first;
+    batch_buffer_t  next;
+    int             have_next;
+    batch_buffer_t  result;
+    long            lineno;
+    int             exit_status;
+    int             j;
+
+    get_errno = figure_out_error;
+    strace_mode = strace_format;
+    if (jobs < 1)
+        jobs = 1;
+    if (!filename || 0 == strcmp(filename, "-"))
+    {
+        fp = stdin;
+        name = "standard input";
+    }
+    else
+    {
+        fp = explain_fopen_or_die(filename, "r");
+        name = filename;
+    }
+    input = fp;
+
+    /*
+     * A worker that dies while we are writing to it is dealt with
+     * when its explanation fails to arrive.
+     */
+#ifdef SIGPIPE
+    signal(SIGPIPE, SIG_IGN);
+#endif
+
+    nworkers = jobs;
+    worker = explain_malloc_or_die(jobs * sizeof(worker[0]));
+    memset(worker, 0, jobs * sizeof(worker[0]));
+    first = explain_malloc_or_die((jobs + 1) * sizeof(first[0]));
+    record_max = 0;
+    record = 0;
+    memset(&next, 0, sizeof(next));
+    memset(&result, 0, sizeof(result));
+    for (j = 0; j < jobs; ++j)
+        worker_start(j);
+
+    /*
+     * Each round, every worker is handed a run of consecutive records,
+     * no more than will fit in a pipe without blocking (except that a
+     * single long record is always sent).  The results are then
+     * collected from each worker in turn, so that the output is in
+     * input order.  Because the records sent never exceed the pipe's
+     * capacity, the workers can never be blocked writing results while
+     * we are blocked writing records.
+     */
+    exit_status = EXIT_SUCCESS;
+    lineno = 0;
+    have_next = read_record(fp, delimiter, &lineno, &next);
+    while (have_next)
+    {
+        size_t          nrecords;
+        int             n;
+
+        nrecords = 0;
+        for (n = 0; n < jobs && have_next; ++n)
+        {
+            size_t          nbytes;
+
+            first[n] = nrecords;
+            nbytes = 0;
+            while
+            (
+                have_next
+            &&
+                (nbytes == 0 || nbytes + next.length <= BATCH_PIPE_SIZE)
+            )
+            {
+                batch_buffer_t  tmp;
+
+                if (nrecords >= record_max)
+                {
+                    size_t          k;
+
+                    k = record_max;
+                    record_max = record_max * 2 + 16;
+                    record =
+                        explain_realloc_or_die
+                        (
+                            record,
+                            record_max * sizeof(record[0])
+                        );
+                    while (k < record_max)
+                        memset(&record[k++], 0, sizeof(record[0]));
+                }
+
+                /* swap, so that the buffers are recycled */
+                tmp = record[nrecords];
+                record[nrecords] = next;
+                next = tmp;
+
+                send(n, &record[nrecords]);
+                nbytes += record[nrecords].length;
+                ++nrecords;
+                have_next = read_record(fp, delimiter, &lineno, &next);
+            }
+            fflush(worker[n].to);
+        }
+        first[n] = nrecords;
+
+        for (j = 0; j < n; ++j)
+        {
+            size_t          r;
+
+            for (r = first[j]; r < first[j + 1]; ++r)
+            {
+                size_t          k;
+
+                if (receive(j, &result) == 0)
+                    continue;
+                if (strace_mode)
+                    ++not_explained;
+                else
+                {
+                    fprintf
+                    (
+                        stderr,
+                        "%s: %ld: unable to explain this record\n",
+                        name,
+                        record[r].lineno
+                    );
+                    exit_status = EXIT_FAILURE;
+                }
+
+                /*
+                 * Start a fresh worker, and give it the rest of the
+                 * records its predecessor did not get to.
+                 */
+                worker_stop(j);
+                worker_start(j);
+                for (k = r + 1; k < first[j + 1]; ++k)
+                    send(j, &record[k]);
+                fflush(worker[j].to);
+            }
+        }
+    }
+
+    for (j = 0; j < jobs; ++j)
+        worker_stop(j);
+    if (fp != stdin)
+        explain_fclose_or_die(fp);
+    explain_fflush_or_die(stdout);
+
+    if (not_understood)
+        fprintf(stderr, "%s: %ld lines not understood\n", name, not_understood);
+    if (not_supported)
+    {
+        fprintf
+        (
+            stderr,
+            "%s: %ld failed calls to unsupported functions\n",
+            name,
+            not_supported
+        );
+    }
+    if (not_explained)
+    {
+        fprintf
+        (
+            stderr,
+            "%s: %ld failed calls could not be explained\n",
+            name,
+            not_explained
+        );
+    }
+    return exit_status;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
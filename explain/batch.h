@@ -0,0 +1,129 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EXPLAIN_BATCH_H
+#define EXPLAIN_BATCH_H
+
+#include <libexplain/ac/stddef.h>
+#include <libexplain/ac/stdio.h>
+
+/**
+  * The batch_buffer_t type is used to represent a growable buffer of
+  * text, used to hold records and results.
+  */
+typedef struct batch_buffer_t batch_buffer_t;
+struct batch_buffer_t
+{
+    char            *text;
+    size_t          length;
+    size_t          maximum;
+    long            lineno;
+};
+
+/**
+  * The batch_buffer_putc function is used to append a character to a
+  * buffer, growing it as necessary.
+  *
+  * @param bp
+  *     The buffer to append to.
+  * @param c
+  *     The character to append.
+  */
+void batch_buffer_putc(batch_buffer_t *bp, int c);
+
+/**
+  * The batch_buffer_write function is used to append text to a buffer,
+  * growing it as necessary.
+  *
+  * @param bp
+  *     The buffer to append to.
+  * @param text
+  *     The text to append.
+  * @param text_size
+  *     The number of bytes of text to append.
+  */
+void batch_buffer_write(batch_buffer_t *bp, const char *text,
+    size_t text_size);
+
+/**
+  * The batch_read_string function is used to read a NUL terminated
+  * string into a buffer.  The buffer is also NUL terminated.
+  *
+  * @param fp
+  *     The stream to read from.
+  * @param bp
+  *     The buffer to read into.
+  * @returns
+  *     1 if a string was read, 0 at end of input
+  */
+int batch_read_string(FILE *fp, batch_buffer_t *bp);
+
+/**
+  * The batch_explain function is used to explain a single record
+  * ("errno function args...") on the standard output.  Anything wrong
+  * with the record results in a diagnostic and exit, exactly as if it
+  * had been given on the command line.
+  *
+  * @param record
+  *     The text of the record.  It is modified in place.
+  * @param figure_out_error
+  *     The function used to turn the first field into an errno value.
+  */
+void batch_explain(char *record, int (*figure_out_error)(const char *text));
+
+/**
+  * The batch function is used to explain many errors, one per record
+  * of the input, without paying for process start-up each time.
+  *
+  * Each record is an error (in any of the forms accepted by the -e
+  * option) followed by a function name and its arguments, separated by
+  * white space.  Single quotes, double quotes and backslash may be used
+  * to insulate white space within an argument.  Empty records and
+  * records starting with a hash (#) are ignored.
+  *
+  * The explanations are written to the standard output, in the same
+  * order as the records were read.  A record that cannot be explained
+  * is reported on the standard error, and the remaining records are
+  * still explained.
+  *
+  * @param filename
+  *     The name of the file to read, or NULL (or "-") for the standard
+  *     input.
+  * @param jobs
+  *     The number of worker processes to explain records in parallel.
+  * @param delimiter
+  *     The character that ends each record, usually newline, or NUL
+  *     for use with find -print0 and similar.
+  * @param strace_format
+  *     If true, the input is the output of strace(1), rather than
+  *     records.  Each failed system call is explained; lines that
+  *     cannot be understood, and calls that cannot be explained, are
+  *     counted and skipped, and the counts are printed at the end.
+  * @param figure_out_error
+  *     The function used to turn the first field of each record into
+  *     an errno value.
+  * @returns
+  *     EXIT_SUCCESS if all records were explained, EXIT_FAILURE if
+  *     any were not.  Always EXIT_SUCCESS for strace input.
+  */
+int batch(const char *filename, int jobs, int delimiter, int strace_format,
+    int (*figure_out_error)(const char *text));
+
+#endif /* EXPLAIN_BATCH_H */
+/* vim: set ts=8 sw=4 et : */
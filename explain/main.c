@@ -29,8 +29,11 @@
 #include <libexplain/iocontrol.h>
 #include <libexplain/string_buffer.h>
 #include <libexplain/version_print.h>
+#include <libexplain/strtol.h>
 #include <libexplain/wrap_and_print.h>
 
+#include <explain/batch.h>
+#include <explain/serve.h>
 #include <explain/syscall.h>
 
 
@@ -39,6 +42,9 @@ usage(void)
 {
     fprintf(stderr, "Usage: explain -e <errno> <function> [ <args> ... ]\n");
     fprintf(stderr, "       explain -m <message> <function> [ <args> ... ]\n");
+    fprintf(stderr, "       explain --batch [ -j <jobs> ][ -z ] [ <file> ]\n");
+    fprintf(stderr, "       explain --strace [ -j <jobs> ] [ <file> ]\n");
+    fprintf(stderr, "       explain --serve <socket> [ -j <jobs> ]\n");
     fprintf(stderr, "       explain -V\n");
     exit(EXIT_FAILURE);
 }
@@ -48,13 +54,18 @@ usage(void)
 
 static const struct option options[] =
 {
+    { "batch", 0, 0, 'b' },
     { "errno", 1, 0, 'e' },
     { "explain-exit-status", 0, 0, 'E' },
+    { "jobs", 1, 0, 'j' },
     { "message", 1, 0, 'm' },
     { "print-errno-info", 0, 0, 'P' },
+    { "serve", 1, 0, 'D' },
     { "statistics", 0, 0, 's' },
+    { "strace", 0, 0, 'S' },
     { "version", 0, 0, 'V' },
     { "check-ioctl-conflicts", 0, 0, 'Z' },
+    { "null", 0, 0, 'z' },
     { 0, 0, 0, 0 }
 };
 
@@ -171,20 +182,38 @@ main(int argc, char **argv)
 {
     func_t          func;
     int             err;
+    int             batch_mode;
+    int             strace_format;
+    int             jobs;
+    int             delimiter;
+    const char      *socket_path;
 
     exit_status = EXIT_SUCCESS;
     err = -1;
+    batch_mode = 0;
+    strace_format = 0;
+    jobs = 1;
+    delimiter = '\n';
+    socket_path = 0;
     for (;;)
     {
 #ifdef HAVE_GETOPT_LONG
-        int c = getopt_long(argc, argv, "Ee:o:PpsVZ", options, 0);
+        int c = getopt_long(argc, argv, "bD:Ee:j:o:PpSsVZz", options, 0);
 #else
-        int c = getopt(argc, argv, "Ee:o:PpsVZ");
+        int c = getopt(argc, argv, "bD:Ee:j:o:PpSsVZz");
 #endif
         if (c == EOF)
             break;
         switch (c)
         {
+        case 'b':
+            batch_mode = 1;
+            break;
+
+        case 'D':
+            socket_path = optarg;
+            break;
+
         case 'E':
             explain_exit_on_exit();
             break;
@@ -193,6 +222,10 @@ main(int argc, char **argv)
             err = figure_out_error(optarg);
             break;
 
+        case 'j':
+            jobs = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
         case 'o':
             explain_freopen_or_die(optarg, "w", stdout);
             break;
@@ -205,6 +238,11 @@ main(int argc, char **argv)
             explain_errno_info_print(1);
             return 0;
 
+        case 'S':
+            batch_mode = 1;
+            strace_format = 1;
+            break;
+
         case 's':
             print_statistics();
             return 0;
@@ -217,11 +255,35 @@ main(int argc, char **argv)
             explain_iocontrol_check_conflicts();
             return 0;
 
+        case 'z':
+            delimiter = '\0';
+            break;
+
         default:
             usage();
             /* NOTREACHED */
         }
     }
+    if (socket_path)
+    {
+        if (optind != argc)
+            usage();
+        return serve(socket_path, jobs, figure_out_error);
+    }
+    if (batch_mode)
+    {
+        if (optind + 1 < argc)
+            usage();
+        return
+            batch
+            (
+                argv[optind],
+                jobs,
+                delimiter,
+                strace_format,
+                figure_out_error
+            );
+    }
     if (err < 0)
     {
         fprintf(stderr, "please specify an error number (-e)\n");
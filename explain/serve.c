@@ -0,0 +1,403 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/poll.h>
+#include <libexplain/ac/signal.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/socket.h>
+#include <libexplain/ac/sys/stat.h>
+#include <libexplain/ac/sys/un.h>
+#include <libexplain/ac/sys/wait.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/bind.h>
+#include <libexplain/chdir.h>
+#include <libexplain/chmod.h>
+#include <libexplain/dup2.h>
+#include <libexplain/fork.h>
+#include <libexplain/listen.h>
+#include <libexplain/malloc.h>
+#include <libexplain/open.h>
+#include <libexplain/socket.h>
+
+#include <explain/batch.h>
+#include <explain/serve.h>
+
+
+static volatile sig_atomic_t stopping;
+static int      (*get_errno)(const char *text);
+static sigset_t original_mask;
+
+
+static void
+stop(int sig)
+{
+    (void)sig;
+    stopping = 1;
+}
+
+
+static void
+child(int sig)
+{
+    /* only here to interrupt sigsuspend */
+    (void)sig;
+}
+
+
+/**
+  * The peer_is_us function is used to check that the process at the
+  * other end of a connection runs as the same user and group as the
+  * daemon.  The daemon probes the file system with its own identity,
+  * so anyone else would be given explanations of files they may not be
+  * able to see, computed for the wrong identity.
+  *
+  * Where the system cannot tell us who the peer is, the permissions of
+  * the socket (0600, see below) are all the protection there is.
+  *
+  * @param fd
+  *     The connection of interest.
+  * @returns
+  *     true (non-zero) if the peer may be served, false (zero) if not
+  */
+static int
+peer_is_us(int fd)
+{
+#ifdef SO_PEERCRED
+    struct ucred    cred;
+    socklen_t       len;
+
+    len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0)
+        return 0;
+    if (cred.uid == geteuid() && cred.gid == getegid())
+        return 1;
+    fprintf
+    (
+        stderr,
+        "refused a connection from uid %ld gid %ld\n",
+        (long)cred.uid,
+        (long)cred.gid
+    );
+    return 0;
+#else
+#ifdef HAVE_GETPEEREID
+    uid_t           uid;
+    gid_t           gid;
+
+    if (getpeereid(fd, &uid, &gid) < 0)
+        return 0;
+    if (uid == geteuid() && gid == getegid())
+        return 1;
+    fprintf
+    (
+        stderr,
+        "refused a connection from uid %ld gid %ld\n",
+        (long)uid,
+        (long)gid
+    );
+    return 0;
+#else
+    (void)fd;
+    return 1;
+#endif
+#endif
+}
+
+
+/**
+  * The wait_for_request function is used to wait for the next request
+  * on a connection.  A client keeps its connection open between
+  * requests, so an idle connection is given up if another client is
+  * waiting to be served; otherwise one long-lived client could keep a
+  * worker to itself.  The client reconnects when it next needs us.
+  *
+  * There is only ever one request outstanding on a connection, and it
+  * has been answered, so there is nothing left in the stdio buffer.
+  *
+  * @param fd
+  *     The connection of interest.
+  * @param listener
+  *     The socket that other clients connect to.
+  * @returns
+  *     true (non-zero) if there is a request (or end of file) to be
+  *     read, false (zero) if the connection is to be given up
+  */
+static int
+wait_for_request(int fd, int listener)
+{
+    for (;;)
+    {
+        struct pollfd   pfd[2];
+        int             ready;
+
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+        pfd[0].revents = 0;
+        pfd[1].fd = listener;
+        pfd[1].events = POLLIN;
+        pfd[1].revents = 0;
+        ready = poll(pfd, 2, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return 1;
+        }
+        if (pfd[0].revents)
+            return 1;
+        if (pfd[1].revents)
+            return 0;
+    }
+}
+
+
+static void
+serve_connection(int fd, int listener)
+{
+    FILE            *fp;
+    batch_buffer_t  cwd;
+    batch_buffer_t  record;
+
+    if (!peer_is_us(fd))
+    {
+        close(fd);
+        return;
+    }
+    fp = fdopen(fd, "r");
+    if (!fp)
+    {
+        close(fd);
+        return;
+    }
+    memset(&cwd, 0, sizeof(cwd));
+    memset(&record, 0, sizeof(record));
+    explain_dup2_or_die(fd, 1);
+    for (;;)
+    {
+        if (!wait_for_request(fd, listener))
+            break;
+        if (!batch_read_string(fp, &cwd))
+            break;
+        if (!batch_read_string(fp, &record))
+            break;
+
+        /*
+         * Relative paths are relative to the client, not to us.
+         */
+        if (!cwd.text[0] || chdir(cwd.text) < 0)
+            explain_chdir_or_die("/");
+
+        batch_explain(record.text, get_errno);
+        putchar('\0');
+        if (fflush(stdout))
+            break;
+    }
+    fclose(fp);
+    free(cwd.text);
+    free(record.text);
+
+    /* don't hold the client's end open */
+    fd = open("/dev/null", O_WRONLY);
+    if (fd >= 0 && fd != 1)
+    {
+        dup2(fd, 1);
+        close(fd);
+    }
+    clearerr(stdout);
+}
+
+
+static void
+worker_main(int listener)
+{
+    signal(SIGTERM, SIG_DFL);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGCHLD, SIG_DFL);
+#ifdef SIGPIPE
+    signal(SIGPIPE, SIG_IGN);
+#endif
+    sigprocmask(SIG_SETMASK, &original_mask, 0);
+    for (;;)
+    {
+        int             fd;
+
+        fd = accept(listener, 0, 0);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            exit(EXIT_FAILURE);
+        }
+        serve_connection(fd, listener);
+    }
+}
+
+
+static int
+worker_start(int listener)
+{
+    int             pid;
+
+    fflush(stdout);
+    pid = explain_fork_or_die();
+    if (pid == 0)
+    {
+        worker_main(listener);
+        /* NOTREACHED */
+    }
+    return pid;
+}
+
+
+int
+serve(const char *socket_path, int jobs,
+    int (*figure_out_error)(const char *text))
+{
+    int             listener;
+    struct sockaddr_un addr;
+    struct stat     st;
+    int             *worker;
+    int             j;
+    struct sigaction sa;
+    sigset_t        mask;
+    mode_t          old_umask;
+    const char      *warm_up;
+
+    get_errno = figure_out_error;
+    if (jobs < 1)
+        jobs = 1;
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "socket path \"%s\" too long\n", socket_path);
+        exit(EXIT_FAILURE);
+    }
+
+    /*
+     * Remove a socket left behind by a previous daemon, but nothing
+     * else; it could be a typo.
+     */
+    if (lstat(socket_path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(socket_path);
+
+    listener = explain_socket_or_die(AF_UNIX, SOCK_STREAM, 0);
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    explain_strendcpy
+    (
+        addr.sun_path,
+        socket_path,
+        addr.sun_path + sizeof(addr.sun_path)
+    );
+
+    /*
+     * Only our own user may connect; see peer_is_us, above.  Clients
+     * wait for the socket to appear, so it listens straight away.
+     */
+    old_umask = umask(077);
+    explain_bind_or_die(listener, (struct sockaddr *)&addr, sizeof(addr));
+    umask(old_umask);
+    explain_listen_or_die(listener, SOMAXCONN);
+    explain_chmod_or_die(socket_path, 0600);
+
+    /*
+     * Warm up the library (message catalogues, locale, mount table,
+     * and so on) once, before forking, so that the workers all start
+     * with it done.
+     */
+    warm_up = explain_errno_open(ENOENT, "/nonexistent/explain", O_RDONLY, 0);
+    (void)warm_up;
+
+    /*
+     * The signals are blocked, except while in sigsuspend, so that
+     * one that arrives between looking at "stopping" and waiting can't
+     * be lost.  The workers unblock them again.
+     */
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGTERM);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &mask, &original_mask);
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = stop;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = 0;
+    sigaction(SIGTERM, &sa, 0);
+    sigaction(SIGINT, &sa, 0);
+    sa.sa_handler = child;
+    sigaction(SIGCHLD, &sa, 0);
+
+    worker = explain_malloc_or_die(jobs * sizeof(worker[0]));
+    for (j = 0; j < jobs; ++j)
+        worker[j] = worker_start(listener);
+
+    /*
+     * A worker exits when it is given a request it can't explain.
+     * Replace it.
+     */
+    while (!stopping)
+    {
+        int             pid;
+        int             status;
+
+        pid = waitpid(-1, &status, WNOHANG);
+        if (pid == 0)
+        {
+            sigsuspend(&original_mask);
+            continue;
+        }
+        if (pid < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        for (j = 0; j < jobs; ++j)
+        {
+            if (worker[j] == pid)
+            {
+                worker[j] = stopping ? -1 : worker_start(listener);
+                break;
+            }
+        }
+    }
+
+    for (j = 0; j < jobs; ++j)
+        if (worker[j] > 0)
+            kill(worker[j], SIGTERM);
+    for (j = 0; j < jobs; ++j)
+    {
+        int             status;
+
+        if (worker[j] > 0)
+            waitpid(worker[j], &status, 0);
+    }
+    close(listener);
+    unlink(socket_path);
+    free(worker);
+    sigprocmask(SIG_SETMASK, &original_mask, 0);
+    return EXIT_SUCCESS;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
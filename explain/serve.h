@@ -0,0 +1,53 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EXPLAIN_SERVE_H
+#define EXPLAIN_SERVE_H
+
+/**
+  * The serve function is used to run the explain command as a daemon,
+  * answering requests on a Unix domain socket, until it is sent
+  * SIGTERM or SIGINT.
+  *
+  * Each request is the client's current directory, then a batch record
+  * ("errno function args..."), each terminated by a NUL.  The reply is
+  * the explanation, terminated by a NUL.  A connection may carry any
+  * number of requests.  If the request cannot be explained, the
+  * connection is closed without a reply.
+  *
+  * The library is not thread safe, so requests are served by a pool of
+  * worker processes, forked after the library has been warmed up, and
+  * kept for as long as they are well, so that their caches stay warm.
+  *
+  * @param socket_path
+  *     The path of the socket to listen on.
+  * @param jobs
+  *     The number of worker processes, and thus the number of clients
+  *     that may be served at once.
+  * @param figure_out_error
+  *     The function used to turn the first field of each record into
+  *     an errno value.
+  * @returns
+  *     EXIT_SUCCESS when terminated by a signal
+  */
+int serve(const char *socket_path, int jobs,
+    int (*figure_out_error)(const char *text));
+
+#endif /* EXPLAIN_SERVE_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,529 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+
+#include <libexplain/sizeof.h>
+
+#include <explain/strace.h>
+#include <explain/syscall.h>
+
+
+typedef struct alias_t alias_t;
+struct alias_t
+{
+    const char      *strace_name;
+    const char      *name;
+};
+
+/*
+ * System calls which strace names after the kernel entry point, where
+ * the arguments are the same as the libc function.
+ */
+static const alias_t alias[] =
+{
+    { "fcntl64", "fcntl" },
+    { "fstat64", "fstat" },
+    { "ftruncate64", "ftruncate" },
+    { "lstat64", "lstat" },
+    { "newfstatat", "fstatat" },
+    { "pread64", "pread" },
+    { "pwrite64", "pwrite" },
+    { "stat64", "stat" },
+    { "truncate64", "truncate" },
+};
+
+/*
+ * The calls which have been interrupted by a call in another process,
+ * waiting for the rest of their line.  If there are too many, the
+ * oldest are forgotten, so that memory use does not grow.
+ */
+#define NPENDING 64
+
+typedef struct pending_t pending_t;
+struct pending_t
+{
+    long            pid;
+    char            *text;
+
+    /* when the call was remembered, larger is newer */
+    unsigned long   age;
+};
+
+static pending_t pending[NPENDING];
+static unsigned long pending_age;
+static batch_buffer_t joined;
+static batch_buffer_t arg;
+static batch_buffer_t args;
+
+
+/**
+  * The find_pending function is used to find the interrupted call of
+  * the given process.
+  *
+  * @param pid
+  *     The process of interest.
+  * @param create
+  *     If true, and there is none, return an empty entry, or failing
+  *     that the oldest one.
+  * @returns
+  *     pointer to the entry, or NULL if there is none
+  */
+
+static pending_t *
+find_pending(long pid, int create)
+{
+    pending_t       *oldest;
+    size_t          j;
+
+    oldest = 0;
+    for (j = 0; j < NPENDING; ++j)
+    {
+        pending_t       *pp;
+
+        pp = &pending[j];
+        if (pp->text && pp->pid == pid)
+            return pp;
+        if (!oldest || !pp->text || (oldest->text && pp->age < oldest->age))
+            oldest = pp;
+    }
+    return (create ? oldest : 0);
+}
+
+
+static int
+starts_with(const char *text, const char *prefix)
+{
+    return (0 == strncmp(text, prefix, strlen(prefix)));
+}
+
+
+/**
+  * The skip_prefix function is used to skip the process id and time
+  * stamps at the start of a line.
+  *
+  * @returns
+  *     the process id, or zero if there was none
+  */
+
+static long
+skip_prefix(const char **cpp)
+{
+    const char      *cp;
+    char            *end;
+    long            pid;
+    int             j;
+
+    cp = *cpp;
+    pid = 0;
+    while (*cp == ' ')
+        ++cp;
+    if (starts_with(cp, "[pid "))
+    {
+        pid = strtol(cp + 5, &end, 10);
+        cp = end;
+        if (*cp == ']')
+            ++cp;
+        while (*cp == ' ')
+            ++cp;
+    }
+
+    /* a process id, and up to two time stamps */
+    for (j = 0; j < 3; ++j)
+    {
+        const char      *start;
+        int             digits_only;
+
+        start = cp;
+        digits_only = 1;
+        while (isdigit((unsigned char)*cp) || *cp == ':' || *cp == '.')
+        {
+            if (!isdigit((unsigned char)*cp))
+                digits_only = 0;
+            ++cp;
+        }
+        if (cp == start || *cp != ' ')
+        {
+            cp = start;
+            break;
+        }
+        if (digits_only && !pid)
+            pid = atol(start);
+        while (*cp == ' ')
+            ++cp;
+    }
+    *cpp = cp;
+    return pid;
+}
+
+
+static void
+put_quoted(batch_buffer_t *record, const char *text, size_t text_size)
+{
+    size_t          j;
+
+    batch_buffer_putc(record, ' ');
+    if (text_size > 0 && !memchr(text, '\0', text_size))
+    {
+        for (j = 0; j < text_size; ++j)
+            if (strchr(" \t\r\n'\"\\#", text[j]))
+                break;
+        if (j >= text_size)
+        {
+            batch_buffer_write(record, text, text_size);
+            return;
+        }
+    }
+
+    /* single quotes insulate everything except single quotes */
+    batch_buffer_putc(record, '\'');
+    for (j = 0; j < text_size; ++j)
+    {
+        if (text[j] == '\'')
+            batch_buffer_write(record, "'\\''", 4);
+        else
+            batch_buffer_putc(record, text[j]);
+    }
+    batch_buffer_putc(record, '\'');
+}
+
+
+/**
+  * The unescape function is used to turn a C string literal, as printed
+  * by strace, back into the string.  Strace may follow the closing
+  * quote with "..." if the string was truncated; this is ignored.
+  * Nothing after an embedded NUL is kept, because the string will be
+  * a command line argument.
+  */
+
+static void
+unescape(const char *cp, const char *end, batch_buffer_t *bp)
+{
+    int             nul;
+
+    nul = 0;
+    ++cp;
+    while (cp < end && *cp != '"')
+    {
+        int             c;
+
+        c = (unsigned char)*cp++;
+        if (c == '\\' && cp < end)
+        {
+            c = (unsigned char)*cp++;
+            switch (c)
+            {
+            case 'a': c = '\a'; break;
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case 'n': c = '\n'; break;
+            case 'r': c = '\r'; break;
+            case 't': c = '\t'; break;
+            case 'v': c = '\v'; break;
+
+            case 'x':
+                c = 0;
+                while (cp < end && isxdigit((unsigned char)*cp))
+                {
+                    int             d;
+
+                    d = (unsigned char)*cp++;
+                    c = c * 16 + (isdigit(d) ? d - '0' : tolower(d) - 'a' + 10);
+                }
+                break;
+
+            case '0': case '1': case '2': case '3':
+            case '4': case '5': case '6': case '7':
+                {
+                    int             n;
+
+                    c -= '0';
+                    for (n = 1; n < 3 && cp < end; ++n)
+                    {
+                        if (*cp < '0' || *cp > '7')
+                            break;
+                        c = c * 8 + *cp++ - '0';
+                    }
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+        if (c == 0)
+            nul = 1;
+        if (!nul)
+            batch_buffer_putc(bp, c);
+    }
+}
+
+
+/**
+  * The skip_string function is used to skip a C string literal.
+  *
+  * @returns
+  *     pointer to the character after the closing quote
+  */
+
+static const char *
+skip_string(const char *cp)
+{
+    ++cp;
+    while (*cp && *cp != '"')
+    {
+        if (*cp == '\\' && cp[1])
+            ++cp;
+        ++cp;
+    }
+    if (*cp == '"')
+        ++cp;
+    return cp;
+}
+
+
+static strace_result_t
+parse_call(const char *cp, batch_buffer_t *record)
+{
+    const char      *name;
+    size_t          name_size;
+    const char      *errno_name;
+    size_t          errno_name_size;
+    size_t          j;
+    int             truncated;
+
+    /* the name of the system call */
+    name = cp;
+    if (!isalpha((unsigned char)*cp) && *cp != '_')
+        return strace_result_unparseable;
+    while (isalnum((unsigned char)*cp) || *cp == '_')
+        ++cp;
+    name_size = cp - name;
+    if (*cp != '(')
+        return strace_result_unparseable;
+    ++cp;
+
+    /*
+     * The arguments.  They are quoted as they are collected, before we
+     * know whether the call failed, which is cheaper than scanning the
+     * line twice.
+     */
+    args.length = 0;
+    truncated = 0;
+    for (;;)
+    {
+        const char      *start;
+        int             depth;
+        int             composite;
+
+        while (*cp == ' ')
+            ++cp;
+        if (*cp == ')')
+            break;
+        start = cp;
+        depth = 0;
+        composite = 0;
+        arg.length = 0;
+        for (;;)
+        {
+            if (!*cp)
+                return strace_result_unparseable;
+            if (*cp == '"')
+            {
+                const char      *s;
+
+                s = cp;
+                cp = skip_string(cp);
+                if (depth == 0 && s == start)
+                    unescape(s, cp, &arg);
+                continue;
+            }
+            if (cp[0] == '/' && cp[1] == '*')
+            {
+                /* a comment, such as the count of environment variables */
+                cp = strstr(cp + 2, "*/");
+                if (!cp)
+                    return strace_result_unparseable;
+                cp += 2;
+                continue;
+            }
+            if (strchr("{[(", *cp))
+            {
+                ++depth;
+                composite = 1;
+            }
+            else if (strchr("}])", *cp))
+            {
+                if (depth == 0)
+                    break;
+                --depth;
+            }
+            else if (*cp == ',' && depth == 0)
+                break;
+            if (depth == 0 && *start != '"' && *cp != ' ')
+                batch_buffer_putc(&arg, *cp);
+            ++cp;
+        }
+        if (*cp != ',' && *cp != ')')
+            return strace_result_unparseable;
+
+        if (composite || *start == '~' || *start == '&')
+            truncated = 1;
+#ifdef AT_FDCWD
+        if (arg.length == 8 && 0 == memcmp(arg.text, "AT_FDCWD", 8))
+        {
+            /*
+             * The explain command would take this to be a file name,
+             * when a file descriptor is expected.
+             */
+            char            number[20];
+
+            snprintf(number, sizeof(number), "%d", AT_FDCWD);
+            arg.length = 0;
+            batch_buffer_write(&arg, number, strlen(number));
+        }
+#endif
+        if (!truncated)
+            put_quoted(&args, arg.text, arg.length);
+        if (*cp == ')')
+            break;
+        ++cp;
+    }
+    ++cp;
+
+    /* the result */
+    while (*cp == ' ')
+        ++cp;
+    if (*cp != '=')
+        return strace_result_unparseable;
+    ++cp;
+    while (*cp == ' ')
+        ++cp;
+    if (*cp == '?' || isdigit((unsigned char)*cp))
+        return strace_result_ignore;
+    if (!starts_with(cp, "-1 "))
+        return strace_result_unparseable;
+    cp += 3;
+    errno_name = cp;
+    while (isupper((unsigned char)*cp) || isdigit((unsigned char)*cp))
+        ++cp;
+    errno_name_size = cp - errno_name;
+    if (errno_name_size == 0 || (*cp && *cp != ' '))
+        return strace_result_unparseable;
+
+    /* map the name onto the explain command's functions */
+    arg.length = 0;
+    batch_buffer_write(&arg, name, name_size);
+    batch_buffer_putc(&arg, '\0');
+    for (j = 0; j < SIZEOF(alias); ++j)
+    {
+        if (0 == strcmp(arg.text, alias[j].strace_name))
+        {
+            arg.length = 0;
+            batch_buffer_write(&arg, alias[j].name, strlen(alias[j].name));
+            batch_buffer_putc(&arg, '\0');
+            break;
+        }
+    }
+    if (!find_function_exact(arg.text))
+        return strace_result_unsupported;
+
+    batch_buffer_write(record, errno_name, errno_name_size);
+    batch_buffer_putc(record, ' ');
+    batch_buffer_write(record, arg.text, arg.length - 1);
+    batch_buffer_write(record, args.text, args.length);
+    return strace_result_record;
+}
+
+
+strace_result_t
+strace_record(const char *line, batch_buffer_t *record)
+{
+    const char      *cp;
+    long            pid;
+    const char      *unfinished;
+    pending_t       *pp;
+
+    cp = line;
+    pid = skip_prefix(&cp);
+    if
+    (
+        !*cp
+    ||
+        starts_with(cp, "+++ ")
+    ||
+        starts_with(cp, "--- ")
+    ||
+        starts_with(cp, "strace: ")
+    )
+        return strace_result_ignore;
+
+    /*
+     * A call interrupted by a call in another process.  Remember it
+     * until the rest of it turns up.
+     */
+    unfinished = strstr(cp, " <unfinished ...>");
+    if (unfinished)
+    {
+        size_t          len;
+
+        pp = find_pending(pid, 1);
+        if (pp->text)
+            free(pp->text);
+        len = unfinished - cp;
+        pp->pid = pid;
+        pp->age = ++pending_age;
+        pp->text = malloc(len + 1);
+        if (!pp->text)
+            return strace_result_unparseable;
+        memcpy(pp->text, cp, len);
+        pp->text[len] = '\0';
+        return strace_result_ignore;
+    }
+
+    /*
+     * The rest of an interrupted call, put them back together.
+     */
+    if (starts_with(cp, "<... "))
+    {
+        const char      *rest;
+
+        rest = strstr(cp, " resumed>");
+        pp = find_pending(pid, 0);
+        if (!rest || !pp)
+            return strace_result_unparseable;
+        rest += 9;
+        joined.length = 0;
+        batch_buffer_write(&joined, pp->text, strlen(pp->text));
+        batch_buffer_write(&joined, rest, strlen(rest));
+        batch_buffer_putc(&joined, '\0');
+        free(pp->text);
+        pp->text = 0;
+        return parse_call(joined.text, record);
+    }
+
+    return parse_call(cp, record);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,74 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EXPLAIN_STRACE_H
+#define EXPLAIN_STRACE_H
+
+#include <explain/batch.h>
+
+typedef enum strace_result_t strace_result_t;
+enum strace_result_t
+{
+    /**
+      * The line was a failed system call, and a record was produced.
+      */
+    strace_result_record,
+
+    /**
+      * The line was understood, but there is nothing to explain
+      * (a successful call, a signal, an exit, etc).
+      */
+    strace_result_ignore,
+
+    /**
+      * The line was not understood.
+      */
+    strace_result_unparseable,
+
+    /**
+      * The line was a failed call to a function the explain command
+      * does not know about.
+      */
+    strace_result_unsupported
+};
+
+/**
+  * The strace_record function is used to turn one line of strace(1)
+  * output into a batch record ("errno function args...").
+  *
+  * The output of "strace -f", with or without time stamps ("-t",
+  * "-tt", "-ttt", "-r") and durations ("-T"), is understood.  Calls
+  * that were split by another process ("unfinished" and "resumed")
+  * are put back together.  Arguments strace shows as structures or
+  * arrays cannot be given to the explain command, so the argument list
+  * is truncated at the first of them.
+  *
+  * @param line
+  *     The line of strace output, without its newline.
+  * @param record
+  *     Where to append the record.
+  * @returns
+  *     what was found
+  * @note
+  *     This function is <b>not</b> thread safe.
+  */
+strace_result_t strace_record(const char *line, batch_buffer_t *record);
+
+#endif /* EXPLAIN_STRACE_H */
+/* vim: set ts=8 sw=4 et : */
@@ -749,25 +749,103 @@ static const table_t table[] =
 };
 
 
+/*
+ * The table above is kept in the order it is easiest to maintain,
+ * not in alphabetical order, so an index sorted by name is built the
+ * first time a function is looked up.  In batch and strace modes
+ * there may be millions of lookups, so a linear scan is too slow.
+ */
+static const table_t *sorted[SIZEOF(table)];
+static int      sorted_ready;
+
+
+static int
+sorted_cmp(const void *va, const void *vb)
+{
+    const table_t   *a;
+    const table_t   *b;
+
+    a = *(const table_t *const *)va;
+    b = *(const table_t *const *)vb;
+    return strcasecmp(a->name, b->name);
+}
+
+
+static void
+sorted_init(void)
+{
+    size_t          j;
+
+    if (sorted_ready)
+        return;
+    for (j = 0; j < SIZEOF(table); ++j)
+        sorted[j] = &table[j];
+    qsort(sorted, SIZEOF(sorted), sizeof(sorted[0]), sorted_cmp);
+    sorted_ready = 1;
+}
+
+
+func_t
+find_function_exact(const char *name)
+{
+    size_t          lo;
+    size_t          hi;
+
+    sorted_init();
+    lo = 0;
+    hi = SIZEOF(sorted);
+    while (lo < hi)
+    {
+        size_t          mid;
+        int             cmp;
+
+        mid = lo + (hi - lo) / 2;
+        cmp = strcasecmp(name, sorted[mid]->name);
+        if (cmp == 0)
+            return sorted[mid]->func;
+        if (cmp < 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return 0;
+}
+
+
 func_t
 find_function(const char *name)
 {
     const table_t   *tp;
     const table_t   *best_tp;
     double          best_weight;
+    size_t          name_len;
+    func_t          func;
 
-    for (tp = table; tp < ENDOF(table); ++tp)
-    {
-        if (0 == strcasecmp(name, tp->name))
-            return tp->func;
-    }
+    func = find_function_exact(name);
+    if (func)
+        return func;
 
     best_tp = 0;
     best_weight = 0.6;
+    name_len = strlen(name);
     for (tp = table; tp < ENDOF(table); ++tp)
     {
         double          weight;
 
+        /*
+         * Names too long or too short to beat the best weight so far
+         * are skipped without the expense of comparing them.
+         */
+        if
+        (
+            !explain_fstrcmp_could_beat
+            (
+                name_len,
+                strlen(tp->name),
+                best_weight
+            )
+        )
+            continue;
         weight = explain_fstrcmp(name, tp->name);
         if (best_weight < weight)
         {
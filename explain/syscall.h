@@ -33,6 +33,18 @@ typedef void (*func_t)(int err, int argc, char **argv);
   */
 func_t find_function(const char *name);
 
+/**
+  * The find_function_exact function is used to locate a libc system
+  * call by name.  Unlike #find_function, there is no fuzzy matching,
+  * and no complaint if the name is not found.
+  *
+  * @param name
+  *    The name of the function to look for.
+  * @returns
+  *    pointer to explainer function, or NULL if not found.
+  */
+func_t find_function_exact(const char *name);
+
 /**
   * The syscall_statistics function is used to obtain statistics about
   * the number of supported system calls.  Only useful for bragging,
@@ -0,0 +1,336 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/glob.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/errno_info.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fflush.h>
+#include <libexplain/fopen.h>
+#include <libexplain/iocontrol.h>
+#include <libexplain/iocontrol/generic.h>
+#include <libexplain/malloc.h>
+#include <libexplain/realloc.h>
+#include <libexplain/strdup.h>
+#include <libexplain/string_buffer.h>
+
+#include <ioctl-scan/coverage.h>
+#include <ioctl-scan/scan.h>
+#include <ioctl-scan/workers.h>
+
+
+/*
+ * The state of the worker process writing the coverage of one device.
+ */
+static FILE     *sink;
+static const char *sink_device;
+static int      scanned[200];
+static size_t   nscanned;
+static long     nfound;
+static long     nsucceeded;
+static long     ndecoded;
+static long     ngeneric;
+
+
+void
+coverage_record(int fildes, int request, int err, const char *source)
+{
+    const explain_iocontrol_t *p;
+    char            name[100];
+    explain_string_buffer_t name_sb;
+    const char      *outcome;
+    int             decoded;
+
+    if (!sink)
+        return;
+    if (err && probe_unknown(err))
+        return;
+
+    /*
+     * The probe will find again the requests already tried by the
+     * fixed scanners.  There are only a few of those, so a simple list
+     * is enough to filter them.
+     */
+    if (0 == strcmp(source, "scan"))
+    {
+        if (nscanned < sizeof(scanned) / sizeof(scanned[0]))
+            scanned[nscanned++] = request;
+    }
+    else
+    {
+        size_t          j;
+
+        for (j = 0; j < nscanned; ++j)
+            if (scanned[j] == request)
+                return;
+    }
+
+    p = explain_iocontrol_find_by_number(fildes, request, 0);
+    decoded = (p && p != &explain_iocontrol_generic);
+    explain_string_buffer_init(&name_sb, name, sizeof(name));
+    explain_iocontrol_print_name(p, &name_sb, 0, fildes, request, 0);
+    outcome = "OK";
+    if (err)
+    {
+        const explain_errno_info_t *eip;
+
+        eip = explain_errno_info_by_number(err);
+        outcome = eip ? eip->name : "error";
+    }
+    fprintf
+    (
+        sink,
+        "%s\t%s\t%s\t%s\t%s\n",
+        sink_device,
+        source,
+        name,
+        outcome,
+        (decoded ? "specific" : "generic")
+    );
+    ++nfound;
+    if (!err)
+        ++nsucceeded;
+    if (decoded)
+        ++ndecoded;
+    else
+        ++ngeneric;
+}
+
+
+static void
+probe_found(void *context, int fildes, int request, int dir, int type,
+    int nr, int size, int err)
+{
+    (void)context;
+    (void)dir;
+    (void)type;
+    (void)nr;
+    (void)size;
+    coverage_record(fildes, request, err, "probe");
+}
+
+
+typedef struct coverage_context_t coverage_context_t;
+struct coverage_context_t
+{
+    char            **device;
+    size_t          ndevices;
+    size_t          maximum;
+    char            **output;
+    const probe_options_t *options;
+    int             dangerous;
+    size_t          ndone;
+};
+
+
+/**
+  * The coverage_task function is used, in a worker process, to scan
+  * one device.
+  */
+static void
+coverage_task(void *context, int task, FILE *fp)
+{
+    coverage_context_t *ccp;
+    int             fildes;
+
+    ccp = context;
+    sink = fp;
+    sink_device = ccp->device[task];
+
+    /*
+     * The scanners print their findings as text, as well, which is of
+     * no interest here.
+     */
+    if (!freopen("/dev/null", "w", stdout))
+        _exit(1);
+
+    fildes = open(sink_device, O_RDONLY | O_NONBLOCK, 0);
+    if (fildes < 0)
+    {
+        const explain_errno_info_t *eip;
+
+        eip = explain_errno_info_by_number(errno);
+        fprintf
+        (
+            fp,
+            "# open\t%s\t%s\n",
+            sink_device,
+            (eip ? eip->name : "error")
+        );
+        return;
+    }
+    scan_fildes(fildes);
+    if (ccp->dangerous)
+    {
+        int             type;
+
+        for (type = 0; type < PROBE_NTYPES; ++type)
+            probe_each(fildes, type, ccp->options->prune, probe_found, 0);
+    }
+    close(fildes);
+    fprintf
+    (
+        fp,
+        "# summary\t%s\t%ld\t%ld\t%ld\t%ld\n",
+        sink_device,
+        nfound,
+        nsucceeded,
+        ndecoded,
+        ngeneric
+    );
+}
+
+
+/**
+  * The coverage_done function is used to keep the results of a worker,
+  * once it has finished.  The report is written at the end, so that
+  * the devices appear in the order given, whatever order they finish.
+  */
+static void
+coverage_done(void *context, int task, int ok, const char *output,
+    size_t size)
+{
+    coverage_context_t *ccp;
+    char            *text;
+    size_t          text_size;
+
+    ccp = context;
+    text_size = size + 100 + strlen(ccp->device[task]);
+    text = explain_malloc_or_die(text_size);
+    memcpy(text, output, size);
+    text[size] = '\0';
+    if (!ok)
+    {
+        snprintf
+        (
+            text + size,
+            text_size - size,
+            "# failed\t%s\n",
+            ccp->device[task]
+        );
+    }
+    ccp->output[task] = text;
+    ++ccp->ndone;
+    fprintf
+    (
+        stderr,
+        "%s: done (%ld of %ld)\n",
+        ccp->device[task],
+        (long)ccp->ndone,
+        (long)ccp->ndevices
+    );
+}
+
+
+static void
+add_device(coverage_context_t *ccp, const char *name)
+{
+    if (ccp->ndevices >= ccp->maximum)
+    {
+        ccp->maximum = ccp->maximum * 2 + 16;
+        ccp->device =
+            explain_realloc_or_die
+            (
+                ccp->device,
+                ccp->maximum * sizeof(ccp->device[0])
+            );
+    }
+    ccp->device[ccp->ndevices++] = explain_strdup_or_die(name);
+}
+
+
+void
+coverage(char **devices, int ndevices, const probe_options_t *options,
+    int dangerous)
+{
+    coverage_context_t context;
+    FILE            *fp;
+    int             j;
+    size_t          k;
+
+    memset(&context, 0, sizeof(context));
+    context.options = options;
+    context.dangerous = dangerous;
+    for (j = 0; j < ndevices; ++j)
+    {
+#ifdef HAVE_GLOB_H
+        glob_t          g;
+
+        if
+        (
+            strpbrk(devices[j], "*?[")
+        &&
+            0 == glob(devices[j], 0, 0, &g)
+        )
+        {
+            size_t          n;
+
+            for (n = 0; n < g.gl_pathc; ++n)
+                add_device(&context, g.gl_pathv[n]);
+            globfree(&g);
+            continue;
+        }
+#endif
+        add_device(&context, devices[j]);
+    }
+    if (!context.ndevices)
+        return;
+    context.output =
+        explain_malloc_or_die(context.ndevices * sizeof(context.output[0]));
+    memset(context.output, 0, context.ndevices * sizeof(context.output[0]));
+
+    workers_run
+    (
+        options->jobs,
+        context.ndevices,
+        coverage_task,
+        coverage_done,
+        &context
+    );
+
+    fp = options->output ? explain_fopen_or_die(options->output, "w") : stdout;
+    fprintf(fp, "# device\tsource\trequest\toutcome\tdecoder\n");
+    fprintf
+    (
+        fp,
+        "# summary\tdevice\tfound\tsucceeded\tdecoded\tgeneric\n"
+    );
+    for (k = 0; k < context.ndevices; ++k)
+    {
+        if (context.output[k])
+            fputs(context.output[k], fp);
+        free(context.output[k]);
+        free(context.device[k]);
+    }
+    if (fp == stdout)
+        explain_fflush_or_die(fp);
+    else
+        explain_fclose_or_die(fp);
+    free(context.output);
+    free(context.device);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
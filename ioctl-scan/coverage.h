@@ -0,0 +1,69 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IOCTL_SCAN_COVERAGE_H
+#define IOCTL_SCAN_COVERAGE_H
+
+#include <ioctl-scan/probe.h>
+
+/**
+  * The coverage function may be used to scan a number of devices, at
+  * the same time, and write a single report of the ioctl requests each
+  * device recognises, and whether libexplain has a decoder for them.
+  *
+  * Each device is scanned in its own worker process, with the fixed
+  * per-header scanners, and optionally with the brute-force probe as
+  * well.  The report is tab-separated: device, source (scan or probe),
+  * request name, outcome (OK or the errno name) and decoder (specific,
+  * or generic when the request falls through to
+  * explain_iocontrol_generic).  Each device ends with a summary line.
+  *
+  * @param devices
+  *    The devices to scan.  Arguments containing wildcards are expanded
+  *    using glob(3), if available.
+  * @param ndevices
+  *    The number of devices.
+  * @param options
+  *    The number of jobs, whether to prune the probe, and the name of
+  *    the report file (NULL for the standard output).
+  * @param dangerous
+  *    Whether to run the brute-force probe on each device as well.
+  */
+void coverage(char **devices, int ndevices, const probe_options_t *options,
+    int dangerous);
+
+/**
+  * The coverage_record function is used by the scanners to note a
+  * request which has been tried, when a coverage report is being
+  * written.  Requests which the driver does not recognise are ignored.
+  * It does nothing when no coverage report is being written.
+  *
+  * @param fildes
+  *    The file descriptor the request was tried on.
+  * @param request
+  *    The request.
+  * @param err
+  *    0 if the request succeeded, or the errno value if it failed.
+  * @param source
+  *    Where the request came from: "scan" or "probe".
+  */
+void coverage_record(int fildes, int request, int err, const char *source);
+
+#endif /* IOCTL_SCAN_COVERAGE_H */
+/* vim: set ts=8 sw=4 et : */
@@ -1,6 +1,6 @@
 /*
  * libexplain - Explain errno values returned by libc functions
- * Copyright (C) 2009, 2011 Peter Miller
+ * Copyright (C) 2009, 2011, 2013 Peter Miller
  * Written by Peter Miller <pmiller@opensource.org.au>
  *
  * This program is free software; you can redistribute it and/or modify
@@ -25,6 +25,7 @@
 #include <libexplain/iocontrol.h>
 #include <libexplain/version_print.h>
 
+#include <ioctl-scan/coverage.h>
 #include <ioctl-scan/probe.h>
 #include <ioctl-scan/scan.h>
 
@@ -33,6 +34,18 @@ static void
 usage(void)
 {
     fprintf(stderr, "Usage: ioctl-scan --block <device>\n");
+    fprintf
+    (
+        stderr,
+        "       ioctl-scan [ -j <jobs> ][ --prune ][ -o <file> [ --resume ]]\n"
+        "                  --dangerous-probe <device>\n"
+    );
+    fprintf
+    (
+        stderr,
+        "       ioctl-scan [ -j <jobs> ][ --dangerous [ --prune ]][ -o <file> ]\n"
+        "                  --coverage <device>...\n"
+    );
     fprintf(stderr, "       ioctl-scan -V\n");
     exit(EXIT_FAILURE);
 }
@@ -43,7 +56,13 @@ usage(void)
 static const struct option options[] =
 {
     { "block", 1, 0, 'B' },
+    { "coverage", 0, 0, 259 },
+    { "dangerous", 0, 0, 260 },
     { "dangerous-probe", 1, 0, 256 },
+    { "jobs", 1, 0, 'j' },
+    { "output", 1, 0, 'o' },
+    { "prune", 0, 0, 257 },
+    { "resume", 0, 0, 258 },
     { "version", 0, 0, 'V' },
     { 0, 0, 0, 0 }
 };
@@ -54,12 +73,22 @@ static const struct option options[] =
 int
 main(int argc, char **argv)
 {
+    probe_options_t probe_options;
+    int             coverage_mode;
+    int             dangerous;
+
+    probe_options.jobs = 1;
+    probe_options.prune = 0;
+    probe_options.output = NULL;
+    probe_options.resume = 0;
+    coverage_mode = 0;
+    dangerous = 0;
     for (;;)
     {
 #ifdef HAVE_GETOPT_LONG
-        int c = getopt_long(argc, argv, "B:V", options, 0);
+        int c = getopt_long(argc, argv, "B:j:o:V", options, 0);
 #else
-        int c = getopt(argc, argv, "B:V");
+        int c = getopt(argc, argv, "B:j:o:V");
 #endif
         if (c < 0)
             break;
@@ -70,9 +99,35 @@ main(int argc, char **argv)
             return 0;
 
         case 256:
-            probe(optarg);
+            probe(optarg, &probe_options);
             return 0;
 
+        case 'j':
+            probe_options.jobs = atoi(optarg);
+            if (probe_options.jobs < 1)
+                usage();
+            break;
+
+        case 'o':
+            probe_options.output = optarg;
+            break;
+
+        case 257:
+            probe_options.prune = 1;
+            break;
+
+        case 258:
+            probe_options.resume = 1;
+            break;
+
+        case 259:
+            coverage_mode = 1;
+            break;
+
+        case 260:
+            dangerous = 1;
+            break;
+
         case 'V':
             explain_version_print();
             return 0;
@@ -82,6 +137,11 @@ main(int argc, char **argv)
             /* NOTREACHED */
         }
     }
+    if (coverage_mode && optind < argc)
+    {
+        coverage(argv + optind, argc - optind, &probe_options, dangerous);
+        return 0;
+    }
     usage();
     return 0;
 }
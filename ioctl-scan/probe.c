@@ -1,6 +1,6 @@
 /*
  * libexplain - Explain errno values returned by libc functions
- * Copyright (C) 2009, 2010 Peter Miller
+ * Copyright (C) 2009, 2010, 2013 Peter Miller
  * Written by Peter Miller <pmiller@opensource.org.au>
  *
  * This program is free software; you can redistribute it and/or modify
@@ -20,26 +20,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/fcntl.h>
 #include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
 #include <libexplain/ac/sys/ioctl.h> /* for ioctl() except Solaris */
 #include <libexplain/ac/unistd.h> /* for ioctl() on Solaris */
 
+#include <libexplain/close.h>
+#include <libexplain/errno_info.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fflush.h>
+#include <libexplain/fopen.h>
 #include <libexplain/iocontrol/generic.h>
 #include <libexplain/open.h>
-#include <libexplain/close.h>
 
 #include <ioctl-scan/probe.h>
-
-
-static void
-report(int fildes, int request, void *data)
-{
-    const explain_iocontrol_t *p;
-    char            name[50];
-
-    p = explain_iocontrol_find_by_number(fildes, request, data);
-    explain_iocontrol_fake_syscall_name(name, sizeof(name), p, request);
-    printf("%s\n", name);
-}
+#include <ioctl-scan/workers.h>
 
 
 static inline int
@@ -55,10 +50,6 @@ size_incr(int size)
 }
 
 
-#ifndef _IOC_TYPEMASK
-#define _IOC_TYPEMASK 255
-#endif
-
 #ifndef _IOC_NRMASK
 #define _IOC_NRMASK 255
 #endif
@@ -87,92 +78,393 @@ size_incr(int size)
 #define minbit(x) ((x) & -(x))
 
 
-void
-probe(const char *pathname)
+int
+probe_unknown(int errnum)
+{
+    switch (errnum)
+    {
+    case ENOSYS:
+#if defined(EOPNOTSUPP) && (ENOSYS != EOPNOTSUPP)
+    case EOPNOTSUPP:
+#endif
+    case ENOTTY:
+#ifdef ENOIOCTLCMD
+    case ENOIOCTLCMD:
+#endif
+#ifdef ENOIOCTL
+    case ENOIOCTL:
+#endif
+        /* definitely does not exist */
+        return 1;
+
+    case EINVAL:
+        /*
+         * Some (old) broken device drivers report these instead of
+         * ENOTTY like they are supposed to.  Assume it means "no".
+         */
+        return 1;
+
+    case EFAULT:
+    case EPERM:
+    case EACCES:
+    default:
+        /* definitely exists */
+        return 0;
+    }
+}
+
+
+/**
+  * The try_request function is used to try one ioctl request, and
+  * decide whether the device driver recognised it.
+  *
+  * @returns
+  *     -1 if the request definitely does not exist, 0 if it succeeded,
+  *     or the errno value if it failed in a way that shows the driver
+  *     knows about it.
+  */
+static int
+try_request(int fildes, int request)
 {
-    int             fildes;
     void            *data;
-    int             type;
-    int             bol;
 
     data = (void *)0x12345;
-    fildes = explain_open_or_die(pathname, O_RDONLY | O_NONBLOCK, 0);
-    bol = 1;
-    for (type = 0; type <= _IOC_TYPEMASK; ++type)
+    if (ioctl(fildes, request, data) >= 0)
+    {
+        /* This one worked.  Hope it didn't make a mess */
+        return 0;
+    }
+    if (probe_unknown(errno))
+        return -1;
+    return errno;
+}
+
+
+/**
+  * The record_request function is used to write a result line for a
+  * request found by a probe worker.
+  */
+static void
+record_request(void *context, int fildes, int request, int dir, int type,
+    int nr, int size, int err)
+{
+    FILE            *fp;
+    const explain_iocontrol_t *p;
+    char            name[50];
+    const char      *outcome;
+
+    fp = context;
+    p = explain_iocontrol_find_by_number(fildes, request, (void *)0x12345);
+    explain_iocontrol_fake_syscall_name(name, sizeof(name), p, request);
+    outcome = "OK";
+    if (err)
     {
-        int             nr;
+        const explain_errno_info_t *eip;
+
+        eip = explain_errno_info_by_number(err);
+        outcome = eip ? eip->name : "error";
+    }
+    fprintf
+    (
+        fp,
+        "%#010x\t%d\t%d\t%d\t%d\t%s\t%s\n",
+        (unsigned)request,
+        dir,
+        type,
+        nr,
+        size,
+        outcome,
+        name
+    );
+}
+
+
+/**
+  * The probe_one function is used to try one request, and call the
+  * found callback if the driver recognised it.
+  *
+  * @returns
+  *     non-zero if the request exists, zero if it does not.
+  */
+static int
+probe_one(int fildes, int dir, int type, int nr, int size,
+    probe_found_t found, void *context)
+{
+    int             request;
+    int             err;
+
+    request = _IOC(dir, type, nr, size);
+    err = try_request(fildes, request);
+    if (err < 0)
+        return 0;
+    found(context, fildes, request, dir, type, nr, size, err);
+    return 1;
+}
+
 
-        fprintf(stderr, "\r%3d of %d ", type, _IOC_TYPEMASK + 1);
-        fflush(stderr);
-        bol = 0;
-        for (nr = 0; nr <= _IOC_NRMASK; ++nr)
+void
+probe_each(int fildes, int type, int prune, probe_found_t found,
+    void *context)
+{
+    int             parent;
+    int             nr;
+
+    /*
+     * This is run in a worker process.  The worker gives up if it is
+     * orphaned, rather than keep probing for nobody.
+     */
+    parent = getppid();
+    for (nr = 0; nr <= _IOC_NRMASK; ++nr)
+    {
+        int             dir;
+        int             first_size;
+
+        if (getppid() != parent)
+            _exit(1);
+        first_size = 0;
+        if (prune)
         {
-            int             dir;
+            int             exists;
 
+            exists = 0;
             for (dir = 0; dir <= _IOC_DIRMASK; dir += minbit(_IOC_DIRMASK))
-            {
-                int             size;
-
-                for (size = 0; size <= _IOC_SIZEMASK; size = size_incr(size))
-                {
-                    int             request;
-
-                    request = _IOC(dir, type, nr, size);
-                    if (ioctl(fildes, request, data) >= 0)
-                    {
-                        /* This one worked.  Hope it didn't make a mess */
-                        if (!bol)
-                        {
-                            fprintf(stderr, "\r\33[K");
-                            bol = 1;
-                        }
-                        report(fildes, request, data);
-                    }
-                    else
-                    {
-                        switch (errno)
-                        {
-                        case ENOSYS:
-#if defined(EOPNOTSUPP) && (ENOSYS != EOPNOTSUPP)
-                        case EOPNOTSUPP:
-#endif
-                        case ENOTTY:
-#ifdef ENOIOCTLCMD
-                        case ENOIOCTLCMD:
-#endif
-#ifdef ENOIOCTL
-                        case ENOIOCTL:
-#endif
-                            /* definitely does not exist */
-                            break;
-
-                        case EINVAL:
-                            /*
-                             * Some (old) broken device drivers report
-                             * these instead of ENOTTY like they are
-                             * supposed to.  Assume it means "no".
-                             */
-                            break;
-
-                        case EFAULT:
-                        case EPERM:
-                        case EACCES:
-                        default:
-                            /* definitely exists */
-                            if (!bol)
-                            {
-                                fprintf(stderr, "\r\33[K");
-                                bol = 1;
-                            }
-                            report(fildes, request, data);
-                            break;
-                        }
-                    }
-                }
-            }
+                exists |= probe_one(fildes, dir, type, nr, 0, found, context);
+            if (!exists)
+                continue;
+            first_size = size_incr(0);
+        }
+        for (dir = 0; dir <= _IOC_DIRMASK; dir += minbit(_IOC_DIRMASK))
+        {
+            int             size;
+
+            for
+            (
+                size = first_size;
+                size <= _IOC_SIZEMASK;
+                size = size_incr(size)
+            )
+                probe_one(fildes, dir, type, nr, size, found, context);
         }
     }
+}
+
+
+typedef struct probe_context_t probe_context_t;
+struct probe_context_t
+{
+    const char      *pathname;
+    const probe_options_t *options;
+    int             type[PROBE_NTYPES];
+    int             ntypes;
+    int             ndone;
+    FILE            *result;
+};
+
+
+/**
+  * The probe_task function is used, in a worker process, to probe all
+  * of the requests of one type.
+  */
+static void
+probe_task(void *context, int task, FILE *fp)
+{
+    probe_context_t *pcp;
+    int             fildes;
+
+    pcp = context;
+    fildes = explain_open_or_die(pcp->pathname, O_RDONLY | O_NONBLOCK, 0);
+    probe_each
+    (
+        fildes,
+        pcp->type[task],
+        pcp->options->prune,
+        record_request,
+        fp
+    );
     explain_close_or_die(fildes);
-    if (!bol)
+}
+
+
+static int      progress_shown;
+
+
+static void
+progress(int ndone)
+{
+    fprintf(stderr, "\r%3d of %d ", ndone, PROBE_NTYPES);
+    fflush(stderr);
+    progress_shown = 1;
+}
+
+
+static void
+progress_clear(void)
+{
+    if (progress_shown)
+    {
         fprintf(stderr, "\r\33[K");
+        progress_shown = 0;
+    }
+}
+
+
+/**
+  * The probe_done function is used to pass on the results of a worker,
+  * once it has finished.
+  */
+static void
+probe_done(void *context, int task, int ok, const char *output, size_t size)
+{
+    probe_context_t *pcp;
+    const char      *cp;
+
+    pcp = context;
+    if (!ok)
+    {
+        progress_clear();
+        fprintf
+        (
+            stderr,
+            "type %d: probe failed, not done\n",
+            pcp->type[task]
+        );
+        progress(pcp->ndone);
+        return;
+    }
+
+    /*
+     * The standard output gets just the names, as always.
+     */
+    if (size)
+        progress_clear();
+    cp = output;
+    while (*cp)
+    {
+        const char      *eol;
+        const char      *name;
+
+        eol = strchr(cp, '\n');
+        if (!eol)
+            break;
+        name = memchr(cp, '\t', eol - cp);
+        while (name)
+        {
+            cp = name + 1;
+            name = memchr(cp, '\t', eol - cp);
+        }
+        printf("%.*s\n", (int)(eol - cp), cp);
+        cp = eol + 1;
+    }
+    fflush(stdout);
+
+    /*
+     * The results of a type are only written once they are complete,
+     * and the "done" line follows them, so that after an interruption
+     * the result file never says a type is done when it isn't.
+     */
+    if (pcp->result)
+    {
+        fwrite(output, 1, size, pcp->result);
+        fprintf(pcp->result, "# done\t%d\n", pcp->type[task]);
+        explain_fflush_or_die(pcp->result);
+    }
+    ++pcp->ndone;
+    progress(pcp->ndone);
+}
+
+
+/**
+  * The read_checkpoint function is used to read an existing result
+  * file, to see which types have already been done.
+  *
+  * @returns
+  *     the number of types already done.
+  */
+static int
+read_checkpoint(const char *pathname, char *done)
+{
+    FILE            *fp;
+    char            line[1000];
+    int             ndone;
+
+    ndone = 0;
+    fp = fopen(pathname, "r");
+    if (!fp)
+        return 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (0 == memcmp(line, "# done\t", 7))
+        {
+            int             type;
+
+            type = atoi(line + 7);
+            if (type >= 0 && type < PROBE_NTYPES && !done[type])
+            {
+                done[type] = 1;
+                ++ndone;
+            }
+        }
+    }
+    fclose(fp);
+    return ndone;
 }
+
+
+void
+probe(const char *pathname, const probe_options_t *options)
+{
+    probe_context_t context;
+    char            done[PROBE_NTYPES];
+    int             type;
+
+    memset(done, 0, sizeof(done));
+    context.pathname = pathname;
+    context.options = options;
+    context.ndone = 0;
+    context.result = NULL;
+    if (options->output)
+    {
+        if (options->resume)
+            context.ndone = read_checkpoint(options->output, done);
+        context.result =
+            explain_fopen_or_die(options->output, context.ndone ? "a" : "w");
+        if (!context.ndone)
+        {
+            fprintf
+            (
+                context.result,
+                "# request\tdir\ttype\tnr\tsize\toutcome\tname\n"
+            );
+        }
+    }
+
+    /*
+     * Make sure the device can be opened, before starting any workers.
+     */
+    explain_close_or_die
+    (
+        explain_open_or_die(pathname, O_RDONLY | O_NONBLOCK, 0)
+    );
+
+    context.ntypes = 0;
+    for (type = 0; type < PROBE_NTYPES; ++type)
+        if (!done[type])
+            context.type[context.ntypes++] = type;
+
+    progress(context.ndone);
+    workers_run
+    (
+        options->jobs,
+        context.ntypes,
+        probe_task,
+        probe_done,
+        &context
+    );
+    progress_clear();
+
+    if (context.result)
+        explain_fclose_or_die(context.result);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
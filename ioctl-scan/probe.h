@@ -21,13 +21,123 @@
 #define IOCTL_SCAN_PROBE_H
 
 /**
-  * The ioctl_scan_probe function may be used to
+  * The PROBE_NTYPES macro is the number of distinct ioctl types, the
+  * 8-bit "type" field of a request number.
+  */
+#define PROBE_NTYPES 256
+
+/**
+  * The probe_options_t type is used to represent the way the
+  * brute-force probe is to be run.
+  */
+typedef struct probe_options_t probe_options_t;
+struct probe_options_t
+{
+    /**
+      * The jobs instance variable is used to remember how many worker
+      * processes may run at once.  Each worker probes one ioctl type,
+      * with its own file descriptor.
+      */
+    int jobs;
+
+    /**
+      * The prune instance variable is used to remember whether to skip
+      * the non-zero sizes of an ioctl number when all of its size-zero
+      * requests are rejected as unknown.
+      */
+    int prune;
+
+    /**
+      * The output instance variable is used to remember the name of the
+      * machine-readable result file, or NULL if there isn't one.
+      */
+    const char *output;
+
+    /**
+      * The resume instance variable is used to remember whether to
+      * append to an existing result file, skipping the types it says
+      * are already done, rather than start again.
+      */
+    int resume;
+};
+
+/**
+  * The probe_unknown function may be used to decide whether the error
+  * from an ioctl(2) request means that the device driver does not
+  * recognise the request at all.
   *
-  * @param arg
-  *    blah blah
+  * @param errnum
+  *    The error returned by the request.
   * @returns
-  *    blah blah
+  *    non-zero if the request is unknown to the driver, zero if the
+  *    error shows the driver knows about it.
+  */
+int probe_unknown(int errnum);
+
+/**
+  * The probe_found_t type is used to represent a function called for
+  * each request found by #probe_each.
+  *
+  * @param context
+  *    The context passed to #probe_each.
+  * @param fildes
+  *    The file descriptor being probed.
+  * @param request
+  *    The request found.
+  * @param dir
+  *    The direction part of the request.
+  * @param type
+  *    The type part of the request.
+  * @param nr
+  *    The number part of the request.
+  * @param size
+  *    The size part of the request.
+  * @param err
+  *    0 if the request succeeded, or the errno value it failed with.
+  */
+typedef void (*probe_found_t)(void *context, int fildes, int request,
+    int dir, int type, int nr, int size, int err);
+
+/**
+  * The probe_each function may be used to try every request of one
+  * ioctl type, calling the found function for each request the device
+  * driver appears to recognise.  It is intended to be called in a
+  * worker process (see #workers_run) and exits if the worker is
+  * orphaned.
+  *
+  * @param fildes
+  *    The file descriptor to be probed.
+  * @param type
+  *    The ioctl type to probe.
+  * @param prune
+  *    Whether to skip the non-zero sizes of a number when all of its
+  *    size-zero requests do not exist.  This is a heuristic: it suits
+  *    drivers which decode just the number, but drivers which switch on
+  *    the whole request will be under-reported.
+  * @param found
+  *    The function to call for each request found.
+  * @param context
+  *    Passed to the found function.
+  */
+void probe_each(int fildes, int type, int prune, probe_found_t found,
+    void *context);
+
+/**
+  * The probe function may be used to try every possible ioctl request
+  * on a device, and report those that the device driver appears to
+  * recognise.  Each request found is printed on the standard output.
+  *
+  * If a result file is given, each request found is also written to it
+  * as a tab-separated line: request number (hex), direction, type,
+  * number, size, outcome (OK or the errno name) and name.  Once all of
+  * the requests of a type have been tried, a "# done" line records the
+  * type, so that an interrupted probe may be resumed.
+  *
+  * @param pathname
+  *    The path of the device to be probed.
+  * @param options
+  *    How the probe is to be run.
   */
-void probe(const char *pathname);
+void probe(const char *pathname, const probe_options_t *options);
 
 #endif /* IOCTL_SCAN_PROBE_H */
@@ -1,6 +1,6 @@
 /*
  * libexplain - Explain errno values returned by libc functions
- * Copyright (C) 2009-2011 Peter Miller
+ * Copyright (C) 2009-2011, 2013 Peter Miller
  * Written by Peter Miller <pmiller@opensource.org.au>
  *
  * This program is free software; you can redistribute it and/or modify
@@ -18,6 +18,7 @@
  */
 
 #include <libexplain/ac/assert.h>
+#include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 #include <libexplain/ac/stdlib.h>
 #include <libexplain/ac/string.h>
@@ -25,9 +26,11 @@
 #include <libexplain/ac/unistd.h> /* for ioctl() on Solaris */
 
 #include <libexplain/iocontrol.h>
+#include <libexplain/iocontrol/generic.h>
 #include <libexplain/malloc.h>
 #include <libexplain/string_buffer.h>
 
+#include <ioctl-scan/coverage.h>
 #include <ioctl-scan/report.h>
 
 
@@ -42,7 +45,17 @@ report_semi_auto(int fildes, int request)
     data = 0;
     p = explain_iocontrol_find_by_number(fildes, request, data);
     assert(p);
-    assert(p->name || p->print_name); /* i.e. p != &explain_iocontrol_generic */
+    if (p == &explain_iocontrol_generic)
+    {
+        /*
+         * There is no decoder for this request on this platform, so
+         * the size of its data is unknown.  A NULL pointer is safe,
+         * and still tells us whether the driver knows the request.
+         */
+        n = ioctl(fildes, request, 0);
+        coverage_record(fildes, request, (n < 0 ? errno : 0), "scan");
+        return;
+    }
     data_size = 0;
     if (p->data_size != NOT_A_POINTER)
     {
@@ -63,6 +76,7 @@ report_semi_auto(int fildes, int request)
         memset(data, 0, p->data_size);
     }
     n = ioctl(fildes, request, data);
+    coverage_record(fildes, request, (n < 0 ? errno : 0), "scan");
     if (n >= 0)
     {
         char            name[100];
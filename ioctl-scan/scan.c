@@ -1,6 +1,6 @@
 /*
  * libexplain - Explain errno values returned by libc functions
- * Copyright (C) 2009 Peter Miller
+ * Copyright (C) 2009, 2013 Peter Miller
  * Written by Peter Miller <pmiller@opensource.org.au>
  *
  * This program is free software; you can redistribute it and/or modify
@@ -39,6 +39,14 @@ scan_block_device(const char *pathname)
     int             fildes;
 
     fildes = explain_open_or_die(pathname, O_RDONLY + O_NONBLOCK, 0);
+    scan_fildes(fildes);
+    explain_close_or_die(fildes);
+}
+
+
+void
+scan_fildes(int fildes)
+{
     scan_asm_ioctls(fildes);
     scan_linux_cdrom(fildes);
     scan_linux_ext2_fs(fildes);
@@ -47,5 +55,4 @@ scan_block_device(const char *pathname)
     scan_linux_lp(fildes);
     scan_linux_vt(fildes);
     scan_sys_mtio(fildes);
-    explain_close_or_die(fildes);
 }
@@ -29,4 +29,13 @@
   */
 void scan_block_device(const char *pathname);
 
+/**
+  * The scan_fildes function may be used to run each of the fixed
+  * per-header scanners against an open file descriptor.
+  *
+  * @param fildes
+  *    The file descriptor of the device to be scanned.
+  */
+void scan_fildes(int fildes);
+
 #endif /* IOCTL_PROBE_SCAN_H */
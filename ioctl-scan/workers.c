@@ -0,0 +1,197 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/poll.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/wait.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/close.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fdopen.h>
+#include <libexplain/fflush.h>
+#include <libexplain/fork.h>
+#include <libexplain/malloc.h>
+#include <libexplain/pipe.h>
+#include <libexplain/poll.h>
+#include <libexplain/read.h>
+#include <libexplain/realloc.h>
+#include <libexplain/waitpid.h>
+
+#include <ioctl-scan/workers.h>
+
+
+typedef struct worker_t worker_t;
+struct worker_t
+{
+    int             pid;
+    int             fildes;
+    int             task;
+    char            *buffer;
+    size_t          length;
+    size_t          maximum;
+};
+
+
+static void
+worker_start(worker_t *wp, int task, workers_task_t func, void *context)
+{
+    int             fd[2];
+
+    explain_pipe_or_die(fd);
+    explain_fflush_or_die(stdout);
+    wp->pid = explain_fork_or_die();
+    if (wp->pid == 0)
+    {
+        FILE            *fp;
+
+        explain_close_or_die(fd[0]);
+        fp = explain_fdopen_or_die(fd[1], "w");
+        func(context, task, fp);
+        explain_fclose_or_die(fp);
+        _exit(0);
+    }
+    explain_close_or_die(fd[1]);
+    wp->fildes = fd[0];
+    wp->task = task;
+    wp->length = 0;
+}
+
+
+/**
+  * The worker_read function is used to collect the output of a worker.
+  *
+  * @returns
+  *     zero at end of file, non-zero if there may be more to come.
+  */
+static int
+worker_read(worker_t *wp)
+{
+    ssize_t         n;
+
+    if (wp->length + 1024 > wp->maximum)
+    {
+        wp->maximum = wp->maximum * 2 + 4096;
+        wp->buffer = explain_realloc_or_die(wp->buffer, wp->maximum);
+    }
+    n =
+        explain_read_or_die
+        (
+            wp->fildes,
+            wp->buffer + wp->length,
+            wp->maximum - wp->length - 1
+        );
+    wp->length += n;
+    return (n != 0);
+}
+
+
+/**
+  * The worker_finish function is used to reap a worker, once it has
+  * closed its end of the pipe, and pass on its results.
+  */
+static void
+worker_finish(worker_t *wp, workers_done_t done, void *context)
+{
+    int             status;
+    int             ok;
+
+    explain_close_or_die(wp->fildes);
+    explain_waitpid_or_die(wp->pid, &status, 0);
+    ok = (WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    if (!wp->buffer)
+    {
+        wp->maximum = 1;
+        wp->buffer = explain_malloc_or_die(wp->maximum);
+    }
+    wp->buffer[wp->length] = '\0';
+    done(context, wp->task, ok, wp->buffer, wp->length);
+}
+
+
+void
+workers_run(int jobs, int ntasks, workers_task_t task, workers_done_t done,
+    void *context)
+{
+    worker_t        *worker;
+    struct pollfd   *pfd;
+    int             running;
+    int             next;
+    int             j;
+
+    if (jobs < 1)
+        jobs = 1;
+    if (jobs > ntasks)
+        jobs = ntasks;
+    if (jobs < 1)
+        return;
+    worker = explain_malloc_or_die(jobs * sizeof(worker[0]));
+    memset(worker, 0, jobs * sizeof(worker[0]));
+    pfd = explain_malloc_or_die(jobs * sizeof(pfd[0]));
+
+    running = 0;
+    next = 0;
+    for (;;)
+    {
+        while (running < jobs && next < ntasks)
+        {
+            worker_start(&worker[running], next, task, context);
+            ++running;
+            ++next;
+        }
+        if (!running)
+            break;
+
+        for (j = 0; j < running; ++j)
+        {
+            pfd[j].fd = worker[j].fildes;
+            pfd[j].events = POLLIN;
+            pfd[j].revents = 0;
+        }
+        explain_poll_or_die(pfd, running, -1);
+        for (j = running - 1; j >= 0; --j)
+        {
+            if (!pfd[j].revents)
+                continue;
+            if (worker_read(&worker[j]))
+                continue;
+            worker_finish(&worker[j], done, context);
+
+            /* keep the list packed, recycling the buffer */
+            if (j != running - 1)
+            {
+                worker_t        temp;
+
+                temp = worker[j];
+                worker[j] = worker[running - 1];
+                worker[running - 1] = temp;
+            }
+            --running;
+        }
+    }
+
+    for (j = 0; j < jobs; ++j)
+        free(worker[j].buffer);
+    free(worker);
+    free(pfd);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,80 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IOCTL_SCAN_WORKERS_H
+#define IOCTL_SCAN_WORKERS_H
+
+#include <libexplain/ac/stddef.h>
+#include <libexplain/ac/stdio.h>
+
+/**
+  * The workers_task_t type is used to represent a function run in a
+  * worker process to perform one task.
+  *
+  * @param context
+  *     The context passed to #workers_run.
+  * @param task
+  *     The number of the task, from zero.
+  * @param fp
+  *     Where the task is to write its results.
+  */
+typedef void (*workers_task_t)(void *context, int task, FILE *fp);
+
+/**
+  * The workers_done_t type is used to represent a function run in the
+  * parent process as each task is finished.
+  *
+  * @param context
+  *     The context passed to #workers_run.
+  * @param task
+  *     The number of the task, from zero.
+  * @param ok
+  *     non-zero if the worker exited successfully, zero if it failed.
+  * @param output
+  *     The results written by the task, NUL terminated.
+  * @param size
+  *     The size of the results, in bytes.
+  */
+typedef void (*workers_done_t)(void *context, int task, int ok,
+    const char *output, size_t size);
+
+/**
+  * The workers_run function may be used to perform a number of tasks,
+  * each in its own worker process, with a bounded number of them
+  * running at any one time.  Using processes, rather than threads,
+  * means that each task has its own file descriptors, and a device
+  * driver which misbehaves can only take one worker down with it.
+  *
+  * @param jobs
+  *     The maximum number of worker processes to run at once.
+  * @param ntasks
+  *     The number of tasks.
+  * @param task
+  *     The function to run, in a worker process, for each task.
+  * @param done
+  *     The function to run, in this process, as each task finishes.
+  *     Tasks finish in no particular order.
+  * @param context
+  *     Passed to the task and done functions.
+  */
+void workers_run(int jobs, int ntasks, workers_task_t task,
+    workers_done_t done, void *context);
+
+#endif /* IOCTL_SCAN_WORKERS_H */
+/* vim: set ts=8 sw=4 et : */
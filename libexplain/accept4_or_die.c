@@ -20,7 +20,9 @@
 #include <libexplain/ac/sys/socket.h>
 
 #include <libexplain/accept4.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -30,7 +32,9 @@ explain_accept4_on_error(int fildes, struct sockaddr *sock_addr,
     int             result;
 
 #ifdef HAVE_ACCEPT4
+    explain_explanation_call_begin();
     result = accept4(fildes, sock_addr, sock_addr_size, flags);
+    explain_explanation_call_end();
 #else
     result = -1;
     errno = ENOSYS;
@@ -40,18 +44,21 @@ explain_accept4_on_error(int fildes, struct sockaddr *sock_addr,
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_accept4
+        if (!explain_output_suppress("accept4", hold_errno, fildes))
+        {
+            explain_output_error
             (
-                hold_errno,
-                fildes,
-                sock_addr,
-                sock_addr_size,
-                flags
-            )
-        );
+                "%s",
+                explain_errno_accept4
+                (
+                    hold_errno,
+                    fildes,
+                    sock_addr,
+                    sock_addr_size,
+                    flags
+                )
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -64,7 +71,9 @@ explain_accept4_or_die(int fildes, struct sockaddr *sock_addr, socklen_t
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_accept4_on_error(fildes, sock_addr, sock_addr_size, flags);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
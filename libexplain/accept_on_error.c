@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/socket.h>
 
 #include <libexplain/accept.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,17 +30,23 @@ explain_accept_on_error(int fildes, struct sockaddr *sock_addr,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = accept(fildes, sock_addr, sock_addr_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_accept(hold_errno, fildes, sock_addr, sock_addr_size)
-        );
+        if (!explain_output_suppress("accept", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_accept(hold_errno, fildes, sock_addr,
+                    sock_addr_size)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 
 #include <libexplain/accept.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,7 +29,9 @@ explain_accept_or_die(int fildes, struct sockaddr *sock_addr,
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_accept_on_error(fildes, sock_addr, sock_addr_size);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
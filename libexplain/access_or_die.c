@@ -21,16 +21,20 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/access.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_access_or_die(const char *pathname, int mode)
 {
+    explain_output_or_die_begin();
     if (explain_access_on_error(pathname, mode) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,17 +43,22 @@ explain_access_on_error(const char *pathname, int mode)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = access(pathname, mode);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_access(hold_errno, pathname, mode)
-        );
+        if (!explain_output_suppress("access", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_access(hold_errno, pathname, mode)
+            );
+        }
         errno = hold_errno;
     }
     return result;
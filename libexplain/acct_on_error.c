@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/acct.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,17 +29,22 @@ explain_acct_on_error(const char *pathname)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = acct(pathname);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acct(hold_errno, pathname)
-        );
+        if (!explain_output_suppress("acct", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acct(hold_errno, pathname)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,15 +18,18 @@
 
 #include <libexplain/acct.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_acct_or_die(const char *pathname)
 {
+    explain_output_or_die_begin();
     if (explain_acct_on_error(pathname) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -20,7 +20,9 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_from_text.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 acl_t
@@ -28,7 +30,9 @@ explain_acl_from_text_or_die(const char *text)
 {
     acl_t           result;
 
+    explain_output_or_die_begin();
     result = explain_acl_from_text_on_error(text);
+    explain_output_or_die_end();
     if (result == (acl_t)NULL)
     {
         explain_output_exit_failure();
@@ -44,7 +48,9 @@ explain_acl_from_text_on_error(const char *text)
     int             hold_errno = errno;
 
 #ifdef HAVE_ACL_FROM_TEXT
+    explain_explanation_call_begin();
     result = acl_from_text(text);
+    explain_explanation_call_end();
     if (result == (acl_t)NULL)
         errno = EINVAL;
 #else
@@ -54,11 +60,14 @@ explain_acl_from_text_on_error(const char *text)
     if (result == (acl_t)NULL)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_from_text(hold_errno, text)
-        );
+        if (!explain_output_suppress("acl_from_text", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_from_text(hold_errno, text)
+            );
+        }
         errno = hold_errno;
     }
     return result;
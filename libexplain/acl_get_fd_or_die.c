@@ -20,7 +20,9 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_get_fd.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 acl_t
@@ -28,7 +30,9 @@ explain_acl_get_fd_or_die(int fildes)
 {
     acl_t           result;
 
+    explain_output_or_die_begin();
     result = explain_acl_get_fd_on_error(fildes);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -43,7 +47,9 @@ explain_acl_get_fd_on_error(int fildes)
     acl_t           result;
 
 #ifdef HAVE_ACL_GET_FD
+    explain_explanation_call_begin();
     result = acl_get_fd(fildes);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = NULL;
@@ -53,11 +59,14 @@ explain_acl_get_fd_on_error(int fildes)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_get_fd(hold_errno, fildes)
-        );
+        if (!explain_output_suppress("acl_get_fd", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_get_fd(hold_errno, fildes)
+            );
+        }
         errno = hold_errno;
     }
     return result;
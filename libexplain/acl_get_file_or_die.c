@@ -20,7 +20,9 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_get_file.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 acl_t
@@ -28,7 +30,9 @@ explain_acl_get_file_or_die(const char *pathname, acl_type_t type)
 {
     acl_t           result;
 
+    explain_output_or_die_begin();
     result = explain_acl_get_file_on_error(pathname, type);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -43,7 +47,9 @@ explain_acl_get_file_on_error(const char *pathname, acl_type_t type)
     acl_t           result;
 
 #ifdef HAVE_ACL_GET_FILE
+    explain_explanation_call_begin();
     result = acl_get_file(pathname, type);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = NULL;
@@ -53,11 +59,14 @@ explain_acl_get_file_on_error(const char *pathname, acl_type_t type)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_get_file(hold_errno, pathname, type)
-        );
+        if (!explain_output_suppress("acl_get_file", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_get_file(hold_errno, pathname, type)
+            );
+        }
         errno = hold_errno;
     }
     return result;
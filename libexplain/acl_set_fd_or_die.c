@@ -20,16 +20,20 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_set_fd.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_acl_set_fd_or_die(int fildes, acl_t acl)
 {
+    explain_output_or_die_begin();
     if (explain_acl_set_fd_on_error(fildes, acl) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,7 +46,9 @@ explain_acl_set_fd_on_error(int fildes, acl_t acl)
     {
         int hold_errno = errno;
         errno = EINVAL;
+        explain_explanation_call_begin();
         result = acl_set_fd(fildes, acl);
+        explain_explanation_call_end();
         if (result >= 0)
             errno = hold_errno;
     }
@@ -53,11 +59,14 @@ explain_acl_set_fd_on_error(int fildes, acl_t acl)
     if (result < 0)
     {
         int hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_set_fd(hold_errno, fildes, acl)
-        );
+        if (!explain_output_suppress("acl_set_fd", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_set_fd(hold_errno, fildes, acl)
+            );
+        }
         errno = hold_errno;
     }
     return result;
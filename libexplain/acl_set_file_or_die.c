@@ -20,16 +20,20 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_set_file.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_acl_set_file_or_die(const char *pathname, acl_type_t type, acl_t acl)
 {
+    explain_output_or_die_begin();
     if (explain_acl_set_file_on_error(pathname, type, acl) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_acl_set_file_on_error(const char *pathname, acl_type_t type, acl_t acl)
     int             result;
 
 #ifdef HAVE_ACL_SET_FILE
+    explain_explanation_call_begin();
     result = acl_set_file(pathname, type, acl);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_acl_set_file_on_error(const char *pathname, acl_type_t type, acl_t acl)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_set_file(hold_errno, pathname, type, acl)
-        );
+        if (!explain_output_suppress("acl_set_file", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_set_file(hold_errno, pathname, type, acl)
+            );
+        }
         errno = hold_errno;
     }
     return result;
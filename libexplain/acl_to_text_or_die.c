@@ -20,7 +20,9 @@
 #include <libexplain/ac/sys/acl.h>
 
 #include <libexplain/acl_to_text.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 char *
@@ -28,7 +30,9 @@ explain_acl_to_text_or_die(acl_t acl, ssize_t *len_p)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_acl_to_text_on_error(acl, len_p);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -43,7 +47,9 @@ explain_acl_to_text_on_error(acl_t acl, ssize_t *len_p)
     char            *result;
 
 #ifdef HAVE_ACL_TO_TEXT
+    explain_explanation_call_begin();
     result = acl_to_text(acl, len_p);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = 0;
@@ -53,11 +59,14 @@ explain_acl_to_text_on_error(acl_t acl, ssize_t *len_p)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_acl_to_text(hold_errno, acl, len_p)
-        );
+        if (!explain_output_suppress("acl_to_text", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_acl_to_text(hold_errno, acl, len_p)
+            );
+        }
         errno = hold_errno;
     }
     return result;
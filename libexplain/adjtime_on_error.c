@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/time.h>
 
 #include <libexplain/adjtime.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,17 +30,22 @@ explain_adjtime_on_error(const struct timeval *delta, struct timeval *olddelta)
     int             result;
 
     /* We have to cast away const-ness because Solaris is broken. */
+    explain_explanation_call_begin();
     result = adjtime((struct timeval *)delta, olddelta);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_adjtime(hold_errno, delta, olddelta)
-        );
+        if (!explain_output_suppress("adjtime", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_adjtime(hold_errno, delta, olddelta)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,15 +18,18 @@
 
 #include <libexplain/adjtime.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_adjtime_or_die(const struct timeval *delta, struct timeval *olddelta)
 {
+    explain_output_or_die_begin();
     if (explain_adjtime_on_error(delta, olddelta) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/timex.h>
 
 #include <libexplain/adjtimex.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,7 +30,9 @@ explain_adjtimex_on_error(struct timex *data)
     int             result;
 
 #ifdef HAVE_ADJTIMEX
+    explain_explanation_call_begin();
     result = adjtimex(data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,11 +42,14 @@ explain_adjtimex_on_error(struct timex *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_adjtimex(hold_errno, data)
-        );
+        if (!explain_output_suppress("adjtimex", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_adjtimex(hold_errno, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,6 +18,7 @@
 
 #include <libexplain/adjtimex.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -25,7 +26,9 @@ explain_adjtimex_or_die(struct timex *data)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_adjtimex_on_error(data);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -23,6 +23,7 @@
 #include <libexplain/asprintf.h>
 #include <libexplain/buffer/errno/asprintf.h>
 #include <libexplain/common_message_buffer.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 #include <libexplain/string_buffer.h>
 
@@ -91,7 +92,9 @@ explain_asprintf_on_error(char **data, const char *format, ...)
     va_copy(ap2, ap);
 
 #ifdef HAVE_ASPRINTF
+    explain_explanation_call_begin();
     result = vasprintf(data, format, ap);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -102,14 +105,17 @@ explain_asprintf_on_error(char **data, const char *format, ...)
 
         hold_errno = errno;
         result = -1;
-        explain_string_buffer_init
-        (
-            &sb,
-            explain_common_message_buffer,
-            explain_common_message_buffer_size
-        );
-        explain_buffer_errno_asprintf(&sb, hold_errno, data, format, ap2);
-        explain_output_error("%s", explain_common_message_buffer);
+        if (!explain_output_suppress("asprintf", hold_errno, -1))
+        {
+            explain_string_buffer_init
+            (
+                &sb,
+                explain_common_message_buffer,
+                explain_common_message_buffer_size
+            );
+            explain_buffer_errno_asprintf(&sb, hold_errno, data, format, ap2);
+            explain_output_error("%s", explain_common_message_buffer);
+        }
         va_end(ap2);
     }
     va_end(ap);
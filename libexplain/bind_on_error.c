@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/socket.h>
 
 #include <libexplain/bind.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,17 +30,23 @@ explain_bind_on_error(int fildes, const struct sockaddr *sock_addr,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = bind(fildes, sock_addr, sock_addr_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_bind(hold_errno, fildes, sock_addr, sock_addr_size)
-        );
+        if (!explain_output_suppress("bind", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_bind(hold_errno, fildes, sock_addr,
+                    sock_addr_size)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,16 +20,19 @@
 
 #include <libexplain/bind.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_bind_or_die(int fildes, const struct sockaddr *sock_addr,
     int sock_addr_size)
 {
+    explain_output_or_die_begin();
     if (explain_bind_on_error(fildes, sock_addr, sock_addr_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
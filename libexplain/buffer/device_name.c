@@ -23,6 +23,7 @@
 #include <libexplain/buffer/device_name.h>
 #include <libexplain/buffer/pointer.h>
 #include <libexplain/is_efault.h>
+#include <libexplain/statistics/probe.h>
 
 
 /**
@@ -132,10 +133,15 @@ explain_buffer_device_name(explain_string_buffer_t *sb, dev_t dev,
 {
     explain_string_buffer_t dev_path_buf;
     char            dev_path[PATH_MAX + 1];
+    explain_probe_timer_t timer;
+    int             result;
 
     explain_string_buffer_init(&dev_path_buf, dev_path, sizeof(dev_path));
     explain_string_buffer_puts(&dev_path_buf, "/dev");
-    return dev_stat_rec(&dev_path_buf, dev, st, sb);
+    explain_probe_begin(&timer, explain_probe_dev);
+    result = dev_stat_rec(&dev_path_buf, dev, st, sb);
+    explain_probe_end(&timer);
+    return result;
 }
 
 
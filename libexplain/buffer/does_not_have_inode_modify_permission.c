@@ -29,6 +29,7 @@
 #include <libexplain/buffer/gettext.h>
 #include <libexplain/buffer/uid.h>
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
 #include <libexplain/name_max.h>
 
 
@@ -43,7 +44,7 @@ explain_buffer_does_not_have_inode_modify_permission1(
     char            dirname[PATH_MAX + 1];
 
     explain_dirname(dirname, pathname, sizeof(dirname));
-    if (stat(dirname, &dirname_st) < 0)
+    if (explain_memo_stat(dirname, &dirname_st) < 0)
     {
         memset(&dirname_st, 0, sizeof(dirname_st));
         dirname_st.st_mode = S_IFDIR;
@@ -23,6 +23,7 @@
 #include <libexplain/buffer/caption_name_type.h>
 #include <libexplain/buffer/eexist.h>
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
 #include <libexplain/name_max.h>
 
 
@@ -34,12 +35,12 @@ explain_buffer_eexist(explain_string_buffer_t *sb, const char *pathname)
     char            basename[NAME_MAX + 1];
     char            dirname[PATH_MAX];
 
-    if (lstat(pathname, &pathname_st) < 0)
+    if (explain_memo_lstat(pathname, &pathname_st) < 0)
         pathname_st.st_mode = -1;
     explain_basename(basename, pathname, sizeof(basename));
 
     explain_dirname(dirname, pathname, sizeof(dirname));
-    if (stat(dirname, &dirname_st) < 0)
+    if (explain_memo_stat(dirname, &dirname_st) < 0)
         dirname_st.st_mode = S_IFDIR;
 
     explain_buffer_eexist5
@@ -19,6 +19,7 @@
 #include <libexplain/ac/sys/stat.h>
 
 #include <libexplain/buffer/eisdir.h>
+#include <libexplain/memo.h>
 
 
 int
@@ -27,7 +28,7 @@ explain_buffer_eisdir(explain_string_buffer_t *sb, const char *pathname,
 {
     struct stat     st;
 
-    if (stat(pathname, &st) >= 0 && S_ISDIR(st.st_mode))
+    if (explain_memo_stat(pathname, &st) >= 0 && S_ISDIR(st.st_mode))
     {
         explain_string_buffer_printf_gettext
         (
@@ -27,6 +27,7 @@
 #include <libexplain/buffer/file_type.h>
 #include <libexplain/buffer/gettext.h>
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 
 
@@ -36,7 +37,7 @@ explain_buffer_emlink(explain_string_buffer_t *sb, const char *oldpath,
 {
     struct stat     oldpath_st;
 
-    if (stat(oldpath, &oldpath_st) >= 0)
+    if (explain_memo_stat(oldpath, &oldpath_st) >= 0)
     {
         if (S_ISDIR(oldpath_st.st_mode))
         {
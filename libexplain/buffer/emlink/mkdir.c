@@ -24,6 +24,7 @@
 
 #include <libexplain/buffer/emlink.h>
 #include <libexplain/get_link_max.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 
 
@@ -67,7 +68,7 @@ explain_buffer_emlink_mkdir(explain_string_buffer_t *sb, const char *parent,
          * If possible, display the actual value in the directory,
          * rather than the value returned by pathconf().
          */
-        if (stat(parent, &st) >= 0)
+        if (explain_memo_stat(parent, &st) >= 0)
             link_max = st.st_nlink;
         else
             link_max = explain_get_link_max(parent);
@@ -25,6 +25,7 @@
 #include <libexplain/buffer/eperm.h>
 #include <libexplain/buffer/uid.h>
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
 
 
 void
@@ -38,13 +39,13 @@ explain_buffer_eperm_unlink(explain_string_buffer_t *sb, const char *pathname,
     explain_dirname(dir, pathname, sizeof(dir));
     if
     (
-        stat(dir, &dir_st) >= 0
+        explain_memo_stat(dir, &dir_st) >= 0
     &&
         (dir_st.st_mode & S_ISVTX)
     &&
         geteuid() != dir_st.st_uid
     &&
-        stat(pathname, &pathname_st) >= 0
+        explain_memo_stat(pathname, &pathname_st) >= 0
     &&
         geteuid() != pathname_st.st_uid
     )
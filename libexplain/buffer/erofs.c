@@ -29,6 +29,7 @@
 #include <libexplain/buffer/erofs.h>
 #include <libexplain/buffer/gettext.h>
 #include <libexplain/buffer/mount_point.h>
+#include <libexplain/memo.h>
 
 
 static void
@@ -77,7 +78,7 @@ explain_buffer_erofs(explain_string_buffer_t *sb, const char *pathname,
 {
     struct stat     st;
 
-    if (stat(pathname, &st) >= 0)
+    if (explain_memo_stat(pathname, &st) >= 0)
     {
         switch (st.st_mode & S_IFMT)
         {
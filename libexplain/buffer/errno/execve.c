@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
 #include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
 #include <libexplain/ac/string.h>
 #include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
 #include <libexplain/ac/unistd.h>
@@ -36,12 +37,14 @@
 #include <libexplain/buffer/errno/generic.h>
 #include <libexplain/buffer/errno/execve.h>
 #include <libexplain/buffer/errno/path_resolution.h>
+#include <libexplain/buffer/file_magic.h>
 #include <libexplain/buffer/path_to_pid.h>
 #include <libexplain/buffer/pathname.h>
 #include <libexplain/buffer/pointer.h>
 #include <libexplain/explanation.h>
 #include <libexplain/option.h>
 #include <libexplain/is_efault.h>
+#include <libexplain/run_command.h>
 
 
 static int
@@ -145,53 +148,78 @@ wonky_pointer(explain_string_buffer_t *sb, char *const *array,
 
 
 /**
-  * The explain_buffer_file1 function is used to run the file(1)
-  * command, if available, and insert its output into the given buffer.
+  * The file_command function is used to run the file(1) command, if
+  * available, and insert its output into the given buffer.  This
+  * spawns a child process, so it is only used when the "file-command"
+  * option asks for it.
+  *
+  * @param sb
+  *     The string buffer to print into.
+  * @param pathname
+  *     The pathname of interest.
+  */
+static void
+file_command(explain_string_buffer_t *sb, const char *pathname)
+{
+    const char      *argv[5];
+    char            *output;
+    size_t          output_size;
+
+    argv[0] = "file";
+    argv[1] = "-b";
+    argv[2] = "--";
+    argv[3] = pathname;
+    argv[4] = NULL;
+    output =
+        explain_run_command
+        (
+            argv,
+            PATH_MAX + 20,
+            EXPLAIN_RUN_COMMAND_TIMEOUT,
+            &output_size
+        );
+    if (!output)
+        return;
+    output[strcspn(output, "\n")] = '\0';
+    if (output[0])
+    {
+        explain_string_buffer_puts(sb, " (");
+        explain_string_buffer_puts(sb, output);
+        explain_string_buffer_putc(sb, ')');
+    }
+    free(output);
+}
+
+
+/**
+  * The explain_buffer_file1 function is used to describe the format
+  * of a file, in the manner of file(1), and insert the description
+  * into the given buffer.
   *
   * @param sb
   *     The string buffer to print into.
   * @param pathname
   *     The pathname of interest.
-  * @returns
-  *     int; 0 on success (file type info printed),
-  *     or -1 on failure (nothing printed).
   */
 static void
 explain_buffer_file1(explain_string_buffer_t *sb, const char *pathname)
 {
-    FILE            *fp;
-    char            buffer[PATH_MAX + 20];
+    char            buffer[PATH_MAX + 100];
+    explain_string_buffer_t buffer_sb;
 
     if (!explain_option_dialect_specific())
         return;
 
-    /* FIXME: need shell quoting */
-    snprintf(buffer, sizeof(buffer), "file -b %s 2> /dev/null", pathname);
-
-    fp = popen(buffer, "r");
-    if (fp)
+    explain_string_buffer_init(&buffer_sb, buffer, sizeof(buffer));
+    if (explain_buffer_file_magic(&buffer_sb, pathname) == 0)
     {
-        char            *bp;
-
-        bp = buffer;
-        for (;;)
-        {
-            int c = getc(fp);
-            if (c == EOF || c == '\n')
-                break;
-            *bp++ = c;
-            if (bp >= buffer + sizeof(buffer) - 1)
-                break;
-        }
-        pclose(fp);
-        *bp = '\0';
-        if (buffer[0])
-        {
-            explain_string_buffer_puts(sb, " (");
-            explain_string_buffer_puts(sb, buffer);
-            explain_string_buffer_putc(sb, ')');
-        }
+        explain_string_buffer_puts(sb, " (");
+        explain_string_buffer_puts(sb, buffer);
+        explain_string_buffer_putc(sb, ')');
+        return;
     }
+    if (explain_option_file_command())
+        file_command(sb, pathname);
 }
 
 
@@ -57,7 +57,7 @@ static const explain_parse_bits_table_t table[] =
 int
 explain_flock_command_parse_or_die(const char *text, const char *caption)
 {
-    return explain_parse_bits_or_die(text, table, sizeof(table), caption);
+    return explain_parse_bits_or_die(text, table, SIZEOF(table), caption);
 }
 
 
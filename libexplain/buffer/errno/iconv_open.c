@@ -16,12 +16,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <libexplain/ac/assert.h>
-#include <libexplain/ac/ctype.h>
 #include <libexplain/ac/errno.h>
-#include <libexplain/ac/stdio.h>
-#include <libexplain/ac/stdlib.h>
-#include <libexplain/ac/string.h>
 
 #include <libexplain/buffer/einval.h>
 #include <libexplain/buffer/errno/generic.h>
@@ -29,7 +24,7 @@
 #include <libexplain/buffer/pathname.h>
 #include <libexplain/buffer/is_the_null_pointer.h>
 #include <libexplain/explanation.h>
-#include <libexplain/fstrcmp.h>
+#include <libexplain/iconv_names.h>
 
 
 static void
@@ -45,212 +40,11 @@ explain_buffer_errno_iconv_open_system_call(explain_string_buffer_t *sb, int
 }
 
 
-static char **known_names;
-static size_t known_names_size;
-static size_t known_names_allocated;
-
-
-static char *
-xstrdup(const char *text)
-{
-    char            *result;
-    size_t          text_size;
-
-    text_size = strlen(text);
-    result = malloc(text_size + 1);
-    if (!result)
-        return (char *)text;
-    memcpy(result, text, text_size + 1);
-    return result;
-}
-
-
-static void
-one_more_name(char *name)
-{
-    if (known_names_size >= known_names_allocated)
-    {
-        char            **new_known_names;
-        size_t          new_known_names_allocated;
-        size_t          j;
-
-        new_known_names_allocated =
-            known_names_allocated ? known_names_allocated * 2 : 19;
-        while (known_names_size > new_known_names_allocated)
-            new_known_names_allocated *= 2;
-        assert(known_names_size < new_known_names_allocated);
-        new_known_names =
-            malloc(new_known_names_allocated * sizeof(char *));
-        for (j = 0; j < known_names_size; ++j)
-            new_known_names[j] = known_names[j];
-        if (known_names)
-            free(known_names);
-        known_names_allocated = new_known_names_allocated;
-        known_names = new_known_names;
-        assert(known_names_size < known_names_allocated);
-    }
-    known_names[known_names_size++] = xstrdup(name);
-}
-
-
-static void
-upcase_insitu(char *name)
-{
-    char            *ip;
-    char            *op;
-
-    /*
-     * eglibc::iconv/iconv_open.c
-     * Normalizes the name, by remove all characters beside alpha-numeric,
-     * '_', '-', '/', '.', and ':'.
-     */
-    ip = name;
-    op = name;
-    for(;;)
-    {
-        unsigned char c = *ip++;
-        if (!c)
-        {
-            *op = '\0';
-            return;
-        }
-        if (islower(c))
-            *op++ = toupper(c);
-        else if (isalnum(c))
-            *op++ = c;
-        else if (strchr("_-/.:", c))
-            *op++ = c;
-        else
-        {
-            /* discard */
-        }
-    }
-}
-
-
-static char *
-strdup_upcase(const char *text)
-{
-    const char      *ip;
-    char            *op;
-    char            *result;
-
-    result = malloc(strlen(text) + 1);
-    if (!result)
-        return NULL;
-    ip = text;
-    op = result;
-    for (;;)
-    {
-        unsigned char c = *ip++;
-        if (!c)
-        {
-            *op = '\0';
-            return result;
-        }
-        if (islower(c))
-            *op++ = toupper(c);
-        else if (isalnum(c))
-            *op++ = c;
-        else if (strchr("_-/.:", c))
-            *op++ = c;
-        else
-        {
-            /* discard */
-        }
-    }
-    return result;
-}
-
-
-static void
-get_list_of_known_names(void)
-{
-    FILE            *fp;
-
-    /*
-     * The only way to do this is via the iconv() command, which has
-     * special eglibc support
-     */
-    fp = popen("iconv --list", "r");
-    if (!fp)
-        return;
-    for (;;)
-    {
-        char            buffer[200];
-        char            *slash;
-
-        if (!fgets(buffer, sizeof(buffer), fp))
-            break;
-        slash = strpbrk(buffer, "/\r\n");
-        if (slash)
-            *slash = '\0';
-        upcase_insitu(buffer);
-        one_more_name(buffer);
-    }
-    pclose(fp);
-}
-
-
-static int
-is_known_name(const char *name)
-{
-    size_t          j;
-
-    for (j = 0; j < known_names_size; ++j)
-    {
-        char *known_name;
-
-        known_name = known_names[j];
-#ifdef HAV_STRVERSCMP
-        if (0 == strverscmp(known_name, name))
-            return 1;
-#else
-        if (0 == strcmp(known_name, name))
-            return 1;
-#endif
-    }
-    return 0;
-}
-
-
-static char *
-known_names_fuzzy(const char *name)
-{
-    char            *best_name;
-    double          best_weight;
-    size_t          j;
-    char            *name2;
-
-    name2 = strdup_upcase(name);
-    if (!name2)
-        return NULL;
-    get_list_of_known_names();
-    best_name = NULL;
-    best_weight = 0.6;
-    for (j = 0; j < known_names_size; ++j)
-    {
-        char            *known_name;
-        double          w;
-
-        known_name = known_names[j];
-        w = explain_fstrcmp(name2, known_name);
-        if (w > best_weight)
-        {
-            best_name = known_name;
-            best_weight = w;
-        }
-    }
-    free(name2);
-    return best_name;
-}
-
-
 static int
 known_names_check(explain_string_buffer_t *sb, const char *locale,
     const char *locale_caption)
 {
-    char            *locale_fuzzy;
+    const char      *locale_fuzzy;
 
     if (!locale)
     {
@@ -258,10 +52,9 @@ known_names_check(explain_string_buffer_t *sb, const char *locale,
         return 1;
     }
 
-    get_list_of_known_names();
-    if (is_known_name(locale))
+    if (explain_iconv_name_is_known(locale))
     {
-        /* no error here */
+        /* no error here, or no way of telling */
         return 0;
     }
 
@@ -273,7 +66,7 @@ known_names_check(explain_string_buffer_t *sb, const char *locale,
         locale_caption
     );
 
-    locale_fuzzy = known_names_fuzzy(locale);
+    locale_fuzzy = explain_iconv_name_fuzzy(locale);
     if (locale_fuzzy)
     {
         explain_string_buffer_puts(sb->footnotes, "; ");
@@ -42,6 +42,7 @@
 #include <libexplain/dirname.h>
 #include <libexplain/explanation.h>
 #include <libexplain/is_efault.h>
+#include <libexplain/memo.h>
 #include <libexplain/string_buffer.h>
 
 
@@ -50,7 +51,7 @@ get_mode(const char *pathname)
 {
     struct stat     st;
 
-    if (stat(pathname, &st) < 0)
+    if (explain_memo_stat(pathname, &st) < 0)
         return S_IFREG;
     return st.st_mode;
 }
@@ -210,7 +211,7 @@ explain_buffer_errno_link_explanation(explain_string_buffer_t *sb,
         {
             struct stat     oldpath_st;
 
-            if (stat(oldpath, &oldpath_st) >= 0)
+            if (explain_memo_stat(oldpath, &oldpath_st) >= 0)
             {
                 if (S_ISDIR(oldpath_st.st_mode))
                 {
@@ -44,6 +44,7 @@
 #include <libexplain/explanation.h>
 #include <libexplain/fildes_is_dot.h>
 #include <libexplain/is_efault.h>
+#include <libexplain/memo.h>
 
 
 static void
@@ -84,7 +85,7 @@ get_mode_at(int fildes, const char *pathname)
 {
     struct stat     st;
 
-    if (fstatat(fildes, pathname, &st, 0) < 0)
+    if (explain_memo_fstatat(fildes, pathname, &st, 0) < 0)
         return S_IFREG;
     return st.st_mode;
 }
@@ -283,7 +284,7 @@ explain_buffer_errno_linkat_explanation(explain_string_buffer_t *sb, int errnum,
         {
             struct stat     oldpath_st;
 
-            if (stat(old_path_full, &oldpath_st) >= 0)
+            if (explain_memo_stat(old_path_full, &oldpath_st) >= 0)
             {
                 if (S_ISDIR(oldpath_st.st_mode))
                 {
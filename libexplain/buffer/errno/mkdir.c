@@ -42,6 +42,7 @@
 #include <libexplain/dirname.h>
 #include <libexplain/get_link_max.h>
 #include <libexplain/explanation.h>
+#include <libexplain/memo.h>
 
 
 static void
@@ -113,7 +114,7 @@ explain_buffer_errno_mkdir_explanation(explain_string_buffer_t *sb,
             assert(link_max > 0);
             if
             (
-                stat(parent, &parent_st) >= 0
+                explain_memo_stat(parent, &parent_st) >= 0
             &&
                 parent_st.st_nlink >= (unsigned long)link_max
             )
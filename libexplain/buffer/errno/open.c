@@ -54,6 +54,7 @@
 #include <libexplain/buffer/uid.h>
 #include <libexplain/capability.h>
 #include <libexplain/explanation.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 #include <libexplain/string_buffer.h>
 
@@ -221,7 +222,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
 
             if
             (
-                stat(pathname, &st) >= 0
+                explain_memo_stat(pathname, &st) >= 0
             &&
                 is_device_file(&st)
             &&
@@ -306,7 +307,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
         {
             struct stat     st;
 
-            if (stat(pathname, &st) >= 0 && S_ISREG(st.st_mode))
+            if (explain_memo_stat(pathname, &st) >= 0 && S_ISREG(st.st_mode))
             {
                 char            siz[20];
                 explain_string_buffer_t siz_sb;
@@ -351,7 +352,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
         {
             struct stat     st;
 
-            if (lstat(pathname, &st) >= 0 && S_ISLNK(st.st_mode))
+            if (explain_memo_lstat(pathname, &st) >= 0 && S_ISLNK(st.st_mode))
             {
                 explain_buffer_gettext
                 (
@@ -417,7 +418,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
         {
             struct stat     st;
 
-            if (stat(pathname, &st) < 0)
+            if (explain_memo_stat(pathname, &st) < 0)
             {
                 enxio_generic:
                 explain_buffer_gettext
@@ -486,7 +487,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
             explain_buffer_uid(&puid_sb, geteuid());
             explain_string_buffer_init(&ftype_sb, ftype, sizeof(ftype));
             explain_string_buffer_init(&fuid_sb, fuid, sizeof(fuid));
-            if (stat(pathname, &st) >= 0)
+            if (explain_memo_stat(pathname, &st) >= 0)
             {
                 explain_buffer_file_type_st(&ftype_sb, &st);
                 explain_buffer_uid(&fuid_sb, st.st_uid);
@@ -560,7 +561,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
         {
             struct stat     st;
 
-            if (stat(pathname, &st) >= 0)
+            if (explain_memo_stat(pathname, &st) >= 0)
             {
                 switch (st.st_mode & S_IFMT)
                 {
@@ -629,7 +630,7 @@ explain_buffer_errno_open_explanation(explain_string_buffer_t *sb,
         {
             struct stat st;
 
-            if (stat(pathname, &st) >= 0)
+            if (explain_memo_stat(pathname, &st) >= 0)
             {
                 explain_string_buffer_t file_type_sb;
                 char            file_type[FILE_TYPE_BUFFER_SIZE_MIN];
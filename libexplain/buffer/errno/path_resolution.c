@@ -19,7 +19,6 @@
 
 #include <libexplain/ac/assert.h>
 #include <libexplain/ac/ctype.h>
-#include <libexplain/ac/dirent.h>
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/fcntl.h>
 #include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
@@ -40,9 +39,11 @@
 #include <libexplain/buffer/uid.h>
 #include <libexplain/buffer/wrong_file_type.h>
 #include <libexplain/capability.h>
+#include <libexplain/directory_scan.h>
 #include <libexplain/fstrcmp.h>
 #include <libexplain/getppcwd.h>
 #include <libexplain/have_permission.h>
+#include <libexplain/memo.h>
 #include <libexplain/name_max.h>
 #include <libexplain/option.h>
 #include <libexplain/symloopmax.h>
@@ -57,48 +58,71 @@ all_slash(const char *s)
 }
 
 
+typedef struct similar_t similar_t;
+struct similar_t
+{
+    const char      *component;
+    size_t          component_length;
+    char            best_name[NAME_MAX + 1];
+    double          best_weight;
+};
+
+
+static int
+similar_one(void *context, const char *name)
+{
+    similar_t       *sp;
+    double          weight;
+
+    sp = context;
+
+    /*
+     * Names which can't beat the best so far are skipped without
+     * comparing them, which matters for very large directories.
+     */
+    if
+    (
+        !explain_fstrcmp_could_beat
+        (
+            strlen(name),
+            sp->component_length,
+            sp->best_weight
+        )
+    )
+        return 0;
+
+    weight = explain_fstrcasecmp(sp->component, name);
+    if (sp->best_weight < weight)
+    {
+        sp->best_weight = weight;
+        explain_strendcpy
+        (
+            sp->best_name,
+            name,
+            sp->best_name + sizeof(sp->best_name)
+        );
+    }
+    return 0;
+}
+
+
 static void
 look_for_similar(explain_string_buffer_t *sb, const char *lookup_directory,
     const char *component)
 {
-    DIR             *dp;
-    char            best_name[NAME_MAX + 1];
-    double          best_weight;
+    similar_t       similar;
+    const char      *best_name;
     char            subject[NAME_MAX * 4 + 3];
     explain_string_buffer_t subject_sb;
     struct stat     st;
 
-    dp = opendir(lookup_directory);
-    if (!dp)
+    similar.component = component;
+    similar.component_length = strlen(component);
+    similar.best_name[0] = '\0';
+    similar.best_weight = 0.6;
+    if (explain_directory_scan(lookup_directory, similar_one, &similar) < 0)
         return;
-
-    best_name[0] = '\0';
-    best_weight = 0.6;
-    for (;;)
-    {
-        struct dirent   *dep;
-        double          weight;
-
-        dep = readdir(dp);
-        if (!dep)
-            break;
-        if (0 == strcmp(dep->d_name, "."))
-            continue;
-        if (0 == strcmp(dep->d_name, ".."))
-            continue;
-        weight = explain_fstrcasecmp(component, dep->d_name);
-        if (best_weight < weight)
-        {
-            best_weight = weight;
-            explain_strendcpy
-            (
-                best_name,
-                dep->d_name,
-                best_name + sizeof(best_name)
-            );
-        }
-    }
-    closedir(dp);
+    best_name = similar.best_name;
 
     if (best_name[0] == '\0')
         return;
@@ -923,6 +947,129 @@ current_directory_confusing(void)
 }
 
 
+/*
+ * The walk below holds a file descriptor open on the current lookup
+ * directory, and looks up each component relative to it.  That way
+ * each component is looked up exactly once, rather than the kernel
+ * walking the whole prefix again for every component (which is
+ * quadratic in the path depth), and the walk stays on the same
+ * directories even if something is renamed while we look.
+ *
+ * The pathname strings are still maintained alongside, because they
+ * are what the explanations talk about, and because they are what the
+ * answers are remembered under (see libexplain/memo.h).  Whenever a
+ * directory cannot be opened (no openat, no file descriptors left, etc)
+ * the walk falls back to using those pathnames directly.
+ */
+#if defined(HAVE_OPENAT) && defined(HAVE_FSTATAT)
+#ifdef AT_SYMLINK_NOFOLLOW
+#define LOOKUP_FD 1
+#endif
+#endif
+
+/*
+ * A short prefix is cheap for the kernel to walk again, cheaper than
+ * the openat and close it takes to hold the directory open, so the
+ * pathnames are used until the walk is this many directories deep.
+ *
+ * This means the shallow components are walked by pathname, not by
+ * file descriptor: if one of them is renamed or replaced part way
+ * through the explanation, later lookups follow the new file.  The
+ * walk only stays on the directories it started with once it is
+ * LOOKUP_FD_DEPTH directories deep.
+ */
+#define LOOKUP_FD_DEPTH 3
+
+
+/**
+  * The lookup_open function is used to open a directory, so that it
+  * may be used as the lookup directory for the next component.
+  *
+  * @param dirfd
+  *     The directory to look up the name in, or AT_FDCWD.
+  * @param name
+  *     The name of the directory to open.
+  * @returns
+  *     a file descriptor on success, or -1 if the pathname must be used
+  *     instead.
+  */
+static int
+lookup_open(int dirfd, const char *name)
+{
+#ifdef LOOKUP_FD
+    int             flags;
+
+#ifdef O_PATH
+    /* no read permission required, and no side effects */
+    flags = O_PATH;
+#else
+    flags = O_RDONLY;
+#endif
+#ifdef O_DIRECTORY
+    flags |= O_DIRECTORY;
+#endif
+#ifdef O_NOFOLLOW
+    flags |= O_NOFOLLOW;
+#endif
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    return openat(dirfd, name, flags);
+#else
+    (void)dirfd;
+    (void)name;
+    return -1;
+#endif
+}
+
+
+/**
+  * The lookup_descend function is used to replace the lookup directory
+  * file descriptor with one for the named subdirectory of it.
+  *
+  * @param dirfd
+  *     The current lookup directory, or -1 if the pathname is being used.
+  * @param name
+  *     The name of the subdirectory.
+  * @param path
+  *     The pathname of the subdirectory.
+  * @param depth
+  *     The number of directories walked so far, including this one.
+  * @returns
+  *     the new lookup directory, or -1 if the pathname must be used.
+  */
+static int
+lookup_descend(int dirfd, const char *name, const char *path, int depth)
+{
+    int             fd;
+
+    if (dirfd < 0)
+    {
+        if (depth < LOOKUP_FD_DEPTH)
+            return -1;
+        return lookup_open(AT_FDCWD, path);
+    }
+    fd = lookup_open(dirfd, name);
+    close(dirfd);
+    return fd;
+}
+
+
+static long
+lookup_pathconf(int dirfd, const char *path, int name)
+{
+    if (dirfd >= 0)
+    {
+        long            result;
+
+        result = fpathconf(dirfd, name);
+        if (result >= 0)
+            return result;
+    }
+    return pathconf(path, name);
+}
+
+
 static int
 is_ok_pathname_caption(const char *caption)
 {
@@ -959,6 +1106,8 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
     const char      *pp;
     char            lookup_directory[PATH_MAX + 1];
     explain_string_buffer_t lookup_directory_buf;
+    int             lookup_fd;
+    int             lookup_depth;
     char            **symlinks_so_far;
     int             symloop_max;
     long            path_max;
@@ -1110,6 +1259,8 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
     );
     while (*pp == '/')
         ++pp;
+    lookup_fd = -1;
+    lookup_depth = 0;
 
     /*
      * Walk along the path
@@ -1128,13 +1279,24 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
         /*
          * Check that the lookup directory will play ball.
          */
-        if (lstat(lookup_directory, &lookup_directory_st) != 0)
+        if
+        (
+            explain_memo_lstat_relative
+            (
+                lookup_fd,
+                ".",
+                lookup_directory,
+                &lookup_directory_st
+            )
+        )
         {
             int lookup_directory_st_errnum = errno;
             if (lookup_directory_st_errnum != ENOENT)
                 goto return_minus_1;
             directory_does_not_exist(sb, caption, lookup_directory);
             return_0:
+            if (lookup_fd >= 0)
+                close(lookup_fd);
             if (symlinks_so_far)
             {
                 int             j;
@@ -1246,10 +1408,12 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
              * they are on does not silently truncate over-long path
              * components.
              */
-            no_trunc = pathconf(lookup_directory, _PC_NO_TRUNC);
+            no_trunc =
+                lookup_pathconf(lookup_fd, lookup_directory, _PC_NO_TRUNC);
             silent_truncate = (no_trunc == 0);
 
-            name_max = pathconf(lookup_directory, _PC_NAME_MAX);
+            name_max =
+                lookup_pathconf(lookup_fd, lookup_directory, _PC_NAME_MAX);
             if (name_max <= 0)
                 name_max = NAME_MAX;
             if (!silent_truncate && component_buf.position > (size_t)name_max)
@@ -1274,7 +1438,8 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
             /*
              * Silently truncate over-long path components.
              */
-            long name_max = pathconf(lookup_directory, _PC_NAME_MAX);
+            long name_max =
+                lookup_pathconf(lookup_fd, lookup_directory, _PC_NAME_MAX);
             if (name_max <= 0)
                 name_max = NAME_MAX;
             if (component_buf.position > (size_t)name_max)
@@ -1296,7 +1461,18 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
         explain_string_buffer_puts(&intermediate_path_buf, lookup_directory);
         explain_string_buffer_path_join(&intermediate_path_buf, component);
 
-        if (lstat(intermediate_path, &intermediate_path_st) < 0)
+        if
+        (
+            explain_memo_lstat_relative
+            (
+                lookup_fd,
+                component,
+                intermediate_path,
+                &intermediate_path_st
+            )
+        <
+            0
+        )
         {
             int             intermediate_path_st_errnum;
 
@@ -1499,7 +1675,15 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
              * Follow the symbolic link, that way we can give the actual
              * path in our error messages.
              */
-            n = readlink(intermediate_path, rlb, sizeof(rlb) - 1);
+            n =
+                explain_memo_readlink_relative
+                (
+                    lookup_fd,
+                    component,
+                    intermediate_path,
+                    rlb,
+                    sizeof(rlb) - 1
+                );
             if (n >= 0)
             {
                 char            new_pathname[PATH_MAX + 1];
@@ -1576,7 +1760,15 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
                 }
                 if
                 (
-                    lstat(intermediate_path, &intermediate_path_st) < 0
+                    explain_memo_lstat_relative
+                    (
+                        (rlb[0] == '/' ? -1 : lookup_fd),
+                        rlb,
+                        intermediate_path,
+                        &intermediate_path_st
+                    )
+                <
+                    0
                 &&
                     errno == ENOENT
                 )
@@ -1598,6 +1790,10 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
                 {
                     explain_string_buffer_rewind(&lookup_directory_buf);
                     explain_string_buffer_putc(&lookup_directory_buf, '/');
+                    if (lookup_fd >= 0)
+                        close(lookup_fd);
+                    lookup_fd = -1;
+                    lookup_depth = 0;
                 }
                 ++number_of_symlinks_followed;
                 if (number_of_symlinks_followed >= symloop_max)
@@ -1655,7 +1851,7 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
                     lookup_directory,
                     lookup_directory_st.st_mode
                 );
-                return 0;
+                goto return_0;
             }
 
             explain_string_buffer_copy
@@ -1663,6 +1859,15 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
                 &lookup_directory_buf,
                 &intermediate_path_buf
             );
+            ++lookup_depth;
+            lookup_fd =
+                lookup_descend
+                (
+                    lookup_fd,
+                    component,
+                    lookup_directory,
+                    lookup_depth
+                );
             continue;
         }
 
@@ -1975,6 +2180,8 @@ explain_buffer_errno_path_resolution(explain_string_buffer_t *sb,
          * did not find one.
          */
         return_minus_1:
+        if (lookup_fd >= 0)
+            close(lookup_fd);
         if (symlinks_so_far)
         {
             int             k;
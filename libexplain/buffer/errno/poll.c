@@ -65,12 +65,24 @@ explain_buffer_errno_poll_explanation(explain_string_buffer_t *sb, int errnum,
     /*
      * http://www.opengroup.org/onlinepubs/009695399/functions/poll.html
      */
-    (void)data;
     (void)timeout;
     switch (errnum)
     {
     case EFAULT:
-        explain_buffer_efault(sb, "data");
+        {
+            int             j;
+
+            j = explain_is_efault_array(data, data_size, sizeof(*data));
+            if (j > 0)
+            {
+                char            buffer[60];
+
+                snprintf(buffer, sizeof(buffer), "data[%d]", j);
+                explain_buffer_efault(sb, buffer);
+            }
+            else
+                explain_buffer_efault(sb, "data");
+        }
         break;
 
     case EINTR:
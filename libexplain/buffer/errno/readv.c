@@ -73,17 +73,13 @@ explain_buffer_errno_readv_explanation(explain_string_buffer_t *sb, int errnum,
             explain_buffer_efault(sb, "data");
             return;
         }
-        for (j = 0; j < data_size; ++j)
+        j = explain_is_efault_iovec(data, data_size, 0);
+        if (j >= 0)
         {
-            const struct iovec *p = data + j;
-            if (explain_is_efault_pointer(p->iov_base, p->iov_len))
-            {
-                char            buffer[60];
+            char            buffer[60];
 
-                snprintf(buffer, sizeof(buffer), "data[%d].iov_base", j);
-                explain_buffer_efault(sb, buffer);
-                return;
-            }
+            snprintf(buffer, sizeof(buffer), "data[%d].iov_base", j);
+            explain_buffer_efault(sb, buffer);
         }
         return;
 
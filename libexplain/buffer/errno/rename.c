@@ -47,6 +47,7 @@
 #include <libexplain/dirname.h>
 #include <libexplain/explanation.h>
 #include <libexplain/have_permission.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 #include <libexplain/is_efault.h>
 #include <libexplain/pathname_is_a_directory.h>
@@ -58,7 +59,7 @@ get_mode(const char *pathname)
 {
     struct stat     st;
 
-    if (stat(pathname, &st) < 0)
+    if (explain_memo_stat(pathname, &st) < 0)
         return S_IFREG;
     return st.st_mode;
 }
@@ -170,7 +171,7 @@ explain_buffer_errno_rename_explanation(explain_string_buffer_t *sb,
              */
             if
             (
-                stat(oldpath, &oldpath_st) >= 0
+                explain_memo_stat(oldpath, &oldpath_st) >= 0
             &&
                 S_ISDIR(oldpath_st.st_mode)
             &&
@@ -309,7 +310,7 @@ explain_buffer_errno_rename_explanation(explain_string_buffer_t *sb,
         {
             struct stat     oldpath_st;
 
-            if (lstat(oldpath, &oldpath_st) >= 0)
+            if (explain_memo_lstat(oldpath, &oldpath_st) >= 0)
             {
                 dir_vs_not_dir(sb, "newpath", "oldpath", &oldpath_st);
             }
@@ -378,7 +379,7 @@ explain_buffer_errno_rename_explanation(explain_string_buffer_t *sb,
 
             if
             (
-                stat(newpath, &newpath_st) >= 0
+                explain_memo_stat(newpath, &newpath_st) >= 0
             &&
                 !S_ISDIR(newpath_st.st_mode)
             )
@@ -421,8 +422,22 @@ explain_buffer_errno_rename_explanation(explain_string_buffer_t *sb,
                 "newpath"
             );
 
-            count = explain_count_directory_entries(newpath);
-            if (count > 0)
+            count =
+                explain_count_directory_entries_at_least
+                (
+                    newpath,
+                    EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT + 1
+                );
+            if (count > EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT)
+            {
+                explain_string_buffer_printf
+                (
+                    sb,
+                    " (%d+)",
+                    EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT
+                );
+            }
+            else if (count > 0)
                 explain_string_buffer_printf(sb, " (%d)", count);
         }
         break;
@@ -234,8 +234,22 @@ explain_buffer_errno_rmdir_explanation(explain_string_buffer_t *sb,
                 i18n("pathname is not an empty directory; that is, it "
                 "contains entries other than \".\" and \"..\"")
             );
-            count = explain_count_directory_entries(pathname);
-            if (count > 0)
+            count =
+                explain_count_directory_entries_at_least
+                (
+                    pathname,
+                    EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT + 1
+                );
+            if (count > EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT)
+            {
+                explain_string_buffer_printf
+                (
+                    sb,
+                    " (%d+)",
+                    EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT
+                );
+            }
+            else if (count > 0)
                 explain_string_buffer_printf(sb, " (%d)", count);
         }
         break;
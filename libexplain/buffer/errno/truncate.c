@@ -39,6 +39,7 @@
 #include <libexplain/buffer/off_t.h>
 #include <libexplain/buffer/pathname.h>
 #include <libexplain/explanation.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 
 
@@ -94,7 +95,7 @@ explain_buffer_errno_truncate_explanation(explain_string_buffer_t *sb,
             struct stat     st;
 
             /* FIXME: explain_buffer_wrong_file_type */
-            if (stat(pathname, &st) >= 0 && !S_ISREG(st.st_mode))
+            if (explain_memo_stat(pathname, &st) >= 0 && !S_ISREG(st.st_mode))
             {
                 explain_string_buffer_puts(sb, "pathname is a ");
                 explain_buffer_file_type_st(sb, &st);
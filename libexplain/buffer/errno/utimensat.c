@@ -30,8 +30,8 @@
 #include <libexplain/buffer/eperm.h>
 #include <libexplain/buffer/erofs.h>
 #include <libexplain/buffer/errno/futimens.h>
+#include <libexplain/buffer/errno/generic.h>
 #include <libexplain/buffer/errno/path_resolution.h>
-#include <libexplain/buffer/errno/utimens.h>
 #include <libexplain/buffer/errno/utimensat.h>
 #include <libexplain/buffer/esrch.h>
 #include <libexplain/buffer/fildes.h>
@@ -342,8 +342,7 @@ explain_buffer_errno_utimensat_explanation(explain_string_buffer_t *sb,
         break;
     }
 
-    explain_buffer_errno_utimens_explanation(sb, errnum, syscall_name,
-        pathname, data);
+    explain_buffer_errno_generic(sb, errnum, syscall_name);
 }
 
 
@@ -16,36 +16,158 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <libexplain/ac/string.h>
+
 #include <libexplain/buffer/fd_set.h>
 #include <libexplain/buffer/fildes_to_pathname.h>
 #include <libexplain/buffer/pointer.h>
+#include <libexplain/fileinfo.h>
 #include <libexplain/is_efault.h>
 
 
+#define WORD_BITS (sizeof(unsigned long) * 8)
+
+
+static int
+bit_number(unsigned long word)
+{
+#if __GNUC__ >= 4 || defined(__clang__)
+    return __builtin_ctzl(word);
+#else
+    int             n;
+
+    n = 0;
+    while (!(word & 1))
+    {
+        word >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+
+/*
+ * The fd_set layout is not specified by POSIX, but it is almost
+ * always an array of words, with file descriptor n at bit (n % bits)
+ * of word (n / bits).  Check once, rather than assume it.
+ */
+
+static int
+layout_is_words(void)
+{
+    static int      result = -1;
+
+    if (result < 0)
+    {
+        fd_set          fds;
+        unsigned long   word;
+        int             probe[3];
+        int             j;
+
+        probe[0] = 0;
+        probe[1] = WORD_BITS - 1;
+        probe[2] = WORD_BITS + 3;
+        result =
+            (
+                sizeof(fd_set) % sizeof(unsigned long) == 0
+            &&
+                probe[2] < FD_SETSIZE
+            );
+        for (j = 0; result && j < 3; ++j)
+        {
+            int             n;
+
+            FD_ZERO(&fds);
+            FD_SET(probe[j], &fds);
+            n = probe[j] / WORD_BITS;
+            memcpy(&word, (const char *)&fds + n * sizeof(word), sizeof(word));
+            if (word != 1uL << (probe[j] % WORD_BITS))
+                result = 0;
+        }
+    }
+    return result;
+}
+
+
 void
 explain_buffer_fd_set(explain_string_buffer_t *sb, int nfds,
     const fd_set *fds)
 {
     int             fildes;
-    int             first;
+    int             member[FD_SETSIZE];
+    int             nmembers;
+    int             have_names;
+    int             j;
 
     if (explain_is_efault_pointer(fds, sizeof(*fds)))
     {
         explain_buffer_pointer(sb, fds);
         return;
     }
-    first = 1;
-    for (fildes = 0; fildes < nfds; ++fildes)
+    if (nfds > FD_SETSIZE)
+        nfds = FD_SETSIZE;
+    nmembers = 0;
+    if (layout_is_words())
     {
-        if (FD_ISSET(fildes, fds))
+        int             base;
+
+        /*
+         * Look at the set a word at a time, so that the (usually
+         * many) empty words are skipped quickly.
+         */
+        for (base = 0; base < nfds; base += WORD_BITS)
         {
-            explain_string_buffer_putc(sb, (first ? '{' : ','));
-            explain_string_buffer_printf(sb, " %d", fildes);
-            explain_buffer_fildes_to_pathname(sb, fildes);
-            first = 0;
+            unsigned long   word;
+
+            memcpy
+            (
+                &word,
+                (const char *)fds + base / WORD_BITS * sizeof(word),
+                sizeof(word)
+            );
+            if (nfds - base < (int)WORD_BITS)
+                word &= (1uL << (nfds - base)) - 1;
+            while (word)
+            {
+                member[nmembers++] = base + bit_number(word);
+                word &= word - 1;
+            }
         }
     }
-    explain_string_buffer_puts(sb, (first ? "{}" : " }"));
+    else
+    {
+        for (fildes = 0; fildes < nfds; ++fildes)
+        {
+            if (FD_ISSET(fildes, fds))
+                member[nmembers++] = fildes;
+        }
+    }
+    if (nmembers == 0)
+    {
+        explain_string_buffer_puts(sb, "{}");
+        return;
+    }
+
+    have_names = (explain_fileinfo_self_fd_names_begin() == 0);
+    if (have_names)
+    {
+        for (j = 0; j < nmembers; ++j)
+            explain_fileinfo_self_fd_names_want(member[j]);
+        explain_fileinfo_self_fd_names_resolve();
+    }
+    for (j = 0; j < nmembers; ++j)
+    {
+        explain_string_buffer_putc(sb, (j ? ',' : '{'));
+        explain_string_buffer_printf(sb, " %d", member[j]);
+        if (have_names)
+            explain_buffer_fildes_to_pathname_table(sb, member[j]);
+        else
+            explain_buffer_fildes_to_pathname(sb, member[j]);
+    }
+    if (have_names)
+        explain_fileinfo_self_fd_names_end();
+    explain_string_buffer_puts(sb, " }");
 }
 
 
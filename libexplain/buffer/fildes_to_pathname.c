@@ -91,4 +91,28 @@ explain_buffer_fildes_to_pathname(explain_string_buffer_t *sb, int fildes)
 }
 
 
+void
+explain_buffer_fildes_to_pathname_table(explain_string_buffer_t *sb,
+    int fildes)
+{
+    const char      *name;
+    int             is_socket;
+
+    name = explain_fileinfo_self_fd_names_lookup(fildes, &is_socket);
+    if (!name)
+        return;
+    if (is_socket)
+    {
+        if (explain_buffer_fildes_to_sockaddr(sb, fildes))
+            explain_buffer_fildes_to_path(sb, fildes);
+        return;
+    }
+    if (*name)
+    {
+        explain_string_buffer_putc(sb, ' ');
+        explain_string_buffer_puts_quoted(sb, name);
+    }
+}
+
+
 /* vim: set ts=8 sw=4 et : */
@@ -35,5 +35,20 @@ struct explain_string_buffer_t; /* forward */
 void explain_buffer_fildes_to_pathname(struct explain_string_buffer_t *sb,
     int fildes);
 
+/**
+  * The explain_buffer_fildes_to_pathname_table function is used in
+  * the same way as #explain_buffer_fildes_to_pathname, except that the
+  * name is taken from the table obtained by
+  * #explain_fileinfo_self_fd_names_begin, which saves several system
+  * calls per file descriptor.
+  *
+  * @param sb
+  *    The string buffer to place the pathname.
+  * @param fildes
+  *    The file descriptor to decipher
+  */
+void explain_buffer_fildes_to_pathname_table(
+    struct explain_string_buffer_t *sb, int fildes);
+
 #endif /* LIBEXPLAIN_BUFFER_FILDES_TO_PATHNAME_H */
 /* vim: set ts=8 sw=4 et : */
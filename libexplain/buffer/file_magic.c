@@ -0,0 +1,358 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/stat.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/buffer/file_magic.h>
+#include <libexplain/sizeof.h>
+
+/*
+ * The ELF constants are spelled out here, rather than taken from
+ * <elf.h>, because the point is to describe executables for other
+ * systems and architectures, whose constants the local <elf.h> may
+ * not have (or the system may not have an <elf.h> at all).
+ */
+#define EI_CLASS        4
+#define EI_DATA         5
+#define EI_VERSION      6
+#define EI_OSABI        7
+#define ELFCLASS32      1
+#define ELFCLASS64      2
+#define ELFDATA2LSB     1
+#define ELFDATA2MSB     2
+
+typedef struct table_t table_t;
+struct table_t
+{
+    int             value;
+    const char      *name;
+};
+
+static const table_t elf_type[] =
+{
+    { 1, "relocatable" },
+    { 2, "executable" },
+    { 3, "shared object" },
+    { 4, "core file" },
+};
+
+static const table_t elf_machine[] =
+{
+    { 2, "SPARC" },
+    { 3, "Intel 80386" },
+    { 4, "Motorola m68k" },
+    { 8, "MIPS" },
+    { 15, "PA-RISC" },
+    { 18, "SPARC32PLUS" },
+    { 20, "PowerPC" },
+    { 21, "64-bit PowerPC" },
+    { 22, "IBM S/390" },
+    { 40, "ARM" },
+    { 42, "Renesas SH" },
+    { 43, "SPARC V9" },
+    { 50, "IA-64" },
+    { 62, "x86-64" },
+    { 183, "ARM aarch64" },
+    { 243, "RISC-V" },
+    { 258, "LoongArch" },
+    { 0x9026, "Alpha" },
+};
+
+static const table_t elf_osabi[] =
+{
+    { 0, "SYSV" },
+    { 1, "HP-UX" },
+    { 2, "NetBSD" },
+    { 3, "GNU/Linux" },
+    { 6, "Solaris" },
+    { 7, "AIX" },
+    { 8, "IRIX" },
+    { 9, "FreeBSD" },
+    { 12, "OpenBSD" },
+    { 97, "ARM" },
+    { 255, "embedded" },
+};
+
+
+static const char *
+lookup(const table_t *table, size_t table_size, int value)
+{
+    size_t          j;
+
+    for (j = 0; j < table_size; ++j)
+        if (table[j].value == value)
+            return table[j].name;
+    return 0;
+}
+
+
+static unsigned
+get16(const unsigned char *p, int msb)
+{
+    return (msb ? (p[0] << 8) | p[1] : (p[1] << 8) | p[0]);
+}
+
+
+static unsigned long
+get32(const unsigned char *p, int msb)
+{
+    return
+        (
+            msb
+        ?
+            ((unsigned long)get16(p, 1) << 16) | get16(p + 2, 1)
+        :
+            ((unsigned long)get16(p + 2, 0) << 16) | get16(p, 0)
+        );
+}
+
+
+static int
+elf(explain_string_buffer_t *sb, const unsigned char *data, size_t size)
+{
+    int             msb;
+    int             n;
+    const char      *name;
+
+    if (size < 24 || memcmp(data, "\177ELF", 4))
+        return -1;
+    switch (data[EI_CLASS])
+    {
+    case ELFCLASS32:
+        explain_string_buffer_puts(sb, "ELF 32-bit");
+        break;
+
+    case ELFCLASS64:
+        explain_string_buffer_puts(sb, "ELF 64-bit");
+        break;
+
+    default:
+        explain_string_buffer_printf(sb, "ELF class %d", data[EI_CLASS]);
+        break;
+    }
+    switch (data[EI_DATA])
+    {
+    case ELFDATA2LSB:
+        msb = 0;
+        explain_string_buffer_puts(sb, " LSB");
+        break;
+
+    case ELFDATA2MSB:
+        msb = 1;
+        explain_string_buffer_puts(sb, " MSB");
+        break;
+
+    default:
+        /* without a byte order, nothing else can be decoded */
+        explain_string_buffer_puts(sb, " invalid byte order");
+        return 0;
+    }
+
+    n = get16(data + 16, msb);
+    name = lookup(elf_type, SIZEOF(elf_type), n);
+    if (name)
+        explain_string_buffer_printf(sb, " %s", name);
+    else
+        explain_string_buffer_printf(sb, " type %d", n);
+
+    n = get16(data + 18, msb);
+    name = lookup(elf_machine, SIZEOF(elf_machine), n);
+    if (name)
+        explain_string_buffer_printf(sb, ", %s", name);
+    else
+        explain_string_buffer_printf(sb, ", machine %d", n);
+
+    explain_string_buffer_printf
+    (
+        sb,
+        ", version %lu",
+        get32(data + 20, msb)
+    );
+    name = lookup(elf_osabi, SIZEOF(elf_osabi), data[EI_OSABI]);
+    if (name)
+        explain_string_buffer_printf(sb, " (%s)", name);
+    else
+        explain_string_buffer_printf(sb, " (OS ABI %d)", data[EI_OSABI]);
+    return 0;
+}
+
+
+static int
+script(explain_string_buffer_t *sb, const unsigned char *data, size_t size)
+{
+    size_t          j;
+    size_t          start;
+
+    if (size < 2 || data[0] != '#' || data[1] != '!')
+        return -1;
+    for (j = 2; j < size && (data[j] == ' ' || data[j] == '\t'); ++j)
+        ;
+    start = j;
+    while (j < size && !isspace(data[j]))
+        ++j;
+    if (j == start)
+    {
+        explain_string_buffer_puts(sb, "script, with no interpreter");
+        return 0;
+    }
+    if (j >= size)
+    {
+        /*
+         * The kernel only looks at the first line, up to a limit
+         * (127 bytes on Linux), so an interpreter name running off the
+         * end of what we read is as good as broken.
+         */
+        explain_string_buffer_puts(sb, "script, interpreter name too long");
+        return 0;
+    }
+    explain_string_buffer_puts(sb, "script, interpreter ");
+    explain_string_buffer_puts_quoted_n
+    (
+        sb,
+        (const char *)data + start,
+        j - start
+    );
+    if (data[j] == '\r')
+    {
+        /* a very common cause of ENOENT */
+        explain_string_buffer_puts(sb, ", with CRLF line terminators");
+    }
+    return 0;
+}
+
+
+typedef struct magic_t magic_t;
+struct magic_t
+{
+    size_t          offset;
+    const char      *bytes;
+    size_t          length;
+    const char      *description;
+};
+
+static const magic_t magic[] =
+{
+    { 0, "!<arch>\n", 8, "current ar archive" },
+    { 0, "\037\213", 2, "gzip compressed data" },
+    { 0, "BZh", 3, "bzip2 compressed data" },
+    { 0, "\375" "7zXZ\0", 6, "XZ compressed data" },
+    { 0, "\050\265\057\375", 4, "Zstandard compressed data" },
+    { 0, "PK\003\004", 4, "Zip archive data" },
+    { 0, "%PDF-", 5, "PDF document" },
+    { 0, "MZ", 2, "MS-DOS or PE32 executable" },
+    { 0, "\317\372\355\376", 4, "Mach-O 64-bit executable" },
+    { 0, "\316\372\355\376", 4, "Mach-O 32-bit executable" },
+    { 0, "\312\376\272\276", 4, "Mach-O universal binary or Java class" },
+    { 0, "\0asm", 4, "WebAssembly binary module" },
+    { 257, "ustar", 5, "POSIX tar archive" },
+};
+
+
+static int
+text(explain_string_buffer_t *sb, const unsigned char *data, size_t size)
+{
+    size_t          j;
+
+    for (j = 0; j < size; ++j)
+    {
+        unsigned char   c;
+
+        c = data[j];
+        if (c < 0x20 && c != '\t' && c != '\n' && c != '\r' && c != '\f')
+            return -1;
+        if (c == 0x7F)
+            return -1;
+    }
+    explain_string_buffer_puts(sb, "text, with no \"#!\" line");
+    return 0;
+}
+
+
+int
+explain_buffer_file_magic(explain_string_buffer_t *sb, const char *pathname)
+{
+    int             fd;
+    int             flags;
+    struct stat     st;
+    unsigned char   data[512];
+    ssize_t         n;
+    size_t          j;
+
+    /*
+     * The pathname could be anything: a FIFO would block the open, and
+     * a terminal could become the controlling terminal.  Only regular
+     * files are read.
+     */
+    flags = O_RDONLY | O_NONBLOCK | O_NOCTTY;
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    fd = open(pathname, flags);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+    {
+        close(fd);
+        return -1;
+    }
+    for (;;)
+    {
+        n = read(fd, data, sizeof(data));
+        if (n >= 0 || errno != EINTR)
+            break;
+    }
+    close(fd);
+    if (n < 0)
+        return -1;
+    if (n == 0)
+    {
+        explain_string_buffer_puts(sb, "empty");
+        return 0;
+    }
+
+    if (elf(sb, data, n) == 0)
+        return 0;
+    if (script(sb, data, n) == 0)
+        return 0;
+    for (j = 0; j < SIZEOF(magic); ++j)
+    {
+        const magic_t   *mp;
+
+        mp = &magic[j];
+        if
+        (
+            mp->offset + mp->length <= (size_t)n
+        &&
+            0 == memcmp(data + mp->offset, mp->bytes, mp->length)
+        )
+        {
+            explain_string_buffer_puts(sb, mp->description);
+            return 0;
+        }
+    }
+    return text(sb, data, n);
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,44 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_BUFFER_FILE_MAGIC_H
+#define LIBEXPLAIN_BUFFER_FILE_MAGIC_H
+
+#include <libexplain/string_buffer.h>
+
+/**
+  * The explain_buffer_file_magic function may be used to describe
+  * the format of a file, by looking at its first few hundred bytes, in
+  * the manner of file(1), but without running it.  It knows about ELF
+  * executables (class, byte order, type, machine and OS ABI), "#!"
+  * scripts, and the common archive and compression formats.
+  *
+  * @param sb
+  *     The string buffer to print into.
+  * @param pathname
+  *     The file of interest.
+  * @returns
+  *     int; 0 on success (description printed), or -1 if the format
+  *     is not known, or the file could not be read (nothing printed).
+  */
+int explain_buffer_file_magic(explain_string_buffer_t *sb,
+    const char *pathname);
+
+#endif /* LIBEXPLAIN_BUFFER_FILE_MAGIC_H */
+/* vim: set ts=8 sw=4 et : */
@@ -28,6 +28,7 @@
 
 #include <libexplain/buffer/file_type.h>
 #include <libexplain/buffer/gettext.h>
+#include <libexplain/memo.h>
 #include <libexplain/option.h>
 
 
@@ -374,7 +375,7 @@ usb_in_dev_symlink(const char *kind, dev_t st_rdev)
         (int)major(st_rdev),
         (int)minor(st_rdev)
     );
-    n = readlink(path, slink, sizeof(slink) - 1);
+    n = explain_memo_readlink(path, slink, sizeof(slink) - 1);
     if (n <= 0)
         return 0;
     slink[n] = '\0';
@@ -28,7 +28,7 @@
 void
 explain_buffer_modem_flags(explain_string_buffer_t *sb, int value)
 {
-    explain_parse_bits_table_t table[] =
+    static const explain_parse_bits_table_t table[] =
     {
         { "TIOCM_LE", TIOCM_LE },
         { "TIOCM_DTR", TIOCM_DTR },
@@ -26,10 +26,12 @@
 
 #include <libexplain/buffer/mount_point.h>
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
+#include <libexplain/statistics/probe.h>
 
 
-int
-explain_buffer_mount_point_dev(explain_string_buffer_t *sb, dev_t dev)
+static int
+mount_point_dev(explain_string_buffer_t *sb, dev_t dev)
 {
     FILE            *fp;
 
@@ -55,7 +57,7 @@ explain_buffer_mount_point_dev(explain_string_buffer_t *sb, dev_t dev)
             break;
         dir = mnt->mnt_dir;
 #endif
-        if (lstat(dir, &st2) == 0)
+        if (explain_memo_lstat(dir, &st2) == 0)
         {
             if (dev == st2.st_dev)
             {
@@ -104,6 +106,19 @@ explain_buffer_mount_point_dev(explain_string_buffer_t *sb, dev_t dev)
 }
 
 
+int
+explain_buffer_mount_point_dev(explain_string_buffer_t *sb, dev_t dev)
+{
+    explain_probe_timer_t timer;
+    int             result;
+
+    explain_probe_begin(&timer, explain_probe_mount);
+    result = mount_point_dev(sb, dev);
+    explain_probe_end(&timer);
+    return result;
+}
+
+
 int
 explain_buffer_mount_point_stat(explain_string_buffer_t *sb,
     const struct stat *st1)
@@ -128,7 +143,7 @@ explain_buffer_mount_point(explain_string_buffer_t *sb, const char *path)
 {
     struct stat     st;
 
-    if (stat(path, &st) < 0)
+    if (explain_memo_stat(path, &st) < 0)
         return -1;
     return explain_buffer_mount_point_stat(sb, &st);
 }
@@ -146,7 +161,7 @@ explain_buffer_mount_point_dirname(explain_string_buffer_t *sb,
 
 
 static int
-explain_mount_point_dev_option(int st_dev, const char *option)
+mount_point_dev_option(int st_dev, const char *option)
 {
     FILE            *fp;
 
@@ -174,7 +189,7 @@ explain_mount_point_dev_option(int st_dev, const char *option)
             break;
         dir = mnt->mnt_dir;
 #endif
-        if (stat(dir, &st2) == 0)
+        if (explain_memo_stat(dir, &st2) == 0)
         {
             if (st_dev == (int)st2.st_dev)
             {
@@ -202,6 +217,19 @@ explain_mount_point_dev_option(int st_dev, const char *option)
 }
 
 
+static int
+explain_mount_point_dev_option(int st_dev, const char *option)
+{
+    explain_probe_timer_t timer;
+    int             result;
+
+    explain_probe_begin(&timer, explain_probe_mount);
+    result = mount_point_dev_option(st_dev, option);
+    explain_probe_end(&timer);
+    return result;
+}
+
+
 static int
 explain_mount_point_stat_option(const struct stat *st, const char *option)
 {
@@ -214,7 +242,7 @@ explain_mount_point_option(const char *pathname, const char *option)
 {
     struct stat     st;
 
-    if (stat(pathname, &st) < 0)
+    if (explain_memo_stat(pathname, &st) < 0)
         return 0;
     return explain_mount_point_stat_option(&st, option);
 }
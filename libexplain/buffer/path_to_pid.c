@@ -28,6 +28,7 @@
 #include <libexplain/buffer/path_to_pid.h>
 #include <libexplain/is_same_inode.h>
 #include <libexplain/lsof.h>
+#include <libexplain/statistics/probe.h>
 #include <libexplain/string_buffer.h>
 
 
@@ -186,11 +187,16 @@ stat_to_pid(explain_string_buffer_t *sb, const struct stat *st)
 #ifdef TRY_PROC_FIRST
     int             count;
     DIR             *dp;
+    explain_probe_timer_t timer;
 
     count = 0;
+    explain_probe_begin(&timer, explain_probe_proc);
     dp = opendir("/proc");
     if (!dp)
+    {
+        explain_probe_end(&timer);
         return -1;
+    }
     for (;;)
     {
         struct dirent *dep;
@@ -215,6 +221,7 @@ stat_to_pid(explain_string_buffer_t *sb, const struct stat *st)
         }
     }
     closedir(dp);
+    explain_probe_end(&timer);
     if (count > 0)
         explain_string_buffer_putc(sb, ')');
     return count;
@@ -264,13 +271,18 @@ explain_buffer_path_users(explain_string_buffer_t *sb, const char *path,
     int             count;
     struct stat     st;
     DIR             *dp;
+    explain_probe_timer_t timer;
 
     if (lstat(path, &st) < 0)
         return -1;
     count = 0;
+    explain_probe_begin(&timer, explain_probe_proc);
     dp = opendir("/proc");
     if (!dp)
+    {
+        explain_probe_end(&timer);
         return -1;
+    }
     for (;;)
     {
         struct dirent *dep;
@@ -300,6 +312,7 @@ explain_buffer_path_users(explain_string_buffer_t *sb, const char *path,
         }
     }
     closedir(dp);
+    explain_probe_end(&timer);
     if (count > 0)
         explain_string_buffer_putc(sb, ')');
     return count;
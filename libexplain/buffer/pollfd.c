@@ -19,8 +19,10 @@
 #include <libexplain/ac/poll.h>
 
 #include <libexplain/buffer/fildes.h>
+#include <libexplain/buffer/fildes_to_pathname.h>
 #include <libexplain/buffer/pollfd.h>
 #include <libexplain/buffer/pointer.h>
+#include <libexplain/fileinfo.h>
 #include <libexplain/parse_bits.h>
 #include <libexplain/is_efault.h>
 
@@ -74,19 +76,20 @@ explain_buffer_pollfd_events(explain_string_buffer_t *sb, int value)
 }
 
 
-void
-explain_buffer_pollfd(explain_string_buffer_t *sb,
-    const struct pollfd *data, int include_revents)
-{
 #ifdef HAVE_POLL_H
-    if (explain_is_efault_pointer(data, sizeof(*data)))
-    {
-        explain_buffer_pointer(sb, data);
-        return;
-    }
 
+static void
+print_pollfd(explain_string_buffer_t *sb, const struct pollfd *data,
+    int include_revents, int have_names)
+{
     explain_string_buffer_puts(sb, "{ fd = ");
-    explain_buffer_fildes(sb, data->fd);
+    if (have_names && data->fd >= 0)
+    {
+        explain_string_buffer_printf(sb, "%d", data->fd);
+        explain_buffer_fildes_to_pathname_table(sb, data->fd);
+    }
+    else
+        explain_buffer_fildes(sb, data->fd);
     explain_string_buffer_puts(sb, ", events = ");
     explain_buffer_pollfd_events(sb, data->events);
     if (include_revents)
@@ -95,6 +98,22 @@ explain_buffer_pollfd(explain_string_buffer_t *sb,
         explain_buffer_pollfd_events(sb, data->revents);
     }
     explain_string_buffer_puts(sb, " }");
+}
+
+#endif
+
+
+void
+explain_buffer_pollfd(explain_string_buffer_t *sb,
+    const struct pollfd *data, int include_revents)
+{
+#ifdef HAVE_POLL_H
+    if (explain_is_efault_pointer(data, sizeof(*data)))
+    {
+        explain_buffer_pointer(sb, data);
+        return;
+    }
+    print_pollfd(sb, data, include_revents, 0);
 #else
     (void)include_revents;
     explain_buffer_pointer(sb, data);
@@ -108,6 +127,7 @@ explain_buffer_pollfd_array(explain_string_buffer_t *sb,
 {
 #ifdef HAVE_POLL_H
     int             j;
+    int             have_names;
 
     if
     (
@@ -120,15 +140,28 @@ explain_buffer_pollfd_array(explain_string_buffer_t *sb,
         return;
     }
 
+    /*
+     * The array has already been checked, so the elements need not
+     * be checked again, and all of their names come from one table.
+     */
+    have_names = (explain_fileinfo_self_fd_names_begin() == 0);
+    if (have_names)
+    {
+        for (j = 0; j < data_size; ++j)
+            explain_fileinfo_self_fd_names_want(data[j].fd);
+        explain_fileinfo_self_fd_names_resolve();
+    }
     explain_string_buffer_putc(sb, '{');
     for (j = 0; j < data_size; ++j)
     {
         if (j)
             explain_string_buffer_putc(sb, ',');
         explain_string_buffer_putc(sb, ' ');
-        explain_buffer_pollfd(sb, data + j, include_revents);
+        print_pollfd(sb, data + j, include_revents, have_names);
     }
     explain_string_buffer_puts(sb, " }");
+    if (have_names)
+        explain_fileinfo_self_fd_names_end();
 #else
     (void)data_size;
     (void)include_revents;
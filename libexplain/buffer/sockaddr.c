@@ -42,6 +42,7 @@
 #include <libexplain/buffer/address_family.h>
 #include <libexplain/option.h>
 #include <libexplain/is_efault.h>
+#include <libexplain/statistics/probe.h>
 
 
 /*
@@ -75,6 +76,7 @@ explain_buffer_in_addr(explain_string_buffer_t *sb,
     else if (explain_option_dialect_specific())
     {
         struct hostent  *hep;
+        explain_probe_timer_t timer;
 
         /*
          * We make this dialect specific, because different systems will
@@ -83,7 +85,9 @@ explain_buffer_in_addr(explain_string_buffer_t *sb,
          * negatives for automated testing.
          */
         /* FIXME: gethostbyaddr_r if available */
+        explain_probe_begin(&timer, explain_probe_dns);
         hep = gethostbyaddr(addr, sizeof(addr), AF_INET);
+        explain_probe_end(&timer);
         if (hep)
         {
             explain_string_buffer_putc(sb, ' ');
@@ -314,6 +318,7 @@ explain_buffer_sockaddr_af_inet6(explain_string_buffer_t *sb,
     if (explain_option_dialect_specific())
     {
         struct hostent  *hep;
+        explain_probe_timer_t timer;
 
         /*
          * We make this dialect specific, because different systems will
@@ -322,7 +327,9 @@ explain_buffer_sockaddr_af_inet6(explain_string_buffer_t *sb,
          * negatives for automated testing.
          */
         /* FIXME: gethostbyaddr_r if available */
+        explain_probe_begin(&timer, explain_probe_dns);
         hep = gethostbyaddr(&sa->sin6_addr, sizeof(sa->sin6_addr), AF_INET6);
+        explain_probe_end(&timer);
         if (hep)
         {
             explain_string_buffer_putc(sb, ' ');
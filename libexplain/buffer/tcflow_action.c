@@ -46,7 +46,7 @@ explain_buffer_tcflow_action(explain_string_buffer_t *sb, int data)
 int
 explain_parse_tcflow_action_or_die(const char *text, const char *caption)
 {
-    return explain_parse_bits_or_die(text, table, sizeof(table), caption);
+    return explain_parse_bits_or_die(text, table, SIZEOF(table), caption);
 }
 
 #else
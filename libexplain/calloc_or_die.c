@@ -20,7 +20,9 @@
 #include <libexplain/ac/stdlib.h>
 
 #include <libexplain/calloc.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void *
@@ -28,7 +30,9 @@ explain_calloc_or_die(size_t nmemb, size_t size)
 {
     void            *result;
 
+    explain_output_or_die_begin();
     result = explain_calloc_on_error(nmemb, size);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -45,17 +49,22 @@ explain_calloc_on_error(size_t nmemb, size_t size)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = calloc(nmemb, size);
+    explain_explanation_call_end();
     if (!result)
     {
         /* this is deliberately conservative */
         size_t nmemb_avail = (((size_t)-1) / 3 * 2 / size);
         hold_errno = (errno ? errno : (nmemb_avail < nmemb ? EINVAL : ENOMEM));
-        explain_output_error
-        (
-            "%s",
-            explain_errno_calloc(hold_errno, nmemb, size)
-        );
+        if (!explain_output_suppress("calloc", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_calloc(hold_errno, nmemb, size)
+            );
+        }
     }
     errno = hold_errno;
     return result;
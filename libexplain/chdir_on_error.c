@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/chdir.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,13 +29,19 @@ explain_chdir_on_error(const char *pathname)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = chdir(pathname);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_chdir(hold_errno, pathname));
+        if (!explain_output_suppress("chdir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_chdir(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/chdir.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_chdir_or_die(const char *pathname)
 {
+    explain_output_or_die_begin();
     if (explain_chdir_on_error(pathname) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -21,15 +21,18 @@
 
 #include <libexplain/chmod.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_chmod_or_die(const char *pathname, int mode)
 {
+    explain_output_or_die_begin();
     if (explain_chmod_on_error(pathname, mode))
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
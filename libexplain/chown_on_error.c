@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/chown.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,17 +29,22 @@ explain_chown_on_error(const char *pathname, int owner, int group)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = chown(pathname, owner, group);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_chown(hold_errno, pathname, owner, group)
-        );
+        if (!explain_output_suppress("chown", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_chown(hold_errno, pathname, owner, group)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/chown.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_chown_or_die(const char *path, int owner, int group)
 {
+    explain_output_or_die_begin();
     if (explain_chown_on_error(path, owner, group) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -18,15 +18,18 @@
 
 #include <libexplain/chroot.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_chroot_or_die(const char *pathname)
 {
+    explain_output_or_die_begin();
     if (explain_chroot_on_error(pathname) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,397 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/poll.h>
+#include <libexplain/ac/signal.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+#include <libexplain/ac/sys/socket.h>
+#include <libexplain/ac/sys/time.h>
+#include <libexplain/ac/sys/un.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/client.h>
+#include <libexplain/run_command.h>
+#include <libexplain/string_buffer.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/*
+ * The number of milliseconds to wait for a reply.  The daemon may run
+ * a helper command to build the explanation, so it is given that long
+ * and a little more.  After that the caller builds the explanation
+ * itself; it is no worse off than if there were no daemon at all.
+ */
+#define REPLY_TIMEOUT (EXPLAIN_RUN_COMMAND_TIMEOUT + 2000)
+
+/*
+ * The connection to the daemon is kept open between calls, this is
+ * the whole point.
+ *
+ * There is only the one connection, and requests and replies must not
+ * be interleaved on it, so it may only be used by one thread at a
+ * time.  A thread that finds it busy returns -1, and the caller builds
+ * the explanation itself.
+ *
+ * A child process shares the connection's stream with its parent, so a
+ * child (or any process that isn't the one that connected) makes a
+ * connection of its own.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) || \
+    defined(__clang__)
+#define HAVE_CLIENT_LOCK 1
+#endif
+
+static int      connection = -1;
+static pid_t    connection_pid;
+static char     connection_path[PATH_MAX + 1];
+#ifdef HAVE_CLIENT_LOCK
+static int      busy;
+#endif
+
+
+static int
+begin(void)
+{
+#ifdef HAVE_CLIENT_LOCK
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+#endif
+    return 0;
+}
+
+
+static void
+end(void)
+{
+#ifdef HAVE_CLIENT_LOCK
+    __sync_lock_release(&busy);
+#endif
+}
+
+
+static void
+disconnect(void)
+{
+    if (connection >= 0)
+    {
+        close(connection);
+        connection = -1;
+    }
+    connection_path[0] = '\0';
+}
+
+
+/**
+  * The connect_to function is used to make sure there is a connection
+  * to the daemon.
+  *
+  * @returns
+  *     1 if an existing connection is being reused, 0 if a new
+  *     connection was made, -1 if no connection could be made
+  */
+
+static int
+connect_to(const char *socket_path)
+{
+    struct sockaddr_un addr;
+    int             fd;
+
+    if
+    (
+        connection >= 0
+    &&
+        connection_pid == getpid()
+    &&
+        0 == strcmp(connection_path, socket_path)
+    )
+        return 1;
+    disconnect();
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+        return -1;
+#ifdef SOCK_CLOEXEC
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+#else
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+#endif
+    if (fd < 0)
+        return -1;
+#if !defined(SOCK_CLOEXEC) && defined(FD_CLOEXEC)
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    explain_strendcpy
+    (
+        addr.sun_path,
+        socket_path,
+        addr.sun_path + sizeof(addr.sun_path)
+    );
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        close(fd);
+        return -1;
+    }
+    connection = fd;
+    connection_pid = getpid();
+    explain_strendcpy
+    (
+        connection_path,
+        socket_path,
+        connection_path + sizeof(connection_path)
+    );
+    return 0;
+}
+
+
+/**
+  * The put_arg function is used to add an argument to a request,
+  * quoted so that the daemon will see it as a single argument.
+  */
+
+static void
+put_arg(explain_string_buffer_t *sb, const char *arg)
+{
+    const char      *cp;
+
+    explain_string_buffer_putc(sb, ' ');
+    if (*arg && !strpbrk(arg, " \t\r\n'\"\\#"))
+    {
+        explain_string_buffer_puts(sb, arg);
+        return;
+    }
+    explain_string_buffer_putc(sb, '\'');
+    for (cp = arg; *cp; ++cp)
+    {
+        if (*cp == '\'')
+            explain_string_buffer_puts(sb, "'\\''");
+        else
+            explain_string_buffer_putc(sb, *cp);
+    }
+    explain_string_buffer_putc(sb, '\'');
+}
+
+
+static int
+send_all(const char *data, size_t data_size)
+{
+    while (data_size > 0)
+    {
+        ssize_t         n;
+
+        n = send(connection, data, data_size, MSG_NOSIGNAL);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        data += n;
+        data_size -= n;
+    }
+    return 0;
+}
+
+
+/**
+  * The receive function is used to read the daemon's reply, up to and
+  * including the terminating NUL.  The daemon wraps its explanations
+  * for printing, so the lines are joined back together.
+  *
+  * @param message
+  *     where to put the explanation
+  * @param message_size
+  *     the size of the message buffer
+  * @param received
+  *     set to true (non-zero) once any of the reply has arrived
+  * @returns
+  *     0 on success, -1 on error (with errno set; zero for end of file,
+  *     ETIMEDOUT if no reply arrived in time)
+  */
+
+static long
+now_msec(void)
+{
+    struct timeval  tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000L + tv.tv_usec / 1000;
+}
+
+
+static int
+receive(char *message, int message_size, int *received)
+{
+    explain_string_buffer_t sb;
+    int             newline;
+    long            deadline;
+
+    explain_string_buffer_init(&sb, message, message_size);
+    newline = 0;
+    *received = 0;
+    deadline = now_msec() + REPLY_TIMEOUT;
+    for (;;)
+    {
+        char            buf[1024];
+        ssize_t         n;
+        ssize_t         j;
+        struct pollfd   pfd;
+        long            remaining;
+        int             ready;
+
+        /*
+         * The daemon may be busy with other clients; don't wait for
+         * it forever.
+         */
+        remaining = deadline - now_msec();
+        if (remaining <= 0)
+        {
+            errno = ETIMEDOUT;
+            return -1;
+        }
+        pfd.fd = connection;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        ready = poll(&pfd, 1, (int)remaining);
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready < 0)
+            return -1;
+        if (ready == 0)
+        {
+            errno = ETIMEDOUT;
+            return -1;
+        }
+
+        n = read(connection, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n == 0)
+            errno = 0;
+        if (n <= 0)
+            return -1;
+        *received = 1;
+        for (j = 0; j < n; ++j)
+        {
+            unsigned char   c;
+
+            c = buf[j];
+            if (c == '\0')
+            {
+                /* there is only ever one reply outstanding */
+                return 0;
+            }
+            if (c == '\n')
+            {
+                newline = 1;
+                continue;
+            }
+            if (newline)
+            {
+                /* skip any hanging indent */
+                if (c == ' ')
+                    continue;
+                newline = 0;
+                explain_string_buffer_putc(&sb, ' ');
+            }
+            explain_string_buffer_putc(&sb, c);
+        }
+    }
+}
+
+
+int
+explain_client_message(char *message, int message_size,
+    const char *socket_path, int errnum, const char *function, int argc,
+    const char *const *argv)
+{
+    char            cwd[PATH_MAX + 1];
+    char            request[PATH_MAX * 4];
+    explain_string_buffer_t sb;
+    int             j;
+
+    if (!socket_path)
+        socket_path = getenv("EXPLAIN_SOCKET");
+    if (!socket_path || !*socket_path || !function || message_size <= 0)
+        return -1;
+
+    /*
+     * The request is the current directory, and then the error in the
+     * same form as the explain(1) command line.
+     */
+    if (!getcwd(cwd, sizeof(cwd)))
+        cwd[0] = '\0';
+    explain_string_buffer_init(&sb, request, sizeof(request));
+    explain_string_buffer_puts(&sb, cwd);
+    explain_string_buffer_putc(&sb, '\0');
+    explain_string_buffer_printf(&sb, "%d", errnum);
+    put_arg(&sb, function);
+    for (j = 0; j < argc; ++j)
+        put_arg(&sb, argv[j] ? argv[j] : "NULL");
+    if (explain_string_buffer_full(&sb))
+        return -1;
+
+    if (begin() < 0)
+        return -1;
+
+    /*
+     * The daemon may have been restarted since the connection was
+     * made.  If an old connection turns out to have been dropped
+     * (EPIPE or ECONNRESET, before any of the reply arrived), try
+     * once more on a fresh one.  Any other failure means the daemon
+     * could not explain the error; the request is not sent again, in
+     * case it was the request that upset the daemon.
+     */
+    for (;;)
+    {
+        int             reused;
+        int             received;
+        int             err;
+
+        reused = connect_to(socket_path);
+        if (reused < 0)
+            break;
+        received = 0;
+        if
+        (
+            send_all(request, sb.position + 1) == 0
+        &&
+            receive(message, message_size, &received) == 0
+        )
+        {
+            end();
+            return 0;
+        }
+        err = errno;
+        disconnect();
+        if (!reused || received || (err != EPIPE && err != ECONNRESET))
+            break;
+    }
+    end();
+    return -1;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,85 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_CLIENT_H
+#define LIBEXPLAIN_CLIENT_H
+
+/**
+  * @file
+  * @brief obtain explanations from an explain(1) daemon
+  */
+
+#include <libexplain/gcc_attributes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  * The explain_client_message function is used to obtain an
+  * explanation from an "explain --serve" daemon, rather than building
+  * it in this process.  The daemon's library is already warmed up, so
+  * short-lived processes need not pay the start-up cost themselves.
+  *
+  * The error is described the same way as on the explain(1) command
+  * line: the name of the function, and its arguments as text.
+  * Relative path names are relative to the current directory of the
+  * calling process.  File descriptors, however, are those of the
+  * daemon, so explanations of errors that depend on the caller's open
+  * files will be less accurate than from the local explain_message_*
+  * functions.
+  *
+  * The connection to the daemon is kept open between calls.
+  *
+  * @param message
+  *     The location in which to store the returned message.
+  * @param message_size
+  *     The size in bytes of the location in which to store the returned
+  *     message.
+  * @param socket_path
+  *     The path of the daemon's socket, or NULL to use the
+  *     EXPLAIN_SOCKET environment variable.
+  * @param errnum
+  *     The error value to be explained.
+  * @param function
+  *     The name of the function that failed, e.g. "open".
+  * @param argc
+  *     The number of arguments.
+  * @param argv
+  *     The arguments, as text, e.g. "/etc/passwd" and "O_RDONLY".
+  * @returns
+  *     0 on success, -1 if no daemon is available, or if the daemon
+  *     could not explain the error.  On failure, the caller should fall
+  *     back to the local explain_message_* functions.
+  * @note
+  *     This function is thread safe, but there is only the one
+  *     connection; a thread that finds it in use by another thread
+  *     returns -1.  So does a call that the daemon does not answer
+  *     within a few seconds.
+  */
+int explain_client_message(char *message, int message_size,
+    const char *socket_path, int errnum, const char *function, int argc,
+    const char *const *argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEXPLAIN_CLIENT_H */
+/* vim: set ts=8 sw=4 et : */
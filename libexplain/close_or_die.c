@@ -20,15 +20,18 @@
 
 #include <libexplain/close.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_close_or_die(int fildes)
 {
+    explain_output_or_die_begin();
     if (explain_close_on_error(fildes) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,7 +20,9 @@
 #include <libexplain/ac/errno.h>
 
 #include <libexplain/closedir.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,13 +30,19 @@ explain_closedir_on_error(DIR *dir)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = closedir(dir);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_closedir(hold_errno, dir));
+        if (!explain_output_suppress("closedir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_closedir(hold_errno,
+                dir));
+        }
         errno = hold_errno;
     }
     return result;
@@ -44,10 +52,12 @@ explain_closedir_on_error(DIR *dir)
 void
 explain_closedir_or_die(DIR *dir)
 {
+    explain_output_or_die_begin();
     if (explain_closedir_on_error(dir) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,16 +20,19 @@
 
 #include <libexplain/connect.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_connect_or_die(int fildes, const struct sockaddr *serv_addr,
     int serv_addr_size)
 {
+    explain_output_or_die_begin();
     if (explain_connect_on_error(fildes, serv_addr, serv_addr_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -17,37 +17,47 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <libexplain/ac/dirent.h>
-#include <libexplain/ac/string.h>
-
 #include <libexplain/count_directory_entries.h>
+#include <libexplain/directory_scan.h>
+
+
+typedef struct counter_t counter_t;
+struct counter_t
+{
+    int             count;
+    int             limit;
+};
+
+
+static int
+count_one(void *context, const char *name)
+{
+    counter_t       *cp;
+
+    (void)name;
+    cp = context;
+    ++cp->count;
+    return (cp->limit > 0 && cp->count >= cp->limit);
+}
 
 
 int
 explain_count_directory_entries(const char *pathname)
 {
-    DIR             *dp;
-    int             count;
+    return explain_count_directory_entries_at_least(pathname, 0);
+}
+
+
+int
+explain_count_directory_entries_at_least(const char *pathname, int limit)
+{
+    counter_t       counter;
 
-    dp = opendir(pathname);
-    if (!dp)
+    counter.count = 0;
+    counter.limit = limit;
+    if (explain_directory_scan(pathname, count_one, &counter) < 0)
         return -1;
-    count = 0;
-    for (;;)
-    {
-        struct dirent   *dep;
-
-        dep = readdir(dp);
-        if (!dep)
-            break;
-        if (0 == strcmp(dep->d_name, "."))
-            continue;
-        if (0 == strcmp(dep->d_name, ".."))
-            continue;
-        ++count;
-    }
-    closedir(dp);
-    return count;
+    return counter.count;
 }
 
 
@@ -31,5 +31,29 @@
   */
 int explain_count_directory_entries(const char *pathname);
 
+/**
+  * The EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT macro is the most entries
+  * an explanation will report exactly, when the count is only for
+  * information; beyond it, the limit is reported with a "+" suffix.
+  */
+#define EXPLAIN_COUNT_DIRECTORY_ENTRIES_LIMIT 1000
+
+/**
+  * The explain_count_directory_entries_at_least function may be used
+  * to count the number of directory entries, not counting "." and
+  * "..", stopping once the limit is reached.  This is much cheaper
+  * than counting them all, for very large directories.
+  *
+  * @param pathname
+  *    The directory to count.
+  * @param limit
+  *    The most entries to count, or zero for no limit.
+  * @returns
+  *    The number of directory entries, or the limit if there are at
+  *    least that many, or -1 if the directory could not be read.
+  */
+int explain_count_directory_entries_at_least(const char *pathname,
+    int limit);
+
 #endif /* LIBEXPLAIN_COUNT_DIRECTORY_ENTRIES_H */
 /* vim: set ts=8 sw=4 et : */
@@ -20,6 +20,7 @@
 #include <libexplain/ac/fcntl.h>
 
 #include <libexplain/creat.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,17 +29,22 @@ explain_creat_on_error(const char *pathname, int mode)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = creat(pathname, mode);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_creat(hold_errno, pathname, mode)
-        );
+        if (!explain_output_suppress("creat", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_creat(hold_errno, pathname, mode)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 
 #include <libexplain/creat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -27,7 +28,9 @@ explain_creat_or_die(const char *pathname, int mode)
 {
     int             fildes;
 
+    explain_output_or_die_begin();
     fildes = explain_creat_on_error(pathname, mode);
+    explain_output_or_die_end();
     if (fildes < 0)
     {
         explain_output_exit_failure();
@@ -0,0 +1,81 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/dirent.h>
+
+#include <libexplain/directory_scan.h>
+#include <libexplain/statistics/probe.h>
+
+
+static int
+is_dot_or_dot_dot(const char *name)
+{
+    return
+        (
+            name[0] == '.'
+        &&
+            (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))
+        );
+}
+
+
+int
+explain_directory_scan(const char *pathname,
+    explain_directory_scan_callback_t callback, void *context)
+{
+    DIR             *dp;
+    int             result;
+    explain_probe_timer_t timer;
+
+    /*
+     * The C library's readdir already reads the directory in large
+     * blocks (32KiB for glibc), so calling getdents(2) directly would
+     * gain little, and would not be portable.  What matters for very
+     * large directories is being able to stop early.
+     */
+    explain_probe_begin(&timer, explain_probe_dir);
+    dp = opendir(pathname);
+    if (!dp)
+    {
+        explain_probe_end(&timer);
+        return -1;
+    }
+    result = 0;
+    for (;;)
+    {
+        struct dirent   *dep;
+
+        dep = readdir(dp);
+        if (!dep)
+            break;
+        if (is_dot_or_dot_dot(dep->d_name))
+            continue;
+        if (callback(context, dep->d_name))
+        {
+            result = 1;
+            break;
+        }
+    }
+    closedir(dp);
+    explain_probe_end(&timer);
+    return result;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,58 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_DIRECTORY_SCAN_H
+#define LIBEXPLAIN_DIRECTORY_SCAN_H
+
+/**
+  * The explain_directory_scan_callback_t type is used to represent a
+  * function called for each entry of a directory.
+  *
+  * @param context
+  *    The context passed to #explain_directory_scan.
+  * @param name
+  *    The name of the directory entry.  It is never "." or "..".
+  * @returns
+  *    zero to keep going, or non-zero to stop the scan early.
+  */
+typedef int (*explain_directory_scan_callback_t)(void *context,
+    const char *name);
+
+/**
+  * The explain_directory_scan function may be used to visit each of
+  * the entries of a directory, not counting "." and "..".  The scan
+  * may be stopped early by the callback, which makes asking questions
+  * of very large directories cheap, when the answer is known before
+  * the end.
+  *
+  * @param pathname
+  *    The directory to scan.
+  * @param callback
+  *    The function to call for each entry.
+  * @param context
+  *    Passed to the callback.
+  * @returns
+  *    0 if the whole directory was scanned, 1 if the callback stopped
+  *    the scan early, or -1 if the directory could not be read.
+  */
+int explain_directory_scan(const char *pathname,
+    explain_directory_scan_callback_t callback, void *context);
+
+#endif /* LIBEXPLAIN_DIRECTORY_SCAN_H */
+/* vim: set ts=8 sw=4 et : */
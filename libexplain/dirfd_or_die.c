@@ -20,7 +20,9 @@
 #include <libexplain/ac/errno.h>
 
 #include <libexplain/dirfd.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -29,7 +31,9 @@ explain_dirfd_on_error(DIR *dir)
     int             result;
 
 #ifdef HAVE_DIRFD
+    explain_explanation_call_begin();
     result = dirfd(dir);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,7 +43,10 @@ explain_dirfd_on_error(DIR *dir)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_dirfd(hold_errno, dir));
+        if (!explain_output_suppress("dirfd", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_dirfd(hold_errno, dir));
+        }
         errno = hold_errno;
     }
     return result;
@@ -51,7 +58,9 @@ explain_dirfd_or_die(DIR *dir)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_dirfd_on_error(dir);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/dup2.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,17 +29,22 @@ explain_dup2_on_error(int oldfd, int newfd)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = dup2(oldfd, newfd);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_dup2(hold_errno, oldfd, newfd)
-        );
+        if (!explain_output_suppress("dup2", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_dup2(hold_errno, oldfd, newfd)
+            );
+        }
         errno = hold_errno;
     }
     return result;
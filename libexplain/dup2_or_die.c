@@ -20,15 +20,18 @@
 
 #include <libexplain/dup2.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_dup2_or_die(int oldfd, int newfd)
 {
+    explain_output_or_die_begin();
     if (explain_dup2_on_error(oldfd, newfd) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
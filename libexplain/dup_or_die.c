@@ -20,6 +20,7 @@
 
 #include <libexplain/dup.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -27,7 +28,9 @@ explain_dup_or_die(int fildes)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_dup_on_error(fildes);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
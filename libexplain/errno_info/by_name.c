@@ -19,12 +19,62 @@
 
 #include <libexplain/ac/string.h>
 
+#include <libexplain/errno_info/name_hash.h>
 #include <libexplain/errno_info/table.h>
 
 
+/*
+ * The errno table is conditionally compiled, so the entry that goes
+ * with each slot of the (generated) name hash is only known at run
+ * time.  The index is built on first use; threads racing to build it
+ * write the same values.  Without atomic builtins, the table is
+ * searched linearly, as before.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) \
+    || defined(__clang__)
+#define HAVE_NAME_INDEX 1
+#endif
+
+#ifdef HAVE_NAME_INDEX
+
+static const explain_errno_info_t *by_slot[EXPLAIN_ERRNO_INFO_NAME_HASH_SIZE];
+static int      by_slot_ready;
+
+
+static void
+by_slot_build(void)
+{
+    const explain_errno_info_t *tp;
+    const explain_errno_info_t *end;
+
+    end = explain_errno_info + explain_errno_info_size;
+    for (tp = explain_errno_info; tp < end; ++tp)
+    {
+        int             slot;
+
+        slot = explain_errno_info_name_hash_slot(tp->name);
+        if (slot >= 0 && !by_slot[slot])
+            by_slot[slot] = tp;
+    }
+}
+
+#endif
+
+
 const explain_errno_info_t *
 explain_errno_info_by_name(const char *name)
 {
+#ifdef HAVE_NAME_INDEX
+    int             slot;
+
+    if (!__sync_fetch_and_add(&by_slot_ready, 0))
+    {
+        by_slot_build();
+        __sync_bool_compare_and_swap(&by_slot_ready, 0, 1);
+    }
+    slot = explain_errno_info_name_hash_slot(name);
+    return (slot < 0 ? 0 : by_slot[slot]);
+#else
     const explain_errno_info_t *tp;
     const explain_errno_info_t *end;
 
@@ -35,6 +85,7 @@ explain_errno_info_by_name(const char *name)
             return tp;
     }
     return 0;
+#endif
 }
 
 
@@ -0,0 +1,256 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This file is generated from libexplain/errno_info/name_hash.def
+ * by "codegen --perfect-hash".
+ * Edit the description, not this file, and regenerate.
+ */
+
+#include <libexplain/ac/string.h>
+
+#include <libexplain/errno_info/name_hash.h>
+
+
+/*
+ * The displacement of each bucket, chosen so that the
+ * second hash sends every key to a slot of its own.
+ */
+static const unsigned short displacement[50] =
+{
+    5, 7, 2, 1, 30, 10, 150, 16, 68, 4,
+    3, 3, 4, 0, 6, 1, 15, 22, 1, 2,
+    33, 46, 13, 4, 5, 105, 58, 9, 125, 8,
+    14, 25, 15, 117, 99, 19, 6, 3, 84, 25,
+    178, 1243, 15, 102, 17, 1575, 1, 124, 53, 3,
+};
+
+
+const char *const explain_errno_info_name_hash_key[] =
+{
+    "ECONNABORTED",
+    "ENOTCONN",
+    "EOPNOTSUPP",
+    "EMULTIHOP",
+    "EISCONN",
+    "ESTRPIPE",
+    "EKEYEXPIRED",
+    "EDESTADDRREQ",
+    "ESTALE",
+    "EKEYREVOKED",
+    "EDEADLK",
+    "ESOCKTNOSUPPORT",
+    "EMLINK",
+    "ELIBEXEC",
+    "EADDRNOTAVAIL",
+    "ESHUTDOWN",
+    "ERESTART",
+    "EFBIG",
+    "EL2HLT",
+    "EUCLEAN",
+    "ENOATTR",
+    "EDOTDOT",
+    "EXFULL",
+    "ENOMEM",
+    "ENFILE",
+    "ENOMEDIUM",
+    "ECONNREFUSED",
+    "EUNATCH",
+    "EJUSTRETURN",
+    "ENOTNAM",
+    "EEXIST",
+    "ERANGE",
+    "EADV",
+    "ECHRNG",
+    "ELIBMAX",
+    "ENOPROTOOPT",
+    "EREMOTEIO",
+    "ENOTDIR",
+    "EDOOFUS",
+    "ENAVAIL",
+    "ESRCH",
+    "ECANCELED",
+    "EROFS",
+    "EBADSLT",
+    "ENAMETOOLONG",
+    "ENETUNREACH",
+    "EPROGUNAVAIL",
+    "ELAST",
+    "EDOM",
+    "ENOANO",
+    "EKEYREJECTED",
+    "ETOOMANYREFS",
+    "ENOEXEC",
+    "EINVAL",
+    "EBADMSG",
+    "ELIBACC",
+    "ENOTRECOVERABLE",
+    "ENOSTR",
+    "EHOSTUNREACH",
+    "EPROTOTYPE",
+    "ENOSR",
+    "EACCES",
+    "EAUTH",
+    "EPROGMISMATCH",
+    "EOVERFLOW",
+    "EWOULDBLOCK",
+    "EBADE",
+    "ECONNRESET",
+    "EREMCHG",
+    "ENOENT",
+    "EPROTO",
+    "EPIPE",
+    "EL2NSYNC",
+    "EPERM",
+    "EISNAM",
+    "EBADR",
+    "ELNRNG",
+    "EUSERS",
+    "EINPROGRESS",
+    "EFAULT",
+    "EIO",
+    "EHOSTDOWN",
+    "EPROTONOSUPPORT",
+    "EXDEV",
+    "EADDRINUSE",
+    "ENOCSI",
+    "EDQUOT",
+    "EBADF",
+    "EPFNOSUPPORT",
+    "ENOTSUP",
+    "ETIMEDOUT",
+    "ELIBAD",
+    "ENOTUNIQ",
+    "ECOMM",
+    "EAFNOSUPPORT",
+    "EPROCUNAVAIL",
+    "ENOSYS",
+    "EISDIR",
+    "EBUSY",
+    "ECHILD",
+    "ENONET",
+    "ELIBSCN",
+    "ENOTSOCK",
+    "EL3RST",
+    "ENOIOCTL",
+    "E2BIG",
+    "EPROCLIM",
+    "EBADRQC",
+    "EREMOTE",
+    "ELIBBAD",
+    "ENODATA",
+    "ENOLINK",
+    "ESPIPE",
+    "EAGAIN",
+    "ERPCMISMATCH",
+    "ENETRESET",
+    "ENOKEY",
+    "ENOTBLK",
+    "ENOPKG",
+    "ENODEV",
+    "ENOLCK",
+    "EIDRM",
+    "ENOTEMPTY",
+    "ESRMNT",
+    "ELOOP",
+    "EDEADLOCK",
+    "EALREADY",
+    "EBFONT",
+    "EMFILE",
+    "EFTYPE",
+    "EBADFD",
+    "ENOTTY",
+    "ENXIO",
+    "EINTR",
+    "ETIME",
+    "ENOMSG",
+    "EILSEQ",
+    "EMEDIUMTYPE",
+    "EL3HLT",
+    "EOWNERDEAD",
+    "ENOSPC",
+    "EDIRIOCTL",
+    "ENOBUFS",
+    "ENEEDAUTH",
+    "ETXTBSY",
+    "EMSGSIZE",
+    "EBADRPC",
+    "ENETDOWN",
+};
+
+
+const unsigned short explain_errno_info_name_hash_sorted[] =
+{
+    105, 61, 84, 14, 32, 94, 113, 126, 62, 66,
+    87, 130, 54, 75, 146, 107, 43, 127, 98, 41,
+    99, 33, 93, 0, 26, 67, 10, 125, 7, 141,
+    48, 38, 21, 86, 30, 79, 17, 129, 81, 58,
+    121, 136, 78, 133, 53, 80, 4, 97, 74, 28,
+    6, 50, 9, 18, 72, 138, 103, 47, 55, 91,
+    109, 13, 34, 101, 76, 124, 137, 128, 12, 145,
+    3, 44, 39, 143, 147, 115, 45, 24, 49, 20,
+    142, 85, 110, 119, 69, 52, 104, 116, 120, 111,
+    25, 23, 135, 100, 118, 35, 140, 60, 57, 96,
+    117, 1, 37, 122, 29, 56, 102, 89, 131, 92,
+    132, 2, 64, 139, 73, 88, 71, 106, 95, 63,
+    46, 70, 82, 59, 31, 68, 108, 36, 16, 42,
+    114, 15, 11, 112, 40, 123, 8, 5, 134, 90,
+    51, 144, 19, 27, 77, 65, 83, 22,
+};
+
+
+static unsigned long
+hash(const char *key, unsigned long seed)
+{
+    unsigned long   h;
+
+    h = (2166136261UL ^ seed) & 0xFFFFFFFFUL;
+    for (; *key; ++key)
+    {
+        unsigned char   c;
+
+        c = *key;
+        if (c >= 'a' && c <= 'z')
+            c += 'A' - 'a';
+        h ^= c;
+        h = (h * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    h ^= h >> 16;
+    h = (h * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+    h ^= h >> 13;
+    h = (h * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+    h ^= h >> 16;
+    return h;
+}
+
+
+int
+explain_errno_info_name_hash_slot(const char *key)
+{
+    unsigned long   bucket;
+    int             slot;
+
+    bucket = hash(key, 0) % 50;
+    slot = hash(key, displacement[bucket]) % 148;
+    if (0 != strcasecmp(key, explain_errno_info_name_hash_key[slot]))
+        return -1;
+    return slot;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,59 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This file is generated from libexplain/errno_info/name_hash.def
+ * by "codegen --perfect-hash".
+ * Edit the description, not this file, and regenerate.
+ */
+
+#ifndef LIBEXPLAIN_ERRNO_INFO_NAME_HASH_H
+#define LIBEXPLAIN_ERRNO_INFO_NAME_HASH_H
+
+/**
+  * The EXPLAIN_ERRNO_INFO_NAME_HASH_SIZE macro is the number of keys,
+  * and so the number of slots.
+  */
+#define EXPLAIN_ERRNO_INFO_NAME_HASH_SIZE 148
+
+/**
+  * The explain_errno_info_name_hash_slot function may be used to
+  * find the slot of a key, using a minimal perfect hash.
+  *
+  * @param key
+  *     The key to look for, case is ignored.
+  * @returns
+  *     the slot, from 0 to EXPLAIN_ERRNO_INFO_NAME_HASH_SIZE - 1,
+  *     or -1 if it is not one of the keys.
+  */
+int explain_errno_info_name_hash_slot(const char *key);
+
+/**
+  * The explain_errno_info_name_hash_key array holds
+  * the keys, in slot order.
+  */
+extern const char *const explain_errno_info_name_hash_key[];
+
+/**
+  * The explain_errno_info_name_hash_sorted array holds
+  * the slots, in the sorted order of their keys.
+  */
+extern const unsigned short explain_errno_info_name_hash_sorted[];
+
+#endif /* LIBEXPLAIN_ERRNO_INFO_NAME_HASH_H */
+/* vim: set ts=8 sw=4 et : */
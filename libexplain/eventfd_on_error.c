@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/eventfd.h>
 
 #include <libexplain/eventfd.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,7 +30,9 @@ explain_eventfd_on_error(unsigned initval, int flags)
     int             result;
 
 #if defined(HAVE_EVENTFD)
+    explain_explanation_call_begin();
     result = eventfd(initval, flags);
+    explain_explanation_call_end();
 #else
     result = -1;
     errno = ENOSYS;
@@ -39,11 +42,14 @@ explain_eventfd_on_error(unsigned initval, int flags)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_eventfd(hold_errno, initval, flags)
-        );
+        if (!explain_output_suppress("eventfd", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_eventfd(hold_errno, initval, flags)
+            );
+        }
         errno = hold_errno;
     }
     return result;
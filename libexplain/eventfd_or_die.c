@@ -18,6 +18,7 @@
 
 #include <libexplain/eventfd.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -25,7 +26,9 @@ explain_eventfd_or_die(unsigned int initval, int flags)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_eventfd_on_error(initval, flags);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -24,6 +24,7 @@
 #include <libexplain/buffer/errno/execlp.h>
 #include <libexplain/common_message_buffer.h>
 #include <libexplain/execlp.h>
+#include <libexplain/explanation.h>
 #include <libexplain/sizeof.h>
 #include <libexplain/string_buffer.h>
 #include <libexplain/output.h>
@@ -90,20 +91,25 @@ explain_execlp_on_error(const char *pathname, const char *arg, ...)
 
     /* Note: if it returns at all, it has failed */
     errno = 0;
+    explain_explanation_call_begin();
     result = execvp(pathname, (char *const *)argv);
+    explain_explanation_call_end();
     /* assert(result < 0); */
 
     hold_errno = errno;
     /* assert(hold_errno != 0); */
 
-    explain_string_buffer_init
-    (
-        &sb,
-        explain_common_message_buffer,
-        explain_common_message_buffer_size
-    );
-    explain_buffer_errno_execlpv(&sb, hold_errno, pathname, argc, argv);
-    explain_output_error("%s", explain_common_message_buffer);
+    if (!explain_output_suppress("execlp", hold_errno, -1))
+    {
+        explain_string_buffer_init
+        (
+            &sb,
+            explain_common_message_buffer,
+            explain_common_message_buffer_size
+        );
+        explain_buffer_errno_execlpv(&sb, hold_errno, pathname, argc, argv);
+        explain_output_error("%s", explain_common_message_buffer);
+    }
     errno = hold_errno;
     return result;
 }
@@ -20,16 +20,20 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/execv.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_execv_or_die(const char *pathname, char *const*argv)
 {
+    explain_output_or_die_begin();
     if (explain_execv_on_error(pathname, argv) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,17 +42,22 @@ explain_execv_on_error(const char *pathname, char *const *argv)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = execv(pathname, argv);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_execv(hold_errno, pathname, argv)
-        );
+        if (!explain_output_suppress("execv", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_execv(hold_errno, pathname, argv)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/execve.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -29,17 +30,22 @@ explain_execve_on_error(const char *pathname, char *const*argv,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = execve(pathname, argv, envp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_execve(hold_errno, pathname, argv, envp)
-        );
+        if (!explain_output_suppress("execve", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_execve(hold_errno, pathname, argv, envp)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,16 +18,19 @@
 
 #include <libexplain/execve.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_execve_or_die(const char *pathname, char *const *argv,
     char *const *envp)
 {
+    explain_output_or_die_begin();
     if (explain_execve_on_error(pathname, argv, envp) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/execvp.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 
 
@@ -28,17 +29,22 @@ explain_execvp_on_error(const char *pathname, char *const*argv)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = execvp(pathname, argv);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_execvp(hold_errno, pathname, argv)
-        );
+        if (!explain_output_suppress("execvp", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_execvp(hold_errno, pathname, argv)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/execvp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_execvp_or_die(const char *pathname, char *const *argv)
 {
+    explain_output_or_die_begin();
     if (explain_execvp_on_error(pathname, argv) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
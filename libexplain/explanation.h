@@ -48,6 +48,43 @@ struct explain_explanation_t
   */
 void explain_explanation_init(explain_explanation_t *exp, int errnum);
 
+/**
+  * The explain_explanation_end function is used (by the assemble
+  * functions) to mark the end of the explanation that was started by
+  * #explain_explanation_init.
+  */
+void explain_explanation_end(void);
+
+/**
+  * The explain_explanation_call_begin function is used by the
+  * explain_*_on_error functions, immediately before they call the
+  * function they explain.  A failure of that call is theirs to
+  * explain, so until the matching #explain_explanation_call_end the
+  * thread counts as busy, and the LD_PRELOAD library leaves it alone.
+  */
+void explain_explanation_call_begin(void);
+
+/**
+  * The explain_explanation_call_end function is used by the
+  * explain_*_on_error functions, immediately after the call that was
+  * started by #explain_explanation_call_begin.
+  */
+void explain_explanation_call_end(void);
+
+/**
+  * The explain_explanation_busy function may be used to determine
+  * whether the calling thread is building an explanation.  The library
+  * makes system calls of its own while it does (stat, readlink, and so
+  * on), and their failures are expected; the LD_PRELOAD library uses
+  * this to leave them unexplained.  It is also busy while an
+  * explain_*_on_error function makes the call it is to explain.
+  *
+  * @returns
+  *     true (non-zero) if an explanation is being built, false (zero)
+  *     if not.
+  */
+int explain_explanation_busy(void);
+
 /**
   * The explain_explanation_assemble function may be used to
   * carefully glue the problem statement and the explanation together,
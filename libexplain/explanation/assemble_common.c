@@ -21,6 +21,7 @@
 
 #include <libexplain/explanation/assemble_common.h>
 #include <libexplain/gettext.h>
+#include <libexplain/memo.h>
 
 
 static long
@@ -143,6 +144,13 @@ explain_explanation_assemble_common(explain_explanation_t *exp,
     long            exp_len;
     int             err_len;
 
+    /*
+     * The explanation is complete; nothing it remembered about the
+     * file system may be used by anything that comes after it.
+     */
+    explain_memo_invalidate();
+    explain_explanation_end();
+
     if (exp->errnum == 0)
     {
         explain_string_buffer_printf_gettext
@@ -18,11 +18,26 @@
  */
 
 #include <libexplain/explanation.h>
+#include <libexplain/fileinfo.h>
+#include <libexplain/is_efault.h>
+#include <libexplain/memo.h>
+
+/*
+ * The number of explanations the thread is building; they may nest.
+ * The explain_*_on_error functions count too, while they make the call
+ * they are about to explain.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+static __thread int depth;
+#else
+static int      depth;
+#endif
 
 
 void
 explain_explanation_init(explain_explanation_t *exp, int errnum)
 {
+    ++depth;
     explain_string_buffer_init
     (
         &exp->system_call_sb,
@@ -44,6 +59,44 @@ explain_explanation_init(explain_explanation_t *exp, int errnum)
     );
     exp->explanation_sb.footnotes = &exp->footnotes_sb;
     exp->system_call_sb.footnotes = &exp->footnotes_sb;
+
+    /*
+     * The address space, the open file descriptors, and the file
+     * system, may have changed since the last explanation.
+     */
+    explain_is_efault_maps_invalidate();
+    explain_fileinfo_self_fd_names_invalidate();
+    explain_memo_invalidate();
+}
+
+
+void
+explain_explanation_end(void)
+{
+    if (depth > 0)
+        --depth;
+}
+
+
+void
+explain_explanation_call_begin(void)
+{
+    ++depth;
+}
+
+
+void
+explain_explanation_call_end(void)
+{
+    if (depth > 0)
+        --depth;
+}
+
+
+int
+explain_explanation_busy(void)
+{
+    return (depth > 0);
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fchdir.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,19 @@ explain_fchdir_on_error(int fildes)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fchdir(fildes);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fchdir(hold_errno, fildes));
+        if (!explain_output_suppress("fchdir", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fchdir(hold_errno,
+                fildes));
+        }
         errno = hold_errno;
     }
     return result;
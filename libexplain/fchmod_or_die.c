@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fchmod.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fchmod_or_die(int fildes, mode_t mode)
 {
+    explain_output_or_die_begin();
     if (explain_fchmod_on_error(fildes, mode) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -41,7 +45,9 @@ explain_fchmod_on_error(int fildes, mode_t mode)
     int             result;
 
 #ifdef HAVE_FCHMOD
+    explain_explanation_call_begin();
     result = fchmod(fildes, mode);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -51,11 +57,14 @@ explain_fchmod_on_error(int fildes, mode_t mode)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fchmod(hold_errno, fildes, mode)
-        );
+        if (!explain_output_suppress("fchmod", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fchmod(hold_errno, fildes, mode)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fchown.h>
 #include <libexplain/output.h>
 
@@ -28,17 +29,22 @@ explain_fchown_on_error(int fildes, int owner, int group)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fchown(fildes, owner, group);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fchown(hold_errno, fildes, owner, group)
-        );
+        if (!explain_output_suppress("fchown", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fchown(hold_errno, fildes, owner, group)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/fchown.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fchown_or_die(int fildes, int owner, int group)
 {
+    explain_output_or_die_begin();
     if (explain_fchown_on_error(fildes, owner, group) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
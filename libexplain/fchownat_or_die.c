@@ -19,18 +19,22 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fchownat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fchownat_or_die(int dirfd, const char *pathname, int owner, int group,
     int flags)
 {
+    explain_output_or_die_begin();
     if (explain_fchownat_on_error(dirfd, pathname, owner, group, flags) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -41,7 +45,9 @@ explain_fchownat_on_error(int dirfd, const char *pathname, int owner, int group,
     int             result;
 
 #ifdef HAVE_FCHOWNAT
+    explain_explanation_call_begin();
     result = fchownat(dirfd, pathname, owner, group, flags);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -51,12 +57,16 @@ explain_fchownat_on_error(int dirfd, const char *pathname, int owner, int group,
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fchownat(hold_errno, dirfd, pathname, owner, group,
-                flags)
-        );
+        if (!explain_output_suppress("fchownat", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fchownat(hold_errno, dirfd, pathname, owner,
+                    group,
+                    flags)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -21,9 +21,11 @@
 #include <libexplain/ac/fcntl.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fclose.h>
 #include <libexplain/fflush.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/stream_to_fildes.h>
 
 
@@ -69,20 +71,31 @@ explain_fclose_on_error(FILE *fp)
              * the user (or developer reading the bug report) with "fflush".
              */
             hold_errno = errno;
-            explain_output_error("%s", explain_errno_fflush(hold_errno, fp));
+            if (!explain_output_suppress("fflush", hold_errno, -1))
+            {
+                explain_output_error("%s", explain_errno_fflush(hold_errno,
+                    fp));
+            }
+            explain_explanation_call_begin();
             fclose(fp);
+            explain_explanation_call_end();
             errno = hold_errno;
             return result;
         }
     }
 
+    explain_explanation_call_begin();
     result = fclose(fp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fclose(hold_errno, fp));
+        if (!explain_output_suppress("fclose", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fclose(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -92,10 +105,12 @@ explain_fclose_on_error(FILE *fp)
 void
 explain_fclose_or_die(FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_fclose_on_error(fp))
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/fcntl.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fcntl.h>
 #include <libexplain/output.h>
 
@@ -28,17 +29,22 @@ explain_fcntl_on_error(int fildes, int command, long arg)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fcntl(fildes, command, arg);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fcntl(hold_errno, fildes, command, arg)
-        );
+        if (!explain_output_suppress("fcntl", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fcntl(hold_errno, fildes, command, arg)
+            );
+        }
         errno = hold_errno;
     }
     return result;
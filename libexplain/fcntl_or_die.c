@@ -20,6 +20,7 @@
 
 #include <libexplain/fcntl.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -27,7 +28,9 @@ explain_fcntl_or_die(int fildes, int command, long arg)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_fcntl_on_error(fildes, command, arg);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
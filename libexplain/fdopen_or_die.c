@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fdopen.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 FILE *
@@ -28,14 +30,19 @@ explain_fdopen_on_error(int fildes, const char *flags)
 {
     FILE            *result;
 
+    explain_explanation_call_begin();
     result = fdopen(fildes, flags);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fdopen(hold_errno, fildes,
-            flags));
+        if (!explain_output_suppress("fdopen", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fdopen(hold_errno, fildes,
+                flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -47,7 +54,9 @@ explain_fdopen_or_die(int fildes, const char *mode)
 {
     FILE            *fp;
 
+    explain_output_or_die_begin();
     fp = explain_fdopen_on_error(fildes, mode);
+    explain_output_or_die_end();
     if (!fp)
     {
         explain_output_exit_failure();
@@ -19,8 +19,10 @@
 #include <libexplain/ac/dirent.h>
 #include <libexplain/ac/errno.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fdopendir.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 #ifndef HAVE_FDOPENDIR
@@ -41,14 +43,19 @@ explain_fdopendir_on_error(int fildes)
 {
     DIR             *result;
 
+    explain_explanation_call_begin();
     result = fdopendir(fildes);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fdopendir(hold_errno,
-            fildes));
+        if (!explain_output_suppress("fdopendir", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fdopendir(hold_errno,
+                fildes));
+        }
         errno = hold_errno;
     }
     return result;
@@ -60,7 +67,9 @@ explain_fdopendir_or_die(int fildes)
 {
     DIR             *result;
 
+    explain_output_or_die_begin();
     result = explain_fdopendir_on_error(fildes);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/feof.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,13 +30,18 @@ explain_feof_on_error(FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = feof(fp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_feof(hold_errno, fp));
+        if (!explain_output_suppress("feof", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_feof(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -46,7 +53,9 @@ explain_feof_or_die(FILE *fp)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_feof_on_error(fp);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
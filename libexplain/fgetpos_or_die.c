@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fgetpos.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,14 +30,19 @@ explain_fgetpos_on_error(FILE *fp, fpos_t *pos)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fgetpos(fp, pos);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fgetpos(hold_errno, fp,
-            pos));
+        if (!explain_output_suppress("fgetpos", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fgetpos(hold_errno, fp,
+                pos));
+        }
         errno = hold_errno;
     }
     return result;
@@ -45,10 +52,12 @@ explain_fgetpos_on_error(FILE *fp, fpos_t *pos)
 void
 explain_fgetpos_or_die(FILE *fp, fpos_t *pos)
 {
+    explain_output_or_die_begin();
     if (explain_fgetpos_on_error(fp, pos) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fgets.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 char *
@@ -28,14 +30,19 @@ explain_fgets_on_error(char *data, int data_size, FILE *fp)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = fgets(data, data_size, fp);
+    explain_explanation_call_end();
     if (!result && ferror(fp))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fgets(hold_errno, data,
-            data_size, fp));
+        if (!explain_output_suppress("fgets", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fgets(hold_errno, data,
+                data_size, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -47,7 +54,9 @@ explain_fgets_or_die(char *data, int data_size, FILE *fp)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_fgets_on_error(data, data_size, fp);
+    explain_output_or_die_end();
     if (!result && ferror(fp))
     {
         explain_output_exit_failure();
@@ -56,6 +56,67 @@ int explain_fileinfo_pid_fd_n(pid_t pid, int fildes, char *data,
   */
 int explain_fileinfo_self_fd_n(int fildes, char *data, size_t data_size);
 
+/**
+  * The explain_fileinfo_self_fd_names_begin function is used to gain
+  * access to a table of the names of this process' file descriptors,
+  * for explaining many file descriptors at once.  Each file descriptor
+  * is looked up at most once per explanation.  On success, the caller
+  * must call #explain_fileinfo_self_fd_names_end when finished.
+  *
+  * @returns
+  *     0 on success, or -1 if the table is not available, in which
+  *     case each file descriptor must be looked up individually.
+  */
+int explain_fileinfo_self_fd_names_begin(void);
+
+/**
+  * The explain_fileinfo_self_fd_names_want function is used to say
+  * that a file descriptor will be looked up, so that
+  * #explain_fileinfo_self_fd_names_resolve can deal with all of the
+  * difficult ones at once.
+  *
+  * @param fildes
+  *     The file descriptor of interest.
+  */
+void explain_fileinfo_self_fd_names_want(int fildes);
+
+/**
+  * The explain_fileinfo_self_fd_names_resolve function is used to find
+  * names for all of the wanted file descriptors which have no path
+  * (pipes and the like), using a single run of lsof(1).
+  */
+void explain_fileinfo_self_fd_names_resolve(void);
+
+/**
+  * The explain_fileinfo_self_fd_names_lookup function is used to find
+  * the name of a file descriptor in the table.
+  *
+  * @param fildes
+  *     The file descriptor of interest.
+  * @param is_socket
+  *     Set to true if the file descriptor is a socket, in which case
+  *     the caller should ask the socket for its addresses.
+  * @returns
+  *     The name, which may be empty, or NULL if the file descriptor is
+  *     not open.  It remains valid until the table is next used.
+  */
+const char *explain_fileinfo_self_fd_names_lookup(int fildes,
+    int *is_socket);
+
+/**
+  * The explain_fileinfo_self_fd_names_end function is used to release
+  * the table obtained by #explain_fileinfo_self_fd_names_begin.
+  */
+void explain_fileinfo_self_fd_names_end(void);
+
+/**
+  * The explain_fileinfo_self_fd_names_invalidate function is used to
+  * discard the table, so that file descriptors will be looked up
+  * again when next needed.  It is called at the start of each
+  * explanation.
+  */
+void explain_fileinfo_self_fd_names_invalidate(void);
+
 /**
   * The explain_fileinfo_pid_cwd function may be used to obtain the
   * absolute path of the current working directory of the given process.
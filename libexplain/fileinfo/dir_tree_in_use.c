@@ -21,7 +21,6 @@
 
 #include <libexplain/fileinfo.h>
 #include <libexplain/lsof.h>
-#include <libexplain/string_buffer.h>
 
 
 typedef struct adapter adapter;
@@ -45,7 +44,7 @@ n_callback(explain_lsof_t *context, const char *name)
      * Get fussier if it proves to be an actual problem.
      */
     a = (adapter *)context;
-    if (!strstr(name, " (readlink: "))
+    if (strstr(name, " (readlink: "))
         return;
     a->found++;
 }
@@ -55,16 +54,10 @@ int
 explain_fileinfo_dir_tree_in_use(const char *path)
 {
     adapter         obj;
-    char            options[1000];
-    explain_string_buffer_t sb;
-
-    explain_string_buffer_init(&sb, options, sizeof(options));
-    explain_string_buffer_puts(&sb, "-- ");
-    explain_string_buffer_puts_shell_quoted(&sb, path);
 
     obj.inherited.n_callback = n_callback;
     obj.found = 0;
-    explain_lsof(options, &obj.inherited);
+    explain_lsof_path(path, &obj.inherited);
     return obj.found;
 }
 
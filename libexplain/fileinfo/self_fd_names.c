@@ -0,0 +1,421 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/fileinfo.h>
+#include <libexplain/lsof.h>
+
+/*
+ * The table holds the file descriptors asked about since the last
+ * explanation began; /proc/self/fd is not walked as a whole, it costs
+ * more than looking up the ones mentioned.
+ *
+ * The table is shared, but the explain_message_* functions are
+ * documented as thread safe, so it may only be used by one thread at
+ * a time.  It has a busy flag of its own.  A thread that finds it busy
+ * looks each file descriptor up individually, the way it always did.
+ */
+#if defined(PROC_PID_FD_N) && ((__GNUC__ > 4 || (__GNUC__ == 4 && \
+    __GNUC_MINOR__ >= 1)) || defined(__clang__))
+#define HAVE_FD_NAMES 1
+#endif
+
+
+#ifdef HAVE_FD_NAMES
+
+enum state_t
+{
+    state_closed,
+    state_socket,
+    state_named,
+    state_unnamed,
+    state_resolved
+};
+typedef enum state_t state_t;
+
+typedef struct entry_t entry_t;
+struct entry_t
+{
+    int             fildes;
+    state_t         state;
+    size_t          offset;
+};
+
+/*
+ * The entries are found by an open addressing hash on the file
+ * descriptor; the names live in a separate pool.
+ */
+static entry_t  *entry;
+static size_t   entry_length;
+static size_t   entry_maximum;
+static char     *pool;
+static size_t   pool_length;
+static size_t   pool_maximum;
+static int      busy;
+static unsigned long generation;
+static unsigned long table_generation;
+
+
+void
+explain_fileinfo_self_fd_names_invalidate(void)
+{
+    /*
+     * The table may be in use by another thread, so it is emptied by
+     * the next thread to begin using it.
+     */
+    __sync_add_and_fetch(&generation, 1);
+}
+
+
+static size_t
+slot(int fildes)
+{
+    size_t          j;
+
+    /* an empty slot has state_closed and offset 0 */
+    j = ((unsigned)fildes * 2654435761u) & (entry_maximum - 1);
+    while (entry[j].offset && entry[j].fildes != fildes)
+        j = (j + 1) & (entry_maximum - 1);
+    return j;
+}
+
+
+static int
+grow(void)
+{
+    entry_t         *old_entry;
+    size_t          old_maximum;
+    size_t          j;
+
+    old_entry = entry;
+    old_maximum = entry_maximum;
+    entry_maximum = (old_maximum ? old_maximum * 2 : 64);
+    entry = calloc(entry_maximum, sizeof(entry[0]));
+    if (!entry)
+    {
+        entry = old_entry;
+        entry_maximum = old_maximum;
+        return -1;
+    }
+    for (j = 0; j < old_maximum; ++j)
+    {
+        if (old_entry[j].offset)
+            entry[slot(old_entry[j].fildes)] = old_entry[j];
+    }
+    free(old_entry);
+    return 0;
+}
+
+
+static size_t
+save(const char *name, size_t name_size)
+{
+    size_t          result;
+
+    if (pool_length == 0)
+    {
+        /* offset 0 is reserved to mean an empty slot */
+        pool_length = 1;
+    }
+    if (pool_length + name_size + 1 > pool_maximum)
+    {
+        size_t          new_maximum;
+        char            *new_pool;
+
+        new_maximum = pool_maximum * 2 + name_size + 1024;
+        new_pool = realloc(pool, new_maximum);
+        if (!new_pool)
+            return 0;
+        pool = new_pool;
+        pool_maximum = new_maximum;
+    }
+    result = pool_length;
+    memcpy(pool + pool_length, name, name_size);
+    pool_length += name_size;
+    pool[pool_length++] = '\0';
+    return result;
+}
+
+
+static entry_t *
+find(int fildes)
+{
+    entry_t         *ep;
+    char            path[40];
+    char            name[PATH_MAX + 1];
+    ssize_t         n;
+    size_t          offset;
+    int             err;
+
+    if (fildes < 0)
+        return 0;
+    if ((entry_length + 1) * 2 > entry_maximum && grow() < 0)
+        return 0;
+    ep = &entry[slot(fildes)];
+    if (ep->offset)
+        return ep;
+
+    /*
+     * One readlink tells us both whether the file descriptor is open,
+     * and what it refers to.
+     */
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fildes);
+    n = readlink(path, name, sizeof(name) - 1);
+    err = errno;
+    offset = save(name, (n < 0 ? 0 : n));
+    if (!offset)
+        return 0;
+    ep = &entry[slot(fildes)];
+    ep->fildes = fildes;
+    ep->offset = offset;
+    if (n < 0)
+    {
+        /*
+         * If the link can't be read (permissions, perhaps), the file
+         * descriptor is still open, and lsof(1) may know more.  The
+         * link only being absent means the file descriptor is closed
+         * if /proc is actually there to ask.
+         */
+        if (err == ENOENT && access("/proc/self/fd", F_OK) == 0)
+            ep->state = state_closed;
+        else
+            ep->state = state_unnamed;
+    }
+    else if (name[0] == '/')
+        ep->state = state_named;
+    else if (n >= 7 && 0 == memcmp(name, "socket:", 7))
+        ep->state = state_socket;
+    else
+        ep->state = state_unnamed;
+    ++entry_length;
+    return ep;
+}
+
+
+typedef struct adapter adapter;
+struct adapter
+{
+    explain_lsof_t  inherited;
+};
+
+
+static void
+n_callback(explain_lsof_t *context, const char *name)
+{
+    entry_t         *ep;
+    size_t          offset;
+
+    (void)context;
+    if (strstr(name, " (readlink: "))
+        return;
+    ep = find(context->fildes);
+    if (!ep || ep->state != state_unnamed)
+        return;
+    offset = save(name, strlen(name));
+    if (offset)
+    {
+        ep->offset = offset;
+        ep->state = state_resolved;
+    }
+}
+
+
+static void
+run_lsof(const char *fd_list)
+{
+    adapter         obj;
+    char            options[150];
+
+    obj.inherited.n_callback = n_callback;
+    snprintf(options, sizeof(options), "-p %ld -d %s", (long)getpid(), fd_list);
+    explain_lsof(options, &obj.inherited);
+}
+
+
+int
+explain_fileinfo_self_fd_names_begin(void)
+{
+    unsigned long   current;
+
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+    current = __sync_add_and_fetch(&generation, 0);
+    if (table_generation != current)
+    {
+        table_generation = current;
+        entry_length = 0;
+        pool_length = 0;
+        if (entry)
+            memset(entry, 0, entry_maximum * sizeof(entry[0]));
+    }
+    return 0;
+}
+
+
+void
+explain_fileinfo_self_fd_names_want(int fildes)
+{
+    find(fildes);
+}
+
+
+void
+explain_fileinfo_self_fd_names_resolve(void)
+{
+    size_t          j;
+    char            fd_list[100];
+    size_t          len;
+
+    /*
+     * The /proc links of pipes and the like are not path names, and
+     * lsof(1) may know better.  Ask it about all of them at once,
+     * rather than once per file descriptor.
+     */
+    len = 0;
+    for (j = 0; j < entry_maximum; ++j)
+    {
+        entry_t         *ep;
+        char            num[20];
+        size_t          num_len;
+
+        ep = &entry[j];
+        if (!ep->offset || ep->state != state_unnamed)
+            continue;
+        num_len = snprintf(num, sizeof(num), "%d", ep->fildes);
+        if (len + num_len + 2 > sizeof(fd_list))
+        {
+            run_lsof(fd_list);
+            len = 0;
+        }
+        if (len)
+            fd_list[len++] = ',';
+        memcpy(fd_list + len, num, num_len + 1);
+        len += num_len;
+    }
+    if (len)
+        run_lsof(fd_list);
+
+    /*
+     * Whatever lsof(1) didn't know, nobody knows.
+     */
+    for (j = 0; j < entry_maximum; ++j)
+    {
+        entry_t         *ep;
+
+        ep = &entry[j];
+        if (ep->offset && ep->state == state_unnamed)
+        {
+            ep->state = state_resolved;
+            ep->offset = save("", 0);
+        }
+    }
+}
+
+
+const char *
+explain_fileinfo_self_fd_names_lookup(int fildes, int *is_socket)
+{
+    entry_t         *ep;
+
+    *is_socket = 0;
+    ep = find(fildes);
+    if (!ep || ep->state == state_closed)
+        return 0;
+    if (ep->state == state_unnamed)
+    {
+        char            num[20];
+
+        snprintf(num, sizeof(num), "%d", fildes);
+        run_lsof(num);
+        ep = find(fildes);
+        if (!ep)
+            return 0;
+        if (ep->state == state_unnamed)
+        {
+            ep->state = state_resolved;
+            ep->offset = save("", 0);
+        }
+    }
+    if (!ep->offset)
+        return 0;
+    if (ep->state == state_socket)
+        *is_socket = 1;
+    return pool + ep->offset;
+}
+
+
+void
+explain_fileinfo_self_fd_names_end(void)
+{
+    __sync_lock_release(&busy);
+}
+
+#else
+
+void
+explain_fileinfo_self_fd_names_invalidate(void)
+{
+}
+
+
+int
+explain_fileinfo_self_fd_names_begin(void)
+{
+    return -1;
+}
+
+
+void
+explain_fileinfo_self_fd_names_want(int fildes)
+{
+    (void)fildes;
+}
+
+
+void
+explain_fileinfo_self_fd_names_resolve(void)
+{
+}
+
+
+const char *
+explain_fileinfo_self_fd_names_lookup(int fildes, int *is_socket)
+{
+    (void)fildes;
+    *is_socket = 0;
+    return 0;
+}
+
+
+void
+explain_fileinfo_self_fd_names_end(void)
+{
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
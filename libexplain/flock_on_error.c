@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/file.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/flock.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_flock_on_error(int fildes, int command)
     int             result;
 
 #ifdef HAVE_FLOCK
+    explain_explanation_call_begin();
     result = flock(fildes, command);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,11 +42,14 @@ explain_flock_on_error(int fildes, int command)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_flock(hold_errno, fildes, command)
-        );
+        if (!explain_output_suppress("flock", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_flock(hold_errno, fildes, command)
+            );
+        }
         errno = hold_errno;
     }
     return result;
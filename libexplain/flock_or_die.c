@@ -18,15 +18,18 @@
 
 #include <libexplain/flock.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_flock_or_die(int fildes, int command)
 {
+    explain_output_or_die_begin();
     if (explain_flock_on_error(fildes, command) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
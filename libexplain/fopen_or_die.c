@@ -20,8 +20,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fopen.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 FILE *
@@ -29,14 +31,19 @@ explain_fopen_on_error(const char *pathname, const char *flags)
 {
     FILE            *result;
 
+    explain_explanation_call_begin();
     result = fopen(pathname, flags);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fopen(hold_errno, pathname,
-            flags));
+        if (!explain_output_suppress("fopen", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fopen(hold_errno,
+                pathname, flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -48,7 +55,9 @@ explain_fopen_or_die(const char *pathname, const char *flags)
 {
     FILE            *fp;
 
+    explain_output_or_die_begin();
     fp = explain_fopen_on_error(pathname, flags);
+    explain_output_or_die_end();
     if (!fp)
     {
         explain_output_exit_failure();
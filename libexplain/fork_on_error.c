@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fork.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_fork_on_error(void)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fork();
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fork(hold_errno));
+        if (!explain_output_suppress("fork", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fork(hold_errno));
+        }
         errno = hold_errno;
     }
     return result;
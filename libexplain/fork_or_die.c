@@ -20,6 +20,7 @@
 
 #include <libexplain/fork.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -27,7 +28,9 @@ explain_fork_or_die(void)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_fork_on_error();
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
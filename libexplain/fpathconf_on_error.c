@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fpathconf.h>
 #include <libexplain/output.h>
 
@@ -31,15 +32,20 @@ explain_fpathconf_on_error(int fildes, int name)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = fpathconf(fildes, name);
+    explain_explanation_call_end();
     if (result == -1 && errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fpathconf(hold_errno, fildes, name)
-        );
+        if (!explain_output_suppress("fpathconf", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fpathconf(hold_errno, fildes, name)
+            );
+        }
     }
     errno = hold_errno;
     return result;
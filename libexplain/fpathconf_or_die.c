@@ -21,6 +21,7 @@
 
 #include <libexplain/fpathconf.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 long
@@ -29,7 +30,9 @@ explain_fpathconf_or_die(int fildes, int name)
     long            result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_fpathconf_on_error(fildes, name);
+    explain_output_or_die_end();
     if (result == -1 && errno != 0)
     {
         explain_output_exit_failure();
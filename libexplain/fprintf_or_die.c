@@ -22,6 +22,7 @@
 
 #include <libexplain/buffer/errno/fprintf.h>
 #include <libexplain/common_message_buffer.h>
+#include <libexplain/explanation.h>
 #include <libexplain/fprintf.h>
 #include <libexplain/output.h>
 #include <libexplain/string_buffer.h>
@@ -91,20 +92,25 @@ explain_fprintf_on_error(FILE *fp, const char *format, ...)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vfprintf(fp, format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         explain_string_buffer_t sb;
 
         hold_errno = errno;
-        explain_string_buffer_init
-        (
-            &sb,
-            explain_common_message_buffer,
-            explain_common_message_buffer_size
-        );
-        explain_buffer_errno_fprintf(&sb, hold_errno, fp, format, ap2);
-        explain_output_error("%s", explain_common_message_buffer);
+        if (!explain_output_suppress("fprintf", hold_errno, -1))
+        {
+            explain_string_buffer_init
+            (
+                &sb,
+                explain_common_message_buffer,
+                explain_common_message_buffer_size
+            );
+            explain_buffer_errno_fprintf(&sb, hold_errno, fp, format, ap2);
+            explain_output_error("%s", explain_common_message_buffer);
+        }
     }
     va_end(ap2); /* yes, both of them */
     va_end(ap);
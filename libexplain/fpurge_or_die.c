@@ -20,8 +20,10 @@
 #include <libexplain/ac/stdio.h>
 #include <libexplain/ac/stdio_ext.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fpurge.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -30,7 +32,9 @@ explain_fpurge_on_error(FILE *fp)
     int             result;
 
 #ifdef HAVE_FPURGE
+    explain_explanation_call_begin();
     result = fpurge(fp);
+    explain_explanation_call_end();
 #elif defined(HAVE___FPURGE)
     errno = 0;
     result = 0;
@@ -46,7 +50,10 @@ explain_fpurge_on_error(FILE *fp)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fpurge(hold_errno, fp));
+        if (!explain_output_suppress("fpurge", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fpurge(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -56,10 +63,12 @@ explain_fpurge_on_error(FILE *fp)
 void
 explain_fpurge_or_die(FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_fpurge_on_error(fp) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fputc.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,13 +30,18 @@ explain_fputc_on_error(int c, FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fputc(c, fp);
+    explain_explanation_call_end();
     if (result == EOF)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fputc(hold_errno, c, fp));
+        if (!explain_output_suppress("fputc", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fputc(hold_errno, c, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -44,10 +51,12 @@ explain_fputc_on_error(int c, FILE *fp)
 void
 explain_fputc_or_die(int c, FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_fputc_on_error(c, fp) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
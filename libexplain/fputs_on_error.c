@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fputs.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_fputs_on_error(const char *s, FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fputs(s, fp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fputs(hold_errno, s, fp));
+        if (!explain_output_suppress("fputs", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fputs(hold_errno, s, fp));
+        }
         errno = hold_errno;
     }
     return result;
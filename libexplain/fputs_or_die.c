@@ -20,15 +20,18 @@
 
 #include <libexplain/fputs.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fputs_or_die(const char *s, FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_fputs_on_error(s, fp) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fread.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 size_t
@@ -28,14 +30,19 @@ explain_fread_on_error(void *ptr, size_t size, size_t nmemb, FILE *fp)
 {
     size_t          result;
 
+    explain_explanation_call_begin();
     result = fread(ptr, size, nmemb, fp);
+    explain_explanation_call_end();
     if (result == 0 && ferror(fp))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fread(hold_errno, ptr,
-            size, nmemb, fp));
+        if (!explain_output_suppress("fread", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fread(hold_errno, ptr,
+                size, nmemb, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -47,7 +54,9 @@ explain_fread_or_die(void *ptr, size_t size, size_t nmemb, FILE *fp)
 {
     size_t          result;
 
+    explain_output_or_die_begin();
     result = explain_fread_on_error(ptr, size, nmemb, fp);
+    explain_output_or_die_end();
     if (result == 0 && ferror(fp))
     {
         explain_output_exit_failure();
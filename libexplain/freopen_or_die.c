@@ -20,8 +20,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/freopen.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 FILE *
@@ -29,14 +31,19 @@ explain_freopen_on_error(const char *pathname, const char *flags, FILE *fp)
 {
     FILE            *result;
 
+    explain_explanation_call_begin();
     result = freopen(pathname, flags, fp);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_freopen(hold_errno,
-            pathname, flags, fp));
+        if (!explain_output_suppress("freopen", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_freopen(hold_errno,
+                pathname, flags, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -46,10 +53,12 @@ explain_freopen_on_error(const char *pathname, const char *flags, FILE *fp)
 void
 explain_freopen_or_die(const char *pathname, const char *flags, FILE *fp)
 {
+    explain_output_or_die_begin();
     if (!explain_freopen_on_error(pathname, flags, fp))
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
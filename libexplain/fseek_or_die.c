@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fseek.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,14 +30,19 @@ explain_fseek_on_error(FILE *fp, long offset, int whence)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fseek(fp, offset, whence);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fseek(hold_errno, fp,
-            offset, whence));
+        if (!explain_output_suppress("fseek", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fseek(hold_errno, fp,
+                offset, whence));
+        }
         errno = hold_errno;
     }
     return result;
@@ -45,10 +52,12 @@ explain_fseek_on_error(FILE *fp, long offset, int whence)
 void
 explain_fseek_or_die(FILE *fp, long offset, int whence)
 {
+    explain_output_or_die_begin();
     if (explain_fseek_on_error(fp, offset, whence) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
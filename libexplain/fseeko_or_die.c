@@ -20,8 +20,10 @@
 #include <libexplain/ac/stdio.h>
 #include <libexplain/ac/sys/types.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fseeko.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -30,7 +32,9 @@ explain_fseeko_on_error(FILE *fp, off_t offset, int whence)
     int             result;
 
 #ifdef HAVE_FSEEKO
+    explain_explanation_call_begin();
     result = fseeko(fp, offset, whence);
+    explain_explanation_call_end();
 #else
     result = -1;
     errno = ENOSYS;
@@ -40,8 +44,11 @@ explain_fseeko_on_error(FILE *fp, off_t offset, int whence)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fseeko(hold_errno, fp,
-            offset, whence));
+        if (!explain_output_suppress("fseeko", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_fseeko(hold_errno, fp,
+                offset, whence));
+        }
         errno = hold_errno;
     }
     return result;
@@ -51,10 +58,12 @@ explain_fseeko_on_error(FILE *fp, off_t offset, int whence)
 void
 explain_fseeko_or_die(FILE *fp, off_t offset, int whence)
 {
+    explain_output_or_die_begin();
     if (explain_fseeko_on_error(fp, offset, whence) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fstat.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_fstat_on_error(int fildes, struct stat *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fstat(fildes, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fstat(hold_errno, fildes,
-            data));
+        if (!explain_output_suppress("fstat", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fstat(hold_errno, fildes,
+                data));
+        }
         errno = hold_errno;
     }
     return result;
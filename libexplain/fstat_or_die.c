@@ -20,15 +20,18 @@
 
 #include <libexplain/fstat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fstat_or_die(int fildes, struct stat *data)
 {
+    explain_output_or_die_begin();
     if (explain_fstat_on_error(fildes, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,18 +19,22 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fstatat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fstatat_or_die(int fildes, const char *pathname, struct stat *data,
     int flags)
 {
+    explain_output_or_die_begin();
     if (explain_fstatat_on_error(fildes, pathname, data, flags) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -41,7 +45,9 @@ explain_fstatat_on_error(int fildes, const char *pathname, struct stat *data,
     int             result;
 
 #ifdef HAVE_FSTATAT
+    explain_explanation_call_begin();
     result = fstatat(fildes, pathname, data, flags);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -51,11 +57,15 @@ explain_fstatat_on_error(int fildes, const char *pathname, struct stat *data,
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_fstatat(hold_errno, fildes, pathname, data, flags)
-        );
+        if (!explain_output_suppress("fstatat", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_fstatat(hold_errno, fildes, pathname, data,
+                    flags)
+            );
+        }
         errno = hold_errno;
     }
     return result;
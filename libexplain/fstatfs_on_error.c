@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/mount.h>
 #include <libexplain/ac/sys/statfs.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fstatfs.h>
 #include <libexplain/output.h>
 
@@ -30,11 +31,13 @@ explain_fstatfs_on_error(int fildes, struct statfs *data)
     int             result;
 
 #ifdef HAVE_FSTATFS
+    explain_explanation_call_begin();
 #if STATFS_NARGS == 4
     result = fstatfs(fildes, data, 0, 0);
 #else
     result = fstatfs(fildes, data);
 #endif
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -44,8 +47,11 @@ explain_fstatfs_on_error(int fildes, struct statfs *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fstatfs(hold_errno, fildes,
-            data));
+        if (!explain_output_suppress("fstatfs", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fstatfs(hold_errno,
+                fildes, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,15 +18,18 @@
 
 #include <libexplain/fstatfs.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fstatfs_or_die(int fildes, struct statfs *data)
 {
+    explain_output_or_die_begin();
     if (explain_fstatfs_on_error(fildes, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
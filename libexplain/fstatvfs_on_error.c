@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/statvfs.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/fstatvfs.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_fstatvfs_on_error(int fildes, struct statvfs *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = fstatvfs(fildes, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_fstatvfs(hold_errno,
-            fildes, data));
+        if (!explain_output_suppress("fstatvfs", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_fstatvfs(hold_errno,
+                fildes, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/fstatvfs.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_fstatvfs_or_die(int fildes, struct statvfs *data)
 {
+    explain_output_or_die_begin();
     if (explain_fstatvfs_on_error(fildes, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -452,4 +452,20 @@ explain_fstrcasecmp(const char *s1, const char *s2)
 }
 
 
+int
+explain_fstrcmp_could_beat(size_t len1, size_t len2, double best)
+{
+    size_t          diff;
+
+    /*
+     * At least the difference in length must be inserted or deleted,
+     * which bounds the weight from above.
+     */
+    if (len1 + len2 == 0)
+        return (1 > best);
+    diff = (len1 < len2 ? len2 - len1 : len1 - len2);
+    return (1 - (double)diff / (len1 + len2) > best);
+}
+
+
 /* vim: set ts=8 sw=4 et : */
@@ -20,6 +20,8 @@
 #ifndef LIBEXPLAIN_FSTRCMP_H
 #define LIBEXPLAIN_FSTRCMP_H
 
+#include <libexplain/ac/stddef.h>
+
 /**
   * The explain_fstrcmp function may be used to compare two strings.
   * The order of the strings has no effect on the result.
@@ -62,5 +64,25 @@ double explain_fstrcmp(const char *s1, const char *s2);
   */
 double explain_fstrcasecmp(const char *s1, const char *s2);
 
+/**
+  * The explain_fstrcmp_could_beat function may be used to decide,
+  * from their lengths alone, whether two strings could possibly be
+  * more similar than the best match found so far.  It is much cheaper
+  * than #explain_fstrcmp, so that most candidates of a "did you mean"
+  * search need not be compared at all.  The answer is the same for
+  * #explain_fstrcasecmp.
+  *
+  * @param len1
+  *     The length of the first string.
+  * @param len2
+  *     The length of the second string.
+  * @param best
+  *     The best weight found so far.
+  * @returns
+  *     true (non-zero) if explain_fstrcmp of the two strings could
+  *     return a weight greater than best, false (zero) if it can't.
+  */
+int explain_fstrcmp_could_beat(size_t len1, size_t len2, double best);
+
 #endif /* LIBEXPLAIN_FSTRCMP_H */
 /* vim: set ts=8 sw=4 et : */
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ftell.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 long
@@ -28,13 +30,18 @@ explain_ftell_on_error(FILE *fp)
 {
     long            result;
 
+    explain_explanation_call_begin();
     result = ftell(fp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_ftell(hold_errno, fp));
+        if (!explain_output_suppress("ftell", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_ftell(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -46,7 +53,9 @@ explain_ftell_or_die(FILE *fp)
 {
     long            result;
 
+    explain_output_or_die_begin();
     result = explain_ftell_on_error(fp);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -20,8 +20,10 @@
 #include <libexplain/ac/stdio.h>
 #include <libexplain/ac/sys/types.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ftello.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 off_t
@@ -29,7 +31,9 @@ explain_ftello_or_die(FILE *fp)
 {
     off_t           result;
 
+    explain_output_or_die_begin();
     result = explain_ftello_on_error(fp);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -44,7 +48,9 @@ explain_ftello_on_error(FILE *fp)
     off_t           result;
 
 #ifdef HAVE_FTELLO
+    explain_explanation_call_begin();
     result = ftello(fp);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -54,11 +60,14 @@ explain_ftello_on_error(FILE *fp)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_ftello(hold_errno, fp)
-        );
+        if (!explain_output_suppress("ftello", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_ftello(hold_errno, fp)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,18 +20,22 @@
 #include <libexplain/ac/time.h>
 #include <libexplain/ac/sys/timeb.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ftime.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/is_efault.h>
 
 
 void
 explain_ftime_or_die(struct timeb *tp)
 {
+    explain_output_or_die_begin();
     if (explain_ftime_on_error(tp) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -66,13 +70,18 @@ explain_ftime_on_error(struct timeb *tp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = ftime(tp);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_ftime(hold_errno, tp));
+        if (!explain_output_suppress("ftime", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_ftime(hold_errno, tp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ftruncate.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_ftruncate_on_error(int fildes, off_t length)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = ftruncate(fildes, length);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_ftruncate(hold_errno,
-            fildes, length));
+        if (!explain_output_suppress("ftruncate", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_ftruncate(hold_errno,
+                fildes, length));
+        }
         errno = hold_errno;
     }
     return result;
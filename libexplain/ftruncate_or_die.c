@@ -20,15 +20,18 @@
 
 #include <libexplain/ftruncate.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_ftruncate_or_die(int fildes, off_t length)
 {
+    explain_output_or_die_begin();
     if (explain_ftruncate_on_error(fildes, length) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
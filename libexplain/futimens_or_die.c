@@ -20,17 +20,21 @@
 #include <libexplain/ac/sys/stat.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/futimens.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_futimens_or_die(int fildes, const struct timespec *data)
 {
+    explain_output_or_die_begin();
     if (explain_futimens_on_error(fildes, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -40,7 +44,9 @@ explain_futimens_on_error(int fildes, const struct timespec *data)
     int             result;
 
 #ifdef HAVE_FUTIMENS
+    explain_explanation_call_begin();
     result = futimens(fildes, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -50,11 +56,14 @@ explain_futimens_on_error(int fildes, const struct timespec *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_futimens(hold_errno, fildes, data)
-        );
+        if (!explain_output_suppress("futimens", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_futimens(hold_errno, fildes, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
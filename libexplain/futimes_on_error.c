@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/futimes.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_futimes_on_error(int fildes, const struct timeval *tv)
     int             result;
 
 #ifdef HAVE_FUTIMES
+    explain_explanation_call_begin();
     result = futimes(fildes, tv);
+    explain_explanation_call_end();
 #ifdef __linux__
     if (result > 0)
     {
@@ -52,8 +55,11 @@ explain_futimes_on_error(int fildes, const struct timeval *tv)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_futimes(hold_errno, fildes,
-            tv));
+        if (!explain_output_suppress("futimes", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_futimes(hold_errno,
+                fildes, tv));
+        }
         errno = hold_errno;
     }
     return result;
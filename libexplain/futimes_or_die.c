@@ -20,15 +20,18 @@
 
 #include <libexplain/futimes.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_futimes_or_die(int fildes, const struct timeval *tv)
 {
+    explain_output_or_die_begin();
     if (explain_futimes_on_error(fildes, tv) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -19,18 +19,22 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/futimesat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_futimesat_or_die(int fildes, const char *pathname, const struct timeval
     *data)
 {
+    explain_output_or_die_begin();
     if (explain_futimesat_on_error(fildes, pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -41,7 +45,9 @@ explain_futimesat_on_error(int fildes, const char *pathname, const struct
     int             result;
 
 #ifdef HAVE_FUTIMESAT
+    explain_explanation_call_begin();
     result = futimesat(fildes, pathname, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -51,11 +57,14 @@ explain_futimesat_on_error(int fildes, const char *pathname, const struct
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_futimesat(hold_errno, fildes, pathname, data)
-        );
+        if (!explain_output_suppress("futimesat", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_futimesat(hold_errno, fildes, pathname, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/netdb.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getaddrinfo.h>
 #include <libexplain/output.h>
 
@@ -30,17 +31,22 @@ explain_getaddrinfo_on_error(const char *node, const char *service,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getaddrinfo(node, service, hints, res);
+    explain_explanation_call_end();
     assert(EAI_SYSTEM < 0);
     if (result == EAI_SYSTEM)
         result = errno;
     if (result)
     {
         /* don't need hold_errno */
-        explain_output_message
-        (
-            explain_errcode_getaddrinfo(result, node, service, hints, res)
-        );
+        if (!explain_output_suppress("getaddrinfo", result, -1))
+        {
+            explain_output_message
+            (
+                explain_errcode_getaddrinfo(result, node, service, hints, res)
+            );
+        }
     }
     return result;
 }
@@ -22,16 +22,19 @@
 
 #include <libexplain/getaddrinfo.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getaddrinfo_or_die(const char *node, const char *service,
     const struct addrinfo *hints, struct addrinfo **res)
 {
+    explain_output_or_die_begin();
     if (explain_getaddrinfo_on_error(node, service, hints, res))
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
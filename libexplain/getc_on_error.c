@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getc.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_getc_on_error(FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getc(fp);
+    explain_explanation_call_end();
     if (result == EOF && ferror(fp))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getc(hold_errno, fp));
+        if (!explain_output_suppress("getc", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getc(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getchar.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_getchar_on_error(void)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getchar();
+    explain_explanation_call_end();
     if (result == EOF && ferror(stdin))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getchar(hold_errno));
+        if (!explain_output_suppress("getchar", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getchar(hold_errno));
+        }
         errno = hold_errno;
     }
     return result;
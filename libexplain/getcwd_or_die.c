@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getcwd.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 char *
@@ -28,14 +30,19 @@ explain_getcwd_on_error(char *data, size_t data_size)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = getcwd(data, data_size);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getcwd(hold_errno, data,
-            data_size));
+        if (!explain_output_suppress("getcwd", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getcwd(hold_errno, data,
+                data_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -47,7 +54,9 @@ explain_getcwd_or_die(char *data, size_t data_size)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_getcwd_on_error(data, data_size);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getdomainname.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -29,7 +31,9 @@ explain_getdomainname_on_error(char *data, size_t data_size)
     int             result;
 
 #ifdef HAVE_GETDOMAINNAME
+    explain_explanation_call_begin();
     result = getdomainname(data, data_size);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +43,11 @@ explain_getdomainname_on_error(char *data, size_t data_size)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getdomainname(hold_errno,
-            data, data_size));
+        if (!explain_output_suppress("getdomainname", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getdomainname(hold_errno,
+                data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -50,10 +57,12 @@ explain_getdomainname_on_error(char *data, size_t data_size)
 void
 explain_getdomainname_or_die(char *data, size_t data_size)
 {
+    explain_output_or_die_begin();
     if (explain_getdomainname_on_error(data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
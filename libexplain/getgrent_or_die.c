@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/grp.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getgrent.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 struct group *
@@ -31,7 +33,9 @@ explain_getgrent_or_die(void)
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_getgrent_on_error();
+    explain_output_or_die_end();
     if (!result)
     {
         /*
@@ -59,7 +63,9 @@ explain_getgrent_on_error(void)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_GETGRENT
+    explain_explanation_call_begin();
     result = getgrent();
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = 0;
@@ -77,7 +83,10 @@ explain_getgrent_on_error(void)
         if (errno != 0)
         {
             hold_errno = errno;
-            explain_output_error("%s", explain_errno_getgrent(hold_errno));
+            if (!explain_output_suppress("getgrent", hold_errno, -1))
+            {
+                explain_output_error("%s", explain_errno_getgrent(hold_errno));
+            }
         }
     }
     errno = hold_errno;
@@ -20,18 +20,22 @@
 #include <libexplain/ac/sys/types.h>
 #include <libexplain/ac/grp.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getgrouplist.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getgrouplist_or_die(const char *user, gid_t group, gid_t *groups, int
     *ngroups)
 {
+    explain_output_or_die_begin();
     if (explain_getgrouplist_on_error(user, group, groups, ngroups) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -114,7 +118,9 @@ explain_getgrouplist_on_error(const char *user, gid_t group, gid_t *groups,
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_GETGROUPLIST
+    explain_explanation_call_begin();
     result = getgrouplist(user, group, groups, ngroups);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -133,11 +139,15 @@ explain_getgrouplist_on_error(const char *user, gid_t group, gid_t *groups,
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_getgrouplist(hold_errno, user, group, groups, ngroups)
-        );
+        if (!explain_output_suppress("getgrouplist", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_getgrouplist(hold_errno, user, group, groups,
+                    ngroups)
+            );
+        }
     }
     errno = hold_errno;
     return result;
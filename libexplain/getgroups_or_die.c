@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getgroups.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,14 +30,19 @@ explain_getgroups_on_error(int data_size, gid_t *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getgroups(data_size, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getgroups(hold_errno,
-            data_size, data));
+        if (!explain_output_suppress("getgroups", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getgroups(hold_errno,
+                data_size, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -47,7 +54,9 @@ explain_getgroups_or_die(int data_size, gid_t *data)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_getgroups_on_error(data_size, data);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
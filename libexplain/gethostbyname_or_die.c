@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/netdb.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/gethostbyname.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 struct hostent *
@@ -28,7 +30,9 @@ explain_gethostbyname_or_die(const char *name)
 {
     struct hostent  *result;
 
+    explain_output_or_die_begin();
     result = explain_gethostbyname_on_error(name);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -43,7 +47,9 @@ explain_gethostbyname_on_error(const char *name)
     struct hostent  *result;
 
 #ifdef HAVE_GETHOSTBYNAME
+    explain_explanation_call_begin();
     result = gethostbyname(name);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
 #ifdef NETDB_INTERNAL
@@ -60,11 +66,14 @@ explain_gethostbyname_on_error(const char *name)
 
         hold_errno = errno;
         hold_h_errno = h_errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_gethostbyname(hold_h_errno, name)
-        );
+        if (!explain_output_suppress("gethostbyname", hold_h_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_gethostbyname(hold_h_errno, name)
+            );
+        }
         errno = hold_errno;
         h_errno = hold_h_errno;
     }
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/gethostid.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 long
@@ -29,7 +31,9 @@ explain_gethostid_or_die(void)
     long            result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_gethostid_on_error();
+    explain_output_or_die_end();
     if (errno != 0)
     {
         explain_output_exit_failure();
@@ -47,7 +51,9 @@ explain_gethostid_on_error(void)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_GETHOSTID
+    explain_explanation_call_begin();
     result = gethostid();
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -55,11 +61,14 @@ explain_gethostid_on_error(void)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_gethostid(hold_errno)
-        );
+        if (!explain_output_suppress("gethostid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_gethostid(hold_errno)
+            );
+        }
     }
     errno = hold_errno;
     return result;
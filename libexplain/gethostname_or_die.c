@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/gethostname.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_gethostname_or_die(char *data, size_t data_size)
 {
+    explain_output_or_die_begin();
     if (explain_gethostname_on_error(data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_gethostname_on_error(char *data, size_t data_size)
     int             result;
 
 #ifdef HAVE_GETHOSTNAME
+    explain_explanation_call_begin();
     result = gethostname(data, data_size);
+    explain_explanation_call_end();
     if (result >= 0 && data_size > 0)
     {
         /*
@@ -64,8 +70,11 @@ explain_gethostname_on_error(char *data, size_t data_size)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_gethostname(hold_errno,
-            data, data_size));
+        if (!explain_output_suppress("gethostname", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_gethostname(hold_errno,
+                data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/socket.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getpeername.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_getpeername_on_error(int fildes, struct sockaddr *sock_addr,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getpeername(fildes, sock_addr, sock_addr_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getpeername(hold_errno,
-            fildes, sock_addr, sock_addr_size));
+        if (!explain_output_suppress("getpeername", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_getpeername(hold_errno,
+                fildes, sock_addr, sock_addr_size));
+        }
         errno = hold_errno;
     }
     return result;
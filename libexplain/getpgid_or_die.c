@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getpgid.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 pid_t
@@ -28,7 +30,9 @@ explain_getpgid_or_die(pid_t pid)
 {
     pid_t           result;
 
+    explain_output_or_die_begin();
     result = explain_getpgid_on_error(pid);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -42,13 +46,18 @@ explain_getpgid_on_error(pid_t pid)
 {
     pid_t           result;
 
+    explain_explanation_call_begin();
     result = getpgid(pid);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getpgid(hold_errno, pid));
+        if (!explain_output_suppress("getpgid", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getpgid(hold_errno, pid));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getpgrp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 pid_t
@@ -28,7 +30,9 @@ explain_getpgrp_or_die(pid_t pid)
 {
     pid_t           result;
 
+    explain_output_or_die_begin();
     result = explain_getpgrp_on_error(pid);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -42,6 +46,7 @@ explain_getpgrp_on_error(pid_t pid)
 {
     pid_t           result;
 
+    explain_explanation_call_begin();
     result =
         getpgrp
         (
@@ -49,12 +54,16 @@ explain_getpgrp_on_error(pid_t pid)
             pid
 #endif
         );
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getpgrp(hold_errno, pid));
+        if (!explain_output_suppress("getpgrp", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getpgrp(hold_errno, pid));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/resource.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getpriority.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -36,7 +38,9 @@ explain_getpriority_or_die(int which, int who)
      * necessary to clear the external variable errno prior to the call, then
      * check it afterward to determine if -1 is an error or a legitimate value.
      */
+    explain_output_or_die_begin();
     result = explain_getpriority_on_error(which, who);
+    explain_output_or_die_end();
     if (errno != 0)
         hold_errno = errno;
     if (result == -1 && hold_errno != 0)
@@ -57,7 +61,9 @@ explain_getpriority_on_error(int which, int who)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_GETPRIORITY
+    explain_explanation_call_begin();
     result = getpriority(which, who);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -65,11 +71,14 @@ explain_getpriority_on_error(int which, int who)
     if (result == -1 && errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_getpriority(hold_errno, which, who)
-        );
+        if (!explain_output_suppress("getpriority", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_getpriority(hold_errno, which, who)
+            );
+        }
         errno = hold_errno;
         result = -1;
     }
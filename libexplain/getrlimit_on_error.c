@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/resource.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getrlimit.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_getrlimit_on_error(int resource, struct rlimit *rlim)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getrlimit(resource, rlim);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getrlimit(hold_errno,
-            resource, rlim));
+        if (!explain_output_suppress("getrlimit", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getrlimit(hold_errno,
+                resource, rlim));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/getrlimit.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getrlimit_or_die(int resource, struct rlimit *rlim)
 {
+    explain_output_or_die_begin();
     if (explain_getrlimit_on_error(resource, rlim) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
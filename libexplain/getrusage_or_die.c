@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/resource.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getrusage.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getrusage_or_die(int who, struct rusage *usage)
 {
+    explain_output_or_die_begin();
     if (explain_getrusage_on_error(who, usage) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_getrusage_on_error(int who, struct rusage *usage)
     int             result;
 
 #ifdef HAVE_GETRUSAGE
+    explain_explanation_call_begin();
     result = getrusage(who, usage);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_getrusage_on_error(int who, struct rusage *usage)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_getrusage(hold_errno, who, usage)
-        );
+        if (!explain_output_suppress("getrusage", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_getrusage(hold_errno, who, usage)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,16 +20,19 @@
 
 #include <libexplain/getsockname.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getsockname_or_die(int fildes, struct sockaddr *sock_addr,
     socklen_t *sock_addr_size)
 {
+    explain_output_or_die_begin();
     if (explain_getsockname_on_error(fildes, sock_addr, sock_addr_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/socket.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getsockopt.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_getsockopt_on_error(int fildes, int level, int name, void *data,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getsockopt(fildes, level, name, data, data_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getsockopt(hold_errno,
-            fildes, level, name, data, data_size));
+        if (!explain_output_suppress("getsockopt", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_getsockopt(hold_errno,
+                fildes, level, name, data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,16 +20,19 @@
 
 #include <libexplain/getsockopt.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_getsockopt_or_die(int fildes, int level, int name, void *data,
     socklen_t *data_size)
 {
+    explain_output_or_die_begin();
     if (explain_getsockopt_on_error(fildes, level, name, data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -17,14 +17,93 @@
  */
 
 #include <libexplain/ac/libintl.h>
+#include <libexplain/ac/locale.h>
+#include <libexplain/ac/stddef.h>
+#include <libexplain/ac/string.h>
 
 #include <libexplain/gettext.h>
 
+/*
+ * Each explanation asks for a dozen or more translations, and dgettext
+ * takes a lock and hashes the text each time.  Since the msgid strings
+ * are literals, a cache keyed on the pointer makes a repeat lookup one
+ * comparison.  It is per thread, so it needs no lock, and it is
+ * emptied whenever the message catalogues change: setlocale,
+ * textdomain and bindtextdomain all increment _nl_msg_cat_cntr, and a
+ * thread's uselocale setting is checked as well.
+ */
+#if defined(HAVE_GETTEXT) && defined(HAVE_NL_MSG_CAT_CNTR) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define GETTEXT_CACHE 1
+#endif
+
+#ifdef GETTEXT_CACHE
+
+/*
+ * The number of translations remembered (per thread).  The cache is
+ * direct mapped, a collision simply replaces the older translation.
+ */
+#define CACHE_SIZE 256
+
+typedef struct cache_entry_t cache_entry_t;
+struct cache_entry_t
+{
+    const char      *msgid;
+    const char      *msgstr;
+};
+
+extern int _nl_msg_cat_cntr;
+
+static __thread cache_entry_t cache[CACHE_SIZE];
+static __thread int cache_generation = -1;
+#ifdef HAVE_USELOCALE
+static __thread locale_t cache_locale;
+#endif
+
+
+static const char *
+cached_dgettext(const char *text)
+{
+    cache_entry_t   *ep;
+
+    if
+    (
+        cache_generation != _nl_msg_cat_cntr
+#ifdef HAVE_USELOCALE
+    ||
+        cache_locale != uselocale((locale_t)0)
+#endif
+    )
+    {
+        memset(cache, 0, sizeof(cache));
+        cache_generation = _nl_msg_cat_cntr;
+#ifdef HAVE_USELOCALE
+        cache_locale = uselocale((locale_t)0);
+#endif
+    }
+
+    /*
+     * The low bits of a string address say little, the alignment of
+     * string literals is often 8 or more.
+     */
+    ep = &cache[((size_t)text >> 3) % CACHE_SIZE];
+    if (ep->msgid != text)
+    {
+        ep->msgstr = dgettext("libexplain", text);
+        ep->msgid = text;
+    }
+    return ep->msgstr;
+}
+
+#endif
+
 
 const char *
 explain_gettext(const char *text)
 {
-#ifdef HAVE_GETTEXT
+#ifdef GETTEXT_CACHE
+    return cached_dgettext(text);
+#elif defined(HAVE_GETTEXT)
     return dgettext("libexplain", text);
 #else
     return text;
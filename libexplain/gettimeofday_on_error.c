@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/gettimeofday.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_gettimeofday_on_error(struct timeval *tv, struct timezone *tz)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = gettimeofday(tv, tz);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_gettimeofday(hold_errno,
-            tv, tz));
+        if (!explain_output_suppress("gettimeofday", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_gettimeofday(hold_errno,
+                tv, tz));
+        }
         errno = hold_errno;
     }
     return result;
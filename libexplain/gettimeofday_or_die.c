@@ -20,15 +20,18 @@
 
 #include <libexplain/gettimeofday.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_gettimeofday_or_die(struct timeval *tv, struct timezone *tz)
 {
+    explain_output_or_die_begin();
     if (explain_gettimeofday_on_error(tv, tz) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
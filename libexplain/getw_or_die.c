@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/getw.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,13 +30,18 @@ explain_getw_on_error(FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = getw(fp);
+    explain_explanation_call_end();
     if (result == EOF && ferror(fp))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_getw(hold_errno, fp));
+        if (!explain_output_suppress("getw", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_getw(hold_errno, fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -46,7 +53,9 @@ explain_getw_or_die(FILE *fp)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_getw_on_error(fp);
+    explain_output_or_die_end();
     if (result == EOF && ferror(fp))
     {
         explain_output_exit_failure();
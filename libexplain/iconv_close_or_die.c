@@ -19,18 +19,22 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/iconv.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/iconv_close.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_iconv_close_or_die(iconv_t cd)
 {
     errno = 0;
+    explain_output_or_die_begin();
     if (explain_iconv_close_on_error(cd) < 0 || errno != 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -43,7 +47,9 @@ explain_iconv_close_on_error(iconv_t cd)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_ICONV_CLOSE
+    explain_explanation_call_begin();
     result = iconv_close(cd);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -51,7 +57,11 @@ explain_iconv_close_on_error(iconv_t cd)
     if (result < 0 || errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_iconv_close(hold_errno, cd));
+        if (!explain_output_suppress("iconv_close", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_iconv_close(hold_errno,
+                cd));
+        }
     }
     errno = hold_errno;
     return result;
@@ -0,0 +1,492 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+#include <libexplain/ac/sys/stat.h>
+
+#include <libexplain/directory_scan.h>
+#include <libexplain/fstrcmp.h>
+#include <libexplain/iconv_names.h>
+#include <libexplain/run_command.h>
+#include <libexplain/sizeof.h>
+
+
+/*
+ * The known names are kept in an open addressing hash set, for
+ * checking, and also in an array, for suggesting alternatives.
+ */
+static char     **name;
+static size_t   name_length;
+static size_t   name_maximum;
+static char     **slot;
+static size_t   slot_maximum;
+static int      loaded;
+
+
+/*
+ * This is the FNV-1a hash.
+ */
+
+static unsigned long
+hash(const char *s)
+{
+    unsigned long   h;
+
+    h = 2166136261uL;
+    while (*s)
+        h = ((h ^ (unsigned char)*s++) * 16777619uL) & 0xFFFFFFFFuL;
+    return h;
+}
+
+
+static size_t
+find_slot(const char *text)
+{
+    size_t          j;
+
+    j = hash(text) & (slot_maximum - 1);
+    while (slot[j] && 0 != strcmp(slot[j], text))
+        j = (j + 1) & (slot_maximum - 1);
+    return j;
+}
+
+
+static int
+grow(void)
+{
+    char            **old_slot;
+    size_t          old_maximum;
+    size_t          j;
+
+    old_slot = slot;
+    old_maximum = slot_maximum;
+    slot_maximum = (old_maximum ? old_maximum * 2 : 1024);
+    slot = calloc(slot_maximum, sizeof(slot[0]));
+    if (!slot)
+    {
+        slot = old_slot;
+        slot_maximum = old_maximum;
+        return -1;
+    }
+    for (j = 0; j < old_maximum; ++j)
+        if (old_slot[j])
+            slot[find_slot(old_slot[j])] = old_slot[j];
+    free(old_slot);
+    return 0;
+}
+
+
+/*
+ * The names are normalized the way eglibc::iconv/iconv_open.c does
+ * it: upper case, discarding all characters beside alpha-numeric,
+ * '_', '-', '.', and ':'.  Anything from the first '/' on is an
+ * option (such as "//TRANSLIT") or a gconv module detail, and is
+ * ignored.
+ */
+
+static void
+normalize(const char *ip, char *op, size_t op_size)
+{
+    char            *op_end;
+
+    op_end = op + op_size - 1;
+    for (;;)
+    {
+        unsigned char   c;
+
+        c = *ip++;
+        if (!c || c == '/' || c == ',' || isspace(c))
+            break;
+        if (op >= op_end)
+            break;
+        if (islower(c))
+            *op++ = toupper(c);
+        else if (isalnum(c) || strchr("_-.:", c))
+            *op++ = c;
+    }
+    *op = '\0';
+}
+
+
+static void
+add(const char *text)
+{
+    char            normal[100];
+    size_t          j;
+    char            *copy;
+    size_t          copy_size;
+
+    normalize(text, normal, sizeof(normal));
+    if (!normal[0] || 0 == strcmp(normal, "INTERNAL"))
+        return;
+    if ((name_length + 1) * 2 > slot_maximum && grow() < 0)
+        return;
+    j = find_slot(normal);
+    if (slot[j])
+        return;
+    if (name_length >= name_maximum)
+    {
+        size_t          new_maximum;
+        char            **new_name;
+
+        new_maximum = name_maximum * 2 + 256;
+        new_name = realloc(name, new_maximum * sizeof(name[0]));
+        if (!new_name)
+            return;
+        name = new_name;
+        name_maximum = new_maximum;
+    }
+    copy_size = strlen(normal) + 1;
+    copy = malloc(copy_size);
+    if (!copy)
+        return;
+    memcpy(copy, normal, copy_size);
+    slot[j] = copy;
+    name[name_length++] = copy;
+}
+
+
+/*
+ * Each line of a gconv-modules file is one of
+ *     alias <alias> <name>
+ *     module <from> <to> <file> [ <cost> ]
+ * and all but the file name are character set names.
+ */
+
+static void
+read_config(const char *path)
+{
+    FILE            *fp;
+    char            line[1000];
+
+    fp = fopen(path, "r");
+    if (!fp)
+        return;
+    while (fgets(line, sizeof(line), fp))
+    {
+        char            *word[4];
+        int             nwords;
+        char            *cp;
+
+        cp = strchr(line, '#');
+        if (cp)
+            *cp = '\0';
+        nwords = 0;
+        cp = line;
+        while (nwords < 4)
+        {
+            while (*cp && isspace((unsigned char)*cp))
+                ++cp;
+            if (!*cp)
+                break;
+            word[nwords++] = cp;
+            while (*cp && !isspace((unsigned char)*cp))
+                ++cp;
+            if (*cp)
+                *cp++ = '\0';
+        }
+        if (nwords >= 3 && 0 == strcmp(word[0], "alias"))
+        {
+            add(word[1]);
+            add(word[2]);
+        }
+        else if (nwords >= 4 && 0 == strcmp(word[0], "module"))
+        {
+            add(word[1]);
+            add(word[2]);
+        }
+    }
+    fclose(fp);
+}
+
+
+typedef struct conf_dir_t conf_dir_t;
+struct conf_dir_t
+{
+    const char      *dir;
+};
+
+
+static int
+read_conf_dir_one(void *context, const char *entry_name)
+{
+    conf_dir_t      *cp;
+    size_t          len;
+    char            path[PATH_MAX + 1];
+
+    cp = context;
+    len = strlen(entry_name);
+    if (len > 5 && 0 == strcmp(entry_name + len - 5, ".conf"))
+    {
+        snprintf(path, sizeof(path), "%s/%s", cp->dir, entry_name);
+        read_config(path);
+    }
+    return 0;
+}
+
+
+/*
+ * Read the gconv-modules file of a directory, and the *.conf files of
+ * its gconv-modules.d directory.  Returns 0 if there was one.
+ */
+
+static int
+read_gconv_dir(const char *dir)
+{
+    char            path[PATH_MAX + 1];
+    struct stat     st;
+    conf_dir_t      context;
+
+    snprintf(path, sizeof(path), "%s/gconv-modules", dir);
+    if (stat(path, &st) < 0)
+        return -1;
+    read_config(path);
+    snprintf(path, sizeof(path), "%s/gconv-modules.d", dir);
+    context.dir = path;
+    explain_directory_scan(path, read_conf_dir_one, &context);
+    return 0;
+}
+
+
+typedef struct multiarch_t multiarch_t;
+struct multiarch_t
+{
+    int             found;
+};
+
+
+static int
+multiarch_one(void *context, const char *entry_name)
+{
+    multiarch_t     *mp;
+    char            dir[PATH_MAX + 1];
+
+    mp = context;
+    snprintf(dir, sizeof(dir), "/usr/lib/%s/gconv", entry_name);
+    if (read_gconv_dir(dir) == 0)
+        mp->found = 1;
+    return mp->found;
+}
+
+
+/*
+ * These names are built into glibc (iconv/gconv_builtin.h), they are
+ * not in any configuration file.
+ */
+static const char *const builtin[] =
+{
+    "10646-1:1993", "ANSI_X3.4", "ANSI_X3.4-1968", "ANSI_X3.4-1986",
+    "ASCII", "CP367", "CSASCII", "CSUCS4", "IBM367", "ISO-10646",
+    "ISO-IR-193", "ISO-IR-6", "ISO646-US", "ISO_646.IRV:1991",
+    "OSF00010020", "OSF00010100", "OSF00010101", "OSF00010102",
+    "OSF00010104", "OSF00010105", "OSF00010106", "OSF05010001", "UCS-2",
+    "UCS-2BE", "UCS-2LE", "UCS-4", "UCS-4BE", "UCS-4LE", "UCS2", "UCS4",
+    "UNICODEBIG", "UNICODELITTLE", "US", "US-ASCII", "UTF-16", "UTF-16BE",
+    "UTF-16LE", "UTF-32", "UTF-32BE", "UTF-32LE", "UTF-7", "UTF-7-IMAP",
+    "UTF-8", "UTF8", "WCHAR_T",
+};
+
+
+static void
+load_from_iconv_list(void)
+{
+    static const char *const argv[] = { "iconv", "--list", NULL };
+    char            *output;
+    size_t          output_size;
+    char            *cp;
+
+    /*
+     * Not glibc, or not where we expected it.  The iconv(1) command
+     * may still know, at the cost of running it.
+     */
+    output =
+        explain_run_command
+        (
+            argv,
+            1L << 20,
+            EXPLAIN_RUN_COMMAND_TIMEOUT,
+            &output_size
+        );
+    if (!output)
+        return;
+
+    /* some versions list several names per line */
+    cp = output;
+    for (;;)
+    {
+        size_t          len;
+
+        cp += strspn(cp, ", \t\r\n");
+        if (!*cp)
+            break;
+        len = strcspn(cp, ", \t\r\n");
+        if (cp[len])
+            cp[len++] = '\0';
+        add(cp);
+        cp += len;
+    }
+    free(output);
+}
+
+
+static void
+load(void)
+{
+    const char      *gconv_path;
+    int             found;
+    size_t          j;
+
+    if (loaded)
+        return;
+    loaded = 1;
+    found = 0;
+
+    /*
+     * GCONV_PATH directories are searched before the default.
+     */
+    gconv_path = getenv("GCONV_PATH");
+    if (gconv_path)
+    {
+        const char      *cp;
+
+        cp = gconv_path;
+        while (*cp)
+        {
+            size_t          len;
+            char            dir[PATH_MAX + 1];
+
+            len = strcspn(cp, ":");
+            if (len > 0 && len < sizeof(dir))
+            {
+                memcpy(dir, cp, len);
+                dir[len] = '\0';
+                if (read_gconv_dir(dir) == 0)
+                    found = 1;
+            }
+            cp += len;
+            if (*cp == ':')
+                ++cp;
+        }
+    }
+
+    /*
+     * The default directory is compiled into glibc, so try the usual
+     * places, including the Debian multiarch directories.
+     */
+    if
+    (
+        read_gconv_dir("/usr/lib64/gconv") == 0
+    ||
+        read_gconv_dir("/usr/lib/gconv") == 0
+    )
+        found = 1;
+    else
+    {
+        multiarch_t     m;
+
+        m.found = 0;
+        explain_directory_scan("/usr/lib", multiarch_one, &m);
+        if (m.found)
+            found = 1;
+    }
+
+    if (found)
+    {
+        for (j = 0; j < SIZEOF(builtin); ++j)
+            add(builtin[j]);
+    }
+    else
+        load_from_iconv_list();
+}
+
+
+void
+explain_iconv_names_read(const char *path)
+{
+    size_t          j;
+
+    for (j = 0; j < name_length; ++j)
+        free(name[j]);
+    name_length = 0;
+    if (slot)
+        memset(slot, 0, slot_maximum * sizeof(slot[0]));
+    loaded = 1;
+    read_config(path);
+}
+
+
+int
+explain_iconv_name_is_known(const char *text)
+{
+    char            normal[100];
+
+    load();
+    if (name_length == 0)
+        return -1;
+    normalize(text, normal, sizeof(normal));
+    return (slot[find_slot(normal)] != 0);
+}
+
+
+const char *
+explain_iconv_name_fuzzy(const char *text)
+{
+    char            normal[100];
+    size_t          normal_length;
+    const char      *best_name;
+    double          best_weight;
+    size_t          j;
+
+    load();
+    normalize(text, normal, sizeof(normal));
+    normal_length = strlen(normal);
+    best_name = 0;
+    best_weight = 0.6;
+    for (j = 0; j < name_length; ++j)
+    {
+        double          w;
+
+        /* most names need not be compared at all */
+        if
+        (
+            !explain_fstrcmp_could_beat
+            (
+                strlen(name[j]),
+                normal_length,
+                best_weight
+            )
+        )
+            continue;
+        w = explain_fstrcmp(normal, name[j]);
+        if (w > best_weight)
+        {
+            best_name = name[j];
+            best_weight = w;
+        }
+    }
+    return best_name;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
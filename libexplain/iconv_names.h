@@ -0,0 +1,61 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_ICONV_NAMES_H
+#define LIBEXPLAIN_ICONV_NAMES_H
+
+/**
+  * The explain_iconv_name_is_known function may be used to determine
+  * whether or not a character set name is known to iconv_open(3).
+  * The names (and their aliases) are read from the gconv-modules
+  * configuration files once per process.
+  *
+  * @param name
+  *     The character set name of interest, as passed to iconv_open.
+  *     Case, and any "//" suffix, are ignored.
+  * @returns
+  *     1 if the name is known, 0 if it is not, or -1 if the list of
+  *     names could not be found (in which case nothing can be said).
+  */
+int explain_iconv_name_is_known(const char *name);
+
+/**
+  * The explain_iconv_name_fuzzy function may be used to find the known
+  * character set name most similar to the one given.
+  *
+  * @param name
+  *     The (unknown) character set name of interest.
+  * @returns
+  *     The most similar known name, or NULL if none is similar enough.
+  */
+const char *explain_iconv_name_fuzzy(const char *name);
+
+/**
+  * The explain_iconv_names_read function may be used to replace the
+  * known character set names with those of the given gconv-modules
+  * file, rather than those of the system.  This is intended for
+  * testing, so that the results do not depend on the host.
+  *
+  * @param path
+  *     The path of a file in gconv-modules format.
+  */
+void explain_iconv_names_read(const char *path);
+
+#endif /* LIBEXPLAIN_ICONV_NAMES_H */
+/* vim: set ts=8 sw=4 et : */
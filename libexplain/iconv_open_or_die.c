@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/iconv.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/iconv_open.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 #define FAIL ((iconv_t)(-1))
@@ -31,7 +33,9 @@ explain_iconv_open_or_die(const char *tocode, const char *fromcode)
 {
     iconv_t         result;
 
+    explain_output_or_die_begin();
     result = explain_iconv_open_on_error(tocode, fromcode);
+    explain_output_or_die_end();
     if (result == FAIL)
     {
         explain_output_exit_failure();
@@ -49,7 +53,9 @@ explain_iconv_open_on_error(const char *tocode, const char *fromcode)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_ICONV_OPEN
+    explain_explanation_call_begin();
     result = iconv_open(tocode, fromcode);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = FAIL;
@@ -57,11 +63,14 @@ explain_iconv_open_on_error(const char *tocode, const char *fromcode)
     if (result == FAIL)
     {
         hold_errno = errno ? errno : EINVAL;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_iconv_open(hold_errno, tocode, fromcode)
-        );
+        if (!explain_output_suppress("iconv_open", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_iconv_open(hold_errno, tocode, fromcode)
+            );
+        }
         errno = hold_errno;
     }
     errno = hold_errno;
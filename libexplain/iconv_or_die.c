@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/iconv.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/iconv.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 #define ICONV_FAIL ((size_t)(-1))
@@ -35,8 +37,10 @@ explain_iconv_or_die(iconv_t cd, char **inbuf, size_t *inbytesleft, char
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_iconv_on_error(cd, inbuf, inbytesleft, outbuf,
         outbytesleft);
+    explain_output_or_die_end();
     if (result == ICONV_FAIL || errno == 0)
     {
         explain_output_exit_failure();
@@ -56,7 +60,9 @@ explain_iconv_on_error(iconv_t cd, char **inbuf, size_t *inbytesleft, char
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_ICONV
+    explain_explanation_call_begin();
     result = iconv(cd, inbuf, inbytesleft, outbuf, outbytesleft);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = ICONV_FAIL;
@@ -65,12 +71,15 @@ explain_iconv_on_error(iconv_t cd, char **inbuf, size_t *inbytesleft, char
     {
         barf:
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_iconv(hold_errno, cd, inbuf, inbytesleft, outbuf,
-                outbytesleft)
-        );
+        if (!explain_output_suppress("iconv", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_iconv(hold_errno, cd, inbuf, inbytesleft, outbuf,
+                    outbytesleft)
+            );
+        }
     }
     else if (errno != 0)
     {
@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/ioctl.h> /* for ioctl() except Solaris */
 #include <libexplain/ac/unistd.h> /* for ioctl() on Solaris */
 
+#include <libexplain/explanation.h>
 #include <libexplain/ioctl.h>
 #include <libexplain/output.h>
 
@@ -32,14 +33,19 @@ explain_ioctl_on_error(int fildes, int request, void *data)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = ioctl(fildes, request, data);
+    explain_explanation_call_end();
     if (result == -1 && errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_ioctl(hold_errno, fildes, request, data)
-        );
+        if (!explain_output_suppress("ioctl", hold_errno, fildes))
+        {
+            explain_output_message
+            (
+                explain_errno_ioctl(hold_errno, fildes, request, data)
+            );
+        }
     }
     errno = hold_errno;
     return result;
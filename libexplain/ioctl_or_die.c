@@ -21,6 +21,7 @@
 
 #include <libexplain/ioctl.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -29,7 +30,9 @@ explain_ioctl_or_die(int fildes, int request, void *data)
     int             result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_ioctl_on_error(fildes, request, data);
+    explain_output_or_die_end();
     if (result == -1 && errno != 0)
     {
         explain_output_exit_failure();
@@ -21,6 +21,7 @@
 #define LIBEXPLAIN_PATH_IS_EFAULT_H
 
 #include <libexplain/ac/stddef.h>
+#include <libexplain/ac/sys/uio.h>
 
 /**
   * The explain_is_efault_path function may be used to determine whether
@@ -51,6 +52,91 @@ int explain_is_efault_path(const char *path);
   */
 int explain_is_efault_pointer(const void *data, size_t data_size);
 
+/**
+  * The explain_is_efault_maps function may be used to determine
+  * whether or not a pointer is valid, using a snapshot of the process
+  * address space read from /proc/self/maps.  The snapshot is kept,
+  * so that checking many pointers in the one explanation costs one
+  * parse and a binary search per pointer.
+  *
+  * @param data
+  *    Pointer to the base address of the memory to be checked.
+  * @param data_size
+  *    The size in bytes of the memory to be checked.
+  * @returns
+  *    int; 1 if the pointer is bad, 0 if the pointer is OK, or -1 if
+  *    the snapshot is not available and some other method must be
+  *    used.
+  */
+int explain_is_efault_maps(const void *data, size_t data_size);
+
+/**
+  * The explain_is_efault_maps_iovec function may be used to check
+  * all of the buffers of an I/O vector against the address space
+  * snapshot, in one pass.
+  *
+  * @param data
+  *    The I/O vector to be checked.  It must itself be valid.
+  * @param data_size
+  *    The number of elements in the I/O vector.
+  * @param verdict
+  *    Where to store the result for each element: 1 if the element's
+  *    buffer is bad, 0 if it is OK.
+  * @returns
+  *    int; the number of bad elements, or -1 if the snapshot is not
+  *    available and some other method must be used.
+  */
+int explain_is_efault_maps_iovec(const struct iovec *data, int data_size,
+    unsigned char *verdict);
+
+/**
+  * The explain_is_efault_maps_invalidate function is used to discard
+  * the address space snapshot used by #explain_is_efault_maps, so that
+  * it will be read again when next needed.  It is called at the start
+  * of each explanation.
+  */
+void explain_is_efault_maps_invalidate(void);
+
+/**
+  * The explain_is_efault_iovec function may be used to determine
+  * whether or not the buffers of an I/O vector are valid, as used by
+  * readv(2) and writev(2).  All of the buffers are checked at once,
+  * which is much cheaper than checking them one at a time.  Buffers
+  * of zero length are always OK, as the kernel does not access them.
+  *
+  * @param data
+  *    The I/O vector to be checked.  It must itself be valid.
+  * @param data_size
+  *    The number of elements in the I/O vector.
+  * @param verdict
+  *    Where to store the result for each element: 1 if the element's
+  *    buffer is bad, 0 if it is OK.  May be NULL if only the first bad
+  *    element is of interest.
+  * @returns
+  *    int; the index of the first bad element, or -1 if all of the
+  *    buffers are OK.
+  */
+int explain_is_efault_iovec(const struct iovec *data, int data_size,
+    unsigned char *verdict);
+
+/**
+  * The explain_is_efault_array function may be used to find the first
+  * element of an array which is not valid.  Because the valid part of
+  * an array is always a prefix, this takes a logarithmic number of
+  * pointer checks, not one per element.
+  *
+  * @param data
+  *    Pointer to the base address of the array.
+  * @param nmemb
+  *    The number of elements in the array.
+  * @param size
+  *    The size in bytes of each element.
+  * @returns
+  *    int; the index of the first element which is bad, or -1 if all
+  *    of the elements are OK.
+  */
+int explain_is_efault_array(const void *data, size_t nmemb, size_t size);
+
 /**
   * The explain_is_efault_string function may be used to determine
   * whether or not a C string is valid.  Typically this is used when
@@ -0,0 +1,56 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/is_efault.h>
+
+
+int
+explain_is_efault_array(const void *data, size_t nmemb, size_t size)
+{
+    size_t          lo;
+    size_t          hi;
+
+    if (nmemb == 0 || size == 0)
+        return -1;
+    if (!data || nmemb > (size_t)-1 / size)
+        return 0;
+    if (!explain_is_efault_pointer(data, nmemb * size))
+        return -1;
+
+    /*
+     * The first lo elements are known to be OK, and the first hi
+     * elements are known to be bad.
+     */
+    lo = 0;
+    hi = nmemb;
+    while (lo + 1 < hi)
+    {
+        size_t          mid;
+
+        mid = lo + (hi - lo) / 2;
+        if (explain_is_efault_pointer(data, mid * size))
+            hi = mid;
+        else
+            lo = mid;
+    }
+    return lo;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
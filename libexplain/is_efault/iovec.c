@@ -0,0 +1,90 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/stdlib.h>
+
+#include <libexplain/is_efault.h>
+
+
+int
+explain_is_efault_iovec(const struct iovec *data, int data_size,
+    unsigned char *verdict)
+{
+    unsigned char   stack_verdict[64];
+    unsigned char   *vp;
+    int             first;
+    int             j;
+
+    if (data_size <= 0)
+        return -1;
+    vp = verdict;
+    if (!vp)
+    {
+        if ((size_t)data_size <= sizeof(stack_verdict))
+            vp = stack_verdict;
+        else
+            vp = malloc(data_size);
+    }
+    if (!vp || explain_is_efault_maps_iovec(data, data_size, vp) < 0)
+    {
+        /*
+         * No snapshot, so do it the slow way, one buffer at a time.
+         */
+        first = -1;
+        for (j = 0; j < data_size; ++j)
+        {
+            int             bad;
+
+            bad =
+                (
+                    data[j].iov_len != 0
+                &&
+                    explain_is_efault_pointer
+                    (
+                        data[j].iov_base,
+                        data[j].iov_len
+                    )
+                );
+            if (bad && first < 0)
+                first = j;
+            if (verdict)
+                verdict[j] = bad;
+            else if (bad)
+                break;
+        }
+    }
+    else
+    {
+        first = -1;
+        for (j = 0; j < data_size; ++j)
+        {
+            if (vp[j])
+            {
+                first = j;
+                break;
+            }
+        }
+    }
+    if (vp && vp != verdict && vp != stack_verdict)
+        free(vp);
+    return first;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
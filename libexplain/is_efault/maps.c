@@ -0,0 +1,394 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/sys/uio.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/is_efault.h>
+#include <libexplain/statistics/probe.h>
+
+/*
+ * The snapshot is shared, but the explain_message_* functions are
+ * documented as thread safe, so it may only be used by one thread at
+ * a time.  A thread that finds it busy falls back to the slow method.
+ * Without an atomic test-and-set, the snapshot is not used at all.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) \
+    || defined(__clang__)
+#define HAVE_MAPS_SNAPSHOT 1
+#endif
+
+
+#ifdef HAVE_MAPS_SNAPSHOT
+
+typedef struct interval_t interval_t;
+struct interval_t
+{
+    unsigned long   lo;
+    unsigned long   hi;
+};
+
+/*
+ * The mapped address ranges of the process, in ascending order, with
+ * adjacent ranges merged, so that a buffer that spans several
+ * mappings can still be checked with a single lookup.
+ */
+static interval_t *interval;
+static size_t   interval_length;
+static size_t   interval_maximum;
+static int      snapshot_valid;
+static int      snapshot_stale;
+static int      busy;
+
+
+void
+explain_is_efault_maps_invalidate(void)
+{
+    snapshot_stale = 1;
+}
+
+
+static int
+append(unsigned long lo, unsigned long hi)
+{
+    if (lo >= hi)
+        return 0;
+    if (interval_length > 0 && interval[interval_length - 1].hi == lo)
+    {
+        interval[interval_length - 1].hi = hi;
+        return 0;
+    }
+    if (interval_length >= interval_maximum)
+    {
+        size_t          new_maximum;
+        interval_t      *new_interval;
+
+        new_maximum = interval_maximum * 2 + 64;
+        new_interval = realloc(interval, new_maximum * sizeof(interval[0]));
+        if (!new_interval)
+            return -1;
+        interval = new_interval;
+        interval_maximum = new_maximum;
+    }
+    interval[interval_length].lo = lo;
+    interval[interval_length].hi = hi;
+    ++interval_length;
+    return 0;
+}
+
+
+static int
+hex_digit(int c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+
+/*
+ * Each line of /proc/self/maps starts with "lo-hi " in hexadecimal;
+ * the rest of the line (permissions, inode, path) is not needed, so
+ * the file is read in blocks and parsed with a small state machine,
+ * rather than a line at a time.
+ */
+
+static int
+snapshot_read(void)
+{
+    int             fd;
+    int             state;
+    unsigned long   lo;
+    unsigned long   hi;
+    char            buf[4096];
+
+    snapshot_valid = 0;
+    interval_length = 0;
+    fd = open("/proc/self/maps", O_RDONLY);
+    if (fd < 0)
+        return -1;
+    state = 0;
+    lo = 0;
+    hi = 0;
+    for (;;)
+    {
+        ssize_t         n;
+        ssize_t         j;
+
+        n = read(fd, buf, sizeof(buf));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            close(fd);
+            return -1;
+        }
+        if (n == 0)
+            break;
+        for (j = 0; j < n; ++j)
+        {
+            int             c;
+            int             d;
+
+            c = (unsigned char)buf[j];
+            switch (state)
+            {
+            case 0:
+                d = hex_digit(c);
+                if (d >= 0)
+                    lo = (lo << 4) | d;
+                else if (c == '-')
+                    state = 1;
+                else
+                    state = 3;
+                break;
+
+            case 1:
+                d = hex_digit(c);
+                if (d >= 0)
+                    hi = (hi << 4) | d;
+                else if (c == ' ')
+                {
+                    if (append(lo, hi) < 0)
+                    {
+                        close(fd);
+                        return -1;
+                    }
+                    state = 2;
+                }
+                else
+                    state = 3;
+                break;
+
+            case 2:
+            default:
+                break;
+            }
+            if (c == '\n')
+            {
+                if (state != 2)
+                {
+                    /* a line we didn't understand */
+                    close(fd);
+                    return -1;
+                }
+                state = 0;
+                lo = 0;
+                hi = 0;
+            }
+        }
+    }
+    close(fd);
+    if (interval_length == 0)
+        return -1;
+    snapshot_valid = 1;
+    snapshot_stale = 0;
+    return 0;
+}
+
+
+static int
+snapshot(void)
+{
+    explain_probe_timer_t timer;
+    int             result;
+
+    explain_probe_begin(&timer, explain_probe_proc);
+    result = snapshot_read();
+    explain_probe_end(&timer);
+    return result;
+}
+
+
+static int
+lookup(unsigned long lo, unsigned long hi)
+{
+    size_t          min;
+    size_t          max;
+
+    /*
+     * Find the last interval starting at or below lo.
+     */
+    min = 0;
+    max = interval_length;
+    while (min < max)
+    {
+        size_t          mid;
+
+        mid = min + (max - min) / 2;
+        if (interval[mid].lo <= lo)
+            min = mid + 1;
+        else
+            max = mid;
+    }
+    if (min == 0)
+        return 0;
+    return (hi <= interval[min - 1].hi);
+}
+
+
+int
+explain_is_efault_maps(const void *data, size_t data_size)
+{
+    unsigned long   lo;
+    unsigned long   hi;
+    int             result;
+
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+    lo = (unsigned long)data;
+    hi = lo + (data_size ? data_size : 1);
+    if (hi < lo)
+    {
+        /* wraps around the end of the address space */
+        __sync_lock_release(&busy);
+        return 1;
+    }
+    result = -1;
+    if (snapshot_valid && !snapshot_stale && lookup(lo, hi))
+        result = 0;
+    else if (snapshot() == 0)
+    {
+        /*
+         * A miss in an old snapshot could be memory that has been
+         * mapped since, so misses are always decided by a fresh
+         * snapshot.
+         */
+        result = !lookup(lo, hi);
+    }
+    __sync_lock_release(&busy);
+    return result;
+}
+
+static int
+lookup_range(const void *data, size_t data_size)
+{
+    unsigned long   lo;
+    unsigned long   hi;
+
+    /*
+     * The kernel does not touch the buffer of an empty range, so it
+     * can't be the cause of an EFAULT.
+     */
+    if (data_size == 0)
+        return 1;
+    lo = (unsigned long)data;
+    hi = lo + data_size;
+    if (hi < lo)
+        return 0;
+    return lookup(lo, hi);
+}
+
+
+int
+explain_is_efault_maps_iovec(const struct iovec *data, int data_size,
+    unsigned char *verdict)
+{
+    int             j;
+    int             nbad;
+    int             refreshed;
+
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+    refreshed = 0;
+    if (!snapshot_valid || snapshot_stale)
+    {
+        if (snapshot() < 0)
+        {
+            __sync_lock_release(&busy);
+            return -1;
+        }
+        refreshed = 1;
+    }
+    nbad = 0;
+    for (j = 0; j < data_size; ++j)
+    {
+        const struct iovec *p;
+
+        p = data + j;
+        verdict[j] = !lookup_range(p->iov_base, p->iov_len);
+        if (verdict[j])
+            ++nbad;
+    }
+    if (nbad && !refreshed)
+    {
+        /*
+         * As for a single pointer, misses are decided by a fresh
+         * snapshot, but only one is needed for the whole vector.
+         */
+        if (snapshot() < 0)
+        {
+            __sync_lock_release(&busy);
+            return -1;
+        }
+        nbad = 0;
+        for (j = 0; j < data_size; ++j)
+        {
+            const struct iovec *p;
+
+            if (!verdict[j])
+                continue;
+            p = data + j;
+            verdict[j] = !lookup_range(p->iov_base, p->iov_len);
+            if (verdict[j])
+                ++nbad;
+        }
+    }
+    __sync_lock_release(&busy);
+    return nbad;
+}
+
+#else
+
+void
+explain_is_efault_maps_invalidate(void)
+{
+}
+
+
+int
+explain_is_efault_maps(const void *data, size_t data_size)
+{
+    (void)data;
+    (void)data_size;
+    return -1;
+}
+
+
+int
+explain_is_efault_maps_iovec(const struct iovec *data, int data_size,
+    unsigned char *verdict)
+{
+    (void)data;
+    (void)data_size;
+    (void)verdict;
+    return -1;
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -23,10 +23,11 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/is_efault.h>
+#include <libexplain/statistics/probe.h>
 
 
-int
-explain_is_efault_pointer(const void *data, size_t data_size)
+static int
+is_efault_pointer_slow(const void *data, size_t data_size)
 {
 #ifdef HAVE_MINCORE
     /* mincore doesn't seem to work as expected on 64-bit Linux */
@@ -125,4 +126,28 @@ explain_is_efault_pointer(const void *data, size_t data_size)
 }
 
 
+int
+explain_is_efault_pointer(const void *data, size_t data_size)
+{
+    int             result;
+    explain_probe_timer_t timer;
+
+    if (!data)
+        return 1;
+
+    /*
+     * Explanations often check many pointers (iovec arrays, ioctl
+     * data), so try the address space snapshot first, and only use
+     * the slow method when it is not available.
+     */
+    result = explain_is_efault_maps(data, data_size);
+    if (result >= 0)
+        return result;
+    explain_probe_begin(&timer, explain_probe_mincore);
+    result = is_efault_pointer_slow(data, data_size);
+    explain_probe_end(&timer);
+    return result;
+}
+
+
 /* vim: set ts=8 sw=4 et : */
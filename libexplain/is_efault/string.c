@@ -23,10 +23,11 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/is_efault.h>
+#include <libexplain/statistics/probe.h>
 
 
-int
-explain_is_efault_string(const char *data)
+static int
+is_efault_string(const char *data)
 {
 #ifdef HAVE_MINCORE
     /* mincore doesn't seem to work as expected on 64-bit Linux */
@@ -80,4 +81,18 @@ explain_is_efault_string(const char *data)
 }
 
 
+
+int
+explain_is_efault_string(const char *data)
+{
+    explain_probe_timer_t timer;
+    int             result;
+
+    explain_probe_begin(&timer, explain_probe_mincore);
+    result = is_efault_string(data);
+    explain_probe_end(&timer);
+    return result;
+}
+
+
 /* vim: set ts=8 sw=4 et : */
@@ -20,6 +20,7 @@
 #include <libexplain/ac/signal.h>
 #include <libexplain/ac/sys/types.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/kill.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_kill_on_error(pid_t pid, int sig)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = kill(pid, sig);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_kill(hold_errno, pid,
-            sig));
+        if (!explain_output_suppress("kill", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_kill(hold_errno, pid,
+                sig));
+        }
         errno = hold_errno;
     }
     return result;
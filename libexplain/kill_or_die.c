@@ -20,15 +20,18 @@
 
 #include <libexplain/kill.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_kill_or_die(pid_t pid, int sig)
 {
+    explain_output_or_die_begin();
     if (explain_kill_on_error(pid, sig) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
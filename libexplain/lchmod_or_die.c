@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/lchmod.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_lchmod_or_die(const char *pathname, mode_t mode)
 {
+    explain_output_or_die_begin();
     if (explain_lchmod_on_error(pathname, mode) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_lchmod_on_error(const char *pathname, mode_t mode)
     int             result;
 
 #ifdef HAVE_LCHMOD
+    explain_explanation_call_begin();
     result = lchmod(pathname, mode);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_lchmod_on_error(const char *pathname, mode_t mode)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_lchmod(hold_errno, pathname, mode)
-        );
+        if (!explain_output_suppress("lchmod", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_lchmod(hold_errno, pathname, mode)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/lchown.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_lchown_on_error(const char *pathname, int owner, int group)
     int             result;
 
 #ifdef HAVE_LCHOWN
+    explain_explanation_call_begin();
     result = lchown(pathname, owner, group);
+    explain_explanation_call_end();
 #else
     /* FIXME:: move this into <libexplain/ac/unitd.h> ? */
     result = chown(pathname, owner, group);
@@ -39,8 +42,11 @@ explain_lchown_on_error(const char *pathname, int owner, int group)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_lchown(hold_errno,
-            pathname, owner, group));
+        if (!explain_output_suppress("lchown", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_lchown(hold_errno,
+                pathname, owner, group));
+        }
         errno = hold_errno;
     }
     return result;
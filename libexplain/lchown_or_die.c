@@ -20,15 +20,18 @@
 
 #include <libexplain/lchown.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_lchown_or_die(const char *pathname, int owner, int group)
 {
+    explain_output_or_die_begin();
     if (explain_lchown_on_error(pathname, owner, group) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -18,17 +18,21 @@
 
 #include <libexplain/ac/errno.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/lchownat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_lchownat_or_die(int fildes, const char *pathname, int uid, int gid)
 {
+    explain_output_or_die_begin();
     if (explain_lchownat_on_error(fildes, pathname, uid, gid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,7 +42,9 @@ explain_lchownat_on_error(int fildes, const char *pathname, int uid, int gid)
     int             result;
 
 #ifdef HAVE_LCHOWNAT
+    explain_explanation_call_begin();
     result = lchownat(fildes, pathname, uid, gid);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -48,11 +54,14 @@ explain_lchownat_on_error(int fildes, const char *pathname, int uid, int gid)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_lchownat(hold_errno, fildes, pathname, uid, gid)
-        );
+        if (!explain_output_suppress("lchownat", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_lchownat(hold_errno, fildes, pathname, uid, gid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
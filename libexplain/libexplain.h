@@ -50,6 +50,7 @@
 #include <libexplain/chmod.h>
 #include <libexplain/chown.h>
 #include <libexplain/chroot.h>
+#include <libexplain/client.h>
 #include <libexplain/close.h>
 #include <libexplain/closedir.h>
 #include <libexplain/connect.h>
@@ -218,6 +219,7 @@
 #include <libexplain/socketpair.h>
 #include <libexplain/sprintf.h>
 #include <libexplain/stat.h>
+#include <libexplain/statistics.h>
 #include <libexplain/statfs.h>
 #include <libexplain/statvfs.h>
 #include <libexplain/stime.h>
@@ -20,15 +20,18 @@
 
 #include <libexplain/link.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_link_or_die(const char *oldpath, const char *newpath)
 {
+    explain_output_or_die_begin();
     if (explain_link_on_error(oldpath, newpath) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,19 +19,23 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/linkat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_linkat_or_die(int old_fildes, const char *old_path, int new_fildes,
     const char *new_path, int flags)
 {
+    explain_output_or_die_begin();
     if (explain_linkat_on_error(old_fildes, old_path, new_fildes, new_path,
         flags) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,7 +46,9 @@ explain_linkat_on_error(int old_fildes, const char *old_path, int new_fildes,
     int             result;
 
 #ifdef HAVE_LINKAT
+    explain_explanation_call_begin();
     result = linkat(old_fildes, old_path, new_fildes, new_path, flags);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -52,12 +58,16 @@ explain_linkat_on_error(int old_fildes, const char *old_path, int new_fildes,
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_linkat(hold_errno, old_fildes, old_path, new_fildes,
-                new_path, flags)
-        );
+        if (!explain_output_suppress("linkat", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_linkat(hold_errno, old_fildes, old_path,
+                    new_fildes,
+                    new_path, flags)
+            );
+        }
         errno = hold_errno;
     }
     return result;
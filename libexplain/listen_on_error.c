@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/socket.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/listen.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_listen_on_error(int fildes, int backlog)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = listen(fildes, backlog);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_listen(hold_errno, fildes,
-            backlog));
+        if (!explain_output_suppress("listen", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_listen(hold_errno, fildes,
+                backlog));
+        }
         errno = hold_errno;
     }
     return result;
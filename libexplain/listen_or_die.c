@@ -20,15 +20,18 @@
 
 #include <libexplain/listen.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_listen_or_die(int fildes, int backlog)
 {
+    explain_output_or_die_begin();
     if (explain_listen_on_error(fildes, backlog) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/lseek.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_lseek_on_error(int fildes, off_t offset, int whence)
 {
     off_t           result;
 
+    explain_explanation_call_begin();
     result = lseek(fildes, offset, whence);
+    explain_explanation_call_end();
     if (result == (off_t)-1)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_lseek(hold_errno, fildes,
-            offset, whence));
+        if (!explain_output_suppress("lseek", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_lseek(hold_errno, fildes,
+                offset, whence));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 
 #include <libexplain/lseek.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 off_t
@@ -27,7 +28,9 @@ explain_lseek_or_die(int fildes, off_t offset, int whence)
 {
     off_t           result;
 
+    explain_output_or_die_begin();
     result = explain_lseek_on_error(fildes, offset, whence);
+    explain_output_or_die_end();
     if (result == (off_t)-1)
     {
         explain_output_exit_failure();
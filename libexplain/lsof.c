@@ -19,73 +19,100 @@
 
 #include <libexplain/ac/ctype.h>
 #include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
-#include <libexplain/ac/stdio.h>
 #include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
 #include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
 
 #include <libexplain/lsof.h>
-#include <libexplain/option.h>
+#include <libexplain/run_command.h>
+#include <libexplain/sizeof.h>
+#include <libexplain/statistics/probe.h>
 
 
-void
-explain_lsof(const char *lsof_options, explain_lsof_t *context)
+static void
+lsof(const char *lsof_options, const char *path, explain_lsof_t *context)
 {
-    FILE            *fp;
-    char            command[200];
+    const char      *argv[20];
+    size_t          argc;
+    char            options[200];
+    char            *op;
+    char            *output;
+    size_t          output_size;
+    const char      *ip;
+    const char      *end;
+    explain_probe_timer_t timer;
 
+    /*
+     * Build the argument vector.  The options are simple words
+     * separated by spaces, there is no quoting to be undone.
+     */
+    argc = 0;
+    argv[argc++] = "lsof";
+    argv[argc++] = "-Ffnp0";
     if (!lsof_options)
         lsof_options = "";
-    snprintf
-    (
-        command,
-        sizeof(command),
-        "lsof -Ffnp0 %s %s %s",
-        (lsof_options[0] ? "-a" : ""),
-        lsof_options,
-        (explain_option_debug() >= 2 ? "" : "2> /dev/null")
-    );
-    fp = popen(command, "r");
-    if (!fp)
+    if (path || lsof_options[strspn(lsof_options, " \t")])
+        argv[argc++] = "-a";
+    explain_strendcpy(options, lsof_options, options + sizeof(options));
+    op = options;
+    for (;;)
+    {
+        op += strspn(op, " \t");
+        if (!*op)
+            break;
+        if (argc >= SIZEOF(argv) - 3)
+            return;
+        argv[argc++] = op;
+        op += strcspn(op, " \t");
+        if (!*op)
+            break;
+        *op++ = '\0';
+    }
+    if (path)
+    {
+        /* a single argument, whatever characters it contains */
+        argv[argc++] = "--";
+        argv[argc++] = path;
+    }
+    argv[argc] = NULL;
+
+    explain_probe_begin(&timer, explain_probe_lsof);
+    output =
+        explain_run_command
+        (
+            argv,
+            EXPLAIN_LSOF_OUTPUT_MAX,
+            EXPLAIN_RUN_COMMAND_TIMEOUT,
+            &output_size
+        );
+    explain_probe_end(&timer);
+    if (!output)
         return;
     context->pid = 0;
     context->fildes = -1;
-    for (;;)
+    ip = output;
+    end = output + output_size;
+    while (ip < end)
     {
-        char            line[PATH_MAX + 2];
-        char            *lp;
+        const char      *line;
 
-        lp = line;
-        for (;;)
-        {
-            int             c;
+        /*
+         * The lsof(1) man page says that -F0 NUL terminates the
+         * lines, but it actually terminates them with "\0\n"
+         * instead, except when it uses just "\0".  Sheesh.
+         * The output buffer is always NUL terminated, so the last
+         * line is terminated too.
+         */
+        line = ip;
+        ip += strlen(ip) + 1;
+        if (ip < end && *ip == '\n')
+            ++ip;
 
-            c = getc(fp);
-            if (c == EOF)
-            {
-                *lp++ = '\0';
-                break;
-            }
-            if (c == '\0')
-            {
-                *lp++ = '\0';
-                /*
-                 * The lsof(1) man page says that -F0 NUL terminates the
-                 * lines, but it actually terminates them with "\0\n"
-                 * instead, except when it uses just "\0".  Sheesh.
-                 */
-                c = getc(fp);
-                if (c != EOF && c != '\n')
-                    ungetc(c, fp);
-                break;
-            }
-            if (lp < line + sizeof(line) - 1)
-                *lp++ = c;
-        }
         switch (line[0])
         {
         case '\0':
-            pclose(fp);
-            return;
+            ip = end;
+            break;
 
         case 'p':
             context->pid = atoi(line + 1);
@@ -102,7 +129,7 @@ explain_lsof(const char *lsof_options, explain_lsof_t *context)
             break;
 
         case 'n':
-            if (context->n_callback)
+            if (strlen(line + 1) < PATH_MAX && context->n_callback)
                 (*context->n_callback)(context, line + 1);
             break;
 
@@ -111,6 +138,21 @@ explain_lsof(const char *lsof_options, explain_lsof_t *context)
             break;
         }
     }
+    free(output);
+}
+
+
+void
+explain_lsof(const char *lsof_options, explain_lsof_t *context)
+{
+    lsof(lsof_options, NULL, context);
+}
+
+
+void
+explain_lsof_path(const char *path, explain_lsof_t *context)
+{
+    lsof(NULL, path, context);
 }
 
 
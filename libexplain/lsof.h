@@ -26,6 +26,12 @@
 #define LIBEXPLAIN_LSOF_FD_rtd (-'r')
 #define LIBEXPLAIN_LSOF_FD_NOFD (-'N')
 
+/**
+  * The EXPLAIN_LSOF_OUTPUT_MAX macro is the most output that will be
+  * read from the lsof(1) command; a system wide listing can be large.
+  */
+#define EXPLAIN_LSOF_OUTPUT_MAX (64L << 20)
+
 typedef struct explain_lsof_t explain_lsof_t;
 struct explain_lsof_t
 {
@@ -45,5 +51,18 @@ struct explain_lsof_t
   */
 void explain_lsof(const char *options, explain_lsof_t *context);
 
+/**
+  * The explain_lsof_path function may be used to ask lsof(1) about
+  * the processes using the given file or directory.
+  *
+  * @param path
+  *    The path of the file or directory.  It is passed to the lsof(1)
+  *    command as a single argument, no quoting is required.
+  * @param context
+  *    The context, used to remember pid and fildes, and call the
+  *    appropriate callbacks, as the data is seen.
+  */
+void explain_lsof_path(const char *path, explain_lsof_t *context);
+
 #endif /* LIBEXPLAIN_LSOF_H */
 /* vim: set ts=8 sw=4 et : */
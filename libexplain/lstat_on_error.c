@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/lstat.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_lstat_on_error(const char *pathname, struct stat *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = lstat(pathname, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_lstat(hold_errno, pathname,
-            data));
+        if (!explain_output_suppress("lstat", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_lstat(hold_errno,
+                pathname, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/lstat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_lstat_or_die(const char *pathname, struct stat *data)
 {
+    explain_output_or_die_begin();
     if (explain_lstat_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/malloc.h>
 #include <libexplain/output.h>
 
@@ -37,13 +38,18 @@ explain_malloc_on_error(size_t size)
     ok_size = size ? size : 1;
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = malloc(ok_size);
+    explain_explanation_call_end();
     if (!result)
     {
         hold_errno = errno;
         if (hold_errno == 0)
             hold_errno = ENOMEM;
-        explain_output_error("%s", explain_errno_malloc(hold_errno, size));
+        if (!explain_output_suppress("malloc", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_malloc(hold_errno, size));
+        }
     }
     errno = hold_errno;
     return result;
@@ -21,6 +21,7 @@
 
 #include <libexplain/malloc.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void *
@@ -28,7 +29,9 @@ explain_malloc_or_die(size_t size)
 {
     void            *result;
 
+    explain_output_or_die_begin();
     result = explain_malloc_on_error(size);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
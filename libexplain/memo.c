@@ -0,0 +1,583 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+
+#include <libexplain/memo.h>
+
+/*
+ * The table is shared, but the explain_message_* functions are
+ * documented as thread safe, so it may only be used by one thread at
+ * a time.  A thread that finds it busy makes the system call itself,
+ * the way it always did.
+ *
+ * Rather than clear the table at the start of every explanation (most
+ * of which never look at a file), explain_memo_invalidate bumps a
+ * generation number, and the table is cleared when next used.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) || \
+    defined(__clang__)
+#define HAVE_MEMO 1
+#endif
+
+
+#ifdef HAVE_MEMO
+
+/*
+ * The first table, and then the pool, is allowed to fill up; after that
+ * the answers are simply not remembered.
+ */
+#define ENTRY_MAXIMUM 128
+#define POOL_MAXIMUM (64 * 1024)
+
+enum kind_t
+{
+    kind_stat,
+    kind_lstat,
+    kind_readlink
+};
+typedef enum kind_t kind_t;
+
+typedef struct entry_t entry_t;
+struct entry_t
+{
+    /* offset of the pathname in the pool, or 0 for an empty slot */
+    size_t          pathname;
+
+    /*
+     * AT_FDCWD, except for explain_memo_fstatat of a relative pathname;
+     * everything else is keyed by pathname alone
+     */
+    int             dirfd;
+    kind_t          kind;
+    ssize_t         result;
+    int             errnum;
+
+    /* kind_stat and kind_lstat */
+    struct stat     st;
+
+    /* kind_readlink: offset of the link's contents in the pool */
+    size_t          data;
+};
+
+static entry_t  *entry;
+static size_t   entry_length;
+static char     *pool;
+static size_t   pool_length;
+static size_t   pool_maximum;
+static int      busy;
+static unsigned long generation;
+static unsigned long table_generation;
+
+
+void
+explain_memo_invalidate(void)
+{
+    __sync_add_and_fetch(&generation, 1);
+}
+
+
+static int
+begin(void)
+{
+    unsigned long   current;
+
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+    current = __sync_add_and_fetch(&generation, 0);
+    if (table_generation != current)
+    {
+        table_generation = current;
+        entry_length = 0;
+        pool_length = 0;
+        if (entry)
+            memset(entry, 0, ENTRY_MAXIMUM * sizeof(entry[0]));
+    }
+    if (!entry)
+    {
+        entry = calloc(ENTRY_MAXIMUM, sizeof(entry[0]));
+        if (!entry)
+        {
+            __sync_lock_release(&busy);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+static void
+end(void)
+{
+    __sync_lock_release(&busy);
+}
+
+
+static size_t
+slot(int dirfd, kind_t kind, const char *pathname)
+{
+    unsigned long   h;
+    const char      *cp;
+    size_t          j;
+
+    /* FNV-1a */
+    h = 2166136261u;
+    for (cp = pathname; *cp; ++cp)
+        h = (h ^ (unsigned char)*cp) * 16777619u;
+    h = (h ^ (unsigned)dirfd) * 16777619u;
+    h = (h ^ kind) * 16777619u;
+
+    /* an empty slot has a zero pathname offset */
+    j = h & (ENTRY_MAXIMUM - 1);
+    for (;;)
+    {
+        entry_t         *ep;
+
+        ep = &entry[j];
+        if
+        (
+            !ep->pathname
+        ||
+            (
+                ep->dirfd == dirfd
+            &&
+                ep->kind == kind
+            &&
+                0 == strcmp(pool + ep->pathname, pathname)
+            )
+        )
+            return j;
+        j = (j + 1) & (ENTRY_MAXIMUM - 1);
+    }
+}
+
+
+static size_t
+save(const char *data, size_t data_size)
+{
+    size_t          result;
+
+    if (pool_length == 0)
+    {
+        /* offset 0 is reserved to mean an empty slot */
+        pool_length = 1;
+    }
+    if (pool_length + data_size + 1 > pool_maximum)
+    {
+        size_t          new_maximum;
+        char            *new_pool;
+
+        new_maximum = pool_maximum * 2 + data_size + 1024;
+        if (new_maximum > POOL_MAXIMUM)
+            new_maximum = POOL_MAXIMUM;
+        if (pool_length + data_size + 1 > new_maximum)
+            return 0;
+        new_pool = realloc(pool, new_maximum);
+        if (!new_pool)
+            return 0;
+        pool = new_pool;
+        pool_maximum = new_maximum;
+    }
+    result = pool_length;
+    memcpy(pool + pool_length, data, data_size);
+    pool_length += data_size;
+    pool[pool_length++] = '\0';
+    return result;
+}
+
+
+/**
+  * The recall function is used to look for a remembered answer.  The
+  * table must already be held.
+  *
+  * @returns
+  *     the entry, or NULL if there is none.
+  */
+static const entry_t *
+recall(int dirfd, kind_t kind, const char *pathname)
+{
+    const entry_t   *ep;
+
+    ep = &entry[slot(dirfd, kind, pathname)];
+    return (ep->pathname ? ep : 0);
+}
+
+
+/**
+  * The remember function is used to add an answer to the table.  The
+  * table must already be held.  Nothing happens if the table is full.
+  *
+  * @returns
+  *     the new entry, or NULL if it could not be added.
+  */
+static entry_t *
+remember(int dirfd, kind_t kind, const char *pathname, ssize_t result,
+    int errnum)
+{
+    entry_t         *ep;
+    size_t          offset;
+
+    if ((entry_length + 1) * 4 > ENTRY_MAXIMUM * 3)
+        return 0;
+    ep = &entry[slot(dirfd, kind, pathname)];
+    if (ep->pathname)
+        return 0;
+    offset = save(pathname, strlen(pathname));
+    if (!offset)
+        return 0;
+    ep->pathname = offset;
+    ep->dirfd = dirfd;
+    ep->kind = kind;
+    ep->result = result;
+    ep->errnum = errnum;
+    ep->data = 0;
+    ++entry_length;
+    return ep;
+}
+
+
+static int
+memo_stat(int dirfd, const char *name, kind_t kind, const char *pathname,
+    struct stat *st)
+{
+    const entry_t   *rp;
+    entry_t         *ep;
+    int             result;
+    int             errnum;
+
+    if (begin() == 0)
+    {
+        rp = recall(AT_FDCWD, kind, pathname);
+        if (!rp && kind == kind_stat)
+        {
+            /*
+             * If lstat failed, stat fails the same way.  If lstat found
+             * something other than a symbolic link, stat finds the same.
+             */
+            rp = recall(AT_FDCWD, kind_lstat, pathname);
+            if (rp && rp->result >= 0 && S_ISLNK(rp->st.st_mode))
+                rp = 0;
+        }
+        if (rp)
+        {
+            result = rp->result;
+            errnum = rp->errnum;
+            if (result >= 0)
+                *st = rp->st;
+            end();
+            if (result < 0)
+                errno = errnum;
+            return result;
+        }
+        end();
+    }
+
+#if defined(HAVE_FSTATAT) && defined(AT_SYMLINK_NOFOLLOW)
+    if (dirfd >= 0)
+    {
+        result =
+            fstatat
+            (
+                dirfd,
+                name,
+                st,
+                (kind == kind_lstat ? AT_SYMLINK_NOFOLLOW : 0)
+            );
+    }
+    else
+#else
+    (void)dirfd;
+    (void)name;
+#endif
+    if (kind == kind_lstat)
+        result = lstat(pathname, st);
+    else
+        result = stat(pathname, st);
+    errnum = errno;
+
+    if (begin() == 0)
+    {
+        ep = remember(AT_FDCWD, kind, pathname, result, errnum);
+        if (ep && result >= 0)
+            ep->st = *st;
+        end();
+    }
+    if (result < 0)
+        errno = errnum;
+    return result;
+}
+
+
+int
+explain_memo_stat(const char *pathname, struct stat *st)
+{
+    return memo_stat(-1, pathname, kind_stat, pathname, st);
+}
+
+
+int
+explain_memo_lstat(const char *pathname, struct stat *st)
+{
+    return memo_stat(-1, pathname, kind_lstat, pathname, st);
+}
+
+
+int
+explain_memo_lstat_relative(int dirfd, const char *name,
+    const char *pathname, struct stat *st)
+{
+    if (dirfd < 0)
+        name = pathname;
+    return memo_stat(dirfd, name, kind_lstat, pathname, st);
+}
+
+
+int
+explain_memo_fstatat(int dirfd, const char *pathname, struct stat *st,
+    int flags)
+{
+    const entry_t   *rp;
+    entry_t         *ep;
+    kind_t          kind;
+    int             result;
+    int             errnum;
+
+    if (dirfd == AT_FDCWD || pathname[0] == '/')
+    {
+        if (flags == 0)
+            return explain_memo_stat(pathname, st);
+#ifdef AT_SYMLINK_NOFOLLOW
+        if (flags == AT_SYMLINK_NOFOLLOW)
+            return explain_memo_lstat(pathname, st);
+#endif
+    }
+
+    kind = kind_stat;
+#ifdef AT_SYMLINK_NOFOLLOW
+    if (flags == AT_SYMLINK_NOFOLLOW)
+        kind = kind_lstat;
+    else
+#endif
+    if (flags != 0)
+    {
+#ifdef HAVE_FSTATAT
+        return fstatat(dirfd, pathname, st, flags);
+#else
+        errno = ENOSYS;
+        return -1;
+#endif
+    }
+
+    if (begin() == 0)
+    {
+        rp = recall(dirfd, kind, pathname);
+        if (rp)
+        {
+            result = rp->result;
+            errnum = rp->errnum;
+            if (result >= 0)
+                *st = rp->st;
+            end();
+            if (result < 0)
+                errno = errnum;
+            return result;
+        }
+        end();
+    }
+
+#ifdef HAVE_FSTATAT
+    result = fstatat(dirfd, pathname, st, flags);
+#else
+    result = -1;
+    errno = ENOSYS;
+#endif
+    errnum = errno;
+
+    if (begin() == 0)
+    {
+        ep = remember(dirfd, kind, pathname, result, errnum);
+        if (ep && result >= 0)
+            ep->st = *st;
+        end();
+    }
+    if (result < 0)
+        errno = errnum;
+    return result;
+}
+
+
+ssize_t
+explain_memo_readlink_relative(int dirfd, const char *name,
+    const char *pathname, char *data, size_t data_size)
+{
+    const entry_t   *rp;
+    entry_t         *ep;
+    char            link[PATH_MAX + 1];
+    ssize_t         result;
+    int             errnum;
+
+    if (data_size > sizeof(link))
+    {
+        /* longer than we are prepared to remember */
+        return readlink(pathname, data, data_size);
+    }
+
+    if (begin() == 0)
+    {
+        rp = recall(AT_FDCWD, kind_readlink, pathname);
+        if (rp)
+        {
+            result = rp->result;
+            errnum = rp->errnum;
+            if (result > (ssize_t)data_size)
+                result = data_size;
+            if (result > 0)
+                memcpy(data, pool + rp->data, result);
+            end();
+            if (result < 0)
+                errno = errnum;
+            return result;
+        }
+        end();
+    }
+
+#if defined(HAVE_READLINKAT) && defined(HAVE_FSTATAT)
+    if (dirfd >= 0)
+        result = readlinkat(dirfd, name, link, sizeof(link));
+    else
+#else
+    (void)dirfd;
+    (void)name;
+#endif
+    result = readlink(pathname, link, sizeof(link));
+    errnum = errno;
+
+    if (begin() == 0)
+    {
+        size_t          offset;
+
+        offset = (result > 0 ? save(link, result) : 0);
+        if (result <= 0 || offset)
+        {
+            ep = remember(AT_FDCWD, kind_readlink, pathname, result, errnum);
+            if (ep)
+                ep->data = offset;
+        }
+        end();
+    }
+
+    if (result > (ssize_t)data_size)
+        result = data_size;
+    if (result > 0)
+        memcpy(data, link, result);
+    if (result < 0)
+        errno = errnum;
+    return result;
+}
+
+
+ssize_t
+explain_memo_readlink(const char *pathname, char *data, size_t data_size)
+{
+    return explain_memo_readlink_relative(-1, pathname, pathname, data,
+        data_size);
+}
+
+#else
+
+void
+explain_memo_invalidate(void)
+{
+}
+
+
+int
+explain_memo_stat(const char *pathname, struct stat *st)
+{
+    return stat(pathname, st);
+}
+
+
+int
+explain_memo_lstat(const char *pathname, struct stat *st)
+{
+    return lstat(pathname, st);
+}
+
+
+int
+explain_memo_lstat_relative(int dirfd, const char *name,
+    const char *pathname, struct stat *st)
+{
+#if defined(HAVE_FSTATAT) && defined(AT_SYMLINK_NOFOLLOW)
+    if (dirfd >= 0)
+        return fstatat(dirfd, name, st, AT_SYMLINK_NOFOLLOW);
+#else
+    (void)dirfd;
+    (void)name;
+#endif
+    return lstat(pathname, st);
+}
+
+
+int
+explain_memo_fstatat(int dirfd, const char *pathname, struct stat *st,
+    int flags)
+{
+#ifdef HAVE_FSTATAT
+    return fstatat(dirfd, pathname, st, flags);
+#else
+    if (flags == 0 && (dirfd == AT_FDCWD || pathname[0] == '/'))
+        return stat(pathname, st);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+
+ssize_t
+explain_memo_readlink_relative(int dirfd, const char *name,
+    const char *pathname, char *data, size_t data_size)
+{
+#if defined(HAVE_READLINKAT) && defined(HAVE_FSTATAT)
+    if (dirfd >= 0)
+        return readlinkat(dirfd, name, data, data_size);
+#else
+    (void)dirfd;
+    (void)name;
+#endif
+    return readlink(pathname, data, data_size);
+}
+
+
+ssize_t
+explain_memo_readlink(const char *pathname, char *data, size_t data_size)
+{
+    return readlink(pathname, data, data_size);
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,159 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_MEMO_H
+#define LIBEXPLAIN_MEMO_H
+
+#include <libexplain/ac/stddef.h>
+#include <libexplain/ac/sys/stat.h>
+#include <libexplain/ac/unistd.h>
+
+/*
+ * A single explanation often asks about the same files several times:
+ * the path resolution, the file type, the mount point and the
+ * directory-of helpers each stat what they need.  These functions
+ * remember the answers until the explanation is complete.
+ *
+ * The answers are keyed by pathname, relative to the current directory.
+ * The _relative functions consult the file through dirfd, but remember
+ * and recall the answer under their pathname argument.  Only
+ * explain_memo_fstatat, given a relative pathname, keys on a real
+ * (dirfd, pathname) pair; those answers are never shared with the
+ * others.
+ *
+ * They behave exactly like the system calls they are named after,
+ * including setting errno on failure.
+ */
+
+/**
+  * The explain_memo_stat function is used to obtain the stat(2) of a
+  * file, remembered for the current explanation.
+  *
+  * @param pathname
+  *     The file of interest.
+  * @param st
+  *     Where to return the file status.
+  * @returns
+  *     0 on success, -1 on error (with errno set).
+  */
+int explain_memo_stat(const char *pathname, struct stat *st);
+
+/**
+  * The explain_memo_lstat function is used to obtain the lstat(2) of a
+  * file, remembered for the current explanation.
+  *
+  * @param pathname
+  *     The file of interest.
+  * @param st
+  *     Where to return the file status.
+  * @returns
+  *     0 on success, -1 on error (with errno set).
+  */
+int explain_memo_lstat(const char *pathname, struct stat *st);
+
+/**
+  * The explain_memo_fstatat function is used to obtain the fstatat(2)
+  * of a file, remembered for the current explanation.
+  *
+  * @param dirfd
+  *     The directory pathname is relative to, or AT_FDCWD.  It must
+  *     remain open on the same directory for the rest of the
+  *     explanation.
+  * @param pathname
+  *     The file of interest.
+  * @param st
+  *     Where to return the file status.
+  * @param flags
+  *     Zero, or AT_SYMLINK_NOFOLLOW.  Other flags are passed through,
+  *     but are not remembered.
+  * @returns
+  *     0 on success, -1 on error (with errno set).
+  */
+int explain_memo_fstatat(int dirfd, const char *pathname, struct stat *st,
+    int flags);
+
+/**
+  * The explain_memo_lstat_relative function is used to obtain the
+  * lstat(2) of a file, remembered for the current explanation, by way
+  * of a short-lived directory file descriptor.
+  *
+  * @param dirfd
+  *     A directory file descriptor, or -1 to use the pathname.
+  * @param name
+  *     The file's name, relative to dirfd.
+  * @param pathname
+  *     A pathname that refers to the same file as dirfd and name; it is
+  *     the name the answer is remembered under.
+  * @param st
+  *     Where to return the file status.
+  * @returns
+  *     0 on success, -1 on error (with errno set).
+  */
+int explain_memo_lstat_relative(int dirfd, const char *name,
+    const char *pathname, struct stat *st);
+
+/**
+  * The explain_memo_readlink function is used to obtain the readlink(2)
+  * of a file, remembered for the current explanation.
+  *
+  * @param pathname
+  *     The symbolic link of interest.
+  * @param data
+  *     Where to return the link's contents (not NUL terminated).
+  * @param data_size
+  *     The size of the data buffer.
+  * @returns
+  *     the number of bytes placed in data, or -1 on error (with errno
+  *     set).
+  */
+ssize_t explain_memo_readlink(const char *pathname, char *data,
+    size_t data_size);
+
+/**
+  * The explain_memo_readlink_relative function is used to obtain the
+  * readlink(2) of a file, remembered for the current explanation, by
+  * way of a short-lived directory file descriptor.
+  *
+  * @param dirfd
+  *     A directory file descriptor, or -1 to use the pathname.
+  * @param name
+  *     The symbolic link's name, relative to dirfd.
+  * @param pathname
+  *     A pathname that refers to the same file as dirfd and name; it is
+  *     the name the answer is remembered under.
+  * @param data
+  *     Where to return the link's contents (not NUL terminated).
+  * @param data_size
+  *     The size of the data buffer.
+  * @returns
+  *     the number of bytes placed in data, or -1 on error (with errno
+  *     set).
+  */
+ssize_t explain_memo_readlink_relative(int dirfd, const char *name,
+    const char *pathname, char *data, size_t data_size);
+
+/**
+  * The explain_memo_invalidate function is used to forget everything
+  * remembered.  It is called at the start and at the end of each
+  * explanation.
+  */
+void explain_memo_invalidate(void);
+
+#endif /* LIBEXPLAIN_MEMO_H */
+/* vim: set ts=8 sw=4 et : */
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mkdir.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_mkdir_on_error(const char *pathname, int mode)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = mkdir(pathname, mode);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_mkdir(hold_errno, pathname,
-            mode));
+        if (!explain_output_suppress("mkdir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mkdir(hold_errno,
+                pathname, mode));
+        }
         errno = hold_errno;
     }
     return result;
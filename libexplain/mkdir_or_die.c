@@ -20,15 +20,18 @@
 
 #include <libexplain/mkdir.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_mkdir_or_die(const char *pathname, int mode)
 {
+    explain_output_or_die_begin();
     if (explain_mkdir_on_error(pathname, mode) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -24,6 +24,7 @@
 #include <libexplain/ac/sys/param.h> /* for PATH_MAX everywhere else */
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/is_efault.h>
 #include <libexplain/mkdtemp.h>
 #include <libexplain/output.h>
@@ -81,14 +82,19 @@ explain_mkdtemp_on_error(char *pathname)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = mkdtemp(pathname);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_mkdtemp(hold_errno,
-            pathname));
+        if (!explain_output_suppress("mkdtemp", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mkdtemp(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,6 +18,7 @@
 
 #include <libexplain/mkdtemp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 char *
@@ -25,7 +26,9 @@ explain_mkdtemp_or_die(char *pathname)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_mkdtemp_on_error(pathname);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -22,6 +22,7 @@
 #include <libexplain/ac/sys/stat.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mknod.h>
 #include <libexplain/output.h>
 
@@ -31,14 +32,19 @@ explain_mknod_on_error(const char *pathname, mode_t mode, dev_t dev)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = mknod(pathname, mode, dev);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_mknod(hold_errno, pathname,
-            mode, dev));
+        if (!explain_output_suppress("mknod", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mknod(hold_errno,
+                pathname, mode, dev));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/mknod.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_mknod_or_die(const char *pathname, mode_t mode, dev_t dev)
 {
+    explain_output_or_die_begin();
     if (explain_mknod_on_error(pathname, mode, dev) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
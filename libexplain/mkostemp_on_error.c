@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mkostemp.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_mkostemp_on_error(char *templat, int flags)
     int             result;
 
 #ifdef HAVE_MKOSTEMP
+    explain_explanation_call_begin();
     result = mkostemp(templat, flags);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_mkostemp_on_error(char *templat, int flags)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_mkostemp(hold_errno,
-            templat, flags));
+        if (!explain_output_suppress("mkostemp", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mkostemp(hold_errno,
+                templat, flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -18,6 +18,7 @@
 
 #include <libexplain/mkostemp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -25,7 +26,9 @@ explain_mkostemp_or_die(char *templat, int flags)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_mkostemp_on_error(templat, flags);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
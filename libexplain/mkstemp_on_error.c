@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mkstemp.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,19 @@ explain_mkstemp_on_error(char *templat)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = mkstemp(templat);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_mkstemp(hold_errno, templat));
+        if (!explain_output_suppress("mkstemp", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mkstemp(hold_errno,
+                templat));
+        }
         errno = hold_errno;
     }
     return result;
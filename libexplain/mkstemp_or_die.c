@@ -18,6 +18,7 @@
 
 #include <libexplain/mkstemp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -25,7 +26,9 @@ explain_mkstemp_or_die(char *templat)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_mkstemp_on_error(templat);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
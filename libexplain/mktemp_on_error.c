@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mktemp.h>
 #include <libexplain/output.h>
 
@@ -43,7 +44,9 @@ explain_mktemp_on_error(char *templat)
      * to '\0'.  Sheesh!  This makes our job much harder.
      */
     first = templat[0];
+    explain_explanation_call_begin();
     result = mktemp(templat);
+    explain_explanation_call_end();
     /* assert(result == templat); */
     if (result[0] == '\0')
     {
@@ -52,7 +55,11 @@ explain_mktemp_on_error(char *templat)
         hold_errno = errno;
         /* assert(templat[0] == '\0'); */
         templat[0] = first;
-        explain_output_error("%s", explain_errno_mktemp(hold_errno, templat));
+        if (!explain_output_suppress("mktemp", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_mktemp(hold_errno,
+                templat));
+        }
         templat[0] = '\0';
         errno = hold_errno;
     }
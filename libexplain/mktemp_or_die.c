@@ -18,6 +18,7 @@
 
 #include <libexplain/mktemp.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 char *
@@ -25,7 +26,9 @@ explain_mktemp_or_die(char *pathname)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_mktemp_on_error(pathname);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
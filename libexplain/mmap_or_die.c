@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/mman.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mmap.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void *
@@ -32,8 +34,10 @@ explain_mmap_or_die(void *data, size_t data_size, int prot, int flags, int
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_mmap_on_error(data, data_size, prot, flags, fildes,
         offset);
+    explain_output_or_die_end();
     if
     (
         result == (void *)(-1)
@@ -62,7 +66,9 @@ explain_mmap_on_error(void *data, size_t data_size, int prot, int flags, int
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_MMAP
+    explain_explanation_call_begin();
     result = mmap(data, data_size, prot, flags, fildes, offset);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = 0;
@@ -75,20 +81,23 @@ explain_mmap_on_error(void *data, size_t data_size, int prot, int flags, int
     )
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_mmap
+        if (!explain_output_suppress("mmap", hold_errno, -1))
+        {
+            explain_output_error
             (
-                hold_errno,
-                data,
-                data_size,
-                prot,
-                flags,
-                fildes,
-                offset
-            )
-        );
+                "%s",
+                explain_errno_mmap
+                (
+                    hold_errno,
+                    data,
+                    data_size,
+                    prot,
+                    flags,
+                    fildes,
+                    offset
+                )
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,19 +19,23 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/mount.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/mount.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_mount_or_die(const char *source, const char *target, const char
     *file_systems_type, unsigned long flags, const void *data)
 {
+    explain_output_or_die_begin();
     if (explain_mount_on_error(source, target, file_systems_type, flags, data) <
         0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,12 +46,14 @@ explain_mount_on_error(const char *source, const char *target, const char
     int             result;
 
 #ifdef HAVE_MOUNT
+    explain_explanation_call_begin();
 # ifdef __FreeBSD__
     (void)file_systems_type;
     result = mount(source, target, flags, data);
 #  else
     result = mount(source, target, file_systems_type, flags, data);
 #  endif
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -57,12 +63,16 @@ explain_mount_on_error(const char *source, const char *target, const char
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_mount(hold_errno, source, target, file_systems_type,
-                flags, data)
-        );
+        if (!explain_output_suppress("mount", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_mount(hold_errno, source, target,
+                    file_systems_type,
+                    flags, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/mman.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/munmap.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_munmap_or_die(void *data, size_t data_size)
 {
+    explain_output_or_die_begin();
     if (explain_munmap_on_error(data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_munmap_on_error(void *data, size_t data_size)
     int             result;
 
 #ifdef HAVE_MUNMAP
+    explain_explanation_call_begin();
     result = munmap(data, data_size);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,8 +55,11 @@ explain_munmap_on_error(void *data, size_t data_size)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_munmap(hold_errno, data,
-            data_size));
+        if (!explain_output_suppress("munmap", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_munmap(hold_errno, data,
+                data_size));
+        }
         errno = hold_errno;
     }
     return result;
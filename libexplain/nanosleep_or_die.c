@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/nanosleep.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_nanosleep_or_die(const struct timespec *req, struct timespec *rem)
 {
+    explain_output_or_die_begin();
     if (explain_nanosleep_on_error(req, rem) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,7 +46,9 @@ explain_nanosleep_on_error(const struct timespec *req, struct timespec *rem)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_NANOSLEEP
+    explain_explanation_call_begin();
     result = nanosleep(req, rem);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -58,11 +64,14 @@ explain_nanosleep_on_error(const struct timespec *req, struct timespec *rem)
          * it returns zero (if the wake-up time has passed).
          */
         hold_errno = errno ? errno : EINTR;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_nanosleep(hold_errno, req, rem)
-        );
+        if (!explain_output_suppress("nanosleep", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_nanosleep(hold_errno, req, rem)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/nice.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_nice_on_error(int inc)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = nice(inc);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_nice(hold_errno, inc));
+        if (!explain_output_suppress("nice", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_nice(hold_errno, inc));
+        }
         errno = hold_errno;
     }
     return result;
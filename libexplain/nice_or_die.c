@@ -18,6 +18,7 @@
 
 #include <libexplain/nice.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -25,7 +26,9 @@ explain_nice_or_die(int inc)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_nice_on_error(inc);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/fcntl.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/open.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_open_on_error(const char *pathname, int flags, int mode)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = open(pathname, flags, mode);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_open(hold_errno, pathname,
-            flags, mode));
+        if (!explain_output_suppress("open", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_open(hold_errno, pathname,
+                flags, mode));
+        }
         errno = hold_errno;
     }
     return result;
@@ -21,6 +21,7 @@
 
 #include <libexplain/open.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,7 +29,9 @@ explain_open_or_die(const char *pathname, int flags, int mode)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_open_on_error(pathname, flags, mode);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
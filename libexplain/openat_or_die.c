@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/fcntl.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/openat.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -28,7 +30,9 @@ explain_openat_or_die(int fildes, const char *pathname, int flags, mode_t mode)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_openat_on_error(fildes, pathname, flags, mode);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -44,7 +48,9 @@ explain_openat_on_error(int fildes, const char *pathname, int flags, mode_t
     int             result;
 
 #ifdef HAVE_OPENAT
+    explain_explanation_call_begin();
     result = openat(fildes, pathname, flags, mode);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -54,11 +60,14 @@ explain_openat_on_error(int fildes, const char *pathname, int flags, mode_t
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_openat(hold_errno, fildes, pathname, flags, mode)
-        );
+        if (!explain_output_suppress("openat", hold_errno, fildes))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_openat(hold_errno, fildes, pathname, flags, mode)
+            );
+        }
         errno = hold_errno;
     }
     return result;
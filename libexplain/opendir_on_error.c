@@ -19,6 +19,7 @@
 #include <libexplain/ac/dirent.h>
 #include <libexplain/ac/errno.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/opendir.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_opendir_on_error(const char *pathname)
 {
     DIR             *result;
 
+    explain_explanation_call_begin();
     result = opendir(pathname);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_opendir(hold_errno,
-            pathname));
+        if (!explain_output_suppress("opendir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_opendir(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
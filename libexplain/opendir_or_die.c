@@ -20,6 +20,7 @@
 
 #include <libexplain/opendir.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 DIR *
@@ -27,7 +28,9 @@ explain_opendir_or_die(const char *pathname)
 {
     DIR             *result;
 
+    explain_output_or_die_begin();
     result = explain_opendir_on_error(pathname);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
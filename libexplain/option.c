@@ -25,6 +25,7 @@
 #include <libexplain/fstrcmp.h>
 #include <libexplain/option.h>
 #include <libexplain/output.h>
+#include <libexplain/output/sample.h>
 #include <libexplain/parse_bits.h>
 #include <libexplain/program_name.h>
 #include <libexplain/sizeof.h>
@@ -77,6 +78,10 @@ static option_t hanging_indent =
     { option_level_default, 0, option_type_int };
 static option_t extra_device_info =
     { option_level_default, 1, option_type_bool };
+static option_t file_command =
+    { option_level_default, 0, option_type_bool };
+static option_t statistics =
+    { option_level_default, 0, option_type_bool };
 
 typedef struct table_t table_t;
 struct table_t
@@ -96,6 +101,8 @@ static const table_t table[] =
     { "program-name", &assemble_program_name },
     { "symbolic-mode-bits", &symbolic_mode_bits },
     { "extra-device-info", &extra_device_info },
+    { "file-command", &file_command },
+    { "statistics", &statistics },
 };
 
 
@@ -120,6 +127,25 @@ process(char *name, option_level_t level)
         return;
     invert = 0;
     value = 1;
+
+    /*
+     * The sample option may be given many times, and its value is not
+     * a number, so it is handed over as is.
+     */
+    if (0 == strncmp(name, "sample", 6))
+    {
+        const char      *cp;
+
+        cp = name + 6;
+        while (isspace((unsigned char)*cp))
+            ++cp;
+        if (*cp == '=')
+        {
+            explain_output_sample_option(cp + 1);
+            return;
+        }
+    }
+
     if (name[0] == 'n' && name[1] == 'o' && name[2] == '-')
     {
         invert = 1;
@@ -379,4 +405,30 @@ explain_option_extra_device_info(void)
 }
 
 
+int
+explain_option_file_command(void)
+{
+    if (!initialised)
+        initialise();
+    return file_command.value;
+}
+
+
+int
+explain_option_statistics(void)
+{
+    if (!initialised)
+        initialise();
+    return statistics.value;
+}
+
+
+void
+explain_option_sample(void)
+{
+    if (!initialised)
+        initialise();
+}
+
+
 /* vim: set ts=8 sw=4 et : */
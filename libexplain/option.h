@@ -124,5 +124,26 @@ int explain_option_hanging_indent(int width);
 
 int explain_option_extra_device_info(void);
 
+/**
+  * The explain_option_file_command function may be used to obtain
+  * the "file-command" option value, which says whether file(1) may be
+  * run to describe files whose format libexplain does not recognise.
+  */
+int explain_option_file_command(void);
+
+/**
+  * The explain_option_statistics function may be used to obtain the
+  * "statistics" option value, which says whether probe statistics are
+  * to be collected, and printed when the program exits.
+  */
+int explain_option_statistics(void);
+
+/**
+  * The explain_option_sample function is used to make sure that the
+  * "sample" options (sampling policies, see #explain_output_sample)
+  * have been read from the environment.
+  */
+void explain_option_sample(void);
+
 #endif /* LIBEXPLAIN_OPTION_H */
 /* vim: set ts=8 sw=4 et : */
@@ -62,6 +62,17 @@ extern "C" {
   *     @endcode
   *     If you need more than two, use several instances of "tee", cascaded.
   *
+  * @section filter "syslog, without the floods"
+  *     The "filter" output class can be used to collapse repeated
+  *     messages, and to limit the rate of messages.
+  *     To cause all output to be sent to syslog, but filtered, use
+  *     @code
+  *     explain_output_register
+  *     (
+  *         explain_output_filter_new(explain_output_syslog_new())
+  *     );
+  *     @endcode
+  *
   * @section file "stderr and a file"
   *     To cause all output to be sent to both stderr and a regular file, use
   *     @code
@@ -307,6 +318,135 @@ explain_output_t *explain_output_file_new(const char *filename, int append);
 explain_output_t *explain_output_tee_new(explain_output_t *first,
     explain_output_t *second);
 
+/**
+  * The explain_output_filter_new function may be used to create a new
+  * dynamically allocated instance of an explain_output_t class that
+  * suppresses duplicate messages, and limits the rate of messages,
+  * before passing them on to another output class.
+  *
+  * The following values are used:                                          <br>
+  *     window = 30 seconds                                                 <br>
+  *     rate = 10 messages per second                                       <br>
+  *     burst = 100 messages                                                <br>
+  * See #explain_output_filter_new4 for more information.
+  *
+  * @param deeper
+  *     The output class to pass the surviving messages on to.
+  * @returns
+  *     NULL on error (i.e. malloc failed), or a pointer to a new
+  *     dynamically allocated instance of the filter class.
+  *
+  * @note
+  *     The output subsystem will "own" the deeper object after this
+  *     call.  You may not make any reference to this pointer ever
+  *     again.  The output subsystem will destroy this object and free
+  *     the memory when it feels like it.
+  */
+explain_output_t *explain_output_filter_new(explain_output_t *deeper);
+
+/**
+  * The explain_output_filter_new4 function may be used to create a new
+  * dynamically allocated instance of an explain_output_t class that
+  * suppresses duplicate messages, and limits the rate of messages,
+  * before passing them on to another output class.
+  *
+  * Identical messages seen again within the window are not passed on,
+  * they are counted instead.  When the window expires, or the output
+  * is destroyed, or the exit method is called, the count is passed on
+  * as a "last message repeated N times" message.
+  *
+  * The remaining messages are subject to a token bucket rate limit.
+  * Messages in excess of the limit are discarded, and the number of
+  * messages discarded is passed on with the next message that makes
+  * it through.
+  *
+  * @param deeper
+  *     The output class to pass the surviving messages on to.
+  * @param window
+  *     The duplicate suppression window, in seconds.
+  *     Zero disables duplicate suppression.
+  * @param rate
+  *     The sustained rate limit, in messages per second.
+  *     Zero disables the rate limit.
+  * @param burst
+  *     The number of messages that may be passed on in a burst, before
+  *     the rate limit applies.
+  * @returns
+  *     NULL on error (i.e. malloc failed), or a pointer to a new
+  *     dynamically allocated instance of the filter class.
+  *
+  * @note
+  *     The output subsystem will "own" the deeper object after this
+  *     call.  You may not make any reference to this pointer ever
+  *     again.  The output subsystem will destroy this object and free
+  *     the memory when it feels like it.
+  */
+explain_output_t *explain_output_filter_new4(explain_output_t *deeper,
+    int window, int rate, int burst);
+
+/**
+  * The explain_output_suppress function may be used to ask the
+  * registered output class whether an explanation for the given
+  * (function, errno, fildes) key would be suppressed as a duplicate,
+  * <i>before</i> going to the expense of building the explanation.
+  *
+  * The answer is "yes" if the sampling policy for the (function,
+  * errno) key says to skip this failure (see #explain_output_sample).
+  * It is also "yes" if the registered output class is a filter (see
+  * #explain_output_filter_new), and an explanation for the same key
+  * was printed within the filter's window.  The suppressed explanation
+  * is counted as a repeat, exactly as if it had been built and
+  * printed.
+  *
+  * @param function
+  *     The name of the function that failed, e.g. "read".
+  * @param errnum
+  *     The error number that the function failed with.
+  * @param fildes
+  *     The file descriptor the function was operating on, or -1 if
+  *     not applicable.
+  * @returns
+  *     true (non-zero) if the explanation would be suppressed, false
+  *     (zero) if it should be built and printed as usual.
+  */
+int explain_output_suppress(const char *function, int errnum, int fildes);
+
+/**
+  * The explain_output_sample function may be used to set the sampling
+  * policy for explanations of failures of the given function with the
+  * given error, by the explain_*_on_error and explain_*_or_die
+  * functions.  The decision is made before any work is done to build
+  * the explanation, so skipped failures cost next to nothing.  Each
+  * (function, errno) pair is sampled separately.
+  *
+  * The policy may be one of
+  * <dl>
+  * <dt>"all"<dd>explain every failure (the default);
+  * <dt>"1/N" or "N"<dd>explain the first failure and every Nth one
+  *     after it;
+  * <dt>"rate:R" or "rate:R/B"<dd>explain at most R failures per
+  *     second, in bursts of up to B (default R);
+  * <dt>"first:N"<dd>explain the first N failures, then count the rest
+  *     and report the count at exit.
+  * </dl>
+  *
+  * The same policies may be set with the EXPLAIN_OPTIONS environment
+  * variable, e.g. "sample=1/100 read EAGAIN".
+  *
+  * @param function
+  *     The name of the function, e.g. "read", or NULL for all
+  *     functions.
+  * @param errnum
+  *     The error number, or 0 for all errors.
+  * @param policy
+  *     The sampling policy, as above.
+  * @returns
+  *     0 on success, or -1 on error (errno is EINVAL if the policy is
+  *     malformed, ENOSPC if there are too many policies).
+  */
+int explain_output_sample(const char *function, int errnum,
+    const char *policy);
+
 /**
   * The explain_output_message function is used to print text.  It is
   * printed via the registered output class, see #explain_output_register
@@ -0,0 +1,512 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+#include <libexplain/ac/sys/time.h>
+
+#include <libexplain/buffer/gettext.h>
+#include <libexplain/option.h>
+#include <libexplain/output/filter.h>
+#include <libexplain/output/or_die.h>
+#include <libexplain/program_name.h>
+#include <libexplain/string_buffer.h>
+
+
+/*
+ * The number of distinct recent messages remembered.  Each is
+ * remembered (and its repeats counted) for the duration of the window.
+ */
+#define NENTRIES 16
+
+/*
+ * The number of distinct recent (function, errno, fildes) keys
+ * remembered, for explain_output_suppress.
+ */
+#define NKEYS 64
+
+typedef struct filter_entry_t filter_entry_t;
+struct filter_entry_t
+{
+    unsigned long   hash;
+    char            *text;
+    double          when;
+    int             count;
+};
+
+typedef struct filter_key_t filter_key_t;
+struct filter_key_t
+{
+    unsigned long   hash;
+    char            function[32];
+    int             errnum;
+    int             fildes;
+    int             entry;
+    unsigned long   message_hash;
+};
+
+typedef struct explain_output_filter_t explain_output_filter_t;
+struct explain_output_filter_t
+{
+    explain_output_t inherited;
+    explain_output_t *deeper;
+    int             window;
+    double          rate;
+    double          burst;
+    double          tokens;
+    double          tokens_when;
+    int             dropped;
+    int             last;
+    int             pending_key;
+    filter_entry_t  entry[NENTRIES];
+    filter_key_t    key[NKEYS];
+};
+
+
+static double
+now(void)
+{
+    struct timeval  tv;
+
+    gettimeofday(&tv, 0);
+    return (tv.tv_sec + 1e-6 * tv.tv_usec);
+}
+
+
+/*
+ * This is the FNV-1a hash, it is fast, and it is good enough to tell
+ * messages apart.  Where it matters, the strings are also compared.
+ */
+
+static unsigned long
+hash_string(unsigned long h, const char *s)
+{
+    const unsigned char *cp;
+
+    for (cp = (const unsigned char *)s; *cp; ++cp)
+        h = ((h ^ *cp) * 16777619uL) & 0xFFFFFFFFuL;
+    return h;
+}
+
+
+static unsigned long
+hash_int(unsigned long h, int n)
+{
+    size_t          j;
+
+    for (j = 0; j < sizeof(n); ++j)
+    {
+        h = ((h ^ (n & 0xFF)) * 16777619uL) & 0xFFFFFFFFuL;
+        n >>= 8;
+    }
+    return h;
+}
+
+
+static void
+prefix(explain_string_buffer_t *sb)
+{
+    if (explain_option_assemble_program_name())
+    {
+        const char      *prog;
+
+        prog = explain_program_name_get();
+        if (prog && *prog)
+        {
+            explain_string_buffer_puts(sb, prog);
+            explain_string_buffer_puts(sb, ": ");
+        }
+    }
+}
+
+
+static void
+report_dropped(explain_output_filter_t *p)
+{
+    explain_string_buffer_t sb;
+    char            buf[200];
+
+    if (p->dropped <= 0)
+        return;
+    explain_string_buffer_init(&sb, buf, sizeof(buf));
+    prefix(&sb);
+    explain_buffer_gettext_printf
+    (
+        &sb,
+        i18n
+        (
+            /*
+             * xgettext: This message is used when the output rate
+             * limit has caused messages to be discarded.
+             *
+             * %1$d => the number of messages discarded
+             */
+            "%d messages suppressed by rate limit"
+        ),
+        p->dropped
+    );
+    p->dropped = 0;
+    explain_output_method_message(p->deeper, buf);
+}
+
+
+static void
+report_repeats(explain_output_filter_t *p, int idx)
+{
+    filter_entry_t  *ep;
+    explain_string_buffer_t sb;
+    char            buf[PATH_MAX * 2 + 200];
+
+    ep = &p->entry[idx];
+    if (ep->count <= 0)
+        return;
+    explain_string_buffer_init(&sb, buf, sizeof(buf));
+    prefix(&sb);
+    if (idx == p->last)
+    {
+        explain_buffer_gettext_printf
+        (
+            &sb,
+            i18n
+            (
+                /*
+                 * xgettext: This message is used when identical
+                 * messages have been collapsed, and the repeated
+                 * message was the immediately preceding message.
+                 *
+                 * %1$d => the number of times it was repeated
+                 */
+                "last message repeated %d times"
+            ),
+            ep->count
+        );
+    }
+    else
+    {
+        explain_buffer_gettext_printf
+        (
+            &sb,
+            i18n
+            (
+                /*
+                 * xgettext: This message is used when identical
+                 * messages have been collapsed, and other messages
+                 * have been printed since the repeated message.
+                 *
+                 * %1$d => the number of times it was repeated
+                 * %2$s => the text of the repeated message
+                 */
+                "message repeated %d times: %s"
+            ),
+            ep->count,
+            ep->text
+        );
+    }
+    ep->count = 0;
+    p->last = -1;
+    explain_output_method_message(p->deeper, buf);
+}
+
+
+static void
+report_expired(explain_output_filter_t *p, double t)
+{
+    int             j;
+
+    for (j = 0; j < NENTRIES; ++j)
+    {
+        filter_entry_t  *ep;
+
+        ep = &p->entry[j];
+        if (ep->text && ep->count > 0 && t >= ep->when + p->window)
+            report_repeats(p, j);
+    }
+}
+
+
+static void
+report_all(explain_output_filter_t *p)
+{
+    int             j;
+
+    for (j = 0; j < NENTRIES; ++j)
+        report_repeats(p, j);
+    report_dropped(p);
+}
+
+
+static int
+rate_limited(explain_output_filter_t *p, double t)
+{
+    if (p->rate <= 0)
+        return 0;
+    p->tokens += (t - p->tokens_when) * p->rate;
+    p->tokens_when = t;
+    if (p->tokens > p->burst)
+        p->tokens = p->burst;
+    if (p->tokens < 1)
+        return 1;
+    p->tokens -= 1;
+    return 0;
+}
+
+
+static void
+destructor(explain_output_t *op)
+{
+    explain_output_filter_t *p;
+    int             j;
+
+    p = (explain_output_filter_t *)op;
+    report_all(p);
+    for (j = 0; j < NENTRIES; ++j)
+        free(p->entry[j].text);
+    explain_output_method_destructor(p->deeper);
+}
+
+
+static void
+message(explain_output_t *op, const char *text)
+{
+    explain_output_filter_t *p;
+    double          t;
+    unsigned long   h;
+    int             idx;
+    filter_entry_t  *ep;
+
+    p = (explain_output_filter_t *)op;
+    if (explain_output_or_die_active())
+    {
+        /*
+         * The failure that is ending the program is never collapsed or
+         * rate limited; anything still being counted is reported
+         * first.
+         */
+        p->pending_key = -1;
+        report_all(p);
+        explain_output_method_message(p->deeper, text);
+        return;
+    }
+    t = now();
+    h = hash_string(2166136261uL, text);
+    report_expired(p, t);
+
+    idx = h % NENTRIES;
+    ep = &p->entry[idx];
+    if (p->pending_key >= 0)
+    {
+        p->key[p->pending_key].entry = idx;
+        p->key[p->pending_key].message_hash = h;
+        p->pending_key = -1;
+    }
+    if
+    (
+        ep->text
+    &&
+        ep->hash == h
+    &&
+        t < ep->when + p->window
+    &&
+        0 == strcmp(ep->text, text)
+    )
+    {
+        ++ep->count;
+        return;
+    }
+
+    /*
+     * A new message means the repeat count of the last message can be
+     * reported now, rather than waiting for its window to expire.
+     * Also forget the previous occupant of the slot (which may be an
+     * earlier instance of the same message, whose window has expired).
+     */
+    if (p->last >= 0)
+        report_repeats(p, p->last);
+    report_repeats(p, idx);
+    if (!ep->text || ep->hash != h || 0 != strcmp(ep->text, text))
+    {
+        free(ep->text);
+        ep->text = strdup(text);
+        ep->hash = h;
+    }
+    ep->when = t;
+    ep->count = 0;
+    if (p->last == idx)
+        p->last = -1;
+
+    if (rate_limited(p, t))
+    {
+        ++p->dropped;
+        return;
+    }
+    report_dropped(p);
+    explain_output_method_message(p->deeper, text);
+    if (ep->text)
+        p->last = idx;
+}
+
+
+static void
+filter_exit(explain_output_t *op, int status)
+{
+    explain_output_filter_t *p;
+
+    p = (explain_output_filter_t *)op;
+    report_all(p);
+    if (p->deeper->vtable->exit)
+        p->deeper->vtable->exit(p->deeper, status);
+}
+
+
+static const explain_output_vtable_t vtable =
+{
+    destructor,
+    message,
+    filter_exit,
+    sizeof(explain_output_filter_t)
+};
+
+
+int
+explain_output_filter_method_suppress(explain_output_t *op,
+    const char *function, int errnum, int fildes)
+{
+    explain_output_filter_t *p;
+    unsigned long   h;
+    int             idx;
+    filter_key_t    *kp;
+
+    if (!op || op->vtable != &vtable || !function)
+        return 0;
+    p = (explain_output_filter_t *)op;
+    h = hash_string(2166136261uL, function);
+    h = hash_int(h, errnum);
+    h = hash_int(h, fildes);
+    idx = h % NKEYS;
+    kp = &p->key[idx];
+    if
+    (
+        kp->entry >= 0
+    &&
+        kp->hash == h
+    &&
+        kp->errnum == errnum
+    &&
+        kp->fildes == fildes
+    &&
+        0 == strcmp(kp->function, function)
+    )
+    {
+        filter_entry_t  *ep;
+
+        ep = &p->entry[kp->entry];
+        if
+        (
+            ep->text
+        &&
+            ep->hash == kp->message_hash
+        &&
+            now() < ep->when + p->window
+        )
+        {
+            /*
+             * The explanation would only have been collapsed into the
+             * repeat count, so there is no need to build it.
+             */
+            ++ep->count;
+            return 1;
+        }
+    }
+
+    /*
+     * Remember the key, the next message will be its explanation.
+     */
+    kp->hash = h;
+    strncpy(kp->function, function, sizeof(kp->function) - 1);
+    kp->function[sizeof(kp->function) - 1] = '\0';
+    kp->errnum = errnum;
+    kp->fildes = fildes;
+    kp->entry = -1;
+    p->pending_key = idx;
+    return 0;
+}
+
+
+explain_output_t *
+explain_output_filter_new(explain_output_t *deeper)
+{
+    int             window;
+    int             rate;
+    int             burst;
+
+    window = 30;
+    rate = 10;
+    burst = 100;
+    return explain_output_filter_new4(deeper, window, rate, burst);
+}
+
+
+explain_output_t *
+explain_output_filter_new4(explain_output_t *deeper, int window, int rate,
+    int burst)
+{
+    explain_output_t *result;
+
+    if (!deeper)
+        return NULL;
+    result = explain_output_new(&vtable);
+    if (result)
+    {
+        explain_output_filter_t *p;
+        int             j;
+
+        p = (explain_output_filter_t *)result;
+        p->deeper = deeper;
+        p->window = (window > 0 ? window : 0);
+        p->rate = (rate > 0 ? rate : 0);
+        p->burst = (burst > 1 ? burst : 1);
+        p->tokens = p->burst;
+        p->tokens_when = now();
+        p->dropped = 0;
+        p->last = -1;
+        p->pending_key = -1;
+        for (j = 0; j < NENTRIES; ++j)
+        {
+            p->entry[j].hash = 0;
+            p->entry[j].text = 0;
+            p->entry[j].when = 0;
+            p->entry[j].count = 0;
+        }
+        for (j = 0; j < NKEYS; ++j)
+        {
+            p->key[j].hash = 0;
+            p->key[j].function[0] = '\0';
+            p->key[j].errnum = 0;
+            p->key[j].fildes = -1;
+            p->key[j].entry = -1;
+            p->key[j].message_hash = 0;
+        }
+    }
+    return result;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
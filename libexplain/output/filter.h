@@ -0,0 +1,51 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_OUTPUT_FILTER_H
+#define LIBEXPLAIN_OUTPUT_FILTER_H
+
+#include <libexplain/output.h>
+
+/**
+  * The explain_output_filter_method_suppress function is used to ask
+  * an output instance whether an explanation for the given key would
+  * be suppressed, so that the caller need not build it at all.
+  *
+  * It is safe for op to be NULL, and it is safe for op to be an
+  * instance of some other output class; in both cases the answer is
+  * always "no".
+  *
+  * @param op
+  *     Pointer to the explain_output_t instance to be operated on.
+  * @param function
+  *     The name of the function that failed.
+  * @param errnum
+  *     The error number that the function failed with.
+  * @param fildes
+  *     The file descriptor the function was operating on, or -1 if
+  *     not applicable.
+  * @returns
+  *     true (non-zero) if the explanation would be suppressed, false
+  *     (zero) if it should be built and printed as usual.
+  */
+int explain_output_filter_method_suppress(explain_output_t *op,
+    const char *function, int errnum, int fildes);
+
+#endif /* LIBEXPLAIN_OUTPUT_FILTER_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,52 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_OUTPUT_OR_DIE_H
+#define LIBEXPLAIN_OUTPUT_OR_DIE_H
+
+/**
+  * The explain_output_or_die_begin function is used by the
+  * explain_*_or_die functions, around their call of the corresponding
+  * explain_*_on_error function.  A failure that is about to terminate
+  * the program is always explained: neither the sampling policy nor the
+  * output filter may suppress it.
+  *
+  * Calls must be paired with #explain_output_or_die_end.  The setting
+  * is per thread.
+  */
+void explain_output_or_die_begin(void);
+
+/**
+  * The explain_output_or_die_end function is used to end the effect of
+  * a previous #explain_output_or_die_begin call.
+  */
+void explain_output_or_die_end(void);
+
+/**
+  * The explain_output_or_die_active function is used to determine
+  * whether the calling thread is within an explain_*_or_die function.
+  *
+  * @returns
+  *     true (non-zero) if explanations must not be suppressed, false
+  *     (zero) if the usual sampling and filtering apply.
+  */
+int explain_output_or_die_active(void);
+
+#endif /* LIBEXPLAIN_OUTPUT_OR_DIE_H */
+/* vim: set ts=8 sw=4 et : */
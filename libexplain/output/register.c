@@ -20,10 +20,24 @@
 #include <libexplain/ac/stdlib.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/filter.h>
+#include <libexplain/output/or_die.h>
+#include <libexplain/output/sample.h>
 #include <libexplain/output/stderr.h>
 
 static explain_output_t *where;
 
+/*
+ * The depth of explain_*_or_die calls, per thread where the compiler
+ * allows, so that one thread dying does not stop another thread's
+ * failures being sampled and filtered.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+static __thread int or_die_depth;
+#else
+static int      or_die_depth;
+#endif
+
 
 void
 explain_output_message(const char *text)
@@ -50,6 +64,41 @@ explain_output_exit_failure(void)
 }
 
 
+void
+explain_output_or_die_begin(void)
+{
+    ++or_die_depth;
+}
+
+
+void
+explain_output_or_die_end(void)
+{
+    if (or_die_depth > 0)
+        --or_die_depth;
+}
+
+
+int
+explain_output_or_die_active(void)
+{
+    return (or_die_depth > 0);
+}
+
+
+int
+explain_output_suppress(const char *function, int errnum, int fildes)
+{
+    /* the failure about to end the program is always explained */
+    if (or_die_depth > 0)
+        return 0;
+    if (explain_output_sample_skip(function, errnum))
+        return 1;
+    return explain_output_filter_method_suppress(where, function, errnum,
+        fildes);
+}
+
+
 void
 explain_output_register(explain_output_t *op)
 {
@@ -0,0 +1,518 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/time.h>
+
+#include <libexplain/buffer/gettext.h>
+#include <libexplain/errno_info.h>
+#include <libexplain/option.h>
+#include <libexplain/output.h>
+#include <libexplain/output/sample.h>
+#include <libexplain/program_name.h>
+#include <libexplain/string_buffer.h>
+#include <libexplain/wrap_and_print.h>
+
+
+/*
+ * The number of distinct sampling rules that may be set.
+ */
+#define NRULES 16
+
+/*
+ * The number of distinct (function, errno) keys remembered.  Like the
+ * output filter, a key that collides with another starts again.
+ */
+#define NKEYS 64
+
+typedef enum sample_mode_t sample_mode_t;
+enum sample_mode_t
+{
+    sample_mode_all,
+    sample_mode_one_in,
+    sample_mode_rate,
+    sample_mode_first
+};
+
+typedef struct sample_rule_t sample_rule_t;
+struct sample_rule_t
+{
+    /* the function name, or "*" for all functions */
+    char            function[32];
+
+    /* the error number, or 0 for all errors */
+    int             errnum;
+
+    sample_mode_t   mode;
+    unsigned long   n;
+    double          rate;
+    double          burst;
+};
+
+typedef struct sample_key_t sample_key_t;
+struct sample_key_t
+{
+    char            function[32];
+    int             errnum;
+    const sample_rule_t *rule;
+    unsigned long   count;
+    unsigned long   skipped;
+    double          tokens;
+    double          tokens_when;
+};
+
+/*
+ * The rules and keys are shared by all threads, so they may only be
+ * used by one thread at a time.  A thread that finds them busy simply
+ * explains the failure, the way it would with no policy at all.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) || \
+    defined(__clang__)
+#define HAVE_SAMPLE_LOCK 1
+#endif
+
+static int      initialised;
+static int      nrules;
+static sample_rule_t rules[NRULES];
+static sample_key_t keys[NKEYS];
+static int      summary_registered;
+#ifdef HAVE_SAMPLE_LOCK
+static int      busy;
+#endif
+
+
+static int
+begin(void)
+{
+#ifdef HAVE_SAMPLE_LOCK
+    if (__sync_lock_test_and_set(&busy, 1))
+        return -1;
+#endif
+    return 0;
+}
+
+
+/**
+  * The begin_wait function is used by the (rare) calls that change the
+  * policy, or report at exit; these must not be skipped, so they wait
+  * for the sampling of other threads to finish.
+  */
+static void
+begin_wait(void)
+{
+    while (begin() < 0)
+        ;
+}
+
+
+static void
+end(void)
+{
+#ifdef HAVE_SAMPLE_LOCK
+    __sync_lock_release(&busy);
+#endif
+}
+
+
+static double
+now(void)
+{
+    struct timeval  tv;
+
+    gettimeofday(&tv, 0);
+    return (tv.tv_sec + 1e-6 * tv.tv_usec);
+}
+
+
+static unsigned long
+hash_key(const char *function, int errnum)
+{
+    const unsigned char *cp;
+    unsigned long   h;
+    size_t          j;
+
+    h = 2166136261uL;
+    for (cp = (const unsigned char *)function; *cp; ++cp)
+        h = ((h ^ *cp) * 16777619uL) & 0xFFFFFFFFuL;
+    for (j = 0; j < sizeof(errnum); ++j)
+    {
+        h = ((h ^ (errnum & 0xFF)) * 16777619uL) & 0xFFFFFFFFuL;
+        errnum >>= 8;
+    }
+    return h;
+}
+
+
+/**
+  * The summarise function is used to report how many failures of a
+  * "first:N" key were not explained.
+  */
+static void
+summarise(sample_key_t *kp)
+{
+    explain_string_buffer_t sb;
+    char            buf[200];
+    char            errname[20];
+    const explain_errno_info_t *eip;
+
+    if (!kp->rule || kp->rule->mode != sample_mode_first || !kp->skipped)
+        return;
+    eip = explain_errno_info_by_number(kp->errnum);
+    if (eip)
+        snprintf(errname, sizeof(errname), "%s", eip->name);
+    else
+        snprintf(errname, sizeof(errname), "%d", kp->errnum);
+
+    explain_string_buffer_init(&sb, buf, sizeof(buf));
+    if (explain_option_assemble_program_name())
+    {
+        const char      *prog;
+
+        prog = explain_program_name_get();
+        if (prog && *prog)
+        {
+            explain_string_buffer_puts(&sb, prog);
+            explain_string_buffer_puts(&sb, ": ");
+        }
+    }
+    explain_buffer_gettext_printf
+    (
+        &sb,
+        i18n
+        (
+            /*
+             * xgettext: This message is used when the sampling policy
+             * has caused failures to go unexplained.
+             *
+             * %1$s => the name of the function that failed
+             * %2$s => the name of the error
+             * %3$lu => the number of failures not explained
+             */
+            "%s: %s: %lu more failures not explained"
+        ),
+        kp->function,
+        errname,
+        kp->skipped
+    );
+    kp->skipped = 0;
+    explain_output_message(buf);
+}
+
+
+static void
+summarise_all_locked(void)
+{
+    int             j;
+
+    for (j = 0; j < NKEYS; ++j)
+        summarise(&keys[j]);
+}
+
+
+static void
+summarise_all(void)
+{
+    begin_wait();
+    summarise_all_locked();
+    end();
+}
+
+
+static int
+parse_policy(const char *text, sample_rule_t *rp)
+{
+    char            *end;
+
+    if (0 == strcmp(text, "all"))
+    {
+        rp->mode = sample_mode_all;
+        return 0;
+    }
+    if (0 == strncmp(text, "first:", 6))
+    {
+        rp->mode = sample_mode_first;
+        rp->n = strtoul(text + 6, &end, 10);
+        return ((end == text + 6 || *end) ? -1 : 0);
+    }
+    if (0 == strncmp(text, "rate:", 5))
+    {
+        rp->mode = sample_mode_rate;
+        rp->rate = strtod(text + 5, &end);
+        if (end == text + 5 || rp->rate <= 0)
+            return -1;
+        rp->burst = (rp->rate < 1 ? 1 : rp->rate);
+        if (*end == '/')
+        {
+            const char      *cp;
+
+            cp = end + 1;
+            rp->burst = strtod(cp, &end);
+            if (end == cp || rp->burst < 1)
+                return -1;
+        }
+        return (*end ? -1 : 0);
+    }
+    if (0 == strncmp(text, "1/", 2))
+        text += 2;
+    rp->mode = sample_mode_one_in;
+    rp->n = strtoul(text, &end, 10);
+    return ((end == text || *end || rp->n < 1) ? -1 : 0);
+}
+
+
+int
+explain_output_sample(const char *function, int errnum, const char *policy)
+{
+    sample_rule_t   rule;
+    int             j;
+
+    if (!initialised)
+    {
+        initialised = 1;
+        explain_option_sample();
+    }
+    if (!function)
+        function = "*";
+    memset(&rule, 0, sizeof(rule));
+    if (!policy || parse_policy(policy, &rule) < 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    strncpy(rule.function, function, sizeof(rule.function) - 1);
+    rule.function[sizeof(rule.function) - 1] = '\0';
+    rule.errnum = errnum;
+
+    /*
+     * A later policy for the same (function, errno) replaces the
+     * earlier one.
+     */
+    begin_wait();
+    for (j = 0; j < nrules; ++j)
+    {
+        if
+        (
+            rules[j].errnum == errnum
+        &&
+            0 == strcmp(rules[j].function, rule.function)
+        )
+            break;
+    }
+    if (j >= NRULES)
+    {
+        end();
+        errno = ENOSPC;
+        return -1;
+    }
+    summarise_all_locked();
+    rules[j] = rule;
+    if (j >= nrules)
+        nrules = j + 1;
+    memset(keys, 0, sizeof(keys));
+    end();
+
+    if (rule.mode == sample_mode_first && !summary_registered)
+    {
+        summary_registered = 1;
+#ifdef HAVE_ATEXIT
+        atexit(summarise_all);
+#endif
+    }
+    return 0;
+}
+
+
+void
+explain_output_sample_option(const char *text)
+{
+    char            policy[50];
+    char            function[32];
+    char            errname[32];
+    int             errnum;
+
+    policy[0] = '\0';
+    function[0] = '\0';
+    errname[0] = '\0';
+    sscanf(text, "%49s %31s %31s", policy, function, errname);
+    errnum = 0;
+    if (errname[0])
+    {
+        if (isdigit((unsigned char)errname[0]))
+            errnum = atoi(errname);
+        else
+        {
+            const explain_errno_info_t *eip;
+            char            *cp;
+
+            /* the option text has been folded to lower case */
+            for (cp = errname; *cp; ++cp)
+                *cp = toupper((unsigned char)*cp);
+            eip = explain_errno_info_by_name(errname);
+            errnum = (eip ? eip->error_number : -1);
+        }
+    }
+    if
+    (
+        errnum < 0
+    ||
+        explain_output_sample(function[0] ? function : 0, errnum, policy) < 0
+    )
+    {
+        if (explain_option_debug())
+        {
+            explain_string_buffer_t buf;
+            char            message[200];
+
+            explain_string_buffer_init(&buf, message, sizeof(message));
+            explain_string_buffer_puts
+            (
+                &buf,
+                "libexplain: Warning: sample option "
+            );
+            explain_string_buffer_puts_quoted(&buf, text);
+            explain_string_buffer_puts(&buf, " malformed");
+            explain_wrap_and_print(stderr, message);
+        }
+    }
+}
+
+
+static const sample_rule_t *
+find_rule(const char *function, int errnum)
+{
+    const sample_rule_t *best;
+    int             best_score;
+    int             j;
+
+    /*
+     * The most specific rule wins: a matching function name counts
+     * for more than a matching error.
+     */
+    best = 0;
+    best_score = -1;
+    for (j = 0; j < nrules; ++j)
+    {
+        const sample_rule_t *rp;
+        int             score;
+
+        rp = &rules[j];
+        score = 0;
+        if (0 == strcmp(rp->function, function))
+            score += 2;
+        else if (0 != strcmp(rp->function, "*"))
+            continue;
+        if (rp->errnum == errnum)
+            score += 1;
+        else if (rp->errnum != 0)
+            continue;
+        if (score > best_score)
+        {
+            best = rp;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+
+int
+explain_output_sample_skip(const char *function, int errnum)
+{
+    const sample_rule_t *rp;
+    sample_key_t    *kp;
+    int             skip;
+
+    if (!initialised)
+    {
+        initialised = 1;
+        explain_option_sample();
+    }
+    if (!nrules || !function)
+        return 0;
+    if (begin() < 0)
+        return 0;
+    rp = find_rule(function, errnum);
+    if (!rp || rp->mode == sample_mode_all)
+    {
+        end();
+        return 0;
+    }
+
+    kp = &keys[hash_key(function, errnum) % NKEYS];
+    if
+    (
+        kp->rule != rp
+    ||
+        kp->errnum != errnum
+    ||
+        0 != strcmp(kp->function, function)
+    )
+    {
+        summarise(kp);
+        memset(kp, 0, sizeof(*kp));
+        strncpy(kp->function, function, sizeof(kp->function) - 1);
+        kp->errnum = errnum;
+        kp->rule = rp;
+        kp->tokens = rp->burst;
+        kp->tokens_when = (rp->mode == sample_mode_rate ? now() : 0);
+    }
+
+    ++kp->count;
+    switch (rp->mode)
+    {
+    case sample_mode_one_in:
+        skip = ((kp->count - 1) % rp->n != 0);
+        break;
+
+    case sample_mode_first:
+        skip = (kp->count > rp->n);
+        break;
+
+    case sample_mode_rate:
+        {
+            double          t;
+
+            t = now();
+            kp->tokens += (t - kp->tokens_when) * rp->rate;
+            kp->tokens_when = t;
+            if (kp->tokens > rp->burst)
+                kp->tokens = rp->burst;
+            skip = (kp->tokens < 1);
+            if (!skip)
+                kp->tokens -= 1;
+        }
+        break;
+
+    case sample_mode_all:
+    default:
+        skip = 0;
+        break;
+    }
+    if (skip)
+        ++kp->skipped;
+    end();
+    return skip;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
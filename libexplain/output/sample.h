@@ -0,0 +1,50 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_OUTPUT_SAMPLE_H
+#define LIBEXPLAIN_OUTPUT_SAMPLE_H
+
+/**
+  * The explain_output_sample_skip function is used to apply the
+  * sampling policy (see #explain_output_sample) to a failure, before
+  * any work is done to explain it.
+  *
+  * @param function
+  *     The name of the function that failed.
+  * @param errnum
+  *     The error number that the function failed with.
+  * @returns
+  *     true (non-zero) if the failure is not to be explained, false
+  *     (zero) if it is.
+  */
+int explain_output_sample_skip(const char *function, int errnum);
+
+/**
+  * The explain_output_sample_option function is used to process the
+  * value of a "sample" option from the EXPLAIN_OPTIONS environment
+  * variable, e.g. "1/100 read EAGAIN".
+  *
+  * @param text
+  *     The option value: a policy, optionally followed by a function
+  *     name (or "*" for all functions) and an error name or number.
+  */
+void explain_output_sample_option(const char *text);
+
+#endif /* LIBEXPLAIN_OUTPUT_SAMPLE_H */
+/* vim: set ts=8 sw=4 et : */
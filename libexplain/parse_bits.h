@@ -154,6 +154,27 @@ const explain_parse_bits_table_t *explain_parse_bits_find_by_value(
     int value, const explain_parse_bits_table_t *table,
     size_t table_size);
 
+/**
+  * The explain_parse_bits_register function may be used to register a
+  * table, so that it is indexed by name and by value immediately,
+  * rather than the first time it is searched.  Tables with only a few
+  * members are not usually indexed at all; registering a table makes
+  * sure it is, whatever its size.
+  *
+  * The table must remain valid for the life of the process.  The index
+  * only notices changes to the size, and to the first and last members
+  * of a table, so a table that has been changed in any other way must
+  * be registered again, to rebuild its index.  A table must not be
+  * changed while another thread may be searching it.
+  *
+  * @param table
+  *      The table to be registered.
+  * @param table_size
+  *      The number of members in the table.
+  */
+void explain_parse_bits_register(const explain_parse_bits_table_t *table,
+    size_t table_size);
+
 struct explain_string_buffer_t; /* forward */
 
 /**
@@ -165,7 +186,8 @@ struct explain_string_buffer_t; /* forward */
   * @param value
   *      The value to dismantle and search for bits in the table
   * @param table
-  *      The table to be searched.
+  *      The table to be searched.  It must be in static storage,
+  *      because its index is cached by address.
   * @param table_size
   *      The number of members in the table to be searched.
   */
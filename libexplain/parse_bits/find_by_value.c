@@ -18,6 +18,7 @@
  */
 
 #include <libexplain/parse_bits.h>
+#include <libexplain/parse_bits/index.h>
 
 
 const explain_parse_bits_table_t *
@@ -26,6 +27,11 @@ explain_parse_bits_find_by_value(int value,
 {
     const explain_parse_bits_table_t *tp;
     const explain_parse_bits_table_t *end;
+    const explain_parse_bits_index_t *ip;
+
+    ip = explain_parse_bits_index(table, table_size);
+    if (ip)
+        return explain_parse_bits_index_find_by_value(ip, value);
 
     end = table + table_size;
     for (tp = table; tp < end; ++tp)
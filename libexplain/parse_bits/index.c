@@ -0,0 +1,417 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+
+#include <libexplain/parse_bits/index.h>
+
+
+/*
+ * Tables smaller than this are searched linearly, it is faster than
+ * the index would be.
+ */
+#define SMALLEST_INDEXED 8
+
+/*
+ * The cache is only looked at or changed while the busy flag is held.
+ * A thread that finds it busy does without the index, and searches
+ * the table linearly.  Once an index has been handed out it is never
+ * changed or freed, because another thread may still be searching it;
+ * a table that changes is given a new index, and the old one is
+ * abandoned.
+ */
+static explain_parse_bits_index_t **cache;
+static size_t   cache_size;
+static size_t   cache_count;
+static int      small_registered;
+static int      busy;
+
+
+static size_t
+hash(const explain_parse_bits_table_t *table)
+{
+    size_t          h;
+
+    h = (size_t)table;
+    return (h ^ (h >> 7) ^ (h >> 17));
+}
+
+
+/*
+ * This is the FNV-1a hash, folded to lower case, because names are
+ * matched using strcasecmp.
+ */
+
+static size_t
+hash_name(const char *name)
+{
+    const unsigned char *cp;
+    unsigned long   h;
+
+    h = 2166136261uL;
+    for (cp = (const unsigned char *)name; *cp; ++cp)
+    {
+        unsigned char   c;
+
+        c = *cp;
+        if (isupper(c))
+            c = tolower(c);
+        h = ((h ^ c) * 16777619uL) & 0xFFFFFFFFuL;
+    }
+    return h;
+}
+
+
+static int
+bit_number(unsigned bit)
+{
+#if __GNUC__ >= 3 || defined(__clang__)
+    return __builtin_ctz(bit);
+#else
+    int             n;
+
+    n = 0;
+    while (!(bit & 1))
+    {
+        bit >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+
+static int
+is_single_bit(int value)
+{
+    unsigned        u;
+
+    u = value;
+    return (u != 0 && (u & (u - 1)) == 0);
+}
+
+
+static int
+cmp(const void *va, const void *vb)
+{
+    const explain_parse_bits_table_t *a;
+    const explain_parse_bits_table_t *b;
+
+    a = *(const explain_parse_bits_table_t *const *)va;
+    b = *(const explain_parse_bits_table_t *const *)vb;
+    if (a->value != b->value)
+        return (a->value < b->value ? -1 : 1);
+    /* both point into the same table, keep the table order */
+    if (a != b)
+        return (a < b ? -1 : 1);
+    return 0;
+}
+
+
+static int
+still_valid(const explain_parse_bits_index_t *ip,
+    const explain_parse_bits_table_t *table, size_t table_size)
+{
+    return
+        (
+            ip->table_size == table_size
+        &&
+            ip->first.name == table[0].name
+        &&
+            ip->first.value == table[0].value
+        &&
+            ip->last.name == table[table_size - 1].name
+        &&
+            ip->last.value == table[table_size - 1].value
+        );
+}
+
+
+static int
+build(explain_parse_bits_index_t *ip, const explain_parse_bits_table_t *table,
+    size_t table_size)
+{
+    const explain_parse_bits_table_t **sorted;
+    const explain_parse_bits_table_t **names;
+    size_t          names_size;
+    size_t          j;
+
+    sorted = malloc(table_size * sizeof(sorted[0]));
+    if (!sorted)
+        return -1;
+    names_size = 16;
+    while (names_size < table_size * 2)
+        names_size *= 2;
+    names = malloc(names_size * sizeof(names[0]));
+    if (!names)
+    {
+        free(sorted);
+        return -1;
+    }
+
+    for (j = 0; j < names_size; ++j)
+        names[j] = 0;
+    for (j = 0; j < table_size; ++j)
+    {
+        const explain_parse_bits_table_t *tp;
+        size_t          k;
+
+        tp = table + j;
+        k = hash_name(tp->name) & (names_size - 1);
+        for (;;)
+        {
+            if (!names[k])
+            {
+                names[k] = tp;
+                break;
+            }
+            if (0 == strcasecmp(names[k]->name, tp->name))
+                break;
+            k = (k + 1) & (names_size - 1);
+        }
+    }
+    ip->names = names;
+    ip->names_size = names_size;
+    for (j = 0; j < table_size; ++j)
+        sorted[j] = table + j;
+    qsort(sorted, table_size, sizeof(sorted[0]), cmp);
+    ip->sorted = sorted;
+
+    for (j = 0; j < EXPLAIN_PARSE_BITS_INDEX_NBITS; ++j)
+        ip->bit[j] = 0;
+    for (j = table_size; j > 0; --j)
+    {
+        const explain_parse_bits_table_t *tp;
+
+        /* backwards, so that the first of any duplicates wins */
+        tp = table + j - 1;
+        if (is_single_bit(tp->value))
+            ip->bit[bit_number(tp->value)] = tp;
+    }
+
+    ip->table = table;
+    ip->table_size = table_size;
+    ip->first = table[0];
+    ip->last = table[table_size - 1];
+    return 0;
+}
+
+
+static int
+grow(void)
+{
+    explain_parse_bits_index_t **new_cache;
+    size_t          new_cache_size;
+    size_t          j;
+
+    new_cache_size = cache_size ? cache_size * 2 : 64;
+    new_cache = malloc(new_cache_size * sizeof(new_cache[0]));
+    if (!new_cache)
+        return -1;
+    for (j = 0; j < new_cache_size; ++j)
+        new_cache[j] = 0;
+    for (j = 0; j < cache_size; ++j)
+    {
+        explain_parse_bits_index_t *ip;
+        size_t          k;
+
+        ip = cache[j];
+        if (!ip)
+            continue;
+        k = hash(ip->table) & (new_cache_size - 1);
+        while (new_cache[k])
+            k = (k + 1) & (new_cache_size - 1);
+        new_cache[k] = ip;
+    }
+    if (cache)
+        free(cache);
+    cache = new_cache;
+    cache_size = new_cache_size;
+    return 0;
+}
+
+
+static explain_parse_bits_index_t *
+new_index(const explain_parse_bits_table_t *table, size_t table_size)
+{
+    explain_parse_bits_index_t *ip;
+
+    ip = malloc(sizeof(*ip));
+    if (!ip)
+        return 0;
+    if (build(ip, table, table_size))
+    {
+        free(ip);
+        return 0;
+    }
+    return ip;
+}
+
+
+static explain_parse_bits_index_t *
+find_or_build(const explain_parse_bits_table_t *table, size_t table_size,
+    int registering)
+{
+    explain_parse_bits_index_t *ip;
+    size_t          k;
+
+    if (cache_count * 2 >= cache_size && grow())
+        return 0;
+
+    k = hash(table) & (cache_size - 1);
+    for (;;)
+    {
+        ip = cache[k];
+        if (!ip)
+            break;
+        if (ip->table == table)
+        {
+            /*
+             * Registering a table always rebuilds its index, so that
+             * a table that has been changed can be registered again.
+             */
+            if (!registering && still_valid(ip, table, table_size))
+                return ip;
+            ip = new_index(table, table_size);
+            if (!ip)
+                return 0;
+            cache[k] = ip;
+            return ip;
+        }
+        k = (k + 1) & (cache_size - 1);
+    }
+
+    /*
+     * Small tables are only indexed if they have been registered.
+     */
+    if (table_size < SMALLEST_INDEXED && !registering)
+        return 0;
+    ip = new_index(table, table_size);
+    if (!ip)
+        return 0;
+    cache[k] = ip;
+    ++cache_count;
+    if (table_size < SMALLEST_INDEXED)
+        small_registered = 1;
+    return ip;
+}
+
+
+static const explain_parse_bits_index_t *
+find_or_build_locked(const explain_parse_bits_table_t *table,
+    size_t table_size, int registering)
+{
+    const explain_parse_bits_index_t *ip;
+
+    if (table_size == 0)
+        return 0;
+    if (table_size < SMALLEST_INDEXED && !registering)
+    {
+        if (!__sync_add_and_fetch(&small_registered, 0))
+            return 0;
+    }
+    while (__sync_lock_test_and_set(&busy, 1))
+    {
+        /*
+         * Registering must not be skipped, so it waits for the
+         * searches of other threads to finish.
+         */
+        if (!registering)
+            return 0;
+    }
+    ip = find_or_build(table, table_size, registering);
+    __sync_lock_release(&busy);
+    return ip;
+}
+
+
+const explain_parse_bits_index_t *
+explain_parse_bits_index(const explain_parse_bits_table_t *table,
+    size_t table_size)
+{
+    return find_or_build_locked(table, table_size, 0);
+}
+
+
+void
+explain_parse_bits_register(const explain_parse_bits_table_t *table,
+    size_t table_size)
+{
+    find_or_build_locked(table, table_size, 1);
+}
+
+
+const explain_parse_bits_table_t *
+explain_parse_bits_index_find_by_name(const explain_parse_bits_index_t *ip,
+    const char *name)
+{
+    size_t          k;
+
+    k = hash_name(name) & (ip->names_size - 1);
+    for (;;)
+    {
+        const explain_parse_bits_table_t *tp;
+
+        tp = ip->names[k];
+        if (!tp)
+            return 0;
+        if (0 == strcasecmp(tp->name, name))
+            return tp;
+        k = (k + 1) & (ip->names_size - 1);
+    }
+}
+
+
+const explain_parse_bits_table_t *
+explain_parse_bits_index_find_by_value(const explain_parse_bits_index_t *ip,
+    int value)
+{
+    size_t          lo;
+    size_t          hi;
+
+    /* find the first member not less than the value */
+    lo = 0;
+    hi = ip->table_size;
+    while (lo < hi)
+    {
+        size_t          mid;
+
+        mid = lo + (hi - lo) / 2;
+        if (ip->sorted[mid]->value < value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < ip->table_size && ip->sorted[lo]->value == value)
+        return ip->sorted[lo];
+    return 0;
+}
+
+
+const explain_parse_bits_table_t *
+explain_parse_bits_index_find_by_bit(const explain_parse_bits_index_t *ip,
+    int bit)
+{
+    return ip->bit[bit_number(bit)];
+}
+
+
+/* vim: set ts=8 sw=4 et : */
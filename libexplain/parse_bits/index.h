@@ -0,0 +1,153 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_PARSE_BITS_INDEX_H
+#define LIBEXPLAIN_PARSE_BITS_INDEX_H
+
+#include <libexplain/ac/limits.h>
+
+#include <libexplain/parse_bits.h>
+
+/**
+  * The number of bits in an int, and thus the number of single-bit
+  * values a bit-set table can name.
+  */
+#define EXPLAIN_PARSE_BITS_INDEX_NBITS (sizeof(int) * CHAR_BIT)
+
+typedef struct explain_parse_bits_index_t explain_parse_bits_index_t;
+struct explain_parse_bits_index_t
+{
+    /**
+      * The table being indexed.
+      */
+    const explain_parse_bits_table_t *table;
+
+    /**
+      * The number of members in the table being indexed.
+      */
+    size_t          table_size;
+
+    /**
+      * The first and last members of the table, as they were when the
+      * index was built.  These are used to notice when a different
+      * table (typically one with automatic storage) turns up at the
+      * same address.  They are only a cheap check, changes to the
+      * other members are not noticed; see explain_parse_bits_register.
+      */
+    explain_parse_bits_table_t first;
+    explain_parse_bits_table_t last;
+
+    /**
+      * The bit array maps bit number to the first table member with
+      * exactly that single-bit value, or NULL if there is none.
+      */
+    const explain_parse_bits_table_t *bit[EXPLAIN_PARSE_BITS_INDEX_NBITS];
+
+    /**
+      * The sorted array holds pointers to every table member, sorted
+      * by value and then by table position, so that a binary search
+      * finds the same member a linear search would.
+      */
+    const explain_parse_bits_table_t **sorted;
+
+    /**
+      * The names array is an open-addressing hash table of pointers to
+      * table members, hashed by name without regard to case.  Where
+      * names differ only in case, only the first in table order is
+      * present, so that a hash search finds the same member a linear
+      * search would.
+      */
+    const explain_parse_bits_table_t **names;
+
+    /**
+      * The number of slots in the names array, always a power of two.
+      */
+    size_t          names_size;
+};
+
+/**
+  * The explain_parse_bits_index function is used to obtain the index
+  * for the given table, building it the first time the table is seen.
+  * Indexes are cached for the life of the process.
+  *
+  * @param table
+  *      The table to be indexed.
+  * @param table_size
+  *      The number of members in the table.
+  * @returns
+  *      pointer to the index, or NULL if the table is too small to be
+  *      worth indexing, or if memory could not be obtained.  Callers
+  *      must fall back to a linear search in that case.
+  * @note
+  *      This function is thread safe; when another thread is using
+  *      the cache it returns NULL.  Indexes are found by table address,
+  *      so tables must be in static storage (never on the stack), and
+  *      must not change after they have been first searched, unless
+  *      they are registered again.
+  */
+const explain_parse_bits_index_t *explain_parse_bits_index(
+    const explain_parse_bits_table_t *table, size_t table_size);
+
+/**
+  * The explain_parse_bits_index_find_by_name function is used to
+  * search an index for the given name, without regard to case.
+  *
+  * @param ip
+  *      The index to be searched.
+  * @param name
+  *      The name to search for.
+  * @returns
+  *      pointer to the first table member (in table order) with the
+  *      given name, or NULL if there is none
+  */
+const explain_parse_bits_table_t *explain_parse_bits_index_find_by_name(
+    const explain_parse_bits_index_t *ip, const char *name);
+
+/**
+  * The explain_parse_bits_index_find_by_value function is used to
+  * search an index for the given value.
+  *
+  * @param ip
+  *      The index to be searched.
+  * @param value
+  *      The value to search for.
+  * @returns
+  *      pointer to the first table member (in table order) with the
+  *      given value, or NULL if there is none
+  */
+const explain_parse_bits_table_t *explain_parse_bits_index_find_by_value(
+    const explain_parse_bits_index_t *ip, int value);
+
+/**
+  * The explain_parse_bits_index_find_by_bit function is used to
+  * search an index for the given single-bit value.
+  *
+  * @param ip
+  *      The index to be searched.
+  * @param bit
+  *      The value to search for, it must have exactly one bit set.
+  * @returns
+  *      pointer to the first table member (in table order) with the
+  *      given value, or NULL if there is none
+  */
+const explain_parse_bits_table_t *explain_parse_bits_index_find_by_bit(
+    const explain_parse_bits_index_t *ip, int bit);
+
+#endif /* LIBEXPLAIN_PARSE_BITS_INDEX_H */
+/* vim: set ts=8 sw=4 et : */
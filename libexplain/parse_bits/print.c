@@ -18,6 +18,7 @@
  */
 
 #include <libexplain/parse_bits.h>
+#include <libexplain/parse_bits/index.h>
 #include <libexplain/string_buffer.h>
 
 
@@ -27,12 +28,14 @@ explain_parse_bits_print(explain_string_buffer_t *sb, int value,
 {
     int             first;
     int             other;
+    const explain_parse_bits_index_t *ip;
 
     if (value == 0)
     {
         explain_string_buffer_puts(sb, "0");
         return;
     }
+    ip = explain_parse_bits_index(table, table_size);
     first = 1;
     other = 0;
     for (;;)
@@ -42,7 +45,10 @@ explain_parse_bits_print(explain_string_buffer_t *sb, int value,
 
         bit = value & -value;
         value -= bit;
-        tp = explain_parse_bits_find_by_value(bit, table, table_size);
+        if (ip)
+            tp = explain_parse_bits_index_find_by_bit(ip, bit);
+        else
+            tp = explain_parse_bits_find_by_value(bit, table, table_size);
         if (tp)
         {
             if (!first)
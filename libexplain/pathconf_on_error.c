@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/pathconf.h>
 #include <libexplain/output.h>
 
@@ -35,14 +36,19 @@ explain_pathconf_on_error(const char *pathname, int name)
 #else
     errno = 0;
 #endif
+    explain_explanation_call_begin();
     result = pathconf(pathname, name);
+    explain_explanation_call_end();
     if (result == -1 && errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_pathconf(hold_errno, pathname, name)
-        );
+        if (!explain_output_suppress("pathconf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_pathconf(hold_errno, pathname, name)
+            );
+        }
     }
     errno = hold_errno;
     return result;
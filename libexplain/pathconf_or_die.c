@@ -21,6 +21,7 @@
 
 #include <libexplain/pathconf.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 long
@@ -29,7 +30,9 @@ explain_pathconf_or_die(const char *pathname, int name)
     long            result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_pathconf_on_error(pathname, name);
+    explain_output_or_die_end();
     if (result == -1 && errno != 0)
     {
         explain_output_exit_failure();
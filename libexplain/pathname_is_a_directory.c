@@ -19,6 +19,7 @@
 
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/memo.h>
 #include <libexplain/pathname_is_a_directory.h>
 
 
@@ -27,7 +28,7 @@ explain_pathname_is_a_directory(const char *pathname)
 {
     struct stat     st;
 
-    return (lstat(pathname, &st) >= 0 && S_ISDIR(st.st_mode));
+    return (explain_memo_lstat(pathname, &st) >= 0 && S_ISDIR(st.st_mode));
 }
 
 
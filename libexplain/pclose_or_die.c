@@ -20,6 +20,7 @@
 
 #include <libexplain/pclose.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 int
@@ -27,7 +28,9 @@ explain_pclose_or_die(FILE *fp)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_pclose_on_error(fp);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
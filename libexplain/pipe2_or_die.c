@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/pipe2.h>
 
 
 void
 explain_pipe2_or_die(int *fildes, int flags)
 {
+    explain_output_or_die_begin();
     if (explain_pipe2_on_error(fildes, flags) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_pipe2_on_error(int *fildes, int flags)
     int             result;
 
 #ifdef HAVE_PIPE2
+    explain_explanation_call_begin();
     result = pipe2(fildes, flags);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_pipe2_on_error(int *fildes, int flags)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_pipe2(hold_errno, fildes, flags)
-        );
+        if (!explain_output_suppress("pipe2", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_pipe2(hold_errno, fildes, flags)
+            );
+        }
         errno = hold_errno;
     }
     return result;
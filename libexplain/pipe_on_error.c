@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/pipe.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_pipe_on_error(int *pipefd)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = pipe(pipefd);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_pipe(hold_errno, pipefd));
+        if (!explain_output_suppress("pipe", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_pipe(hold_errno, pipefd));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,15 +20,18 @@
 
 #include <libexplain/pipe.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_pipe_or_die(int *pipefd)
 {
+    explain_output_or_die_begin();
     if (explain_pipe_on_error(pipefd) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/poll.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/poll.h>
 
 
@@ -28,7 +30,9 @@ explain_poll_or_die(struct pollfd *data, int data_size, int timeout)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_poll_on_error(data, data_size, timeout);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -43,7 +47,9 @@ explain_poll_on_error(struct pollfd *data, int data_size, int timeout)
     int             result;
 
 #ifdef HAVE_POLL
+    explain_explanation_call_begin();
     result = poll(data, data_size, timeout);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -53,11 +59,14 @@ explain_poll_on_error(struct pollfd *data, int data_size, int timeout)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_poll(hold_errno, data, data_size, timeout)
-        );
+        if (!explain_output_suppress("poll", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_poll(hold_errno, data, data_size, timeout)
+            );
+        }
         errno = hold_errno;
     }
     return result;
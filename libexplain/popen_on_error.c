@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/popen.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_popen_on_error(const char *command, const char *flags)
 {
     FILE            *result;
 
+    explain_explanation_call_begin();
     result = popen(command, flags);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_popen(hold_errno, command,
-            flags));
+        if (!explain_output_suppress("popen", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_popen(hold_errno, command,
+                flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 
 #include <libexplain/popen.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 FILE *
@@ -27,7 +28,9 @@ explain_popen_or_die(const char *command, const char *flags)
 {
     FILE            *fp;
 
+    explain_output_or_die_begin();
     fp = explain_popen_on_error(command, flags);
+    explain_output_or_die_end();
     if (!fp)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/pread.h>
 
 
@@ -27,7 +28,9 @@ explain_pread_or_die(int fildes, void *data, size_t data_size, off_t offset)
 {
     ssize_t         result;
 
+    explain_output_or_die_begin();
     result = explain_pread_on_error(fildes, data, data_size, offset);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
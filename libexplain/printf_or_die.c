@@ -22,6 +22,7 @@
 
 #include <libexplain/buffer/errno/printf.h>
 #include <libexplain/common_message_buffer.h>
+#include <libexplain/explanation.h>
 #include <libexplain/printf.h>
 #include <libexplain/output.h>
 #include <libexplain/string_buffer.h>
@@ -77,20 +78,25 @@ explain_printf_on_error(const char *format, ...)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vprintf(format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         explain_string_buffer_t sb;
 
         hold_errno = errno;
-        explain_string_buffer_init
-        (
-            &sb,
-            explain_common_message_buffer,
-            explain_common_message_buffer_size
-        );
-        explain_buffer_errno_printf(&sb, hold_errno, format, ap2);
-        explain_output_error("%s", explain_common_message_buffer);
+        if (!explain_output_suppress("printf", hold_errno, -1))
+        {
+            explain_string_buffer_init
+            (
+                &sb,
+                explain_common_message_buffer,
+                explain_common_message_buffer_size
+            );
+            explain_buffer_errno_printf(&sb, hold_errno, format, ap2);
+            explain_output_error("%s", explain_common_message_buffer);
+        }
     }
     va_end(ap2); /* yes, both of them */
     va_end(ap);
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/ptrace.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/ptrace.h>
 
 
@@ -28,7 +30,9 @@ explain_ptrace_or_die(int request, pid_t pid, void *addr, void *data)
 {
     long            result;
 
+    explain_output_or_die_begin();
     result = explain_ptrace_on_error(request, pid, addr, data);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -56,17 +60,22 @@ explain_ptrace_on_error(int request, pid_t pid, void *addr, void *data)
 {
     long            result;
 
+    explain_explanation_call_begin();
     result = ptrace(request, pid, addr, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_ptrace(hold_errno, request, pid, addr, data)
-        );
+        if (!explain_output_suppress("ptrace", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_ptrace(hold_errno, request, pid, addr, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/putc.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,10 @@ explain_putc_on_error_failed(int c, FILE *fp)
     int             hold_errno;
 
     hold_errno = errno;
-    explain_output_error("%s", explain_errno_putc(hold_errno, c, fp));
+    if (!explain_output_suppress("putc", hold_errno, -1))
+    {
+        explain_output_error("%s", explain_errno_putc(hold_errno, c, fp));
+    }
     errno = hold_errno;
 }
 
@@ -41,7 +45,9 @@ explain_putc_on_error(int c, FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = putc(c, fp);
+    explain_explanation_call_end();
     if (result == EOF)
         explain_putc_on_error_failed(c, fp);
     return result;
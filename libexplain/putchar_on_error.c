@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/putchar.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,10 @@ explain_putchar_on_error_failed(int c)
     int             hold_errno;
 
     hold_errno = errno;
-    explain_output_error("%s", explain_errno_putchar(hold_errno, c));
+    if (!explain_output_suppress("putchar", hold_errno, -1))
+    {
+        explain_output_error("%s", explain_errno_putchar(hold_errno, c));
+    }
     errno = hold_errno;
 }
 
@@ -41,7 +45,9 @@ explain_putchar_on_error(int c)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = putchar(c);
+    explain_explanation_call_end();
     if (result == EOF)
         explain_putchar_on_error_failed(c);
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/putenv.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_putenv_on_error(char *string)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = putenv(string);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_putenv(hold_errno,
-            string));
+        if (!explain_output_suppress("putenv", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_putenv(hold_errno,
+                string));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/putenv.h>
 
 
 void
 explain_putenv_or_die(char *string)
 {
+    explain_output_or_die_begin();
     if (explain_putenv_on_error(string) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/puts.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_puts_on_error(const char *s)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = puts(s);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_puts(hold_errno, s));
+        if (!explain_output_suppress("puts", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_puts(hold_errno, s));
+        }
         errno = hold_errno;
     }
     return result;
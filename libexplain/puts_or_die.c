@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/puts.h>
 
 
 void
 explain_puts_or_die(const char *s)
 {
+    explain_output_or_die_begin();
     if (explain_puts_on_error(s) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
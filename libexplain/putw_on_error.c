@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/putw.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_putw_on_error(int value, FILE *fp)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = putw(value, fp);
+    explain_explanation_call_end();
     if (result == EOF)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_putw(hold_errno, value,
-            fp));
+        if (!explain_output_suppress("putw", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_putw(hold_errno, value,
+                fp));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,16 +19,19 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/putw.h>
 
 
 void
 explain_putw_or_die(int value, FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_putw_on_error(value, fp) == EOF)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
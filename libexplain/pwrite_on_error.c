@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/pwrite.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_pwrite_on_error(int fildes, const void *data, size_t data_size, off_t
 {
     ssize_t         result;
 
+    explain_explanation_call_begin();
     result = pwrite(fildes, data, data_size, offset);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_pwrite(hold_errno, fildes,
-            data, data_size, offset));
+        if (!explain_output_suppress("pwrite", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_pwrite(hold_errno, fildes,
+                data, data_size, offset));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/pwrite.h>
 
 
@@ -28,7 +29,9 @@ explain_pwrite_or_die(int fildes, const void *data, size_t data_size, off_t
 {
     ssize_t         result;
 
+    explain_output_or_die_begin();
     result = explain_pwrite_on_error(fildes, data, data_size, offset);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
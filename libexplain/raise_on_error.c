@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/signal.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/raise.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_raise_on_error(int sig)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = raise(sig);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_raise(hold_errno, sig));
+        if (!explain_output_suppress("raise", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_raise(hold_errno, sig));
+        }
         errno = hold_errno;
     }
     return result;
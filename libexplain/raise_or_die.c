@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/raise.h>
 
 
 void
 explain_raise_or_die(int sig)
 {
+    explain_output_or_die_begin();
     if (explain_raise_on_error(sig) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/dirent.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/readdir.h>
 #include <libexplain/output.h>
 
@@ -31,11 +32,16 @@ explain_readdir_on_error(DIR *dir)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = readdir(dir);
+    explain_explanation_call_end();
     if (!result && errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_readdir(hold_errno, dir));
+        if (!explain_output_suppress("readdir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_readdir(hold_errno, dir));
+        }
     }
     errno = hold_errno;
     return result;
@@ -21,6 +21,7 @@
 
 #include <libexplain/readdir.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 struct dirent *
@@ -29,7 +30,9 @@ explain_readdir_or_die(DIR *dir)
     struct dirent   *result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_readdir_on_error(dir);
+    explain_output_or_die_end();
     if (!result && errno)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/readlink.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_readlink_on_error(const char *pathname, char *data, size_t data_size)
 {
     ssize_t         result;
 
+    explain_explanation_call_begin();
     result = readlink(pathname, data, data_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_readlink(hold_errno,
-            pathname, data, data_size));
+        if (!explain_output_suppress("readlink", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_readlink(hold_errno,
+                pathname, data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
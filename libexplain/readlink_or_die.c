@@ -19,6 +19,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/readlink.h>
 
 
@@ -27,7 +28,9 @@ explain_readlink_or_die(const char *pathname, char *data, size_t data_size)
 {
     ssize_t         result;
 
+    explain_output_or_die_begin();
     result = explain_readlink_on_error(pathname, data, data_size);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/uio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/readv.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_readv_on_error(int fildes, const struct iovec *data, int data_size)
     ssize_t         result;
 
 #ifdef HAVE_READV
+    explain_explanation_call_begin();
     result = readv(fildes, data, data_size);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_readv_on_error(int fildes, const struct iovec *data, int data_size)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_readv(hold_errno, fildes,
-            data, data_size));
+        if (!explain_output_suppress("readv", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_readv(hold_errno, fildes,
+                data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
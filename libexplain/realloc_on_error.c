@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/realloc.h>
 #include <libexplain/output.h>
 
@@ -38,14 +39,19 @@ explain_realloc_on_error(void *ptr, size_t size)
     hold_errno = errno;
     errno = 0;
     ok_size = size ? size : 1;
+    explain_explanation_call_begin();
     result = ptr ? realloc(ptr, ok_size) : malloc(ok_size);
+    explain_explanation_call_end();
     if (!result)
     {
         hold_errno = errno;
         if (hold_errno == 0)
             hold_errno = ENOMEM;
-        explain_output_error("%s", explain_errno_realloc(hold_errno, ptr,
-            size));
+        if (!explain_output_suppress("realloc", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_realloc(hold_errno, ptr,
+                size));
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/stdlib.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/realloc.h>
 
 
@@ -27,7 +28,9 @@ explain_realloc_or_die(void *ptr, size_t size)
 {
     void            *result;
 
+    explain_output_or_die_begin();
     result = explain_realloc_on_error(ptr, size);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/realpath.h>
 
 
@@ -28,7 +30,9 @@ explain_realpath_or_die(const char *pathname, char *resolved_pathname)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_realpath_on_error(pathname, resolved_pathname);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -42,14 +46,19 @@ explain_realpath_on_error(const char *pathname, char *resolved_pathname)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = realpath(pathname, resolved_pathname);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_realpath(hold_errno, pathname,
-            resolved_pathname));
+        if (!explain_output_suppress("realpath", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_realpath(hold_errno,
+                pathname, resolved_pathname));
+        }
         errno = hold_errno;
     }
     return result;
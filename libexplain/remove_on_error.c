@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/remove.h>
 #include <libexplain/output.h>
 
@@ -44,13 +45,19 @@ explain_remove_on_error(const char *pathname)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = remove(pathname);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_remove(hold_errno, pathname));
+        if (!explain_output_suppress("remove", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_remove(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,15 +19,18 @@
 
 #include <libexplain/rename.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 
 
 void
 explain_rename_or_die(const char *oldpath, const char *newpath)
 {
+    explain_output_or_die_begin();
     if (explain_rename_on_error(oldpath, newpath) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/rmdir.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_rmdir_on_error(const char *pathname)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = rmdir(pathname);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_rmdir(hold_errno,
-            pathname));
+        if (!explain_output_suppress("rmdir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_rmdir(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
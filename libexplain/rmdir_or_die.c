@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/rmdir.h>
 
 
 void
 explain_rmdir_or_die(const char *pathname)
 {
+    explain_output_or_die_begin();
     if (explain_rmdir_on_error(pathname) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -0,0 +1,291 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/poll.h>
+#include <libexplain/ac/signal.h>
+#include <libexplain/ac/spawn.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/time.h>
+#include <libexplain/ac/sys/wait.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/option.h>
+#include <libexplain/run_command.h>
+
+
+/**
+  * The make_pipe function is used to create a pipe, both ends of which
+  * are close-on-exec, so that neither the helper command nor any other
+  * child of the application inherits them by accident.
+  */
+static int
+make_pipe(int fildes[2])
+{
+#ifdef HAVE_PIPE2
+    if (pipe2(fildes, O_CLOEXEC) >= 0)
+        return 0;
+    if (errno != ENOSYS && errno != EINVAL)
+        return -1;
+#endif
+    if (pipe(fildes) < 0)
+        return -1;
+    fcntl(fildes[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fildes[1], F_SETFD, FD_CLOEXEC);
+    return 0;
+}
+
+
+/**
+  * The start function is used to start the command running, with its
+  * standard output going to the given file descriptor.
+  *
+  * @returns
+  *     the process ID of the child, or -1 on error.
+  */
+static pid_t
+start(const char *const *argv, int out, int quiet)
+{
+#if defined(HAVE_SPAWN_H) && defined(HAVE_POSIX_SPAWNP)
+    posix_spawn_file_actions_t actions;
+    pid_t           pid;
+    int             err;
+
+    if (posix_spawn_file_actions_init(&actions) != 0)
+        return -1;
+    /*
+     * dup2 clears the close-on-exec flag of the new descriptor, the
+     * pipe itself is closed by exec.
+     */
+    err = posix_spawn_file_actions_addopen
+    (
+        &actions,
+        0,
+        "/dev/null",
+        O_RDONLY,
+        0
+    );
+    if (!err)
+        err = posix_spawn_file_actions_adddup2(&actions, out, 1);
+    if (!err && quiet)
+    {
+        err =
+            posix_spawn_file_actions_addopen
+            (
+                &actions,
+                2,
+                "/dev/null",
+                O_WRONLY,
+                0
+            );
+    }
+    if (!err)
+    {
+        err =
+            posix_spawnp
+            (
+                &pid,
+                argv[0],
+                &actions,
+                NULL,
+                (char *const *)argv,
+                environ
+            );
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    if (err)
+    {
+        errno = err;
+        return -1;
+    }
+    return pid;
+#else
+    pid_t           pid;
+
+    pid = fork();
+    if (pid != 0)
+        return pid;
+
+    /*
+     * Child process.  Only async-signal-safe functions from here on.
+     */
+    {
+        int             fd;
+
+        fd = open("/dev/null", O_RDWR);
+        if (fd >= 0)
+        {
+            dup2(fd, 0);
+            if (quiet)
+                dup2(fd, 2);
+            if (fd > 2)
+                close(fd);
+        }
+    }
+    dup2(out, 1);
+    execvp(argv[0], (char *const *)argv);
+    _exit(127);
+    return -1;
+#endif
+}
+
+
+static long
+now_msec(void)
+{
+    struct timeval  tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000L + tv.tv_usec / 1000;
+}
+
+
+char *
+explain_run_command(const char *const *argv, size_t max_size,
+    int timeout_msec, size_t *size)
+{
+    int             fildes[2];
+    pid_t           pid;
+    char            *buffer;
+    size_t          length;
+    size_t          maximum;
+    long            deadline;
+    int             finished;
+    int             status;
+
+    *size = 0;
+    if (make_pipe(fildes) < 0)
+        return NULL;
+    pid = start(argv, fildes[1], explain_option_debug() < 2);
+    close(fildes[1]);
+    if (pid < 0)
+    {
+        close(fildes[0]);
+        return NULL;
+    }
+
+    buffer = NULL;
+    length = 0;
+    maximum = 0;
+    finished = 0;
+    deadline = now_msec() + timeout_msec;
+    for (;;)
+    {
+        struct pollfd   pfd;
+        long            remaining;
+        ssize_t         n;
+        int             ready;
+
+        remaining = deadline - now_msec();
+        if (remaining <= 0)
+            break;
+        pfd.fd = fildes[0];
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        ready = poll(&pfd, 1, (int)remaining);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (ready == 0)
+            break;
+
+        if (length + 1 >= maximum)
+        {
+            size_t          new_maximum;
+            char            *new_buffer;
+
+            new_maximum = maximum ? maximum * 2 : 4096;
+            if (new_maximum > max_size + 1)
+                new_maximum = max_size + 1;
+            if (new_maximum <= length + 1)
+                break;
+            new_buffer = realloc(buffer, new_maximum);
+            if (!new_buffer)
+                break;
+            buffer = new_buffer;
+            maximum = new_maximum;
+        }
+        n = read(fildes[0], buffer + length, maximum - 1 - length);
+        if (n < 0)
+        {
+            if (errno == EINTR || errno == EAGAIN)
+                continue;
+            break;
+        }
+        if (n == 0)
+        {
+            finished = 1;
+            break;
+        }
+        length += n;
+    }
+    close(fildes[0]);
+
+    /*
+     * If the command is still running (too slow, or too verbose) it
+     * gets killed, rather than leave it running unsupervised.
+     */
+    if (!finished)
+        kill(pid, SIGKILL);
+    for (;;)
+    {
+        if (waitpid(pid, &status, 0) >= 0)
+            break;
+        if (errno != EINTR)
+        {
+            free(buffer);
+            return NULL;
+        }
+    }
+
+    /*
+     * Only the output of a command which ran to completion, and said
+     * it succeeded, is believed.  This includes the exit status 127
+     * used when the command could not be executed at all.
+     */
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+        free(buffer);
+        if (!finished)
+            errno = ETIMEDOUT;
+        else if (WIFEXITED(status) && WEXITSTATUS(status) == 127)
+            errno = ENOENT;
+        else
+            errno = ECHILD;
+        return NULL;
+    }
+
+    if (!buffer)
+    {
+        buffer = malloc(1);
+        if (!buffer)
+            return NULL;
+    }
+    buffer[length] = '\0';
+    *size = length;
+    return buffer;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
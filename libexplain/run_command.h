@@ -0,0 +1,68 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_RUN_COMMAND_H
+#define LIBEXPLAIN_RUN_COMMAND_H
+
+#include <libexplain/ac/stddef.h>
+
+/**
+  * The EXPLAIN_RUN_COMMAND_TIMEOUT macro is the number of milliseconds
+  * a helper command is given to finish, before it is killed.
+  */
+#define EXPLAIN_RUN_COMMAND_TIMEOUT 10000
+
+/**
+  * The explain_run_command function may be used to run a helper
+  * command, such as lsof(1) or file(1), and collect its standard
+  * output.
+  *
+  * No shell is involved: the argument vector is passed directly to the
+  * command, so there is no need to quote the arguments, and nothing
+  * that they contain will be interpreted.  The command is found using
+  * the PATH environment variable.  Standard input is redirected from
+  * /dev/null, as is standard error unless the debug option is 2 or
+  * more.  None of the file descriptors of the calling process are
+  * inherited by the command.
+  *
+  * The command is killed if it runs for longer than the time limit, or
+  * writes more than the maximum output size.  Output is only returned
+  * if the command exits with status zero; a command which could not be
+  * executed, failed, or was killed, returns NULL.
+  *
+  * @param argv
+  *     The command name and its arguments, terminated by a NULL
+  *     pointer.
+  * @param max_size
+  *     The maximum number of bytes of output to collect.
+  * @param timeout_msec
+  *     The maximum number of milliseconds to wait for the command.
+  * @param size
+  *     Where to put the number of bytes of output collected.
+  * @returns
+  *     pointer to the output, which is always NUL terminated, and must
+  *     be released using free() when no longer required; or NULL (with
+  *     errno set) if the command could not be run, did not exit with
+  *     status zero, or was killed.
+  */
+char *explain_run_command(const char *const *argv, size_t max_size,
+    int timeout_msec, size_t *size);
+
+#endif /* LIBEXPLAIN_RUN_COMMAND_H */
+/* vim: set ts=8 sw=4 et : */
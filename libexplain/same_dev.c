@@ -22,6 +22,7 @@
 #include <libexplain/ac/sys/stat.h>
 
 #include <libexplain/dirname.h>
+#include <libexplain/memo.h>
 #include <libexplain/same_dev.h>
 
 
@@ -32,10 +33,10 @@ explain_same_dev(const char *oldpath, const char *newpath)
     struct stat     newdir_st;
     char            newdir[PATH_MAX + 1];
 
-    if (stat(oldpath, &oldpath_st) < 0)
+    if (explain_memo_stat(oldpath, &oldpath_st) < 0)
         return 0;
     explain_dirname(newdir, newpath, sizeof(newdir));
-    if (stat(newdir, &newdir_st) < 0)
+    if (explain_memo_stat(newdir, &newdir_st) < 0)
         return 0;
     return (oldpath_st.st_dev == newdir_st.st_dev);
 }
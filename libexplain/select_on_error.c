@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/select.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/select.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_select_on_error(int nfds, fd_set *readfds, fd_set *writefds,
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = select(nfds, readfds, writefds, exceptfds, timeout);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_select(hold_errno, nfds,
-            readfds, writefds, exceptfds, timeout));
+        if (!explain_output_suppress("select", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_select(hold_errno, nfds,
+                readfds, writefds, exceptfds, timeout));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/sys/select.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/select.h>
 
 
@@ -28,8 +29,10 @@ explain_select_or_die(int nfds, fd_set *readfds, fd_set *writefds,
 {
     int             result;
 
+    explain_output_or_die_begin();
     result =
         explain_select_on_error(nfds, readfds, writefds, exceptfds, timeout);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
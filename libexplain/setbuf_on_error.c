@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setbuf.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_setbuf_on_error(FILE *fp, char *data)
     int             hold_errno;
 
     hold_errno = errno;
+    explain_explanation_call_begin();
     setbuf(fp, data);
+    explain_explanation_call_end();
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_setbuf(hold_errno, fp, data)
-        );
+        if (!explain_output_suppress("setbuf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_setbuf(hold_errno, fp, data)
+            );
+        }
     }
     errno = hold_errno;
 }
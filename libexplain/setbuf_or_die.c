@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setbuf.h>
 
 
@@ -27,7 +28,9 @@ void
 explain_setbuf_or_die(FILE *fp, char *data)
 {
     errno = 0;
+    explain_output_or_die_begin();
     explain_setbuf_on_error(fp, data);
+    explain_output_or_die_end();
     if (errno != 0)
     {
         explain_output_exit_failure();
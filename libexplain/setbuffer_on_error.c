@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setbuffer.h>
 #include <libexplain/output.h>
 
@@ -30,14 +31,19 @@ explain_setbuffer_on_error(FILE *fp, char *data, size_t size)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     setbuffer(fp, data, size);
+    explain_explanation_call_end();
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_setbuffer(hold_errno, fp, data, size)
-        );
+        if (!explain_output_suppress("setbuffer", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_setbuffer(hold_errno, fp, data, size)
+            );
+        }
     }
     errno = hold_errno;
 }
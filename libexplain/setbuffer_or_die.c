@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setbuffer.h>
 
 
@@ -27,7 +28,9 @@ void
 explain_setbuffer_or_die(FILE *fp, char *data, size_t size)
 {
     errno = 0;
+    explain_output_or_die_begin();
     explain_setbuffer_on_error(fp, data, size);
+    explain_output_or_die_end();
     if (errno != 0)
     {
         explain_output_exit_failure();
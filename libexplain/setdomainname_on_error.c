@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setdomainname.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_setdomainname_on_error(const char *data, size_t data_size)
     int             result;
 
 #ifdef HAVE_SETDOMAINNAME
+    explain_explanation_call_begin();
     result = setdomainname(data, data_size);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_setdomainname_on_error(const char *data, size_t data_size)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setdomainname(hold_errno,
-            data, data_size));
+        if (!explain_output_suppress("setdomainname", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setdomainname(hold_errno,
+                data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
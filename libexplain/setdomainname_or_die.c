@@ -19,16 +19,19 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setdomainname.h>
 
 
 void
 explain_setdomainname_or_die(const char *data, size_t data_size)
 {
+    explain_output_or_die_begin();
     if (explain_setdomainname_on_error(data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
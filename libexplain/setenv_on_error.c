@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdlib.h>
 #include <libexplain/ac/string.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/is_efault.h>
 #include <libexplain/output.h>
 #include <libexplain/setenv.h>
@@ -180,14 +181,19 @@ explain_setenv_on_error(const char *name, const char *value, int overwrite)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = setenv(name, value, overwrite);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setenv(hold_errno, name,
-            value, overwrite));
+        if (!explain_output_suppress("setenv", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setenv(hold_errno, name,
+                value, overwrite));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setenv.h>
 
 
 void
 explain_setenv_or_die(const char *name, const char *value, int overwrite)
 {
+    explain_output_or_die_begin();
     if (explain_setenv_on_error(name, value, overwrite) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
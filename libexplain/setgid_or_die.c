@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setgid.h>
 
 
 void
 explain_setgid_or_die(gid_t gid)
 {
+    explain_output_or_die_begin();
     if (explain_setgid_on_error(gid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,17 +42,22 @@ explain_setgid_on_error(gid_t gid)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = setgid(gid);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setgid(hold_errno, gid)
-        );
+        if (!explain_output_suppress("setgid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setgid(hold_errno, gid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
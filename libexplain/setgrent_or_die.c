@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/grp.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setgrent.h>
 
 
@@ -30,7 +32,9 @@ explain_setgrent_or_die(void)
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     explain_setgrent_on_error();
+    explain_output_or_die_end();
     if (errno)
     {
         hold_errno = errno;
@@ -48,14 +52,19 @@ explain_setgrent_on_error(void)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_SETGRENT
+    explain_explanation_call_begin();
     setgrent();
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
 #endif
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setgrent(hold_errno));
+        if (!explain_output_suppress("setgrent", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setgrent(hold_errno));
+        }
     }
     errno = hold_errno;
 }
@@ -20,6 +20,7 @@
 #include <libexplain/ac/grp.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setgroups.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_setgroups_on_error(size_t data_size, const gid_t *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = setgroups(data_size, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setgroups(hold_errno,
-            data_size, data));
+        if (!explain_output_suppress("setgroups", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setgroups(hold_errno,
+                data_size, data));
+        }
         errno = hold_errno;
     }
     return result;
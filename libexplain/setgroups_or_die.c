@@ -19,16 +19,19 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setgroups.h>
 
 
 void
 explain_setgroups_or_die(size_t data_size, const gid_t *data)
 {
+    explain_output_or_die_begin();
     if (explain_setgroups_on_error(data_size, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/sethostname.h>
 #include <libexplain/output.h>
 
@@ -29,14 +30,19 @@ explain_sethostname_on_error(const char *name, size_t name_size)
     int             result;
 
     /* We have to cast away const-ness because Solaris is stupid. */
+    explain_explanation_call_begin();
     result = sethostname((char *)name, name_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_sethostname(hold_errno,
-            name, name_size));
+        if (!explain_output_suppress("sethostname", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_sethostname(hold_errno,
+                name, name_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,14 +19,17 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/sethostname.h>
 
 
 void
 explain_sethostname_or_die(const char *name, size_t name_size)
 {
+    explain_output_or_die_begin();
     if (explain_sethostname_on_error(name, name_size) < 0)
         explain_output_exit_failure();
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
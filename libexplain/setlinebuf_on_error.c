@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setlinebuf.h>
 #include <libexplain/output.h>
 
@@ -30,14 +31,19 @@ explain_setlinebuf_on_error(FILE *fp)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     setlinebuf(fp);
+    explain_explanation_call_end();
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_setlinebuf(hold_errno, fp)
-        );
+        if (!explain_output_suppress("setlinebuf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_setlinebuf(hold_errno, fp)
+            );
+        }
     }
     errno = hold_errno;
 }
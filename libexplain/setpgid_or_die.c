@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setpgid.h>
 
 
 void
 explain_setpgid_or_die(pid_t pid, pid_t pgid)
 {
+    explain_output_or_die_begin();
     if (explain_setpgid_on_error(pid, pgid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,17 +42,22 @@ explain_setpgid_on_error(pid_t pid, pid_t pgid)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = setpgid(pid, pgid);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setpgid(hold_errno, pid, pgid)
-        );
+        if (!explain_output_suppress("setpgid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setpgid(hold_errno, pid, pgid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setpgrp.h>
 
 
 void
 explain_setpgrp_or_die(pid_t pid, pid_t pgid)
 {
+    explain_output_or_die_begin();
     if (explain_setpgrp_on_error(pid, pgid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,6 +46,7 @@ explain_setpgrp_on_error(pid_t pid, pid_t pgid)
      * FIXME: is nargs==0, shouldn't we EINVAL if either of the
      * arguments are different that the result will be?
      */
+    explain_explanation_call_begin();
     result =
         setpgrp
         (
@@ -50,16 +55,20 @@ explain_setpgrp_on_error(pid_t pid, pid_t pgid)
             pgid
 #endif
         );
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setpgrp(hold_errno, pid, pgid)
-        );
+        if (!explain_output_suppress("setpgrp", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setpgrp(hold_errno, pid, pgid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
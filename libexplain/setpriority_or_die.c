@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/resource.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setpriority.h>
 
 
 void
 explain_setpriority_or_die(int which, int who, int prio)
 {
+    explain_output_or_die_begin();
     if (explain_setpriority_on_error(which, who, prio) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_setpriority_on_error(int which, int who, int prio)
     int             result;
 
 #ifdef HAVE_SETPRIORITY
+    explain_explanation_call_begin();
     result = setpriority(which, who, prio);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_setpriority_on_error(int which, int who, int prio)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setpriority(hold_errno, which, who, prio)
-        );
+        if (!explain_output_suppress("setpriority", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setpriority(hold_errno, which, who, prio)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setregid.h>
 
 
 void
 explain_setregid_or_die(gid_t rgid, gid_t egid)
 {
+    explain_output_or_die_begin();
     if (explain_setregid_on_error(rgid, egid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_setregid_on_error(gid_t rgid, gid_t egid)
     int             result;
 
 #ifdef HAVE_SETREGID
+    explain_explanation_call_begin();
     result = setregid(rgid, egid);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_setregid_on_error(gid_t rgid, gid_t egid)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setregid(hold_errno, rgid, egid)
-        );
+        if (!explain_output_suppress("setregid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setregid(hold_errno, rgid, egid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setresgid.h>
 
 
 void
 explain_setresgid_or_die(gid_t rgid, gid_t egid, gid_t sgid)
 {
+    explain_output_or_die_begin();
     if (explain_setresgid_on_error(rgid, egid, sgid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_setresgid_on_error(gid_t rgid, gid_t egid, gid_t sgid)
     int             result;
 
 #ifdef HAVE_SETRESGID
+    explain_explanation_call_begin();
     result = setresgid(rgid, egid, sgid);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_setresgid_on_error(gid_t rgid, gid_t egid, gid_t sgid)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setresgid(hold_errno, rgid, egid, sgid)
-        );
+        if (!explain_output_suppress("setresgid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setresgid(hold_errno, rgid, egid, sgid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
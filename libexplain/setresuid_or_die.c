@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setresuid.h>
 
 
 void
 explain_setresuid_or_die(uid_t ruid, uid_t euid, uid_t suid)
 {
+    explain_output_or_die_begin();
     if (explain_setresuid_on_error(ruid, euid, suid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_setresuid_on_error(uid_t ruid, uid_t euid, uid_t suid)
     int             result;
 
 #ifdef HAVE_SETRESUID
+    explain_explanation_call_begin();
     result = setresuid(ruid, euid, suid);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_setresuid_on_error(uid_t ruid, uid_t euid, uid_t suid)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setresuid(hold_errno, ruid, euid, suid)
-        );
+        if (!explain_output_suppress("setresuid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setresuid(hold_errno, ruid, euid, suid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
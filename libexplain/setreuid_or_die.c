@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setreuid.h>
 
 
 void
 explain_setreuid_or_die(uid_t ruid, uid_t euid)
 {
+    explain_output_or_die_begin();
     if (explain_setreuid_on_error(ruid, euid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_setreuid_on_error(uid_t ruid, uid_t euid)
     int             result;
 
 #ifdef HAVE_SETREUID
+    explain_explanation_call_begin();
     result = setreuid(ruid, euid);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_setreuid_on_error(uid_t ruid, uid_t euid)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_setreuid(hold_errno, ruid, euid)
-        );
+        if (!explain_output_suppress("setreuid", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_setreuid(hold_errno, ruid, euid)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setsid.h>
 
 
@@ -40,7 +42,9 @@ explain_setsid_or_die(void)
 {
     pid_t           result;
 
+    explain_output_or_die_begin();
     result = explain_setsid_on_error();
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -54,13 +58,18 @@ explain_setsid_on_error(void)
 {
     pid_t           result;
 
+    explain_explanation_call_begin();
     result = setsid();
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setsid(hold_errno));
+        if (!explain_output_suppress("setsid", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setsid(hold_errno));
+        }
         errno = hold_errno;
     }
     return result;
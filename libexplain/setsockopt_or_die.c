@@ -19,6 +19,7 @@
 #include <libexplain/ac/sys/socket.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setsockopt.h>
 
 
@@ -26,10 +27,12 @@ void
 explain_setsockopt_or_die(int fildes, int level, int name, void *data,
     socklen_t data_size)
 {
+    explain_output_or_die_begin();
     if (explain_setsockopt_on_error(fildes, level, name, data, data_size) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/settimeofday.h>
 
 
 void
 explain_settimeofday_or_die(const struct timeval *tv, const struct timezone *tz)
 {
+    explain_output_or_die_begin();
     if (explain_settimeofday_on_error(tv, tz) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -40,7 +44,9 @@ explain_settimeofday_on_error(const struct timeval *tv, const struct timezone
     int             result;
 
 #ifdef HAVE_SETTIMEOFDAY
+    explain_explanation_call_begin();
     result = settimeofday(tv, tz);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -50,11 +56,14 @@ explain_settimeofday_on_error(const struct timeval *tv, const struct timezone
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_settimeofday(hold_errno, tv, tz)
-        );
+        if (!explain_output_suppress("settimeofday", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_settimeofday(hold_errno, tv, tz)
+            );
+        }
         errno = hold_errno;
     }
     return result;
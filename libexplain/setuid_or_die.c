@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setuid.h>
 
 
 void
 explain_setuid_or_die(int uid)
 {
+    explain_output_or_die_begin();
     if (explain_setuid_on_error(uid) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,13 +42,18 @@ explain_setuid_on_error(int uid)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = setuid(uid);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_setuid(hold_errno, uid));
+        if (!explain_output_suppress("setuid", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_setuid(hold_errno, uid));
+        }
         errno = hold_errno;
     }
     return result;
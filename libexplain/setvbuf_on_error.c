@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/setvbuf.h>
 #include <libexplain/output.h>
 
@@ -31,14 +32,19 @@ explain_setvbuf_on_error(FILE *fp, char *data, int mode, size_t size)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = setvbuf(fp, data, mode, size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_setvbuf(hold_errno, fp, data, mode, size)
-        );
+        if (!explain_output_suppress("setvbuf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_setvbuf(hold_errno, fp, data, mode, size)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,16 +19,19 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/setvbuf.h>
 
 
 void
 explain_setvbuf_or_die(FILE *fp, char *data, int mode, size_t size)
 {
+    explain_output_or_die_begin();
     if (explain_setvbuf_on_error(fp, data, mode, size) != 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/shm.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/shmat.h>
 
 
@@ -43,7 +45,9 @@ explain_shmat_or_die(int shmid, const void *shmaddr, int shmflg)
 {
     void            *result;
 
+    explain_output_or_die_begin();
     result = explain_shmat_on_error(shmid, shmaddr, shmflg);
+    explain_output_or_die_end();
     if (!result || result == (void *)(-1))
     {
         explain_output_exit_failure();
@@ -57,17 +61,22 @@ explain_shmat_on_error(int shmid, const void *shmaddr, int shmflg)
 {
     void            *result;
 
+    explain_explanation_call_begin();
     result = shmat(shmid, shmaddr, shmflg);
+    explain_explanation_call_end();
     if (!result || result == (void *)(-1))
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_shmat(hold_errno, shmid, shmaddr, shmflg)
-        );
+        if (!explain_output_suppress("shmat", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_shmat(hold_errno, shmid, shmaddr, shmflg)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/shm.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/shmctl.h>
 
 
@@ -42,7 +44,9 @@ explain_shmctl_or_die(int shmid, int command, struct shmid_ds *data)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_shmctl_on_error(shmid, command, data);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -56,17 +60,22 @@ explain_shmctl_on_error(int shmid, int command, struct shmid_ds *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = shmctl(shmid, command, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_shmctl(hold_errno, shmid, command, data)
-        );
+        if (!explain_output_suppress("shmctl", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_shmctl(hold_errno, shmid, command, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
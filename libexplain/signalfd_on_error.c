@@ -20,6 +20,7 @@
 #include <libexplain/ac/signal.h>
 #include <libexplain/ac/sys/signalfd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/signalfd.h>
 #include <libexplain/output.h>
 
@@ -30,7 +31,9 @@ explain_signalfd_on_error(int fildes, const sigset_t *mask, int flags)
     int             result;
 
 #ifdef HAVE_SIGNALFD
+    explain_explanation_call_begin();
     result = signalfd(fildes, mask, flags);
+    explain_explanation_call_end();
 #else
     result = -1;
     errno = ENOSYS;
@@ -40,8 +43,11 @@ explain_signalfd_on_error(int fildes, const sigset_t *mask, int flags)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_signalfd(hold_errno,
-            fildes, mask, flags));
+        if (!explain_output_suppress("signalfd", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_signalfd(hold_errno,
+                fildes, mask, flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/signal.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/signalfd.h>
 
 
@@ -27,7 +28,9 @@ explain_signalfd_or_die(int fildes, const sigset_t *mask, int flags)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_signalfd_on_error(fildes, mask, flags);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
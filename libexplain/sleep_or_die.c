@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/sleep.h>
 
 
@@ -31,7 +33,9 @@ explain_sleep_or_die(unsigned int seconds)
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_sleep_on_error(seconds);
+    explain_output_or_die_end();
     if (errno != 0)
     {
         explain_output_exit_failure();
@@ -50,7 +54,9 @@ explain_sleep_on_error(unsigned int seconds)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_SLEEP
+    explain_explanation_call_begin();
     result = sleep(seconds);
+    explain_explanation_call_end();
 #else
 # if HAVE_NANOSLEEP
     {
@@ -69,7 +75,11 @@ explain_sleep_on_error(unsigned int seconds)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_sleep(hold_errno, seconds));
+        if (!explain_output_suppress("sleep", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_sleep(hold_errno,
+                seconds));
+        }
         errno = hold_errno;
     }
     errno = hold_errno;
@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/common_message_buffer.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 #include <libexplain/snprintf.h>
 #include <libexplain/buffer/errno/snprintf.h>
@@ -82,28 +83,33 @@ explain_snprintf_on_error(char *data, size_t data_size, const char *format, ...)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vsnprintf(data, data_size, format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         explain_string_buffer_t sb;
 
         hold_errno = errno;
-        explain_string_buffer_init
-        (
-            &sb,
-            explain_common_message_buffer,
-            explain_common_message_buffer_size
-        );
-        explain_buffer_errno_snprintf
-        (
-            &sb,
-            hold_errno,
-            data,
-            data_size,
-            format,
-            ap2
-        );
-        explain_output_error("%s", explain_common_message_buffer);
+        if (!explain_output_suppress("snprintf", hold_errno, -1))
+        {
+            explain_string_buffer_init
+            (
+                &sb,
+                explain_common_message_buffer,
+                explain_common_message_buffer_size
+            );
+            explain_buffer_errno_snprintf
+            (
+                &sb,
+                hold_errno,
+                data,
+                data_size,
+                format,
+                ap2
+            );
+            explain_output_error("%s", explain_common_message_buffer);
+        }
     }
     va_end(ap2); /* yes, both of them */
     va_end(ap);
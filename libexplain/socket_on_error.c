@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/socket.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/socket.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_socket_on_error(int domain, int type, int protocol)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = socket(domain, type, protocol);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_socket(hold_errno, domain,
-            type, protocol));
+        if (!explain_output_suppress("socket", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_socket(hold_errno, domain,
+                type, protocol));
+        }
         errno = hold_errno;
     }
     return result;
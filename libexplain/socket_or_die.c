@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/socket.h>
 
 
@@ -25,7 +26,9 @@ explain_socket_or_die(int domain, int type, int protocol)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_socket_on_error(domain, type, protocol);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
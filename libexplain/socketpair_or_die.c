@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/socket.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/socketpair.h>
 
 
 void
 explain_socketpair_or_die(int domain, int type, int protocol, int *sv)
 {
+    explain_output_or_die_begin();
     if (explain_socketpair_on_error(domain, type, protocol, sv) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -38,17 +42,23 @@ explain_socketpair_on_error(int domain, int type, int protocol, int *sv)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = socketpair(domain, type, protocol, sv);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_socketpair(hold_errno, domain, type, protocol, sv)
-        );
+        if (!explain_output_suppress("socketpair", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_socketpair(hold_errno, domain, type, protocol,
+                    sv)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/common_message_buffer.h>
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
 #include <libexplain/sprintf.h>
 #include <libexplain/buffer/errno/sprintf.h>
@@ -77,20 +78,25 @@ explain_sprintf_on_error(char *data, const char *format, ...)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vsprintf(data, format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         explain_string_buffer_t sb;
 
         hold_errno = errno;
-        explain_string_buffer_init
-        (
-            &sb,
-            explain_common_message_buffer,
-            explain_common_message_buffer_size
-        );
-        explain_buffer_errno_sprintf(&sb, hold_errno, data, format, ap2);
-        explain_output_error("%s", explain_common_message_buffer);
+        if (!explain_output_suppress("sprintf", hold_errno, -1))
+        {
+            explain_string_buffer_init
+            (
+                &sb,
+                explain_common_message_buffer,
+                explain_common_message_buffer_size
+            );
+            explain_buffer_errno_sprintf(&sb, hold_errno, data, format, ap2);
+            explain_output_error("%s", explain_common_message_buffer);
+        }
     }
     va_end(ap2); /* yes, both of them */
     va_end(ap);
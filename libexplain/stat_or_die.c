@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/stat.h>
 
 
 void
 explain_stat_or_die(const char *pathname, struct stat *data)
 {
+    explain_output_or_die_begin();
     if (explain_stat_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
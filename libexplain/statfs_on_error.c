@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/mount.h>
 #include <libexplain/ac/sys/statfs.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/statfs.h>
 #include <libexplain/output.h>
 
@@ -30,11 +31,13 @@ explain_statfs_on_error(const char *pathname, struct statfs *data)
     int             result;
 
 #ifdef HAVE_STATFS
+    explain_explanation_call_begin();
 #if STATFS_NARGS == 4
     result = statfs(pathname, data, 0, 0);
 #else
     result = statfs(pathname, data);
 #endif
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -44,8 +47,11 @@ explain_statfs_on_error(const char *pathname, struct statfs *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_statfs(hold_errno,
-            pathname, data));
+        if (!explain_output_suppress("statfs", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_statfs(hold_errno,
+                pathname, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/statfs.h>
 
 
 void
 explain_statfs_or_die(const char *pathname, struct statfs *data)
 {
+    explain_output_or_die_begin();
     if (explain_statfs_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 /* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,196 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/time.h>
+
+#include <libexplain/option.h>
+#include <libexplain/statistics.h>
+#include <libexplain/statistics/probe.h>
+
+/*
+ * The counters are shared by all threads.  Without atomic builtins
+ * they are updated without locking, and so may miss a probe now and
+ * then, which is acceptable for statistics.
+ */
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) \
+    || defined(__clang__)
+#define STATISTICS_ADD(p, n) __sync_fetch_and_add((p), (n))
+#define STATISTICS_CAS(p, a, b) __sync_bool_compare_and_swap((p), (a), (b))
+#else
+#define STATISTICS_ADD(p, n) (*(p) += (n))
+#define STATISTICS_CAS(p, a, b) (*(p) == (a) ? (*(p) = (b), 1) : 0)
+#endif
+
+static const char *const probe_name[explain_probe_max] =
+{
+    "lsof",
+    "proc",
+    "dev",
+    "mount",
+    "dns",
+    "dir",
+    "mincore",
+};
+
+static unsigned long probe_count[explain_probe_max];
+static unsigned long long probe_nsec[explain_probe_max];
+
+/* the "statistics" option, or -1 if not yet read */
+static int      option_state = -1;
+
+/* the explain_statistics_enable setting, or -1 if never called */
+static int      client_state = -1;
+
+
+static unsigned long long
+now_nsec(void)
+{
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+    {
+        return
+            (unsigned long long)ts.tv_sec * 1000000000uL
+        +
+            (unsigned long long)ts.tv_nsec;
+    }
+#endif
+    {
+        struct timeval  tv;
+
+        gettimeofday(&tv, 0);
+        return
+            (unsigned long long)tv.tv_sec * 1000000000uL
+        +
+            (unsigned long long)tv.tv_usec * 1000uL;
+    }
+}
+
+
+static void
+print_statistics(void)
+{
+    int             j;
+
+    for (j = 0; j < explain_probe_max; ++j)
+    {
+        fprintf
+        (
+            stderr,
+            "libexplain: statistics: %s: %lu probe%s, %.3f ms\n",
+            probe_name[j],
+            probe_count[j],
+            (probe_count[j] == 1 ? "" : "s"),
+            probe_nsec[j] / 1e6
+        );
+    }
+}
+
+
+static int
+option_statistics(void)
+{
+    if (option_state < 0)
+    {
+        int             yes;
+
+        yes = !!explain_option_statistics();
+        if (STATISTICS_CAS(&option_state, -1, yes) && yes)
+        {
+#ifdef HAVE_ATEXIT
+            atexit(print_statistics);
+#endif
+        }
+    }
+    return option_state;
+}
+
+
+static int
+is_enabled(void)
+{
+    if (client_state >= 0)
+        return client_state;
+    return option_statistics();
+}
+
+
+void
+explain_probe_begin(explain_probe_timer_t *tp, explain_probe_t probe)
+{
+    if (!is_enabled())
+    {
+        tp->probe = explain_probe_max;
+        return;
+    }
+    tp->probe = probe;
+    tp->start = now_nsec();
+}
+
+
+void
+explain_probe_end(const explain_probe_timer_t *tp)
+{
+    unsigned long long elapsed;
+
+    if (tp->probe >= explain_probe_max)
+        return;
+    elapsed = now_nsec() - tp->start;
+    STATISTICS_ADD(&probe_count[tp->probe], 1);
+    STATISTICS_ADD(&probe_nsec[tp->probe], elapsed);
+}
+
+
+int
+explain_statistics_get(explain_statistics_t *data, int data_size)
+{
+    int             j;
+
+    for (j = 0; j < explain_probe_max && j < data_size; ++j)
+    {
+        data[j].name = probe_name[j];
+        data[j].count = probe_count[j];
+        data[j].seconds = probe_nsec[j] / 1e9;
+    }
+    return explain_probe_max;
+}
+
+
+void
+explain_statistics_enable(int yesno)
+{
+    /* read the option now, so that printing at exit is registered */
+    option_statistics();
+    client_state = !!yesno;
+}
+
+
+void
+explain_statistics_reset(void)
+{
+    memset(probe_count, 0, sizeof(probe_count));
+    memset(probe_nsec, 0, sizeof(probe_nsec));
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,100 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_STATISTICS_H
+#define LIBEXPLAIN_STATISTICS_H
+
+/**
+  * @file
+  * @brief time spent probing the system
+  *
+  * Some explanations probe the system to find out more, for example
+  * by running lsof(1), walking /proc or /dev, or scanning the mount
+  * table.  These probes are counted and timed, so that it is possible
+  * to find out which one made an explanation slow.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct explain_statistics_t explain_statistics_t;
+struct explain_statistics_t
+{
+    /**
+      * The name of the probe class, one of "lsof" (running lsof),
+      * "proc" (reading /proc), "dev" (walking /dev), "mount" (scanning
+      * the mount table), "dns" (host name lookups), "dir" (directory
+      * scans) and "mincore" (checking pointers for EFAULT).
+      */
+    const char      *name;
+
+    /**
+      * The number of times probes of this class were run.
+      */
+    unsigned long   count;
+
+    /**
+      * The total time spent in probes of this class, in seconds.
+      */
+    double          seconds;
+};
+
+/**
+  * The explain_statistics_get function may be used to obtain the probe
+  * statistics, one element for each class of probe.
+  *
+  * The statistics are only collected when enabled, either by the
+  * #explain_statistics_enable function, or by the EXPLAIN_OPTIONS
+  * environment variable "statistics" option.  The option also prints
+  * the statistics on stderr when the program exits.
+  *
+  * @param data
+  *     The array in which to return the statistics.
+  * @param data_size
+  *     The number of elements in the data array.
+  * @returns
+  *     The number of probe classes.  If this is larger than data_size,
+  *     only the first data_size elements were set.
+  */
+int explain_statistics_get(explain_statistics_t *data, int data_size);
+
+/**
+  * The explain_statistics_enable function may be used to turn the
+  * collection of probe statistics on or off.  This overrides the
+  * EXPLAIN_OPTIONS "statistics" option, except that it does not
+  * change whether the statistics are printed at exit.
+  *
+  * @param yesno
+  *     true (non-zero) to collect statistics, false (zero) to stop.
+  */
+void explain_statistics_enable(int yesno);
+
+/**
+  * The explain_statistics_reset function may be used to set all of the
+  * probe statistics back to zero.
+  */
+void explain_statistics_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBEXPLAIN_STATISTICS_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,73 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_STATISTICS_PROBE_H
+#define LIBEXPLAIN_STATISTICS_PROBE_H
+
+/**
+  * The explain_probe_t enum is used to represent the class of a probe
+  * of the system.  The order must match the names in
+  * libexplain/statistics.c
+  */
+typedef enum explain_probe_t explain_probe_t;
+enum explain_probe_t
+{
+    explain_probe_lsof,
+    explain_probe_proc,
+    explain_probe_dev,
+    explain_probe_mount,
+    explain_probe_dns,
+    explain_probe_dir,
+    explain_probe_mincore,
+    explain_probe_max
+};
+
+typedef struct explain_probe_timer_t explain_probe_timer_t;
+struct explain_probe_timer_t
+{
+    /* the class of probe, or explain_probe_max if not collecting */
+    explain_probe_t probe;
+
+    /* when the probe started, in nanoseconds */
+    unsigned long long start;
+};
+
+/**
+  * The explain_probe_begin function is used to note the start of a
+  * probe.  When statistics are not being collected, it does nothing
+  * more than test a flag.
+  *
+  * @param tp
+  *     The timer, to be passed to explain_probe_end.
+  * @param probe
+  *     The class of probe.
+  */
+void explain_probe_begin(explain_probe_timer_t *tp, explain_probe_t probe);
+
+/**
+  * The explain_probe_end function is used to note the end of a probe,
+  * and add it to the statistics.
+  *
+  * @param tp
+  *     The timer, as given to explain_probe_begin.
+  */
+void explain_probe_end(const explain_probe_timer_t *tp);
+
+#endif /* LIBEXPLAIN_STATISTICS_PROBE_H */
+/* vim: set ts=8 sw=4 et : */
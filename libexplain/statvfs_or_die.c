@@ -19,16 +19,19 @@
 #include <libexplain/ac/sys/statvfs.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/statvfs.h>
 
 
 void
 explain_statvfs_or_die(const char *pathname, struct statvfs *data)
 {
+    explain_output_or_die_begin();
     if (explain_statvfs_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,6 +20,7 @@
 #include <libexplain/ac/time.h> /* for stime() except Solaris */
 #include <libexplain/ac/unistd.h> /* for stime() on Solaris */
 
+#include <libexplain/explanation.h>
 #include <libexplain/stime.h>
 #include <libexplain/output.h>
 
@@ -30,7 +31,9 @@ explain_stime_on_error(time_t *t)
     int             result;
 
 #ifdef HAVE_STIME
+    explain_explanation_call_begin();
     result = stime(t);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -40,7 +43,10 @@ explain_stime_on_error(time_t *t)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_stime(hold_errno, t));
+        if (!explain_output_suppress("stime", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_stime(hold_errno, t));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,16 +19,19 @@
 #include <libexplain/ac/time.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/stime.h>
 
 
 void
 explain_stime_or_die(time_t *t)
 {
+    explain_output_or_die_begin();
     if (explain_stime_on_error(t) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
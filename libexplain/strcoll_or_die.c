@@ -19,7 +19,9 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/string.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/strcoll.h>
 
 
@@ -29,7 +31,9 @@ explain_strcoll_or_die(const char *s1, const char *s2)
     int             result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_strcoll_on_error(s1, s2);
+    explain_output_or_die_end();
     if (errno != 0)
     {
         explain_output_exit_failure();
@@ -47,7 +51,9 @@ explain_strcoll_on_error(const char *s1, const char *s2)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_STRCOLL
+    explain_explanation_call_begin();
     result = strcoll(s1, s2);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = 0; /* result of string comparison, can be any int value */
@@ -55,11 +61,14 @@ explain_strcoll_on_error(const char *s1, const char *s2)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_strcoll(hold_errno, s1, s2)
-        );
+        if (!explain_output_suppress("strcoll", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_strcoll(hold_errno, s1, s2)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/string.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/strdup.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_strdup_on_error(const char *data)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = strdup(data);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_strdup(hold_errno, data));
+        if (!explain_output_suppress("strdup", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_strdup(hold_errno, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/strdup.h>
 
 
@@ -25,7 +26,9 @@ explain_strdup_or_die(const char *data)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_strdup_on_error(data);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdlib.h>
 #include <libexplain/ac/string.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/strndup.h>
 #include <libexplain/output.h>
 
@@ -57,14 +58,19 @@ explain_strndup_on_error(const char *data, size_t data_size)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = strndup(data, data_size);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_strndup(hold_errno, data,
-            data_size));
+        if (!explain_output_suppress("strndup", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_strndup(hold_errno, data,
+                data_size));
+        }
         errno = hold_errno;
     }
     return result;
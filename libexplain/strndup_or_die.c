@@ -19,6 +19,7 @@
 #include <libexplain/ac/string.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/strndup.h>
 
 
@@ -27,7 +28,9 @@ explain_strndup_or_die(const char *data, size_t data_size)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_strndup_on_error(data, data_size);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
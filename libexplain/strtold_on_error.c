@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/strtold.h>
 #include <libexplain/output.h>
 
@@ -33,7 +34,9 @@ explain_strtold_on_error(const char *nptr, char **endptr)
     hold_errno = errno;
     dummy = 0;
     errno = 0;
+    explain_explanation_call_begin();
     result = explain_ac_strtold(nptr, endptr ? endptr : &dummy);
+    explain_explanation_call_end();
     if (errno == 0 && (endptr ? *endptr : dummy) == nptr)
     {
         /*
@@ -45,7 +48,10 @@ explain_strtold_on_error(const char *nptr, char **endptr)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_strtold(nptr, endptr));
+        if (!explain_output_suppress("strtold", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_strtold(nptr, endptr));
+        }
     }
     errno = hold_errno;
     return result;
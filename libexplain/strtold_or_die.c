@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/strtold.h>
 
 
@@ -30,7 +31,9 @@ explain_strtold_or_die(const char *nptr, char **endptr)
 
     err = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_strtold_on_error(nptr, endptr);
+    explain_output_or_die_end();
     if (errno)
         explain_output_exit_failure();
     errno = err;
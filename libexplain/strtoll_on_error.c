@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/strtoll.h>
 #include <libexplain/output.h>
 
@@ -33,7 +34,9 @@ explain_strtoll_on_error(const char *nptr, char **endptr, int base)
     hold_errno = errno;
     dummy = 0;
     errno = 0;
+    explain_explanation_call_begin();
     result = strtoll(nptr, endptr ? endptr : &dummy, base);
+    explain_explanation_call_end();
     if (errno == 0 && (endptr ? *endptr : dummy) == nptr)
     {
         /*
@@ -45,10 +48,13 @@ explain_strtoll_on_error(const char *nptr, char **endptr, int base)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_strtoll(hold_errno, nptr, endptr, base)
-        );
+        if (!explain_output_suppress("strtoll", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_strtoll(hold_errno, nptr, endptr, base)
+            );
+        }
     }
     errno = hold_errno;
     return result;
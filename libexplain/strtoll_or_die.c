@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/strtoll.h>
 
 
@@ -30,7 +31,9 @@ explain_strtoll_or_die(const char *nptr, char **endptr, int base)
 
     err = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_strtoll_on_error(nptr, endptr, base);
+    explain_output_or_die_end();
     if (errno)
         explain_output_exit_failure();
     errno = err;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/strtoul.h>
 #include <libexplain/output.h>
 
@@ -33,7 +34,9 @@ explain_strtoul_on_error(const char *nptr, char **endptr, int base)
     hold_errno = errno;
     errno = 0;
     dummy = 0;
+    explain_explanation_call_begin();
     result = strtoul(nptr, endptr ? endptr : &dummy, base);
+    explain_explanation_call_end();
     if (errno == 0 && (endptr ? *endptr : dummy) == nptr)
     {
         /*
@@ -45,10 +48,13 @@ explain_strtoul_on_error(const char *nptr, char **endptr, int base)
     if (errno != 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_strtoul(hold_errno, nptr, endptr, base)
-        );
+        if (!explain_output_suppress("strtoul", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_strtoul(hold_errno, nptr, endptr, base)
+            );
+        }
     }
     errno = hold_errno;
     return result;
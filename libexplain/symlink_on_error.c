@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/symlink.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_symlink_on_error(const char *oldpath, const char *newpath)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = symlink(oldpath, newpath);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_symlink(hold_errno,
-            oldpath, newpath));
+        if (!explain_output_suppress("symlink", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_symlink(hold_errno,
+                oldpath, newpath));
+        }
         errno = hold_errno;
     }
     return result;
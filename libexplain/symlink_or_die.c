@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/symlink.h>
 
 
 void
 explain_symlink_or_die(const char *oldpath, const char *newpath)
 {
+    explain_output_or_die_begin();
     if (explain_symlink_on_error(oldpath, newpath) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
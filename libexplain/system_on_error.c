@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdlib.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/system.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_system_on_error(const char *command)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = system(command);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_system(hold_errno,
-            command));
+        if (!explain_output_suppress("system", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_system(hold_errno,
+                command));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/system.h>
 
 
@@ -25,7 +26,9 @@ explain_system_or_die(const char *command)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_system_on_error(command);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcdrain.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcdrain_on_error(int fildes)
     int             result;
 
 #ifdef HAVE_TCDRAIN
+    explain_explanation_call_begin();
     result = tcdrain(fildes);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcdrain_on_error(int fildes)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcdrain(hold_errno,
-            fildes));
+        if (!explain_output_suppress("tcdrain", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcdrain(hold_errno,
+                fildes));
+        }
         errno = hold_errno;
     }
     return result;
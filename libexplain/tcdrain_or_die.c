@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcdrain.h>
 
 
 void
 explain_tcdrain_or_die(int fildes)
 {
+    explain_output_or_die_begin();
     if (explain_tcdrain_on_error(fildes) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcflow.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcflow_on_error(int fildes, int action)
     int             result;
 
 #ifdef HAVE_TCFLOW
+    explain_explanation_call_begin();
     result = tcflow(fildes, action);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcflow_on_error(int fildes, int action)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcflow(hold_errno, fildes,
-            action));
+        if (!explain_output_suppress("tcflow", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcflow(hold_errno, fildes,
+                action));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcflow.h>
 
 
 void
 explain_tcflow_or_die(int fildes, int action)
 {
+    explain_output_or_die_begin();
     if (explain_tcflow_on_error(fildes, action) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
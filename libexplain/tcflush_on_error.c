@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcflush.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcflush_on_error(int fildes, int selector)
     int             result;
 
 #ifdef HAVE_TCFLUSH
+    explain_explanation_call_begin();
     result = tcflush(fildes, selector);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcflush_on_error(int fildes, int selector)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcflush(hold_errno, fildes,
-            selector));
+        if (!explain_output_suppress("tcflush", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcflush(hold_errno,
+                fildes, selector));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcflush.h>
 
 
 void
 explain_tcflush_or_die(int fildes, int selector)
 {
+    explain_output_or_die_begin();
     if (explain_tcflush_on_error(fildes, selector) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
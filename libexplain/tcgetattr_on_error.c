@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcgetattr.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcgetattr_on_error(int fildes, struct termios *data)
     int             result;
 
 #ifdef HAVE_TCGETATTR
+    explain_explanation_call_begin();
     result = tcgetattr(fildes, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcgetattr_on_error(int fildes, struct termios *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcgetattr(hold_errno,
-            fildes, data));
+        if (!explain_output_suppress("tcgetattr", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcgetattr(hold_errno,
+                fildes, data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcgetattr.h>
 
 
 void
 explain_tcgetattr_or_die(int fildes, struct termios *data)
 {
+    explain_output_or_die_begin();
     if (explain_tcgetattr_on_error(fildes, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcsendbreak.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcsendbreak_on_error(int fildes, int duration)
     int             result;
 
 #ifdef HAVE_TCSENDBREAK
+    explain_explanation_call_begin();
     result = tcsendbreak(fildes, duration);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcsendbreak_on_error(int fildes, int duration)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcsendbreak(hold_errno,
-            fildes, duration));
+        if (!explain_output_suppress("tcsendbreak", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcsendbreak(hold_errno,
+                fildes, duration));
+        }
         errno = hold_errno;
     }
     return result;
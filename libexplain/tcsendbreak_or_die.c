@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcsendbreak.h>
 
 
 void
 explain_tcsendbreak_or_die(int fildes, int duration)
 {
+    explain_output_or_die_begin();
     if (explain_tcsendbreak_on_error(fildes, duration) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
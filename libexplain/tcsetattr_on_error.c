@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/termios.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tcsetattr.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_tcsetattr_on_error(int fildes, int options, const struct termios *data)
     int             result;
 
 #ifdef HAVE_TCSETATTR
+    explain_explanation_call_begin();
     result = tcsetattr(fildes, options, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -39,8 +42,11 @@ explain_tcsetattr_on_error(int fildes, int options, const struct termios *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tcsetattr(hold_errno,
-            fildes, options, data));
+        if (!explain_output_suppress("tcsetattr", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_tcsetattr(hold_errno,
+                fildes, options, data));
+        }
         errno = hold_errno;
     }
     return result;
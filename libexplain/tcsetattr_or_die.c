@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tcsetattr.h>
 
 
 void
 explain_tcsetattr_or_die(int fildes, int options, const struct termios *data)
 {
+    explain_output_or_die_begin();
     if (explain_tcsetattr_on_error(fildes, options, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/dirent.h>
 #include <libexplain/ac/errno.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/telldir.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_telldir_on_error(DIR *dir)
 {
     long            result;
 
+    explain_explanation_call_begin();
     result = telldir(dir);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_telldir(hold_errno, dir));
+        if (!explain_output_suppress("telldir", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_telldir(hold_errno, dir));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/dirent.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/telldir.h>
 
 
@@ -27,7 +28,9 @@ explain_telldir_or_die(DIR *dir)
 {
     long            result;
 
+    explain_output_or_die_begin();
     result = explain_telldir_on_error(dir);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tempnam.h>
 #include <libexplain/output.h>
 
@@ -28,17 +29,22 @@ explain_tempnam_on_error(const char *dir, const char *prefix)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = tempnam(dir, prefix);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_tempnam(hold_errno, dir, prefix)
-        );
+        if (!explain_output_suppress("tempnam", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_tempnam(hold_errno, dir, prefix)
+            );
+        }
         errno = hold_errno;
     }
     return result;
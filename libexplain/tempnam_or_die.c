@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tempnam.h>
 
 
@@ -25,7 +26,9 @@ explain_tempnam_or_die(const char *dir, const char *prefix)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_tempnam_on_error(dir, prefix);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/time.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_time_on_error(time_t *t)
 {
     time_t          result;
 
+    explain_explanation_call_begin();
     result = time(t);
+    explain_explanation_call_end();
     if (result == (time_t)-1)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_time(hold_errno, t));
+        if (!explain_output_suppress("time", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_time(hold_errno, t));
+        }
         errno = hold_errno;
     }
     return result;
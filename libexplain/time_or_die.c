@@ -19,6 +19,7 @@
 #include <libexplain/ac/time.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/time.h>
 
 
@@ -27,7 +28,9 @@ explain_time_or_die(time_t *t)
 {
     time_t          result;
 
+    explain_output_or_die_begin();
     result = explain_time_on_error(t);
+    explain_output_or_die_end();
     if (result == (time_t)-1)
     {
         explain_output_exit_failure();
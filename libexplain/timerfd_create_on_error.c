@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/timerfd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/timerfd_create.h>
 #include <libexplain/output.h>
 
@@ -29,7 +30,9 @@ explain_timerfd_create_on_error(int clockid, int flags)
     int             result;
 
 #ifdef HAVE_TIMERFD_CREATE
+    explain_explanation_call_begin();
     result = timerfd_create(clockid, flags);
+    explain_explanation_call_end();
 #else
     result = -1;
     errno = ENOSYS;
@@ -39,8 +42,11 @@ explain_timerfd_create_on_error(int clockid, int flags)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_timerfd_create(hold_errno,
-            clockid, flags));
+        if (!explain_output_suppress("timerfd_create", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_timerfd_create(hold_errno,
+                clockid, flags));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/timerfd_create.h>
 
 
@@ -25,7 +26,9 @@ explain_timerfd_create_or_die(int clockid, int flags)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_timerfd_create_on_error(clockid, flags);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
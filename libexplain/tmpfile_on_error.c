@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/buffer/errno/tmpfile.h>
+#include <libexplain/explanation.h>
 #include <libexplain/tmpfile.h>
 #include <libexplain/output.h>
 
@@ -29,13 +30,18 @@ explain_tmpfile_on_error(void)
 {
     FILE            *result;
 
+    explain_explanation_call_begin();
     result = tmpfile();
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tmpfile(hold_errno));
+        if (!explain_output_suppress("tmpfile", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_tmpfile(hold_errno));
+        }
         errno = hold_errno;
     }
     return result;
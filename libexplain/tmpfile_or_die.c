@@ -19,6 +19,7 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tmpfile.h>
 
 
@@ -27,7 +28,9 @@ explain_tmpfile_or_die(void)
 {
     FILE            *result;
 
+    explain_output_or_die_begin();
     result = explain_tmpfile_on_error();
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/tmpnam.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,19 @@ explain_tmpnam_on_error(char *pathname)
 {
     char            *result;
 
+    explain_explanation_call_begin();
     result = tmpnam(pathname);
+    explain_explanation_call_end();
     if (!result)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_tmpnam(hold_errno, pathname));
+        if (!explain_output_suppress("tmpnam", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_tmpnam(hold_errno,
+                pathname));
+        }
         errno = hold_errno;
     }
     return result;
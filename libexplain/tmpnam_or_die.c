@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/tmpnam.h>
 
 
@@ -25,7 +26,9 @@ explain_tmpnam_or_die(char *pathname)
 {
     char            *result;
 
+    explain_output_or_die_begin();
     result = explain_tmpnam_on_error(pathname);
+    explain_output_or_die_end();
     if (!result)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/truncate.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_truncate_on_error(const char *pathname, off_t length)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = truncate(pathname, length);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_truncate(hold_errno,
-            pathname, length));
+        if (!explain_output_suppress("truncate", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_truncate(hold_errno,
+                pathname, length));
+        }
         errno = hold_errno;
     }
     return result;
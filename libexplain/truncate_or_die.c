@@ -20,16 +20,19 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/truncate.h>
 
 
 void
 explain_truncate_or_die(const char *pathname, off_t length)
 {
+    explain_output_or_die_begin();
     if (explain_truncate_on_error(pathname, length) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
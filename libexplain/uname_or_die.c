@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/utsname.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/uname.h>
 
 
 void
 explain_uname_or_die(struct utsname *data)
 {
+    explain_output_or_die_begin();
     if (explain_uname_on_error(data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_uname_on_error(struct utsname *data)
     int             result;
 
 #ifdef HAVE_UNAME
+    explain_explanation_call_begin();
     result = uname(data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,11 +55,14 @@ explain_uname_on_error(struct utsname *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_uname(hold_errno, data)
-        );
+        if (!explain_output_suppress("uname", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_uname(hold_errno, data)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ungetc.h>
 #include <libexplain/output.h>
 
@@ -31,13 +32,19 @@ explain_ungetc_on_error(int c, FILE *fp)
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = ungetc(c, fp);
+    explain_explanation_call_end();
     if (result == EOF)
     {
         hold_errno = errno;
         if (hold_errno == 0)
             hold_errno = EINVAL;
-        explain_output_error("%s", explain_errno_ungetc(hold_errno, c, fp));
+        if (!explain_output_suppress("ungetc", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_ungetc(hold_errno, c,
+                fp));
+        }
     }
     errno = hold_errno;
     return result;
@@ -19,16 +19,19 @@
 #include <libexplain/ac/stdio.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/ungetc.h>
 
 
 void
 explain_ungetc_or_die(int c, FILE *fp)
 {
+    explain_output_or_die_begin();
     if (explain_ungetc_on_error(c, fp) == EOF)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -20,6 +20,7 @@
 #include <libexplain/ac/stdlib.h>
 #include <libexplain/ac/string.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/unsetenv.h>
 #include <libexplain/output.h>
 
@@ -85,13 +86,19 @@ explain_unsetenv_on_error(const char *name)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = unsetenv(name);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_unsetenv(hold_errno, name));
+        if (!explain_output_suppress("unsetenv", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_unsetenv(hold_errno,
+                name));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/unsetenv.h>
 
 
 void
 explain_unsetenv_or_die(const char *name)
 {
+    explain_output_or_die_begin();
     if (explain_unsetenv_on_error(name) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/usleep.h>
 
 
 void
 explain_usleep_or_die(long long usec)
 {
+    explain_output_or_die_begin();
     if (explain_usleep_on_error(usec) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_usleep_on_error(long long usec)
     int             result;
 
 #ifdef HAVE_USLEEP
+    explain_explanation_call_begin();
     result = usleep(usec);
+    explain_explanation_call_end();
 #else
 # if HAVE_NANOSLEEP
     {
@@ -64,11 +70,14 @@ explain_usleep_on_error(long long usec)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_usleep(hold_errno, usec)
-        );
+        if (!explain_output_suppress("usleep", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_usleep(hold_errno, usec)
+            );
+        }
         errno = hold_errno;
     }
     return result;
@@ -21,6 +21,7 @@
 #include <libexplain/ac/sys/types.h>
 #include <libexplain/ac/ustat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/ustat.h>
 #include <libexplain/output.h>
 
@@ -31,7 +32,9 @@ explain_ustat_on_error(dev_t dev, struct ustat *data)
     int             result;
 
 #ifdef HAVE_USTAT
+    explain_explanation_call_begin();
     result = ustat(dev, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -41,8 +44,11 @@ explain_ustat_on_error(dev_t dev, struct ustat *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_ustat(hold_errno, dev,
-            data));
+        if (!explain_output_suppress("ustat", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_ustat(hold_errno, dev,
+                data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -21,16 +21,19 @@
 #include <libexplain/ac/ustat.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/ustat.h>
 
 
 void
 explain_ustat_or_die(dev_t dev, struct ustat *ubuf)
 {
+    explain_output_or_die_begin();
     if (explain_ustat_on_error(dev, ubuf) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/utime.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/utime.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_utime_on_error(const char *pathname, const struct utimbuf *times)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = utime(pathname, times);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_utime(hold_errno, pathname,
-            times));
+        if (!explain_output_suppress("utime", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_utime(hold_errno,
+                pathname, times));
+        }
         errno = hold_errno;
     }
     return result;
@@ -17,16 +17,19 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/utime.h>
 
 
 void
 explain_utime_or_die(const char *pathname, const struct utimbuf *times)
 {
+    explain_output_or_die_begin();
     if (explain_utime_on_error(pathname, times) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
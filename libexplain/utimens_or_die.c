@@ -20,18 +20,22 @@
 #include <libexplain/ac/fcntl.h> /* for AT_FDCWD */
 #include <libexplain/ac/sys/stat.h> /* for utimens and utimensat */
 
+#include <libexplain/explanation.h>
 #include <libexplain/option.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/utimens.h>
 
 
 void
 explain_utimens_or_die(const char *pathname, const struct timespec *data)
 {
+    explain_output_or_die_begin();
     if (explain_utimens_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -58,14 +62,19 @@ explain_utimens_on_error(const char *pathname, const struct timespec *data)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = utimens(pathname, data);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_message(explain_errno_utimens(hold_errno, pathname,
-            data));
+        if (!explain_output_suppress("utimens", hold_errno, -1))
+        {
+            explain_output_message(explain_errno_utimens(hold_errno, pathname,
+                data));
+        }
         errno = hold_errno;
     }
     return result;
@@ -19,8 +19,10 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/stat.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/option.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/utimensat.h>
 
 
@@ -28,10 +30,12 @@ void
 explain_utimensat_or_die(int fildes, const char *pathname,
     const struct timespec *data, int flags)
 {
+    explain_output_or_die_begin();
     if (explain_utimensat_on_error(fildes, pathname, data, flags) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -58,7 +62,9 @@ explain_utimensat_on_error(int fildes, const char *pathname, const struct
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = utimensat(fildes, pathname, data, flags);
+    explain_explanation_call_end();
 
 #ifdef __linux__
     /*
@@ -77,8 +83,11 @@ explain_utimensat_on_error(int fildes, const char *pathname, const struct
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_message(explain_errno_utimensat(hold_errno, fildes,
-            pathname, data, flags));
+        if (!explain_output_suppress("utimensat", hold_errno, -1))
+        {
+            explain_output_message(explain_errno_utimensat(hold_errno, fildes,
+                pathname, data, flags));
+        }
         errno = hold_errno;
     }
     return result;
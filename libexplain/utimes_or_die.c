@@ -19,17 +19,21 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/time.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/utimes.h>
 
 
 void
 explain_utimes_or_die(const char *pathname, const struct timeval *data)
 {
+    explain_output_or_die_begin();
     if (explain_utimes_on_error(pathname, data) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -39,7 +43,9 @@ explain_utimes_on_error(const char *pathname, const struct timeval *data)
     int             result;
 
 #ifdef HAVE_UTIMES
+    explain_explanation_call_begin();
     result = utimes(pathname, data);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -49,8 +55,11 @@ explain_utimes_on_error(const char *pathname, const struct timeval *data)
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_utimes(hold_errno, pathname,
-            data));
+        if (!explain_output_suppress("utimes", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_utimes(hold_errno,
+                pathname, data));
+        }
         errno = hold_errno;
     }
     return result;
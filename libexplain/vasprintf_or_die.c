@@ -20,7 +20,9 @@
 #include <libexplain/ac/stdarg.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vasprintf.h>
 
 
@@ -32,7 +34,9 @@ explain_vasprintf_or_die(char **data, const char *format, va_list ap)
 
     hold_errno = errno;
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_vasprintf_on_error(data, format, ap);
+    explain_output_or_die_end();
     if (result < 0 || errno)
     {
         explain_output_exit_failure();
@@ -51,7 +55,9 @@ explain_vasprintf_on_error(char **data, const char *format, va_list ap)
     hold_errno = errno;
     errno = 0;
 #ifdef HAVE_VASPRINTF
+    explain_explanation_call_begin();
     result = vasprintf(data, format, ap);
+    explain_explanation_call_end();
 #else
     errno = ENOSYS;
     result = -1;
@@ -59,11 +65,14 @@ explain_vasprintf_on_error(char **data, const char *format, va_list ap)
     if (result < 0 || errno != 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_vasprintf(hold_errno, data, format, ap)
-        );
+        if (!explain_output_suppress("vasprintf", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_vasprintf(hold_errno, data, format, ap)
+            );
+        }
     }
     errno = hold_errno;
     return result;
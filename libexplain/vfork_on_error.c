@@ -20,6 +20,7 @@
 #include <libexplain/ac/sys/types.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/vfork.h>
 #include <libexplain/output.h>
 
@@ -46,13 +47,18 @@ explain_vfork_on_error(void)
      * instead.  Mind you, this only happens if they are using GCC with
      * version < 3.0.
      */
+    explain_explanation_call_begin();
     result = fork();
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_vfork(hold_errno));
+        if (!explain_output_suppress("vfork", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_vfork(hold_errno));
+        }
         errno = hold_errno;
     }
     return result;
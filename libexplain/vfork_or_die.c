@@ -20,6 +20,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vfork.h>
 
 
@@ -28,7 +29,9 @@ explain_vfork_or_die(void)
 {
     pid_t           result;
 
+    explain_output_or_die_begin();
     result = explain_vfork_on_error();
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -20,17 +20,21 @@
 #include <libexplain/ac/stdarg.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vfprintf.h>
 
 
 void
 explain_vfprintf_or_die(FILE *fp, const char *format, va_list ap)
 {
+    explain_output_or_die_begin();
     if (explain_vfprintf_on_error(fp, format, ap) < 0)
     {
         explain_output_exit_failure();
     }
+    explain_output_or_die_end();
 }
 
 
@@ -42,15 +46,20 @@ explain_vfprintf_on_error(FILE *fp, const char *format, va_list ap)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vfprintf(fp, format, ap);
+    explain_explanation_call_end();
 fprintf(stderr, "%s: %d: result = %d\n", __FILE__, __LINE__, result);
     if (result < 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_vfprintf(hold_errno, fp, format, ap)
-        );
+        if (!explain_output_suppress("vfprintf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_vfprintf(hold_errno, fp, format, ap)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -20,7 +20,9 @@
 #include <libexplain/ac/stdarg.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vprintf.h>
 
 
@@ -29,7 +31,9 @@ explain_vprintf_or_die(const char *format, va_list ap)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_vprintf_on_error(format, ap);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -46,15 +50,20 @@ explain_vprintf_on_error(const char *format, va_list ap)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vprintf(format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         hold_errno = errno;
-        explain_output_error
-        (
-            "%s",
-            explain_errno_vprintf(hold_errno, format, ap)
-        );
+        if (!explain_output_suppress("vprintf", hold_errno, -1))
+        {
+            explain_output_error
+            (
+                "%s",
+                explain_errno_vprintf(hold_errno, format, ap)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -20,7 +20,9 @@
 #include <libexplain/ac/stdarg.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vsnprintf.h>
 
 
@@ -31,7 +33,9 @@ explain_vsnprintf_or_die(char *data, size_t data_size, const char *format,
     int             result;
 
     errno = 0;
+    explain_output_or_die_begin();
     result = explain_vsnprintf_on_error(data, data_size, format, ap);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -49,12 +53,17 @@ explain_vsnprintf_on_error(char *data, size_t data_size, const char *format,
 
     hold_errno = errno;
     errno = 0;
+    explain_explanation_call_begin();
     result = vsnprintf(data, data_size, format, ap);
+    explain_explanation_call_end();
     if (result < 0 && errno != 0)
     {
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_vsnprintf(hold_errno, data,
-            data_size, format, ap));
+        if (!explain_output_suppress("vsnprintf", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_vsnprintf(hold_errno,
+                data, data_size, format, ap));
+        }
     }
     errno = hold_errno;
     return result;
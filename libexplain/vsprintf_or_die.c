@@ -20,7 +20,9 @@
 #include <libexplain/ac/stdarg.h>
 #include <libexplain/ac/stdio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/vsprintf.h>
 
 
@@ -32,7 +34,9 @@ explain_vsprintf_or_die(char *data, const char *format, va_list ap)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_vsprintf_on_error(data, format, ap);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -49,14 +53,19 @@ explain_vsprintf_on_error(char *data, const char *format, va_list ap)
 
     hold_errno = errno;
     errno = EINVAL;
+    explain_explanation_call_begin();
     result = vsprintf(data, format, ap);
+    explain_explanation_call_end();
     if (result < 0)
     {
         hold_errno = errno;
-        explain_output_message
-        (
-            explain_errno_vsprintf(hold_errno, data, format, ap)
-        );
+        if (!explain_output_suppress("vsprintf", hold_errno, -1))
+        {
+            explain_output_message
+            (
+                explain_errno_vsprintf(hold_errno, data, format, ap)
+            );
+        }
     }
     errno = hold_errno;
     return result;
@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/wait3.h>
 
 
@@ -25,7 +26,9 @@ explain_wait3_or_die(int *status, int options, struct rusage *rusage)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_wait3_on_error(status, options, rusage);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/wait.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/wait4.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_wait4_on_error(int pid, int *status, int options, struct rusage *rusage)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = wait4(pid, status, options, rusage);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_wait4(hold_errno, pid,
-            status, options, rusage));
+        if (!explain_output_suppress("wait4", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_wait4(hold_errno, pid,
+                status, options, rusage));
+        }
         errno = hold_errno;
     }
     return result;
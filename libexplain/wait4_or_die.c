@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/wait4.h>
 
 
@@ -26,7 +27,9 @@ explain_wait4_or_die(int pid, int *status, int options,
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_wait4_on_error(pid, status, options, rusage);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/wait.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/wait.h>
 #include <libexplain/output.h>
 
@@ -28,13 +29,18 @@ explain_wait_on_error(int *status)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = wait(status);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_wait(hold_errno, status));
+        if (!explain_output_suppress("wait", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_wait(hold_errno, status));
+        }
         errno = hold_errno;
     }
     return result;
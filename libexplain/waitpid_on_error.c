@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/wait.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/waitpid.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_waitpid_on_error(int pid, int *status, int options)
 {
     int             result;
 
+    explain_explanation_call_begin();
     result = waitpid(pid, status, options);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_waitpid(hold_errno, pid,
-            status, options));
+        if (!explain_output_suppress("waitpid", hold_errno, -1))
+        {
+            explain_output_error("%s", explain_errno_waitpid(hold_errno, pid,
+                status, options));
+        }
         errno = hold_errno;
     }
     return result;
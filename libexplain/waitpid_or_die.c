@@ -17,6 +17,7 @@
  */
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/waitpid.h>
 
 
@@ -25,7 +26,9 @@ explain_waitpid_or_die(int pid, int *status, int options)
 {
     int             result;
 
+    explain_output_or_die_begin();
     result = explain_waitpid_on_error(pid, status, options);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
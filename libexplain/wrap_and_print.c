@@ -41,103 +41,292 @@
 
 #define MAX_LINE_LENGTH (PATH_MAX + 10)
 
+/*
+ * The paragraph is assembled in this much memory, and written out
+ * using a single fwrite when it is complete.  Only very long messages
+ * will need more than one fwrite.
+ */
+#define PARAGRAPH_SIZE (2 * (MAX_LINE_LENGTH + 2))
 
-#if defined(HAVE_MBRTOWC) && defined(HAVE_WCWIDTH)
 
-void
-explain_wrap_and_print_width(FILE *fp, const char *text, int width)
+typedef struct paragraph_t paragraph_t;
+struct paragraph_t
 {
-    const char      *cp;
-    const char      *end;
-    char            line_string[MAX_LINE_LENGTH + 1];
-    explain_string_buffer_t line_buf;
-    char            word_string[MAX_LINE_LENGTH + 1];
-    explain_string_buffer_t word_buf;
-    static mbstate_t mbz;
-    mbstate_t       state;
-    int             width_of_line;
-    int             width_of_word;
+    FILE            *fp;
+    int             width;
     int             hanging_indent;
     int             first_line;
+    int             width_of_line;
+    int             indent_is_width;
+    size_t          line_start;
+    size_t          size;
+    int             error;
+    char            buffer[PARAGRAPH_SIZE];
+};
 
+
+static void
+paragraph_init(paragraph_t *pp, FILE *fp, int width)
+{
     assert(width > 0);
     if (width <= 0)
         width = DEFAULT_LINE_WIDTH ;
     if (width > MAX_LINE_LENGTH)
         width = MAX_LINE_LENGTH;
-    hanging_indent = explain_option_hanging_indent(width);
-    assert(sizeof(word_string) <= sizeof(line_string));
+    pp->fp = fp;
+    pp->width = width;
+    pp->hanging_indent = explain_option_hanging_indent(width);
+    pp->first_line = 1;
+    pp->width_of_line = 0;
+    pp->indent_is_width = 0;
+    pp->line_start = 0;
+    pp->size = 0;
+    pp->error = 0;
+}
+
+
+static void
+paragraph_flush(paragraph_t *pp)
+{
+    if (pp->size && !pp->error)
+    {
+        if (0 == fwrite(pp->buffer, pp->size, 1, pp->fp))
+            pp->error = 1;
+    }
+    pp->size = 0;
+    pp->line_start = 0;
+}
+
+
+/**
+  * The paragraph_word function is used to add a word to the paragraph,
+  * starting a new line if the word will not fit on the current line.
+  *
+  * @param pp
+  *     The paragraph being assembled.
+  * @param word
+  *     The text of the word (not NUL terminated).
+  * @param word_size
+  *     The length of the word, in bytes.
+  * @param width_of_word
+  *     The width of the word, in character columns.  This can be less
+  *     than the number of bytes, when multi-byte character sequences
+  *     represent single displayed characters.  This can be more than
+  *     the number of bytes, for example kanji, when a character is
+  *     displayed 2 columns wide.
+  */
+
+static void
+paragraph_word(paragraph_t *pp, const char *word, size_t word_size,
+    int width_of_word)
+{
+    size_t          line_size;
+    size_t          room;
+
+    line_size = pp->size - pp->line_start;
+    if (line_size == 0)
+    {
+        /* do nothing */
+    }
+    else if
+    (
+        pp->width_of_line + 1 + width_of_word
+    <=
+        pp->width - (pp->first_line ? 0 : pp->hanging_indent)
+    )
+    {
+        if (line_size < MAX_LINE_LENGTH)
+        {
+            pp->buffer[pp->size++] = ' ';
+            ++line_size;
+        }
+        ++pp->width_of_line;
+    }
+    else
+    {
+        pp->buffer[pp->size++] = '\n';
+        pp->line_start = pp->size;
+        pp->width_of_line = 0;
+        pp->first_line = 0;
+        line_size = 0;
+
+        /*
+         * Make sure there is room for a whole line, and its newline.
+         */
+        if (pp->size + MAX_LINE_LENGTH + 1 > sizeof(pp->buffer))
+            paragraph_flush(pp);
+    }
+    if (line_size == 0 && !pp->first_line && pp->hanging_indent)
+    {
+        line_size = pp->hanging_indent;
+        if (line_size > MAX_LINE_LENGTH)
+            line_size = MAX_LINE_LENGTH;
+        memset(pp->buffer + pp->size, ' ', line_size);
+        pp->size += line_size;
+        if (pp->indent_is_width)
+            pp->width_of_line += line_size;
+    }
+    room = MAX_LINE_LENGTH - line_size;
+    if (word_size > room)
+        word_size = room;
+    memcpy(pp->buffer + pp->size, word, word_size);
+    pp->size += word_size;
+    pp->width_of_line += width_of_word;
+
+    /*
+     * Note: it is possible for a line to be longer than (width)
+     * when it contains a single word that is itself longer than
+     * (width).  We do this to avoid putting line breaks in the
+     * middle of pathnames, provided the pathanme itself does not
+     * contain white space.  This is useful for copy-and-paste.
+     */
+}
+
+
+static void
+paragraph_end(paragraph_t *pp)
+{
+    if (pp->size > pp->line_start)
+        pp->buffer[pp->size++] = '\n';
+    paragraph_flush(pp);
+}
+
+
+/*
+ * Plain ASCII characters are printable, one column wide, and are
+ * unaffected by the multi-byte conversion state (when it is in its
+ * initial state).  The white space characters are included, because
+ * they are the same in every locale.
+ */
+#define is_ascii_print(c) ((c) >= 0x20 && (c) < 0x7F)
+#define is_ascii_space(c) ((c) == ' ' || ((c) >= '\t' && (c) <= '\r'))
+
+
+#if defined(HAVE_MBRTOWC) && defined(HAVE_WCWIDTH)
+
+static size_t
+next_char(wchar_t *wc, const char *cp, const char *end, mbstate_t *state)
+{
+    unsigned char   c;
+    size_t          n;
+
+    if (cp >= end)
+    {
+        *wc = L'\0';
+        return 0;
+    }
+    c = *cp;
+    if ((is_ascii_print(c) || is_ascii_space(c)) && mbsinit(state))
+    {
+        *wc = c;
+        return 1;
+    }
+    n = mbrtowc(wc, cp, end - cp, state);
+    if ((ssize_t)n < 0)
+    {
+        *wc = *cp;
+        n = 1;
+    }
+    return n;
+}
+
+
+static int
+char_is_space(wchar_t wc)
+{
+    if (wc < 0x80 && (is_ascii_print(wc) || is_ascii_space(wc)))
+        return is_ascii_space(wc);
+    return iswspace(wc);
+}
+
+
+static int
+char_width(wchar_t wc)
+{
+    if (wc < 0x80 && is_ascii_print(wc))
+        return 1;
+    return wcwidth(wc);
+}
+
+
+void
+explain_wrap_and_print_width(FILE *fp, const char *text, int width)
+{
+    const char      *cp;
+    const char      *end;
+    paragraph_t     para;
+    static mbstate_t mbz;
+    mbstate_t       state;
+
+    paragraph_init(&para, fp, width);
     cp = text;
     end = text + strlen(text);
-    explain_string_buffer_init(&line_buf, line_string, sizeof(line_string));
-    explain_string_buffer_init(&word_buf, word_string, sizeof(word_string));
     state = mbz;
-    width_of_line = 0;
-    width_of_word = 0;
-    first_line = 1;
     for (;;)
     {
         const char      *starts_here;
         wchar_t         wc;
         size_t          n;
+        const char      *word;
+        size_t          word_size;
+        int             width_of_word;
 
         starts_here = cp;
-        n = mbrtowc(&wc, cp, end - cp, &state);
-        if ((ssize_t)n < 0)
-        {
-            wc = *cp;
-            n = 1;
-        }
+        n = next_char(&wc, cp, end, &state);
         cp += n;
         if (n == 0 || wc == L'\0')
         {
-            if (line_buf.position)
-            {
-                if (0 == fwrite(line_string, line_buf.position, 1, fp))
-                    return;
-                putc('\n', fp);
-            }
+            paragraph_end(&para);
             return;
         }
 
-        if (iswspace(wc))
+        if (char_is_space(wc))
             continue;
 
         /*
-         * Grab the next word.
-         *
-         * The width_of_word records the number of character positions
-         * consumed.  This can be less than the number of bytes, when
-         * multi-byte character sequences represent single displayed
-         * characters.  This can be more than the number of bytes, for
-         * exmaple kanji, when a character is display 2 columns wide.
+         * Grab the next word.  The word is not copied, it is
+         * remembered as a position and length within the text.
          */
-        word_buf.position = 0;
+        word = starts_here;
+        word_size = 0;
         width_of_word = 0;
         for (;;)
         {
             mbstate_t       hold;
 
-            explain_string_buffer_write(&word_buf, starts_here, n);
-            width_of_word += wcwidth(wc);
-            if (explain_string_buffer_full(&word_buf))
-                break;
-
-            hold = state;
-            starts_here = cp;
-            n = mbrtowc(&wc, cp, end - cp, &state);
-            if ((ssize_t)n < 0)
+            word_size += n;
+            width_of_word += char_width(wc);
+            if (word_size >= MAX_LINE_LENGTH)
             {
-                wc = *cp;
-                n = 1;
+                word_size = MAX_LINE_LENGTH;
+                break;
             }
 
-            if (n == 0 || wc == '\0')
+            /*
+             * Nearly all text is plain ASCII.  Runs of it need no
+             * conversion, and are exactly one column per byte.
+             */
+            if (mbsinit(&state))
             {
-                state = hold;
-                break;
+                const char      *run;
+                const char      *run_end;
+
+                run = cp;
+                run_end = word + MAX_LINE_LENGTH;
+                if (run_end > end)
+                    run_end = end;
+                while (run < run_end && is_ascii_print(*run) && *run != ' ')
+                    ++run;
+                word_size += run - cp;
+                width_of_word += run - cp;
+                cp = run;
+                if (word_size >= MAX_LINE_LENGTH)
+                    break;
             }
-            if (iswspace(wc))
+
+            hold = state;
+            n = next_char(&wc, cp, end, &state);
+            if (n == 0 || wc == L'\0' || char_is_space(wc))
             {
                 state = hold;
                 break;
@@ -145,47 +334,7 @@ explain_wrap_and_print_width(FILE *fp, const char *text, int width)
             cp += n;
         }
 
-        if (line_buf.position == 0)
-        {
-            /* do nothing */
-        }
-        else if
-        (
-            width_of_line + 1 + width_of_word
-        <=
-            width - (first_line ? 0 : hanging_indent))
-        {
-            explain_string_buffer_putc(&line_buf, ' ');
-            ++width_of_line;
-        }
-        else
-        {
-            if (0 == fwrite(line_string, line_buf.position, 1, fp))
-                return;
-            putc('\n', fp);
-            line_buf.position = 0;
-            width_of_line = 0;
-            first_line = 0;
-        }
-        if (line_buf.position == 0 && !first_line && hanging_indent)
-        {
-            for (;;)
-            {
-                explain_string_buffer_putc(&line_buf, ' ');
-                if (line_buf.position >= (size_t)hanging_indent)
-                    break;
-            }
-        }
-        explain_string_buffer_puts(&line_buf, word_string);
-        width_of_line += width_of_word;
-
-        /*
-         * Note: it is possible for a line to be longer than (width)
-         * when it contains a single word that is itself longer than
-         * (width).  We do this to avoid putting line breaks in the
-         * middle of pathnames, provided the pathanme itself does not
-         * contain white space.  This is useful for copy-and-paste.
-         */
+        paragraph_word(&para, word, word_size, width_of_word);
     }
 }
 
@@ -195,94 +344,49 @@ void
 explain_wrap_and_print_width(FILE *fp, const char *text, int width)
 {
     const char      *cp;
-    char            line_string[MAX_LINE_LENGTH + 1];
-    explain_string_buffer_t line_buf;
-    char            word_string[MAX_LINE_LENGTH + 1];
-    explain_string_buffer_t word_buf;
-    unsigned        hanging_indent;
-    int             first_line;
+    paragraph_t     para;
+
+    paragraph_init(&para, fp, width);
+
+    /*
+     * Without multi-byte support, the width of a line is simply its
+     * length in bytes, and that includes any hanging indent.
+     */
+    para.indent_is_width = 1;
 
-    assert(width > 0);
-    if (width <= 0)
-        width = DEFAULT_LINE_WIDTH ;
-    if (width > MAX_LINE_LENGTH)
-        width = MAX_LINE_LENGTH;
-    hanging_indent = explain_option_hanging_indent(width);
-    assert(sizeof(word_string) <= sizeof(line_string));
     cp = text;
-    explain_string_buffer_init(&line_buf, line_string, sizeof(line_string));
-    explain_string_buffer_init(&word_buf, word_string, sizeof(word_string));
-    first_line = 1;
     for (;;)
     {
-        unsigned char c = *cp++;
-        if (c == '\0')
+        const char      *word;
+        size_t          word_size;
+
+        if (*cp == '\0')
         {
-            if (line_buf.position)
-            {
-                if (0 == fwrite(line_string, line_buf.position, 1, fp))
-                    return;
-                putc('\n', fp);
-            }
+            paragraph_end(&para);
             return;
         }
-
-        if (isspace(c))
+        if (isspace((unsigned char)*cp))
+        {
+            ++cp;
             continue;
+        }
 
         /*
          * Grab the next word.
          */
-        word_buf.position = 0;
+        word = cp;
         for (;;)
         {
-            explain_string_buffer_putc(&word_buf, c);
-            if (explain_string_buffer_full(&word_buf))
+            ++cp;
+            if ((size_t)(cp - word) >= MAX_LINE_LENGTH)
                 break;
-            c = *cp;
-            if (c == '\0')
+            if (*cp == '\0')
                 break;
-            if (isspace(c))
+            if (isspace((unsigned char)*cp))
                 break;
-            ++cp;
         }
-
-        if (line_buf.position == 0)
-        {
-            /* do nothing */
-        }
-        else if
-        (
-            line_buf.position + 1 + word_buf.position
-        <=
-            (size_t)(width - (first_line ? 0 : hanging_indent))
-        )
-        {
-            explain_string_buffer_putc(&line_buf, ' ');
-        }
-        else
-        {
-            if (0 == fwrite(line_string, line_buf.position, 1, fp))
-                return;
-            putc('\n', fp);
-            line_buf.position = 0;
-            first_line = 0;
-        }
-        if (line_buf.position == 0 && !first_line && hanging_indent)
-        {
-            for (;;)
-            {
-                explain_string_buffer_putc(&line_buf, ' ');
-                if (line_buf.position >= hanging_indent)
-                    break;
-            }
-        }
-        explain_string_buffer_puts(&line_buf, word_string);
-        /*
-         * Note: it is possible for a line to be longer than (width)
-         * when it contains a single word that is itself longer than
-         * (width).
-         */
+        word_size = cp - word;
+        paragraph_word(&para, word, word_size, word_size);
     }
 }
 
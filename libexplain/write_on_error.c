@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/unistd.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/write.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_write_on_error(int fildes, const void *data, size_t data_size)
 {
     ssize_t         result;
 
+    explain_explanation_call_begin();
     result = write(fildes, data, data_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_write(hold_errno, fildes,
-            data, data_size));
+        if (!explain_output_suppress("write", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_write(hold_errno,
+                fildes, data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
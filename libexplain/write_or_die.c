@@ -19,6 +19,7 @@
 #include <libexplain/ac/unistd.h>
 
 #include <libexplain/output.h>
+#include <libexplain/output/or_die.h>
 #include <libexplain/write.h>
 
 
@@ -27,7 +28,9 @@ explain_write_or_die(int fildes, const void *data, size_t data_size)
 {
     ssize_t         result;
 
+    explain_output_or_die_begin();
     result = explain_write_on_error(fildes, data, data_size);
+    explain_output_or_die_end();
     if (result < 0)
     {
         explain_output_exit_failure();
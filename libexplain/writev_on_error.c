@@ -19,6 +19,7 @@
 #include <libexplain/ac/errno.h>
 #include <libexplain/ac/sys/uio.h>
 
+#include <libexplain/explanation.h>
 #include <libexplain/writev.h>
 #include <libexplain/output.h>
 
@@ -28,14 +29,19 @@ explain_writev_on_error(int fildes, const struct iovec *data, int data_size)
 {
     ssize_t         result;
 
+    explain_explanation_call_begin();
     result = writev(fildes, data, data_size);
+    explain_explanation_call_end();
     if (result < 0)
     {
         int             hold_errno;
 
         hold_errno = errno;
-        explain_output_error("%s", explain_errno_writev(hold_errno, fildes,
-            data, data_size));
+        if (!explain_output_suppress("writev", hold_errno, fildes))
+        {
+            explain_output_error("%s", explain_errno_writev(hold_errno, fildes,
+                data, data_size));
+        }
         errno = hold_errno;
     }
     return result;
@@ -0,0 +1,197 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+
+#include <libexplain/errno_info.h>
+#include <libexplain/explanation.h>
+#include <libexplain/output.h>
+#include <libexplain/string_list.h>
+
+#include <libexplain_preload/preload.h>
+
+#if EXPLAIN_PRELOAD_SUPPORTED
+
+/*
+ * The most error numbers that EXPLAIN_PRELOAD_ERRNOS may name.
+ */
+#define MAX_ERRNOS 64
+
+static explain_string_list_t functions;
+static int      errnos[MAX_ERRNOS];
+static int      nerrnos;
+static unsigned long sample;
+static unsigned long counter;
+
+/*
+ * 0 before the environment has been read, 1 while it is being read,
+ * and 2 afterwards.
+ */
+static volatile int configured;
+
+/*
+ * The explanations themselves call libc functions, some of which may
+ * (legitimately) fail, and those calls also go through the wrappers.
+ * This stops them being explained in turn.  The program's own
+ * explain_*_on_error calls, both the failure they are to explain and
+ * the explanation they build, are caught by explain_explanation_busy.
+ */
+static __thread int depth;
+
+
+/**
+  * The configure function is used to read the filter settings from the
+  * environment, once.  It is run when the library is loaded, before
+  * the program has any threads, so that the filter tables may be read
+  * afterwards without locking.  It is also run by the first failure,
+  * in case that happens in the constructor of a library initialized
+  * before this one.
+  */
+static void configure(void) __attribute__((constructor));
+
+static void
+configure(void)
+{
+    const char      *cp;
+
+    if (!__sync_bool_compare_and_swap(&configured, 0, 1))
+    {
+        while (configured != 2)
+            ;
+        return;
+    }
+    explain_string_list_constructor(&functions);
+    cp = getenv("EXPLAIN_PRELOAD_FUNCTIONS");
+    if (cp)
+        explain_string_list_split(&functions, cp);
+
+    cp = getenv("EXPLAIN_PRELOAD_ERRNOS");
+    if (cp)
+    {
+        explain_string_list_t names;
+        size_t          j;
+
+        explain_string_list_constructor(&names);
+        explain_string_list_split(&names, cp);
+        for (j = 0; j < names.length && nerrnos < MAX_ERRNOS; ++j)
+        {
+            const char      *name;
+            const explain_errno_info_t *eip;
+
+            name = names.string[j];
+            if (isdigit((unsigned char)*name))
+            {
+                errnos[nerrnos++] = atoi(name);
+                continue;
+            }
+            eip = explain_errno_info_by_name(name);
+            if (!eip)
+            {
+                explain_output_error
+                (
+                    "EXPLAIN_PRELOAD_ERRNOS: error \"%s\" unknown",
+                    name
+                );
+                continue;
+            }
+            errnos[nerrnos++] = eip->error_number;
+        }
+        explain_string_list_destructor(&names);
+    }
+
+    cp = getenv("EXPLAIN_PRELOAD_SAMPLE");
+    if (cp)
+        sample = strtoul(cp, 0, 10);
+    __sync_synchronize();
+    configured = 2;
+}
+
+
+static int
+wanted(const char *function, int errnum)
+{
+    if (functions.length)
+    {
+        size_t          j;
+
+        for (j = 0; ; ++j)
+        {
+            if (j >= functions.length)
+                return 0;
+            if (0 == strcmp(functions.string[j], function))
+                break;
+        }
+    }
+    if (nerrnos)
+    {
+        int             j;
+
+        for (j = 0; ; ++j)
+        {
+            if (j >= nerrnos)
+                return 0;
+            if (errnos[j] == errnum)
+                break;
+        }
+    }
+
+    /*
+     * Of the failures that pass the other filters, one in every
+     * "sample" is explained.
+     */
+    if (sample > 1 && __sync_fetch_and_add(&counter, 1) % sample)
+        return 0;
+    return 1;
+}
+
+
+int
+explain_preload_begin(const char *function, int errnum, int fildes)
+{
+    if (depth || explain_explanation_busy())
+        return 0;
+    ++depth;
+    if (configured != 2)
+        configure();
+    if
+    (
+        !wanted(function, errnum)
+    ||
+        explain_output_suppress(function, errnum, fildes)
+    )
+    {
+        --depth;
+        return 0;
+    }
+    return 1;
+}
+
+
+void
+explain_preload_end(void)
+{
+    --depth;
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,114 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBEXPLAIN_PRELOAD_PRELOAD_H
+#define LIBEXPLAIN_PRELOAD_PRELOAD_H
+
+/**
+  * @file
+  * @brief LD_PRELOAD interposition of libc functions
+  *
+  * The libexplain_preload shared library defines functions with the
+  * same names as the libc functions it explains.  When loaded with
+  * LD_PRELOAD each call goes to the wrapper, which calls the real
+  * function, and only on failure does anything more.
+  */
+
+#include <libexplain/config.h>
+
+/*
+ * Interposition needs ELF symbol preemption, asm labels (so that the
+ * wrappers do not collide with the system header declarations),
+ * thread local storage, and dlsym(RTLD_NEXT).
+ */
+#if defined(__ELF__) && (defined(__GNUC__) || defined(__clang__)) && \
+    defined(HAVE_DLSYM) && defined(HAVE_DLFCN_H)
+#define EXPLAIN_PRELOAD_SUPPORTED 1
+#else
+#define EXPLAIN_PRELOAD_SUPPORTED 0
+#endif
+
+/*
+ * The wrappers for functions with off_t or struct stat arguments are
+ * only safe where the large file support functions are the same as
+ * the plain ones.  There, the *64 variants (which is what programs
+ * compiled with _FILE_OFFSET_BITS=64 call) are aliases of the same
+ * wrappers.  Elsewhere the *64 variants would need wrappers of their
+ * own, and are left alone.
+ */
+#if defined(__LP64__) || defined(_LP64)
+#define EXPLAIN_PRELOAD_LFS 1
+#else
+#define EXPLAIN_PRELOAD_LFS 0
+#endif
+
+/**
+  * The EXPLAIN_PRELOAD_SYMBOL macro is used to give a wrapper the
+  * link-time name of the libc function it replaces.
+  */
+#define EXPLAIN_PRELOAD_SYMBOL(name) __asm__(name)
+
+/**
+  * The EXPLAIN_PRELOAD_ALIAS macro is used to give a wrapper a second
+  * link-time name, for the large file support variant of a function.
+  */
+#define EXPLAIN_PRELOAD_ALIAS(name, target) \
+    __asm__(name) __attribute__((alias(target)))
+
+/**
+  * The explain_preload_resolve function is used to find the next
+  * definition of a function (usually the one in libc) after the
+  * preload library.  It does not return if there is no such function.
+  *
+  * @param name
+  *     The name of the function.
+  * @returns
+  *     the function's address
+  */
+void *explain_preload_resolve(const char *name);
+
+/**
+  * The explain_preload_begin function is used by the wrappers, after
+  * the real function has failed, to decide whether to explain the
+  * failure.  Failures inside an explanation are never explained, nor
+  * are those excluded by the EXPLAIN_PRELOAD_FUNCTIONS,
+  * EXPLAIN_PRELOAD_ERRNOS or EXPLAIN_PRELOAD_SAMPLE environment
+  * variables, or by the output filter's duplicate suppression.
+  *
+  * @param function
+  *     The name of the function that failed.
+  * @param errnum
+  *     The error number of the failure.
+  * @param fildes
+  *     The file descriptor the function was called on, or -1 if none.
+  * @returns
+  *     true (non-zero) if the failure is to be explained, in which
+  *     case explain_preload_end must be called afterwards; false
+  *     (zero) if it is to be ignored.
+  */
+int explain_preload_begin(const char *function, int errnum, int fildes);
+
+/**
+  * The explain_preload_end function is used to mark the end of an
+  * explanation started by a successful explain_preload_begin call.
+  */
+void explain_preload_end(void);
+
+#endif /* LIBEXPLAIN_PRELOAD_PRELOAD_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,49 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation; either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/dlfcn.h>
+
+#include <libexplain/output.h>
+
+#include <libexplain_preload/preload.h>
+
+#if EXPLAIN_PRELOAD_SUPPORTED
+
+
+void *
+explain_preload_resolve(const char *name)
+{
+    void            *result;
+
+    result = dlsym(RTLD_NEXT, name);
+    if (!result)
+    {
+        explain_output_error_and_die
+        (
+            "LD_PRELOAD: unable to find the real %s function",
+            name
+        );
+    }
+    return result;
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
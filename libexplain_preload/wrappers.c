@@ -0,0 +1,4021 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This file is generated from the catalogue/ entries
+ * by "codegen --preload".  Do not edit it, regenerate it.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/stdarg.h>
+
+#include <libexplain/accept.h>
+#include <libexplain/acct.h>
+#include <libexplain/adjtime.h>
+#include <libexplain/adjtimex.h>
+#include <libexplain/bind.h>
+#include <libexplain/chdir.h>
+#include <libexplain/chmod.h>
+#include <libexplain/chown.h>
+#include <libexplain/chroot.h>
+#include <libexplain/close.h>
+#include <libexplain/connect.h>
+#include <libexplain/creat.h>
+#include <libexplain/dup.h>
+#include <libexplain/dup2.h>
+#include <libexplain/eventfd.h>
+#include <libexplain/execve.h>
+#include <libexplain/execvp.h>
+#include <libexplain/fchdir.h>
+#include <libexplain/fchown.h>
+#include <libexplain/fcntl.h>
+#include <libexplain/flock.h>
+#include <libexplain/fork.h>
+#include <libexplain/fputs.h>
+#include <libexplain/fstat.h>
+#include <libexplain/fstatfs.h>
+#include <libexplain/fstatvfs.h>
+#include <libexplain/fsync.h>
+#include <libexplain/ftruncate.h>
+#include <libexplain/getpeername.h>
+#include <libexplain/getrlimit.h>
+#include <libexplain/getsockname.h>
+#include <libexplain/getsockopt.h>
+#include <libexplain/gettimeofday.h>
+#include <libexplain/kill.h>
+#include <libexplain/lchown.h>
+#include <libexplain/link.h>
+#include <libexplain/listen.h>
+#include <libexplain/lstat.h>
+#include <libexplain/mkdir.h>
+#include <libexplain/mknod.h>
+#include <libexplain/mkostemp.h>
+#include <libexplain/mkstemp.h>
+#include <libexplain/nice.h>
+#include <libexplain/open.h>
+#include <libexplain/opendir.h>
+#include <libexplain/pclose.h>
+#include <libexplain/pipe.h>
+#include <libexplain/popen.h>
+#include <libexplain/pread.h>
+#include <libexplain/putenv.h>
+#include <libexplain/puts.h>
+#include <libexplain/pwrite.h>
+#include <libexplain/raise.h>
+#include <libexplain/read.h>
+#include <libexplain/readlink.h>
+#include <libexplain/readv.h>
+#include <libexplain/rename.h>
+#include <libexplain/rmdir.h>
+#include <libexplain/select.h>
+#include <libexplain/setdomainname.h>
+#include <libexplain/setgroups.h>
+#include <libexplain/sethostname.h>
+#include <libexplain/setsockopt.h>
+#include <libexplain/signalfd.h>
+#include <libexplain/socket.h>
+#include <libexplain/stat.h>
+#include <libexplain/statfs.h>
+#include <libexplain/statvfs.h>
+#include <libexplain/symlink.h>
+#include <libexplain/system.h>
+#include <libexplain/tcdrain.h>
+#include <libexplain/tcflow.h>
+#include <libexplain/tcflush.h>
+#include <libexplain/tcgetattr.h>
+#include <libexplain/tcsendbreak.h>
+#include <libexplain/tcsetattr.h>
+#include <libexplain/telldir.h>
+#include <libexplain/timerfd_create.h>
+#include <libexplain/tmpfile.h>
+#include <libexplain/truncate.h>
+#include <libexplain/unlink.h>
+#include <libexplain/utime.h>
+#include <libexplain/wait.h>
+#include <libexplain/wait3.h>
+#include <libexplain/wait4.h>
+#include <libexplain/waitpid.h>
+#include <libexplain/write.h>
+#include <libexplain/writev.h>
+#include <libexplain/output.h>
+
+#include <libexplain_preload/preload.h>
+
+#if EXPLAIN_PRELOAD_SUPPORTED
+
+
+static int resolve_accept(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size);
+static int (*real_accept)(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size) =
+    resolve_accept;
+
+
+static int
+resolve_accept(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    *(void **)&real_accept = explain_preload_resolve("accept");
+    return real_accept(fildes, sock_addr, sock_addr_size);
+}
+
+
+int explain_preload_accept(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+    EXPLAIN_PRELOAD_SYMBOL("accept");
+
+int
+explain_preload_accept(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    int             result;
+
+    result = real_accept(fildes, sock_addr, sock_addr_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("accept", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_accept(message, sizeof(message), hold_errno,
+                fildes, sock_addr, sock_addr_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_acct(const char *pathname);
+static int (*real_acct)(const char *pathname) =
+    resolve_acct;
+
+
+static int
+resolve_acct(const char *pathname)
+{
+    *(void **)&real_acct = explain_preload_resolve("acct");
+    return real_acct(pathname);
+}
+
+
+int explain_preload_acct(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("acct");
+
+int
+explain_preload_acct(const char *pathname)
+{
+    int             result;
+
+    result = real_acct(pathname);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("acct", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_acct(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_adjtime(const struct timeval *delta,
+    struct timeval *olddelta);
+static int (*real_adjtime)(const struct timeval *delta,
+    struct timeval *olddelta) =
+    resolve_adjtime;
+
+
+static int
+resolve_adjtime(const struct timeval *delta, struct timeval *olddelta)
+{
+    *(void **)&real_adjtime = explain_preload_resolve("adjtime");
+    return real_adjtime(delta, olddelta);
+}
+
+
+int explain_preload_adjtime(const struct timeval *delta,
+    struct timeval *olddelta)
+    EXPLAIN_PRELOAD_SYMBOL("adjtime");
+
+int
+explain_preload_adjtime(const struct timeval *delta, struct timeval *olddelta)
+{
+    int             result;
+
+    result = real_adjtime(delta, olddelta);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("adjtime", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_adjtime(message, sizeof(message), hold_errno,
+                delta, olddelta);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_adjtimex(struct timex *data);
+static int (*real_adjtimex)(struct timex *data) =
+    resolve_adjtimex;
+
+
+static int
+resolve_adjtimex(struct timex *data)
+{
+    *(void **)&real_adjtimex = explain_preload_resolve("adjtimex");
+    return real_adjtimex(data);
+}
+
+
+int explain_preload_adjtimex(struct timex *data)
+    EXPLAIN_PRELOAD_SYMBOL("adjtimex");
+
+int
+explain_preload_adjtimex(struct timex *data)
+{
+    int             result;
+
+    result = real_adjtimex(data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("adjtimex", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_adjtimex(message, sizeof(message),
+                hold_errno, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_bind(int fildes, const struct sockaddr *sock_addr,
+    socklen_t sock_addr_size);
+static int (*real_bind)(int fildes, const struct sockaddr *sock_addr,
+    socklen_t sock_addr_size) =
+    resolve_bind;
+
+
+static int
+resolve_bind(int fildes, const struct sockaddr *sock_addr,
+    socklen_t sock_addr_size)
+{
+    *(void **)&real_bind = explain_preload_resolve("bind");
+    return real_bind(fildes, sock_addr, sock_addr_size);
+}
+
+
+int explain_preload_bind(int fildes, const struct sockaddr *sock_addr,
+    socklen_t sock_addr_size)
+    EXPLAIN_PRELOAD_SYMBOL("bind");
+
+int
+explain_preload_bind(int fildes, const struct sockaddr *sock_addr,
+    socklen_t sock_addr_size)
+{
+    int             result;
+
+    result = real_bind(fildes, sock_addr, sock_addr_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("bind", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_bind(message, sizeof(message), hold_errno,
+                fildes, sock_addr, sock_addr_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_chdir(const char *pathname);
+static int (*real_chdir)(const char *pathname) =
+    resolve_chdir;
+
+
+static int
+resolve_chdir(const char *pathname)
+{
+    *(void **)&real_chdir = explain_preload_resolve("chdir");
+    return real_chdir(pathname);
+}
+
+
+int explain_preload_chdir(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("chdir");
+
+int
+explain_preload_chdir(const char *pathname)
+{
+    int             result;
+
+    result = real_chdir(pathname);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("chdir", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_chdir(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_chmod(const char *pathname, int mode);
+static int (*real_chmod)(const char *pathname, int mode) =
+    resolve_chmod;
+
+
+static int
+resolve_chmod(const char *pathname, int mode)
+{
+    *(void **)&real_chmod = explain_preload_resolve("chmod");
+    return real_chmod(pathname, mode);
+}
+
+
+int explain_preload_chmod(const char *pathname, int mode)
+    EXPLAIN_PRELOAD_SYMBOL("chmod");
+
+int
+explain_preload_chmod(const char *pathname, int mode)
+{
+    int             result;
+
+    result = real_chmod(pathname, mode);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("chmod", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_chmod(message, sizeof(message), hold_errno,
+                pathname, mode);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_chown(const char *pathname, int owner, int group);
+static int (*real_chown)(const char *pathname, int owner, int group) =
+    resolve_chown;
+
+
+static int
+resolve_chown(const char *pathname, int owner, int group)
+{
+    *(void **)&real_chown = explain_preload_resolve("chown");
+    return real_chown(pathname, owner, group);
+}
+
+
+int explain_preload_chown(const char *pathname, int owner, int group)
+    EXPLAIN_PRELOAD_SYMBOL("chown");
+
+int
+explain_preload_chown(const char *pathname, int owner, int group)
+{
+    int             result;
+
+    result = real_chown(pathname, owner, group);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("chown", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_chown(message, sizeof(message), hold_errno,
+                pathname, owner, group);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_chroot(const char *pathname);
+static int (*real_chroot)(const char *pathname) =
+    resolve_chroot;
+
+
+static int
+resolve_chroot(const char *pathname)
+{
+    *(void **)&real_chroot = explain_preload_resolve("chroot");
+    return real_chroot(pathname);
+}
+
+
+int explain_preload_chroot(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("chroot");
+
+int
+explain_preload_chroot(const char *pathname)
+{
+    int             result;
+
+    result = real_chroot(pathname);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("chroot", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_chroot(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_close(int fildes);
+static int (*real_close)(int fildes) =
+    resolve_close;
+
+
+static int
+resolve_close(int fildes)
+{
+    *(void **)&real_close = explain_preload_resolve("close");
+    return real_close(fildes);
+}
+
+
+int explain_preload_close(int fildes)
+    EXPLAIN_PRELOAD_SYMBOL("close");
+
+int
+explain_preload_close(int fildes)
+{
+    int             result;
+
+    result = real_close(fildes);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("close", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_close(message, sizeof(message), hold_errno,
+                fildes);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_connect(int fildes, const struct sockaddr *serv_addr,
+    int serv_addr_size);
+static int (*real_connect)(int fildes, const struct sockaddr *serv_addr,
+    int serv_addr_size) =
+    resolve_connect;
+
+
+static int
+resolve_connect(int fildes, const struct sockaddr *serv_addr,
+    int serv_addr_size)
+{
+    *(void **)&real_connect = explain_preload_resolve("connect");
+    return real_connect(fildes, serv_addr, serv_addr_size);
+}
+
+
+int explain_preload_connect(int fildes, const struct sockaddr *serv_addr,
+    int serv_addr_size)
+    EXPLAIN_PRELOAD_SYMBOL("connect");
+
+int
+explain_preload_connect(int fildes, const struct sockaddr *serv_addr,
+    int serv_addr_size)
+{
+    int             result;
+
+    result = real_connect(fildes, serv_addr, serv_addr_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("connect", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_connect(message, sizeof(message), hold_errno,
+                fildes, serv_addr, serv_addr_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_creat(const char *pathname, int mode);
+static int (*real_creat)(const char *pathname, int mode) =
+    resolve_creat;
+
+
+static int
+resolve_creat(const char *pathname, int mode)
+{
+    *(void **)&real_creat = explain_preload_resolve("creat");
+    return real_creat(pathname, mode);
+}
+
+
+int explain_preload_creat(const char *pathname, int mode)
+    EXPLAIN_PRELOAD_SYMBOL("creat");
+
+int
+explain_preload_creat(const char *pathname, int mode)
+{
+    int             result;
+
+    result = real_creat(pathname, mode);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("creat", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_creat(message, sizeof(message), hold_errno,
+                pathname, mode);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+int explain_preload_creat64(const char *pathname, int mode)
+    EXPLAIN_PRELOAD_ALIAS("creat64", "creat");
+
+#endif
+
+
+static int resolve_dup(int fildes);
+static int (*real_dup)(int fildes) =
+    resolve_dup;
+
+
+static int
+resolve_dup(int fildes)
+{
+    *(void **)&real_dup = explain_preload_resolve("dup");
+    return real_dup(fildes);
+}
+
+
+int explain_preload_dup(int fildes)
+    EXPLAIN_PRELOAD_SYMBOL("dup");
+
+int
+explain_preload_dup(int fildes)
+{
+    int             result;
+
+    result = real_dup(fildes);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("dup", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_dup(message, sizeof(message), hold_errno,
+                fildes);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_dup2(int oldfd, int newfd);
+static int (*real_dup2)(int oldfd, int newfd) =
+    resolve_dup2;
+
+
+static int
+resolve_dup2(int oldfd, int newfd)
+{
+    *(void **)&real_dup2 = explain_preload_resolve("dup2");
+    return real_dup2(oldfd, newfd);
+}
+
+
+int explain_preload_dup2(int oldfd, int newfd)
+    EXPLAIN_PRELOAD_SYMBOL("dup2");
+
+int
+explain_preload_dup2(int oldfd, int newfd)
+{
+    int             result;
+
+    result = real_dup2(oldfd, newfd);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("dup2", hold_errno, oldfd))
+        {
+            char            message[3000];
+
+            explain_message_errno_dup2(message, sizeof(message), hold_errno,
+                oldfd, newfd);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_eventfd(unsigned initval, int flags);
+static int (*real_eventfd)(unsigned initval, int flags) =
+    resolve_eventfd;
+
+
+static int
+resolve_eventfd(unsigned initval, int flags)
+{
+    *(void **)&real_eventfd = explain_preload_resolve("eventfd");
+    return real_eventfd(initval, flags);
+}
+
+
+int explain_preload_eventfd(unsigned initval, int flags)
+    EXPLAIN_PRELOAD_SYMBOL("eventfd");
+
+int
+explain_preload_eventfd(unsigned initval, int flags)
+{
+    int             result;
+
+    result = real_eventfd(initval, flags);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("eventfd", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_eventfd(message, sizeof(message), hold_errno,
+                initval, flags);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_execve(const char *pathname, char *const *argv,
+    char *const *envp);
+static int (*real_execve)(const char *pathname, char *const *argv,
+    char *const *envp) =
+    resolve_execve;
+
+
+static int
+resolve_execve(const char *pathname, char *const *argv, char *const *envp)
+{
+    *(void **)&real_execve = explain_preload_resolve("execve");
+    return real_execve(pathname, argv, envp);
+}
+
+
+int explain_preload_execve(const char *pathname, char *const *argv,
+    char *const *envp)
+    EXPLAIN_PRELOAD_SYMBOL("execve");
+
+int
+explain_preload_execve(const char *pathname, char *const *argv,
+    char *const *envp)
+{
+    int             result;
+
+    result = real_execve(pathname, argv, envp);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("execve", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_execve(message, sizeof(message), hold_errno,
+                pathname, argv, envp);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_execvp(const char *pathname, char *const *argv);
+static int (*real_execvp)(const char *pathname, char *const *argv) =
+    resolve_execvp;
+
+
+static int
+resolve_execvp(const char *pathname, char *const *argv)
+{
+    *(void **)&real_execvp = explain_preload_resolve("execvp");
+    return real_execvp(pathname, argv);
+}
+
+
+int explain_preload_execvp(const char *pathname, char *const *argv)
+    EXPLAIN_PRELOAD_SYMBOL("execvp");
+
+int
+explain_preload_execvp(const char *pathname, char *const *argv)
+{
+    int             result;
+
+    result = real_execvp(pathname, argv);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("execvp", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_execvp(message, sizeof(message), hold_errno,
+                pathname, argv);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_fchdir(int fildes);
+static int (*real_fchdir)(int fildes) =
+    resolve_fchdir;
+
+
+static int
+resolve_fchdir(int fildes)
+{
+    *(void **)&real_fchdir = explain_preload_resolve("fchdir");
+    return real_fchdir(fildes);
+}
+
+
+int explain_preload_fchdir(int fildes)
+    EXPLAIN_PRELOAD_SYMBOL("fchdir");
+
+int
+explain_preload_fchdir(int fildes)
+{
+    int             result;
+
+    result = real_fchdir(fildes);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fchdir", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fchdir(message, sizeof(message), hold_errno,
+                fildes);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_fchown(int fildes, int owner, int group);
+static int (*real_fchown)(int fildes, int owner, int group) =
+    resolve_fchown;
+
+
+static int
+resolve_fchown(int fildes, int owner, int group)
+{
+    *(void **)&real_fchown = explain_preload_resolve("fchown");
+    return real_fchown(fildes, owner, group);
+}
+
+
+int explain_preload_fchown(int fildes, int owner, int group)
+    EXPLAIN_PRELOAD_SYMBOL("fchown");
+
+int
+explain_preload_fchown(int fildes, int owner, int group)
+{
+    int             result;
+
+    result = real_fchown(fildes, owner, group);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fchown", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fchown(message, sizeof(message), hold_errno,
+                fildes, owner, group);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_fcntl(int fildes, int command, ...);
+static int (*real_fcntl)(int fildes, int command, ...) =
+    resolve_fcntl;
+
+
+static int
+resolve_fcntl(int fildes, int command, ...)
+{
+    long            data;
+    va_list         ap;
+
+    va_start(ap, command);
+    data = va_arg(ap, long);
+    va_end(ap);
+    *(void **)&real_fcntl = explain_preload_resolve("fcntl");
+    return real_fcntl(fildes, command, data);
+}
+
+
+int explain_preload_fcntl(int fildes, int command, ...)
+    EXPLAIN_PRELOAD_SYMBOL("fcntl");
+
+int
+explain_preload_fcntl(int fildes, int command, ...)
+{
+    long            data;
+    va_list         ap;
+    int             result;
+
+    va_start(ap, command);
+    data = va_arg(ap, long);
+    va_end(ap);
+    result = real_fcntl(fildes, command, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fcntl", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fcntl(message, sizeof(message), hold_errno,
+                fildes, command, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+int explain_preload_fcntl64(int fildes, int command, ...)
+    EXPLAIN_PRELOAD_ALIAS("fcntl64", "fcntl");
+
+#endif
+
+
+static int resolve_flock(int fildes, int command);
+static int (*real_flock)(int fildes, int command) =
+    resolve_flock;
+
+
+static int
+resolve_flock(int fildes, int command)
+{
+    *(void **)&real_flock = explain_preload_resolve("flock");
+    return real_flock(fildes, command);
+}
+
+
+int explain_preload_flock(int fildes, int command)
+    EXPLAIN_PRELOAD_SYMBOL("flock");
+
+int
+explain_preload_flock(int fildes, int command)
+{
+    int             result;
+
+    result = real_flock(fildes, command);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("flock", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_flock(message, sizeof(message), hold_errno,
+                fildes, command);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_fork(void);
+static int (*real_fork)(void) =
+    resolve_fork;
+
+
+static int
+resolve_fork(void)
+{
+    *(void **)&real_fork = explain_preload_resolve("fork");
+    return real_fork();
+}
+
+
+int explain_preload_fork(void)
+    EXPLAIN_PRELOAD_SYMBOL("fork");
+
+int
+explain_preload_fork(void)
+{
+    int             result;
+
+    result = real_fork();
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fork", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_fork(message, sizeof(message), hold_errno);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_fputs(const char *s, FILE *fp);
+static int (*real_fputs)(const char *s, FILE *fp) =
+    resolve_fputs;
+
+
+static int
+resolve_fputs(const char *s, FILE *fp)
+{
+    *(void **)&real_fputs = explain_preload_resolve("fputs");
+    return real_fputs(s, fp);
+}
+
+
+int explain_preload_fputs(const char *s, FILE *fp)
+    EXPLAIN_PRELOAD_SYMBOL("fputs");
+
+int
+explain_preload_fputs(const char *s, FILE *fp)
+{
+    int             result;
+
+    result = real_fputs(s, fp);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fputs", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_fputs(message, sizeof(message), hold_errno,
+                s, fp);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_fstat(int fildes, struct stat *data);
+static int (*real_fstat)(int fildes, struct stat *data) =
+    resolve_fstat;
+
+
+static int
+resolve_fstat(int fildes, struct stat *data)
+{
+    *(void **)&real_fstat = explain_preload_resolve("fstat");
+    return real_fstat(fildes, data);
+}
+
+
+int explain_preload_fstat(int fildes, struct stat *data)
+    EXPLAIN_PRELOAD_SYMBOL("fstat");
+
+int
+explain_preload_fstat(int fildes, struct stat *data)
+{
+    int             result;
+
+    result = real_fstat(fildes, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fstat", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fstat(message, sizeof(message), hold_errno,
+                fildes, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_fstat64(int fildes, struct stat *data)
+    EXPLAIN_PRELOAD_ALIAS("fstat64", "fstat");
+
+#endif
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_fstatfs(int fildes, struct statfs *data);
+static int (*real_fstatfs)(int fildes, struct statfs *data) =
+    resolve_fstatfs;
+
+
+static int
+resolve_fstatfs(int fildes, struct statfs *data)
+{
+    *(void **)&real_fstatfs = explain_preload_resolve("fstatfs");
+    return real_fstatfs(fildes, data);
+}
+
+
+int explain_preload_fstatfs(int fildes, struct statfs *data)
+    EXPLAIN_PRELOAD_SYMBOL("fstatfs");
+
+int
+explain_preload_fstatfs(int fildes, struct statfs *data)
+{
+    int             result;
+
+    result = real_fstatfs(fildes, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fstatfs", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fstatfs(message, sizeof(message), hold_errno,
+                fildes, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_fstatfs64(int fildes, struct statfs *data)
+    EXPLAIN_PRELOAD_ALIAS("fstatfs64", "fstatfs");
+
+#endif
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_fstatvfs(int fildes, struct statvfs *data);
+static int (*real_fstatvfs)(int fildes, struct statvfs *data) =
+    resolve_fstatvfs;
+
+
+static int
+resolve_fstatvfs(int fildes, struct statvfs *data)
+{
+    *(void **)&real_fstatvfs = explain_preload_resolve("fstatvfs");
+    return real_fstatvfs(fildes, data);
+}
+
+
+int explain_preload_fstatvfs(int fildes, struct statvfs *data)
+    EXPLAIN_PRELOAD_SYMBOL("fstatvfs");
+
+int
+explain_preload_fstatvfs(int fildes, struct statvfs *data)
+{
+    int             result;
+
+    result = real_fstatvfs(fildes, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fstatvfs", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fstatvfs(message, sizeof(message),
+                hold_errno, fildes, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_fstatvfs64(int fildes, struct statvfs *data)
+    EXPLAIN_PRELOAD_ALIAS("fstatvfs64", "fstatvfs");
+
+#endif
+
+
+static int resolve_fsync(int fildes);
+static int (*real_fsync)(int fildes) =
+    resolve_fsync;
+
+
+static int
+resolve_fsync(int fildes)
+{
+    *(void **)&real_fsync = explain_preload_resolve("fsync");
+    return real_fsync(fildes);
+}
+
+
+int explain_preload_fsync(int fildes)
+    EXPLAIN_PRELOAD_SYMBOL("fsync");
+
+int
+explain_preload_fsync(int fildes)
+{
+    int             result;
+
+    result = real_fsync(fildes);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("fsync", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_fsync(message, sizeof(message), hold_errno,
+                fildes);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_ftruncate(int fildes, off_t length);
+static int (*real_ftruncate)(int fildes, off_t length) =
+    resolve_ftruncate;
+
+
+static int
+resolve_ftruncate(int fildes, off_t length)
+{
+    *(void **)&real_ftruncate = explain_preload_resolve("ftruncate");
+    return real_ftruncate(fildes, length);
+}
+
+
+int explain_preload_ftruncate(int fildes, off_t length)
+    EXPLAIN_PRELOAD_SYMBOL("ftruncate");
+
+int
+explain_preload_ftruncate(int fildes, off_t length)
+{
+    int             result;
+
+    result = real_ftruncate(fildes, length);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("ftruncate", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_ftruncate(message, sizeof(message),
+                hold_errno, fildes, length);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_ftruncate64(int fildes, off_t length)
+    EXPLAIN_PRELOAD_ALIAS("ftruncate64", "ftruncate");
+
+#endif
+
+
+static int resolve_getpeername(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size);
+static int (*real_getpeername)(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size) =
+    resolve_getpeername;
+
+
+static int
+resolve_getpeername(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    *(void **)&real_getpeername = explain_preload_resolve("getpeername");
+    return real_getpeername(fildes, sock_addr, sock_addr_size);
+}
+
+
+int explain_preload_getpeername(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+    EXPLAIN_PRELOAD_SYMBOL("getpeername");
+
+int
+explain_preload_getpeername(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    int             result;
+
+    result = real_getpeername(fildes, sock_addr, sock_addr_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("getpeername", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_getpeername(message, sizeof(message),
+                hold_errno, fildes, sock_addr, sock_addr_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_getrlimit(int resource, struct rlimit *rlim);
+static int (*real_getrlimit)(int resource, struct rlimit *rlim) =
+    resolve_getrlimit;
+
+
+static int
+resolve_getrlimit(int resource, struct rlimit *rlim)
+{
+    *(void **)&real_getrlimit = explain_preload_resolve("getrlimit");
+    return real_getrlimit(resource, rlim);
+}
+
+
+int explain_preload_getrlimit(int resource, struct rlimit *rlim)
+    EXPLAIN_PRELOAD_SYMBOL("getrlimit");
+
+int
+explain_preload_getrlimit(int resource, struct rlimit *rlim)
+{
+    int             result;
+
+    result = real_getrlimit(resource, rlim);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("getrlimit", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_getrlimit(message, sizeof(message),
+                hold_errno, resource, rlim);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_getsockname(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size);
+static int (*real_getsockname)(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size) =
+    resolve_getsockname;
+
+
+static int
+resolve_getsockname(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    *(void **)&real_getsockname = explain_preload_resolve("getsockname");
+    return real_getsockname(fildes, sock_addr, sock_addr_size);
+}
+
+
+int explain_preload_getsockname(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+    EXPLAIN_PRELOAD_SYMBOL("getsockname");
+
+int
+explain_preload_getsockname(int fildes, struct sockaddr *sock_addr,
+    socklen_t *sock_addr_size)
+{
+    int             result;
+
+    result = real_getsockname(fildes, sock_addr, sock_addr_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("getsockname", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_getsockname(message, sizeof(message),
+                hold_errno, fildes, sock_addr, sock_addr_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_getsockopt(int fildes, int level, int name, void *data,
+    socklen_t *data_size);
+static int (*real_getsockopt)(int fildes, int level, int name, void *data,
+    socklen_t *data_size) =
+    resolve_getsockopt;
+
+
+static int
+resolve_getsockopt(int fildes, int level, int name, void *data,
+    socklen_t *data_size)
+{
+    *(void **)&real_getsockopt = explain_preload_resolve("getsockopt");
+    return real_getsockopt(fildes, level, name, data, data_size);
+}
+
+
+int explain_preload_getsockopt(int fildes, int level, int name, void *data,
+    socklen_t *data_size)
+    EXPLAIN_PRELOAD_SYMBOL("getsockopt");
+
+int
+explain_preload_getsockopt(int fildes, int level, int name, void *data,
+    socklen_t *data_size)
+{
+    int             result;
+
+    result = real_getsockopt(fildes, level, name, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("getsockopt", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_getsockopt(message, sizeof(message),
+                hold_errno, fildes, level, name, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_gettimeofday(struct timeval *tv, struct timezone *tz);
+static int (*real_gettimeofday)(struct timeval *tv, struct timezone *tz) =
+    resolve_gettimeofday;
+
+
+static int
+resolve_gettimeofday(struct timeval *tv, struct timezone *tz)
+{
+    *(void **)&real_gettimeofday = explain_preload_resolve("gettimeofday");
+    return real_gettimeofday(tv, tz);
+}
+
+
+int explain_preload_gettimeofday(struct timeval *tv, struct timezone *tz)
+    EXPLAIN_PRELOAD_SYMBOL("gettimeofday");
+
+int
+explain_preload_gettimeofday(struct timeval *tv, struct timezone *tz)
+{
+    int             result;
+
+    result = real_gettimeofday(tv, tz);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("gettimeofday", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_gettimeofday(message, sizeof(message),
+                hold_errno, tv, tz);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_kill(pid_t pid, int sig);
+static int (*real_kill)(pid_t pid, int sig) =
+    resolve_kill;
+
+
+static int
+resolve_kill(pid_t pid, int sig)
+{
+    *(void **)&real_kill = explain_preload_resolve("kill");
+    return real_kill(pid, sig);
+}
+
+
+int explain_preload_kill(pid_t pid, int sig)
+    EXPLAIN_PRELOAD_SYMBOL("kill");
+
+int
+explain_preload_kill(pid_t pid, int sig)
+{
+    int             result;
+
+    result = real_kill(pid, sig);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("kill", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_kill(message, sizeof(message), hold_errno,
+                pid, sig);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_lchown(const char *pathname, int owner, int group);
+static int (*real_lchown)(const char *pathname, int owner, int group) =
+    resolve_lchown;
+
+
+static int
+resolve_lchown(const char *pathname, int owner, int group)
+{
+    *(void **)&real_lchown = explain_preload_resolve("lchown");
+    return real_lchown(pathname, owner, group);
+}
+
+
+int explain_preload_lchown(const char *pathname, int owner, int group)
+    EXPLAIN_PRELOAD_SYMBOL("lchown");
+
+int
+explain_preload_lchown(const char *pathname, int owner, int group)
+{
+    int             result;
+
+    result = real_lchown(pathname, owner, group);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("lchown", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_lchown(message, sizeof(message), hold_errno,
+                pathname, owner, group);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_link(const char *oldpath, const char *newpath);
+static int (*real_link)(const char *oldpath, const char *newpath) =
+    resolve_link;
+
+
+static int
+resolve_link(const char *oldpath, const char *newpath)
+{
+    *(void **)&real_link = explain_preload_resolve("link");
+    return real_link(oldpath, newpath);
+}
+
+
+int explain_preload_link(const char *oldpath, const char *newpath)
+    EXPLAIN_PRELOAD_SYMBOL("link");
+
+int
+explain_preload_link(const char *oldpath, const char *newpath)
+{
+    int             result;
+
+    result = real_link(oldpath, newpath);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("link", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_link(message, sizeof(message), hold_errno,
+                oldpath, newpath);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_listen(int fildes, int backlog);
+static int (*real_listen)(int fildes, int backlog) =
+    resolve_listen;
+
+
+static int
+resolve_listen(int fildes, int backlog)
+{
+    *(void **)&real_listen = explain_preload_resolve("listen");
+    return real_listen(fildes, backlog);
+}
+
+
+int explain_preload_listen(int fildes, int backlog)
+    EXPLAIN_PRELOAD_SYMBOL("listen");
+
+int
+explain_preload_listen(int fildes, int backlog)
+{
+    int             result;
+
+    result = real_listen(fildes, backlog);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("listen", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_listen(message, sizeof(message), hold_errno,
+                fildes, backlog);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_lstat(const char *pathname, struct stat *data);
+static int (*real_lstat)(const char *pathname, struct stat *data) =
+    resolve_lstat;
+
+
+static int
+resolve_lstat(const char *pathname, struct stat *data)
+{
+    *(void **)&real_lstat = explain_preload_resolve("lstat");
+    return real_lstat(pathname, data);
+}
+
+
+int explain_preload_lstat(const char *pathname, struct stat *data)
+    EXPLAIN_PRELOAD_SYMBOL("lstat");
+
+int
+explain_preload_lstat(const char *pathname, struct stat *data)
+{
+    int             result;
+
+    result = real_lstat(pathname, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("lstat", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_lstat(message, sizeof(message), hold_errno,
+                pathname, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_lstat64(const char *pathname, struct stat *data)
+    EXPLAIN_PRELOAD_ALIAS("lstat64", "lstat");
+
+#endif
+
+
+static int resolve_mkdir(const char *pathname, int mode);
+static int (*real_mkdir)(const char *pathname, int mode) =
+    resolve_mkdir;
+
+
+static int
+resolve_mkdir(const char *pathname, int mode)
+{
+    *(void **)&real_mkdir = explain_preload_resolve("mkdir");
+    return real_mkdir(pathname, mode);
+}
+
+
+int explain_preload_mkdir(const char *pathname, int mode)
+    EXPLAIN_PRELOAD_SYMBOL("mkdir");
+
+int
+explain_preload_mkdir(const char *pathname, int mode)
+{
+    int             result;
+
+    result = real_mkdir(pathname, mode);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("mkdir", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_mkdir(message, sizeof(message), hold_errno,
+                pathname, mode);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_mknod(const char *pathname, mode_t mode, dev_t dev);
+static int (*real_mknod)(const char *pathname, mode_t mode, dev_t dev) =
+    resolve_mknod;
+
+
+static int
+resolve_mknod(const char *pathname, mode_t mode, dev_t dev)
+{
+    *(void **)&real_mknod = explain_preload_resolve("mknod");
+    return real_mknod(pathname, mode, dev);
+}
+
+
+int explain_preload_mknod(const char *pathname, mode_t mode, dev_t dev)
+    EXPLAIN_PRELOAD_SYMBOL("mknod");
+
+int
+explain_preload_mknod(const char *pathname, mode_t mode, dev_t dev)
+{
+    int             result;
+
+    result = real_mknod(pathname, mode, dev);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("mknod", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_mknod(message, sizeof(message), hold_errno,
+                pathname, mode, dev);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_mkostemp(char *templat, int flags);
+static int (*real_mkostemp)(char *templat, int flags) =
+    resolve_mkostemp;
+
+
+static int
+resolve_mkostemp(char *templat, int flags)
+{
+    *(void **)&real_mkostemp = explain_preload_resolve("mkostemp");
+    return real_mkostemp(templat, flags);
+}
+
+
+int explain_preload_mkostemp(char *templat, int flags)
+    EXPLAIN_PRELOAD_SYMBOL("mkostemp");
+
+int
+explain_preload_mkostemp(char *templat, int flags)
+{
+    int             result;
+
+    result = real_mkostemp(templat, flags);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("mkostemp", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_mkostemp(message, sizeof(message),
+                hold_errno, templat, flags);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+int explain_preload_mkostemp64(char *templat, int flags)
+    EXPLAIN_PRELOAD_ALIAS("mkostemp64", "mkostemp");
+
+#endif
+
+
+static int resolve_mkstemp(char *templat);
+static int (*real_mkstemp)(char *templat) =
+    resolve_mkstemp;
+
+
+static int
+resolve_mkstemp(char *templat)
+{
+    *(void **)&real_mkstemp = explain_preload_resolve("mkstemp");
+    return real_mkstemp(templat);
+}
+
+
+int explain_preload_mkstemp(char *templat)
+    EXPLAIN_PRELOAD_SYMBOL("mkstemp");
+
+int
+explain_preload_mkstemp(char *templat)
+{
+    int             result;
+
+    result = real_mkstemp(templat);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("mkstemp", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_mkstemp(message, sizeof(message), hold_errno,
+                templat);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+int explain_preload_mkstemp64(char *templat)
+    EXPLAIN_PRELOAD_ALIAS("mkstemp64", "mkstemp");
+
+#endif
+
+
+static int resolve_nice(int inc);
+static int (*real_nice)(int inc) =
+    resolve_nice;
+
+
+static int
+resolve_nice(int inc)
+{
+    *(void **)&real_nice = explain_preload_resolve("nice");
+    return real_nice(inc);
+}
+
+
+int explain_preload_nice(int inc)
+    EXPLAIN_PRELOAD_SYMBOL("nice");
+
+int
+explain_preload_nice(int inc)
+{
+    int             result;
+
+    result = real_nice(inc);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("nice", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_nice(message, sizeof(message), hold_errno,
+                inc);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_open(const char *pathname, int flags, ...);
+static int (*real_open)(const char *pathname, int flags, ...) =
+    resolve_open;
+
+
+static int
+resolve_open(const char *pathname, int flags, ...)
+{
+    int             mode;
+    va_list         ap;
+
+    va_start(ap, flags);
+    mode = va_arg(ap, int);
+    va_end(ap);
+    *(void **)&real_open = explain_preload_resolve("open");
+    return real_open(pathname, flags, mode);
+}
+
+
+int explain_preload_open(const char *pathname, int flags, ...)
+    EXPLAIN_PRELOAD_SYMBOL("open");
+
+int
+explain_preload_open(const char *pathname, int flags, ...)
+{
+    int             mode;
+    va_list         ap;
+    int             result;
+
+    va_start(ap, flags);
+    mode = va_arg(ap, int);
+    va_end(ap);
+    result = real_open(pathname, flags, mode);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("open", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_open(message, sizeof(message), hold_errno,
+                pathname, flags, mode);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+int explain_preload_open64(const char *pathname, int flags, ...)
+    EXPLAIN_PRELOAD_ALIAS("open64", "open");
+
+#endif
+
+
+static DIR *resolve_opendir(const char *pathname);
+static DIR *(*real_opendir)(const char *pathname) =
+    resolve_opendir;
+
+
+static DIR *
+resolve_opendir(const char *pathname)
+{
+    *(void **)&real_opendir = explain_preload_resolve("opendir");
+    return real_opendir(pathname);
+}
+
+
+DIR *explain_preload_opendir(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("opendir");
+
+DIR *
+explain_preload_opendir(const char *pathname)
+{
+    DIR             *result;
+
+    result = real_opendir(pathname);
+    if (!result)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("opendir", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_opendir(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_pclose(FILE *fp);
+static int (*real_pclose)(FILE *fp) =
+    resolve_pclose;
+
+
+static int
+resolve_pclose(FILE *fp)
+{
+    *(void **)&real_pclose = explain_preload_resolve("pclose");
+    return real_pclose(fp);
+}
+
+
+int explain_preload_pclose(FILE *fp)
+    EXPLAIN_PRELOAD_SYMBOL("pclose");
+
+int
+explain_preload_pclose(FILE *fp)
+{
+    int             result;
+
+    result = real_pclose(fp);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("pclose", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_pclose(message, sizeof(message), hold_errno,
+                fp);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_pipe(int *pipefd);
+static int (*real_pipe)(int *pipefd) =
+    resolve_pipe;
+
+
+static int
+resolve_pipe(int *pipefd)
+{
+    *(void **)&real_pipe = explain_preload_resolve("pipe");
+    return real_pipe(pipefd);
+}
+
+
+int explain_preload_pipe(int *pipefd)
+    EXPLAIN_PRELOAD_SYMBOL("pipe");
+
+int
+explain_preload_pipe(int *pipefd)
+{
+    int             result;
+
+    result = real_pipe(pipefd);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("pipe", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_pipe(message, sizeof(message), hold_errno,
+                pipefd);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static FILE *resolve_popen(const char *command, const char *flags);
+static FILE *(*real_popen)(const char *command, const char *flags) =
+    resolve_popen;
+
+
+static FILE *
+resolve_popen(const char *command, const char *flags)
+{
+    *(void **)&real_popen = explain_preload_resolve("popen");
+    return real_popen(command, flags);
+}
+
+
+FILE *explain_preload_popen(const char *command, const char *flags)
+    EXPLAIN_PRELOAD_SYMBOL("popen");
+
+FILE *
+explain_preload_popen(const char *command, const char *flags)
+{
+    FILE            *result;
+
+    result = real_popen(command, flags);
+    if (!result)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("popen", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_popen(message, sizeof(message), hold_errno,
+                command, flags);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static ssize_t resolve_pread(int fildes, void *data, size_t data_size,
+    off_t offset);
+static ssize_t (*real_pread)(int fildes, void *data, size_t data_size,
+    off_t offset) =
+    resolve_pread;
+
+
+static ssize_t
+resolve_pread(int fildes, void *data, size_t data_size, off_t offset)
+{
+    *(void **)&real_pread = explain_preload_resolve("pread");
+    return real_pread(fildes, data, data_size, offset);
+}
+
+
+ssize_t explain_preload_pread(int fildes, void *data, size_t data_size,
+    off_t offset)
+    EXPLAIN_PRELOAD_SYMBOL("pread");
+
+ssize_t
+explain_preload_pread(int fildes, void *data, size_t data_size, off_t offset)
+{
+    ssize_t         result;
+
+    result = real_pread(fildes, data, data_size, offset);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("pread", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_pread(message, sizeof(message), hold_errno,
+                fildes, data, data_size, offset);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+ssize_t explain_preload_pread64(int fildes, void *data, size_t data_size,
+    off_t offset)
+    EXPLAIN_PRELOAD_ALIAS("pread64", "pread");
+
+#endif
+
+
+static int resolve_putenv(char *string);
+static int (*real_putenv)(char *string) =
+    resolve_putenv;
+
+
+static int
+resolve_putenv(char *string)
+{
+    *(void **)&real_putenv = explain_preload_resolve("putenv");
+    return real_putenv(string);
+}
+
+
+int explain_preload_putenv(char *string)
+    EXPLAIN_PRELOAD_SYMBOL("putenv");
+
+int
+explain_preload_putenv(char *string)
+{
+    int             result;
+
+    result = real_putenv(string);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("putenv", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_putenv(message, sizeof(message), hold_errno,
+                string);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_puts(const char *s);
+static int (*real_puts)(const char *s) =
+    resolve_puts;
+
+
+static int
+resolve_puts(const char *s)
+{
+    *(void **)&real_puts = explain_preload_resolve("puts");
+    return real_puts(s);
+}
+
+
+int explain_preload_puts(const char *s)
+    EXPLAIN_PRELOAD_SYMBOL("puts");
+
+int
+explain_preload_puts(const char *s)
+{
+    int             result;
+
+    result = real_puts(s);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("puts", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_puts(message, sizeof(message), hold_errno,
+                s);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static ssize_t resolve_pwrite(int fildes, const void *data, size_t data_size,
+    off_t offset);
+static ssize_t (*real_pwrite)(int fildes, const void *data, size_t data_size,
+    off_t offset) =
+    resolve_pwrite;
+
+
+static ssize_t
+resolve_pwrite(int fildes, const void *data, size_t data_size, off_t offset)
+{
+    *(void **)&real_pwrite = explain_preload_resolve("pwrite");
+    return real_pwrite(fildes, data, data_size, offset);
+}
+
+
+ssize_t explain_preload_pwrite(int fildes, const void *data, size_t data_size,
+    off_t offset)
+    EXPLAIN_PRELOAD_SYMBOL("pwrite");
+
+ssize_t
+explain_preload_pwrite(int fildes, const void *data, size_t data_size,
+    off_t offset)
+{
+    ssize_t         result;
+
+    result = real_pwrite(fildes, data, data_size, offset);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("pwrite", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_pwrite(message, sizeof(message), hold_errno,
+                fildes, data, data_size, offset);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+ssize_t explain_preload_pwrite64(int fildes, const void *data,
+    size_t data_size, off_t offset)
+    EXPLAIN_PRELOAD_ALIAS("pwrite64", "pwrite");
+
+#endif
+
+
+static int resolve_raise(int sig);
+static int (*real_raise)(int sig) =
+    resolve_raise;
+
+
+static int
+resolve_raise(int sig)
+{
+    *(void **)&real_raise = explain_preload_resolve("raise");
+    return real_raise(sig);
+}
+
+
+int explain_preload_raise(int sig)
+    EXPLAIN_PRELOAD_SYMBOL("raise");
+
+int
+explain_preload_raise(int sig)
+{
+    int             result;
+
+    result = real_raise(sig);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("raise", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_raise(message, sizeof(message), hold_errno,
+                sig);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static ssize_t resolve_read(int fildes, void *data, size_t data_size);
+static ssize_t (*real_read)(int fildes, void *data, size_t data_size) =
+    resolve_read;
+
+
+static ssize_t
+resolve_read(int fildes, void *data, size_t data_size)
+{
+    *(void **)&real_read = explain_preload_resolve("read");
+    return real_read(fildes, data, data_size);
+}
+
+
+ssize_t explain_preload_read(int fildes, void *data, size_t data_size)
+    EXPLAIN_PRELOAD_SYMBOL("read");
+
+ssize_t
+explain_preload_read(int fildes, void *data, size_t data_size)
+{
+    ssize_t         result;
+
+    result = real_read(fildes, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("read", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_read(message, sizeof(message), hold_errno,
+                fildes, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static ssize_t resolve_readlink(const char *pathname, char *data,
+    size_t data_size);
+static ssize_t (*real_readlink)(const char *pathname, char *data,
+    size_t data_size) =
+    resolve_readlink;
+
+
+static ssize_t
+resolve_readlink(const char *pathname, char *data, size_t data_size)
+{
+    *(void **)&real_readlink = explain_preload_resolve("readlink");
+    return real_readlink(pathname, data, data_size);
+}
+
+
+ssize_t explain_preload_readlink(const char *pathname, char *data,
+    size_t data_size)
+    EXPLAIN_PRELOAD_SYMBOL("readlink");
+
+ssize_t
+explain_preload_readlink(const char *pathname, char *data, size_t data_size)
+{
+    ssize_t         result;
+
+    result = real_readlink(pathname, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("readlink", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_readlink(message, sizeof(message),
+                hold_errno, pathname, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static ssize_t resolve_readv(int fildes, const struct iovec *data,
+    int data_size);
+static ssize_t (*real_readv)(int fildes, const struct iovec *data,
+    int data_size) =
+    resolve_readv;
+
+
+static ssize_t
+resolve_readv(int fildes, const struct iovec *data, int data_size)
+{
+    *(void **)&real_readv = explain_preload_resolve("readv");
+    return real_readv(fildes, data, data_size);
+}
+
+
+ssize_t explain_preload_readv(int fildes, const struct iovec *data,
+    int data_size)
+    EXPLAIN_PRELOAD_SYMBOL("readv");
+
+ssize_t
+explain_preload_readv(int fildes, const struct iovec *data, int data_size)
+{
+    ssize_t         result;
+
+    result = real_readv(fildes, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("readv", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_readv(message, sizeof(message), hold_errno,
+                fildes, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_rename(const char *oldpath, const char *newpath);
+static int (*real_rename)(const char *oldpath, const char *newpath) =
+    resolve_rename;
+
+
+static int
+resolve_rename(const char *oldpath, const char *newpath)
+{
+    *(void **)&real_rename = explain_preload_resolve("rename");
+    return real_rename(oldpath, newpath);
+}
+
+
+int explain_preload_rename(const char *oldpath, const char *newpath)
+    EXPLAIN_PRELOAD_SYMBOL("rename");
+
+int
+explain_preload_rename(const char *oldpath, const char *newpath)
+{
+    int             result;
+
+    result = real_rename(oldpath, newpath);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("rename", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_rename(message, sizeof(message), hold_errno,
+                oldpath, newpath);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_rmdir(const char *pathname);
+static int (*real_rmdir)(const char *pathname) =
+    resolve_rmdir;
+
+
+static int
+resolve_rmdir(const char *pathname)
+{
+    *(void **)&real_rmdir = explain_preload_resolve("rmdir");
+    return real_rmdir(pathname);
+}
+
+
+int explain_preload_rmdir(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("rmdir");
+
+int
+explain_preload_rmdir(const char *pathname)
+{
+    int             result;
+
+    result = real_rmdir(pathname);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("rmdir", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_rmdir(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_select(int nfds, fd_set *readfds, fd_set *writefds,
+    fd_set *exceptfds, struct timeval *timeout);
+static int (*real_select)(int nfds, fd_set *readfds, fd_set *writefds,
+    fd_set *exceptfds, struct timeval *timeout) =
+    resolve_select;
+
+
+static int
+resolve_select(int nfds, fd_set *readfds, fd_set *writefds, fd_set *exceptfds,
+    struct timeval *timeout)
+{
+    *(void **)&real_select = explain_preload_resolve("select");
+    return real_select(nfds, readfds, writefds, exceptfds, timeout);
+}
+
+
+int explain_preload_select(int nfds, fd_set *readfds, fd_set *writefds,
+    fd_set *exceptfds, struct timeval *timeout)
+    EXPLAIN_PRELOAD_SYMBOL("select");
+
+int
+explain_preload_select(int nfds, fd_set *readfds, fd_set *writefds,
+    fd_set *exceptfds, struct timeval *timeout)
+{
+    int             result;
+
+    result = real_select(nfds, readfds, writefds, exceptfds, timeout);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("select", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_select(message, sizeof(message), hold_errno,
+                nfds, readfds, writefds, exceptfds, timeout);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_setdomainname(const char *data, size_t data_size);
+static int (*real_setdomainname)(const char *data, size_t data_size) =
+    resolve_setdomainname;
+
+
+static int
+resolve_setdomainname(const char *data, size_t data_size)
+{
+    *(void **)&real_setdomainname = explain_preload_resolve("setdomainname");
+    return real_setdomainname(data, data_size);
+}
+
+
+int explain_preload_setdomainname(const char *data, size_t data_size)
+    EXPLAIN_PRELOAD_SYMBOL("setdomainname");
+
+int
+explain_preload_setdomainname(const char *data, size_t data_size)
+{
+    int             result;
+
+    result = real_setdomainname(data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("setdomainname", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_setdomainname(message, sizeof(message),
+                hold_errno, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_setgroups(size_t data_size, const gid_t *data);
+static int (*real_setgroups)(size_t data_size, const gid_t *data) =
+    resolve_setgroups;
+
+
+static int
+resolve_setgroups(size_t data_size, const gid_t *data)
+{
+    *(void **)&real_setgroups = explain_preload_resolve("setgroups");
+    return real_setgroups(data_size, data);
+}
+
+
+int explain_preload_setgroups(size_t data_size, const gid_t *data)
+    EXPLAIN_PRELOAD_SYMBOL("setgroups");
+
+int
+explain_preload_setgroups(size_t data_size, const gid_t *data)
+{
+    int             result;
+
+    result = real_setgroups(data_size, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("setgroups", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_setgroups(message, sizeof(message),
+                hold_errno, data_size, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_sethostname(const char *name, size_t name_size);
+static int (*real_sethostname)(const char *name, size_t name_size) =
+    resolve_sethostname;
+
+
+static int
+resolve_sethostname(const char *name, size_t name_size)
+{
+    *(void **)&real_sethostname = explain_preload_resolve("sethostname");
+    return real_sethostname(name, name_size);
+}
+
+
+int explain_preload_sethostname(const char *name, size_t name_size)
+    EXPLAIN_PRELOAD_SYMBOL("sethostname");
+
+int
+explain_preload_sethostname(const char *name, size_t name_size)
+{
+    int             result;
+
+    result = real_sethostname(name, name_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("sethostname", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_sethostname(message, sizeof(message),
+                hold_errno, name, name_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_setsockopt(int fildes, int level, int name, void *data,
+    socklen_t data_size);
+static int (*real_setsockopt)(int fildes, int level, int name, void *data,
+    socklen_t data_size) =
+    resolve_setsockopt;
+
+
+static int
+resolve_setsockopt(int fildes, int level, int name, void *data,
+    socklen_t data_size)
+{
+    *(void **)&real_setsockopt = explain_preload_resolve("setsockopt");
+    return real_setsockopt(fildes, level, name, data, data_size);
+}
+
+
+int explain_preload_setsockopt(int fildes, int level, int name, void *data,
+    socklen_t data_size)
+    EXPLAIN_PRELOAD_SYMBOL("setsockopt");
+
+int
+explain_preload_setsockopt(int fildes, int level, int name, void *data,
+    socklen_t data_size)
+{
+    int             result;
+
+    result = real_setsockopt(fildes, level, name, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("setsockopt", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_setsockopt(message, sizeof(message),
+                hold_errno, fildes, level, name, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_signalfd(int fildes, const sigset_t *mask, int flags);
+static int (*real_signalfd)(int fildes, const sigset_t *mask, int flags) =
+    resolve_signalfd;
+
+
+static int
+resolve_signalfd(int fildes, const sigset_t *mask, int flags)
+{
+    *(void **)&real_signalfd = explain_preload_resolve("signalfd");
+    return real_signalfd(fildes, mask, flags);
+}
+
+
+int explain_preload_signalfd(int fildes, const sigset_t *mask, int flags)
+    EXPLAIN_PRELOAD_SYMBOL("signalfd");
+
+int
+explain_preload_signalfd(int fildes, const sigset_t *mask, int flags)
+{
+    int             result;
+
+    result = real_signalfd(fildes, mask, flags);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("signalfd", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_signalfd(message, sizeof(message),
+                hold_errno, fildes, mask, flags);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_socket(int domain, int type, int protocol);
+static int (*real_socket)(int domain, int type, int protocol) =
+    resolve_socket;
+
+
+static int
+resolve_socket(int domain, int type, int protocol)
+{
+    *(void **)&real_socket = explain_preload_resolve("socket");
+    return real_socket(domain, type, protocol);
+}
+
+
+int explain_preload_socket(int domain, int type, int protocol)
+    EXPLAIN_PRELOAD_SYMBOL("socket");
+
+int
+explain_preload_socket(int domain, int type, int protocol)
+{
+    int             result;
+
+    result = real_socket(domain, type, protocol);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("socket", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_socket(message, sizeof(message), hold_errno,
+                domain, type, protocol);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_stat(const char *pathname, struct stat *data);
+static int (*real_stat)(const char *pathname, struct stat *data) =
+    resolve_stat;
+
+
+static int
+resolve_stat(const char *pathname, struct stat *data)
+{
+    *(void **)&real_stat = explain_preload_resolve("stat");
+    return real_stat(pathname, data);
+}
+
+
+int explain_preload_stat(const char *pathname, struct stat *data)
+    EXPLAIN_PRELOAD_SYMBOL("stat");
+
+int
+explain_preload_stat(const char *pathname, struct stat *data)
+{
+    int             result;
+
+    result = real_stat(pathname, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("stat", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_stat(message, sizeof(message), hold_errno,
+                pathname, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_stat64(const char *pathname, struct stat *data)
+    EXPLAIN_PRELOAD_ALIAS("stat64", "stat");
+
+#endif
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_statfs(const char *pathname, struct statfs *data);
+static int (*real_statfs)(const char *pathname, struct statfs *data) =
+    resolve_statfs;
+
+
+static int
+resolve_statfs(const char *pathname, struct statfs *data)
+{
+    *(void **)&real_statfs = explain_preload_resolve("statfs");
+    return real_statfs(pathname, data);
+}
+
+
+int explain_preload_statfs(const char *pathname, struct statfs *data)
+    EXPLAIN_PRELOAD_SYMBOL("statfs");
+
+int
+explain_preload_statfs(const char *pathname, struct statfs *data)
+{
+    int             result;
+
+    result = real_statfs(pathname, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("statfs", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_statfs(message, sizeof(message), hold_errno,
+                pathname, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_statfs64(const char *pathname, struct statfs *data)
+    EXPLAIN_PRELOAD_ALIAS("statfs64", "statfs");
+
+#endif
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_statvfs(const char *pathname, struct statvfs *data);
+static int (*real_statvfs)(const char *pathname, struct statvfs *data) =
+    resolve_statvfs;
+
+
+static int
+resolve_statvfs(const char *pathname, struct statvfs *data)
+{
+    *(void **)&real_statvfs = explain_preload_resolve("statvfs");
+    return real_statvfs(pathname, data);
+}
+
+
+int explain_preload_statvfs(const char *pathname, struct statvfs *data)
+    EXPLAIN_PRELOAD_SYMBOL("statvfs");
+
+int
+explain_preload_statvfs(const char *pathname, struct statvfs *data)
+{
+    int             result;
+
+    result = real_statvfs(pathname, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("statvfs", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_statvfs(message, sizeof(message), hold_errno,
+                pathname, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_statvfs64(const char *pathname, struct statvfs *data)
+    EXPLAIN_PRELOAD_ALIAS("statvfs64", "statvfs");
+
+#endif
+
+
+static int resolve_symlink(const char *oldpath, const char *newpath);
+static int (*real_symlink)(const char *oldpath, const char *newpath) =
+    resolve_symlink;
+
+
+static int
+resolve_symlink(const char *oldpath, const char *newpath)
+{
+    *(void **)&real_symlink = explain_preload_resolve("symlink");
+    return real_symlink(oldpath, newpath);
+}
+
+
+int explain_preload_symlink(const char *oldpath, const char *newpath)
+    EXPLAIN_PRELOAD_SYMBOL("symlink");
+
+int
+explain_preload_symlink(const char *oldpath, const char *newpath)
+{
+    int             result;
+
+    result = real_symlink(oldpath, newpath);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("symlink", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_symlink(message, sizeof(message), hold_errno,
+                oldpath, newpath);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_system(const char *command);
+static int (*real_system)(const char *command) =
+    resolve_system;
+
+
+static int
+resolve_system(const char *command)
+{
+    *(void **)&real_system = explain_preload_resolve("system");
+    return real_system(command);
+}
+
+
+int explain_preload_system(const char *command)
+    EXPLAIN_PRELOAD_SYMBOL("system");
+
+int
+explain_preload_system(const char *command)
+{
+    int             result;
+
+    result = real_system(command);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("system", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_system(message, sizeof(message), hold_errno,
+                command);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcdrain(int fildes);
+static int (*real_tcdrain)(int fildes) =
+    resolve_tcdrain;
+
+
+static int
+resolve_tcdrain(int fildes)
+{
+    *(void **)&real_tcdrain = explain_preload_resolve("tcdrain");
+    return real_tcdrain(fildes);
+}
+
+
+int explain_preload_tcdrain(int fildes)
+    EXPLAIN_PRELOAD_SYMBOL("tcdrain");
+
+int
+explain_preload_tcdrain(int fildes)
+{
+    int             result;
+
+    result = real_tcdrain(fildes);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcdrain", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcdrain(message, sizeof(message), hold_errno,
+                fildes);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcflow(int fildes, int action);
+static int (*real_tcflow)(int fildes, int action) =
+    resolve_tcflow;
+
+
+static int
+resolve_tcflow(int fildes, int action)
+{
+    *(void **)&real_tcflow = explain_preload_resolve("tcflow");
+    return real_tcflow(fildes, action);
+}
+
+
+int explain_preload_tcflow(int fildes, int action)
+    EXPLAIN_PRELOAD_SYMBOL("tcflow");
+
+int
+explain_preload_tcflow(int fildes, int action)
+{
+    int             result;
+
+    result = real_tcflow(fildes, action);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcflow", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcflow(message, sizeof(message), hold_errno,
+                fildes, action);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcflush(int fildes, int selector);
+static int (*real_tcflush)(int fildes, int selector) =
+    resolve_tcflush;
+
+
+static int
+resolve_tcflush(int fildes, int selector)
+{
+    *(void **)&real_tcflush = explain_preload_resolve("tcflush");
+    return real_tcflush(fildes, selector);
+}
+
+
+int explain_preload_tcflush(int fildes, int selector)
+    EXPLAIN_PRELOAD_SYMBOL("tcflush");
+
+int
+explain_preload_tcflush(int fildes, int selector)
+{
+    int             result;
+
+    result = real_tcflush(fildes, selector);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcflush", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcflush(message, sizeof(message), hold_errno,
+                fildes, selector);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcgetattr(int fildes, struct termios *data);
+static int (*real_tcgetattr)(int fildes, struct termios *data) =
+    resolve_tcgetattr;
+
+
+static int
+resolve_tcgetattr(int fildes, struct termios *data)
+{
+    *(void **)&real_tcgetattr = explain_preload_resolve("tcgetattr");
+    return real_tcgetattr(fildes, data);
+}
+
+
+int explain_preload_tcgetattr(int fildes, struct termios *data)
+    EXPLAIN_PRELOAD_SYMBOL("tcgetattr");
+
+int
+explain_preload_tcgetattr(int fildes, struct termios *data)
+{
+    int             result;
+
+    result = real_tcgetattr(fildes, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcgetattr", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcgetattr(message, sizeof(message),
+                hold_errno, fildes, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcsendbreak(int fildes, int duration);
+static int (*real_tcsendbreak)(int fildes, int duration) =
+    resolve_tcsendbreak;
+
+
+static int
+resolve_tcsendbreak(int fildes, int duration)
+{
+    *(void **)&real_tcsendbreak = explain_preload_resolve("tcsendbreak");
+    return real_tcsendbreak(fildes, duration);
+}
+
+
+int explain_preload_tcsendbreak(int fildes, int duration)
+    EXPLAIN_PRELOAD_SYMBOL("tcsendbreak");
+
+int
+explain_preload_tcsendbreak(int fildes, int duration)
+{
+    int             result;
+
+    result = real_tcsendbreak(fildes, duration);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcsendbreak", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcsendbreak(message, sizeof(message),
+                hold_errno, fildes, duration);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_tcsetattr(int fildes, int options,
+    const struct termios *data);
+static int (*real_tcsetattr)(int fildes, int options,
+    const struct termios *data) =
+    resolve_tcsetattr;
+
+
+static int
+resolve_tcsetattr(int fildes, int options, const struct termios *data)
+{
+    *(void **)&real_tcsetattr = explain_preload_resolve("tcsetattr");
+    return real_tcsetattr(fildes, options, data);
+}
+
+
+int explain_preload_tcsetattr(int fildes, int options,
+    const struct termios *data)
+    EXPLAIN_PRELOAD_SYMBOL("tcsetattr");
+
+int
+explain_preload_tcsetattr(int fildes, int options, const struct termios *data)
+{
+    int             result;
+
+    result = real_tcsetattr(fildes, options, data);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tcsetattr", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_tcsetattr(message, sizeof(message),
+                hold_errno, fildes, options, data);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static long resolve_telldir(DIR *dir);
+static long (*real_telldir)(DIR *dir) =
+    resolve_telldir;
+
+
+static long
+resolve_telldir(DIR *dir)
+{
+    *(void **)&real_telldir = explain_preload_resolve("telldir");
+    return real_telldir(dir);
+}
+
+
+long explain_preload_telldir(DIR *dir)
+    EXPLAIN_PRELOAD_SYMBOL("telldir");
+
+long
+explain_preload_telldir(DIR *dir)
+{
+    long            result;
+
+    result = real_telldir(dir);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("telldir", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_telldir(message, sizeof(message), hold_errno,
+                dir);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_timerfd_create(int clockid, int flags);
+static int (*real_timerfd_create)(int clockid, int flags) =
+    resolve_timerfd_create;
+
+
+static int
+resolve_timerfd_create(int clockid, int flags)
+{
+    *(void **)&real_timerfd_create = explain_preload_resolve("timerfd_create");
+    return real_timerfd_create(clockid, flags);
+}
+
+
+int explain_preload_timerfd_create(int clockid, int flags)
+    EXPLAIN_PRELOAD_SYMBOL("timerfd_create");
+
+int
+explain_preload_timerfd_create(int clockid, int flags)
+{
+    int             result;
+
+    result = real_timerfd_create(clockid, flags);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("timerfd_create", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_timerfd_create(message, sizeof(message),
+                hold_errno, clockid, flags);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static FILE *resolve_tmpfile(void);
+static FILE *(*real_tmpfile)(void) =
+    resolve_tmpfile;
+
+
+static FILE *
+resolve_tmpfile(void)
+{
+    *(void **)&real_tmpfile = explain_preload_resolve("tmpfile");
+    return real_tmpfile();
+}
+
+
+FILE *explain_preload_tmpfile(void)
+    EXPLAIN_PRELOAD_SYMBOL("tmpfile");
+
+FILE *
+explain_preload_tmpfile(void)
+{
+    FILE            *result;
+
+    result = real_tmpfile();
+    if (!result)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("tmpfile", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_tmpfile(message, sizeof(message),
+                hold_errno);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#if EXPLAIN_PRELOAD_LFS
+
+FILE *explain_preload_tmpfile64(void)
+    EXPLAIN_PRELOAD_ALIAS("tmpfile64", "tmpfile");
+
+#endif
+
+#if EXPLAIN_PRELOAD_LFS
+
+static int resolve_truncate(const char *pathname, off_t length);
+static int (*real_truncate)(const char *pathname, off_t length) =
+    resolve_truncate;
+
+
+static int
+resolve_truncate(const char *pathname, off_t length)
+{
+    *(void **)&real_truncate = explain_preload_resolve("truncate");
+    return real_truncate(pathname, length);
+}
+
+
+int explain_preload_truncate(const char *pathname, off_t length)
+    EXPLAIN_PRELOAD_SYMBOL("truncate");
+
+int
+explain_preload_truncate(const char *pathname, off_t length)
+{
+    int             result;
+
+    result = real_truncate(pathname, length);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("truncate", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_truncate(message, sizeof(message),
+                hold_errno, pathname, length);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+int explain_preload_truncate64(const char *pathname, off_t length)
+    EXPLAIN_PRELOAD_ALIAS("truncate64", "truncate");
+
+#endif
+
+
+static int resolve_unlink(const char *pathname);
+static int (*real_unlink)(const char *pathname) =
+    resolve_unlink;
+
+
+static int
+resolve_unlink(const char *pathname)
+{
+    *(void **)&real_unlink = explain_preload_resolve("unlink");
+    return real_unlink(pathname);
+}
+
+
+int explain_preload_unlink(const char *pathname)
+    EXPLAIN_PRELOAD_SYMBOL("unlink");
+
+int
+explain_preload_unlink(const char *pathname)
+{
+    int             result;
+
+    result = real_unlink(pathname);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("unlink", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_unlink(message, sizeof(message), hold_errno,
+                pathname);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_utime(const char *pathname, const struct utimbuf *times);
+static int (*real_utime)(const char *pathname, const struct utimbuf *times) =
+    resolve_utime;
+
+
+static int
+resolve_utime(const char *pathname, const struct utimbuf *times)
+{
+    *(void **)&real_utime = explain_preload_resolve("utime");
+    return real_utime(pathname, times);
+}
+
+
+int explain_preload_utime(const char *pathname, const struct utimbuf *times)
+    EXPLAIN_PRELOAD_SYMBOL("utime");
+
+int
+explain_preload_utime(const char *pathname, const struct utimbuf *times)
+{
+    int             result;
+
+    result = real_utime(pathname, times);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("utime", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_utime(message, sizeof(message), hold_errno,
+                pathname, times);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_wait(int *status);
+static int (*real_wait)(int *status) =
+    resolve_wait;
+
+
+static int
+resolve_wait(int *status)
+{
+    *(void **)&real_wait = explain_preload_resolve("wait");
+    return real_wait(status);
+}
+
+
+int explain_preload_wait(int *status)
+    EXPLAIN_PRELOAD_SYMBOL("wait");
+
+int
+explain_preload_wait(int *status)
+{
+    int             result;
+
+    result = real_wait(status);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("wait", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_wait(message, sizeof(message), hold_errno,
+                status);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_wait3(int *status, int options, struct rusage *rusage);
+static int (*real_wait3)(int *status, int options, struct rusage *rusage) =
+    resolve_wait3;
+
+
+static int
+resolve_wait3(int *status, int options, struct rusage *rusage)
+{
+    *(void **)&real_wait3 = explain_preload_resolve("wait3");
+    return real_wait3(status, options, rusage);
+}
+
+
+int explain_preload_wait3(int *status, int options, struct rusage *rusage)
+    EXPLAIN_PRELOAD_SYMBOL("wait3");
+
+int
+explain_preload_wait3(int *status, int options, struct rusage *rusage)
+{
+    int             result;
+
+    result = real_wait3(status, options, rusage);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("wait3", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_wait3(message, sizeof(message), hold_errno,
+                status, options, rusage);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_wait4(int pid, int *status, int options,
+    struct rusage *rusage);
+static int (*real_wait4)(int pid, int *status, int options,
+    struct rusage *rusage) =
+    resolve_wait4;
+
+
+static int
+resolve_wait4(int pid, int *status, int options, struct rusage *rusage)
+{
+    *(void **)&real_wait4 = explain_preload_resolve("wait4");
+    return real_wait4(pid, status, options, rusage);
+}
+
+
+int explain_preload_wait4(int pid, int *status, int options,
+    struct rusage *rusage)
+    EXPLAIN_PRELOAD_SYMBOL("wait4");
+
+int
+explain_preload_wait4(int pid, int *status, int options, struct rusage *rusage)
+{
+    int             result;
+
+    result = real_wait4(pid, status, options, rusage);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("wait4", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_wait4(message, sizeof(message), hold_errno,
+                pid, status, options, rusage);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static int resolve_waitpid(int pid, int *status, int options);
+static int (*real_waitpid)(int pid, int *status, int options) =
+    resolve_waitpid;
+
+
+static int
+resolve_waitpid(int pid, int *status, int options)
+{
+    *(void **)&real_waitpid = explain_preload_resolve("waitpid");
+    return real_waitpid(pid, status, options);
+}
+
+
+int explain_preload_waitpid(int pid, int *status, int options)
+    EXPLAIN_PRELOAD_SYMBOL("waitpid");
+
+int
+explain_preload_waitpid(int pid, int *status, int options)
+{
+    int             result;
+
+    result = real_waitpid(pid, status, options);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("waitpid", hold_errno, -1))
+        {
+            char            message[3000];
+
+            explain_message_errno_waitpid(message, sizeof(message), hold_errno,
+                pid, status, options);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static ssize_t resolve_write(int fildes, const void *data, size_t data_size);
+static ssize_t (*real_write)(int fildes, const void *data, size_t data_size) =
+    resolve_write;
+
+
+static ssize_t
+resolve_write(int fildes, const void *data, size_t data_size)
+{
+    *(void **)&real_write = explain_preload_resolve("write");
+    return real_write(fildes, data, data_size);
+}
+
+
+ssize_t explain_preload_write(int fildes, const void *data, size_t data_size)
+    EXPLAIN_PRELOAD_SYMBOL("write");
+
+ssize_t
+explain_preload_write(int fildes, const void *data, size_t data_size)
+{
+    ssize_t         result;
+
+    result = real_write(fildes, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("write", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_write(message, sizeof(message), hold_errno,
+                fildes, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+
+static ssize_t resolve_writev(int fildes, const struct iovec *data,
+    int data_size);
+static ssize_t (*real_writev)(int fildes, const struct iovec *data,
+    int data_size) =
+    resolve_writev;
+
+
+static ssize_t
+resolve_writev(int fildes, const struct iovec *data, int data_size)
+{
+    *(void **)&real_writev = explain_preload_resolve("writev");
+    return real_writev(fildes, data, data_size);
+}
+
+
+ssize_t explain_preload_writev(int fildes, const struct iovec *data,
+    int data_size)
+    EXPLAIN_PRELOAD_SYMBOL("writev");
+
+ssize_t
+explain_preload_writev(int fildes, const struct iovec *data, int data_size)
+{
+    ssize_t         result;
+
+    result = real_writev(fildes, data, data_size);
+    if (result < 0)
+    {
+        int             hold_errno;
+
+        hold_errno = errno;
+        if (explain_preload_begin("writev", hold_errno, fildes))
+        {
+            char            message[3000];
+
+            explain_message_errno_writev(message, sizeof(message), hold_errno,
+                fildes, data, data_size);
+            explain_output_error("%s", message);
+            explain_preload_end();
+        }
+        errno = hold_errno;
+    }
+    return result;
+}
+
+#endif
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,108 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain_output_filter_new"
+. test_prelude
+
+#
+# duplicate suppression
+#
+cat > test.in << 'fubar'
+alpha
+alpha
+alpha
+beta
+beta
+gamma
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+alpha
+last message repeated 2 times
+beta
+last message repeated 1 times
+gamma
+fubar
+test $? -eq 0 || no_result
+
+test_output_filter < test.in > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# rate limiting
+#
+cat > test.in << 'fubar'
+one
+two
+three
+four
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+one
+two
+2 messages suppressed by rate limit
+fubar
+test $? -eq 0 || no_result
+
+test_output_filter -w 0 -r 1 -b 2 < test.in > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# suppression by key, before the explanation is built
+#
+cat > test.in << 'fubar'
+3
+3
+3
+4
+3
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+fildes 3 failed
+last message repeated 2 times
+fildes 4 failed
+message repeated 1 times: fildes 3 failed
+fubar
+test $? -eq 0 || no_result
+
+test_output_filter -k < test.in > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim: set ts=8 sw=4 et :
@@ -0,0 +1,86 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain --batch"
+. test_prelude
+
+cat > test.in << 'fubar'
+EAGAIN fcntl 42 F_GETFL
+
+# comments and empty records are ignored
+ENOENT open "/no such/file" O_RDONLY
+EBADF nosuchfunction 1
+EBADF close 99
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+fcntl(fildes = 42, command = F_GETFL) failed, Resource temporarily
+unavailable (EAGAIN) because the operation is prohibited by locks held by
+other processes; or, the operation is prohibited because the file has been
+memory-mapped by another process
+open(pathname = "/no such/file", flags = O_RDONLY) failed, No such file or
+directory (ENOENT) because there is no "no such" directory in the pathname
+"/" directory
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok.2 << 'fubar'
+function "nosuchfunction" unknown
+test.in: 5: unable to explain this record
+fubar
+test $? -eq 0 || no_result
+
+#
+# The bad record fails, the others are still explained, in order.
+#
+explain --batch test.in > test.out 2> test.out.2
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+diff test.ok.2 test.out.2
+test $? -eq 0 || fail
+
+#
+# Several workers, and NUL delimited records on the standard input,
+# make no difference to the output.
+#
+tr '\n' '\0' < test.in > test.in.0
+test $? -eq 0 || no_result
+
+explain --batch --jobs=3 --null < test.in.0 > test.out 2> /dev/null
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Only definite negatives are possible.
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim:ts=8:sw=4:et
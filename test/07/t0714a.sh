@@ -0,0 +1,80 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain --strace"
+. test_prelude
+
+cat > test.in << 'fubar'
+execve("/bin/cat", ["cat", "/nonexistent"], 0x7ffd1b2a7d88 /* 24 vars */) = 0
+brk(NULL)                               = 0x55d4c8f6d000
+12345 12:34:56.789012 open("/nonexistent/x y", O_RDONLY) = -1 ENOENT (No such file or directory)
+[pid  4243] read(98,  <unfinished ...>
+[pid  4242] 1700000000.123456 close(99) = -1 EBADF (Bad file descriptor) <0.000012>
+[pid  4243] <... read resumed>NULL, 4096) = -1 EBADF (Bad file descriptor)
+rt_sigaction(SIGINT, {sa_handler=0x1, sa_flags=0}, NULL, 8) = -1 EINVAL (Invalid argument)
+--- SIGCHLD {si_signo=SIGCHLD, si_code=CLD_EXITED} ---
+this is not strace output
++++ exited with 1 +++
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+open(pathname = "/nonexistent/x y", flags = O_RDONLY) failed, No such file
+or directory (ENOENT) because there is no "nonexistent" directory in the
+pathname "/" directory
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+read(fildes = 98, data = NULL, data_size = 4096) failed, Bad file
+descriptor (EBADF) because the fildes argument does not refer to an open
+file; this is more likely to be a software error (a bug) than it is to be a
+user error
+fubar
+test $? -eq 0 || no_result
+
+cat > test.ok.2 << 'fubar'
+test.in: 1 lines not understood
+test.in: 1 failed calls to unsupported functions
+fubar
+test $? -eq 0 || no_result
+
+explain --strace test.in > test.out 2> test.out.2
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+diff test.ok.2 test.out.2
+test $? -eq 0 || fail
+
+explain --strace --jobs=2 < test.in > test.out 2> /dev/null
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Only definite negatives are possible.
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,101 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain --serve"
+. test_prelude
+
+explain --serve test.sock --jobs=2 2> /dev/null &
+server=$!
+
+# wait for the socket to appear
+n=0
+while test ! -S test.sock
+do
+    n=`expr $n + 1`
+    test $n -gt 50 && { kill $server; no_result; }
+    sleep 0.1 2> /dev/null || sleep 1
+done
+
+cat > test.ok << 'fubar'
+open(pathname = "nosuchdir/x", flags = O_RDONLY) failed, No such file or
+directory (ENOENT) because there is no "nosuchdir" directory in the current
+directory
+fubar
+test $? -eq 0 || { kill $server; no_result; }
+
+test_client -s test.sock 2 open nosuchdir/x O_RDONLY > test.out
+test $? -eq 0 || { kill $server; fail; }
+
+diff test.ok test.out
+test $? -eq 0 || { kill $server; fail; }
+
+#
+# a request the server can't explain is refused, and the server
+# carries on
+#
+echo unavailable > test.ok
+test $? -eq 0 || { kill $server; no_result; }
+
+test_client -s test.sock 2 nosuchfunction 1 > test.out 2> /dev/null
+test $? -eq 1 || { kill $server; fail; }
+
+diff test.ok test.out
+test $? -eq 0 || { kill $server; fail; }
+
+cat > test.ok << 'fubar'
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+fubar
+test $? -eq 0 || { kill $server; no_result; }
+
+test_client -s test.sock 9 close 99 > test.out
+test $? -eq 0 || { kill $server; fail; }
+
+diff test.ok test.out
+test $? -eq 0 || { kill $server; fail; }
+
+#
+# the server removes its socket when terminated
+#
+kill $server
+wait $server
+test -S test.sock && fail
+
+#
+# no server, no explanation
+#
+echo unavailable > test.ok
+test $? -eq 0 || no_result
+
+test_client -s test.sock 9 close 99 > test.out
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Only definite negatives are possible.
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain function lookup"
+. test_prelude
+
+#
+# Names are found regardless of case, and wherever they are in the
+# table.
+#
+cat > test.ok << 'fubar'
+acl_get_file(pathname = "nosuchfile", type = ACL_TYPE_ACCESS) failed, No
+such file or directory (ENOENT) because there is no "nosuchfile" regular
+file in the current directory
+fubar
+test $? -eq 0 || no_result
+
+explain -e ENOENT ACL_GET_FILE nosuchfile ACL_TYPE_ACCESS > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+cat > test.ok << 'fubar'
+write(fildes = 42, data = NULL, data_size = 0) failed, Bad file descriptor
+(EBADF) because the fildes argument does not refer to an open file; this is
+more likely to be a software error (a bug) than it is to be a user error
+fubar
+test $? -eq 0 || no_result
+
+explain -e EBADF Write 42 0 0 > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Misspelled names still get a suggestion.
+#
+cat > test.ok << 'fubar'
+function "gettimeofdya" unknown, did you mean the "gettimeofday" function?
+fubar
+test $? -eq 0 || no_result
+
+explain -e EFAULT gettimeofdya > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
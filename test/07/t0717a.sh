@@ -0,0 +1,50 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain_is_efault_pointer"
+. test_prelude
+
+cat > test.ok << 'fubar'
+null: bad
+stack: ok
+heap: ok
+pages: ok
+last byte: ok
+hole: bad
+straddle: bad
+wrap: bad
+iovec: first bad 1
+iovec: ok bad ok ok bad
+array: first bad at the hole
+array: first bad -1
+unmapped: bad
+first page: ok
+fubar
+test $? -eq 0 || no_result
+
+test_is_efault > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain_buffer_fd_set"
+. test_prelude
+
+#
+# The first file descriptor is closed before the second rendering.
+# Closed file descriptors are listed, but have no name.
+#
+cat > test.ok << 'fubar'
+{ 3 "/dev/null", 63 "/dev/null", 64 "/dev/null", 65, 100 "/dev/null", 1023 "/dev/null" }
+{ 3, 63 "/dev/null", 64 "/dev/null", 65, 100 "/dev/null", 1023 "/dev/null" }
+{ 63 "/dev/null", 64 "/dev/null" }
+{ 63, 64 "/dev/null" }
+{}
+{}
+fubar
+test $? -eq 0 || no_result
+
+test_fd_set 1024 3 63 64 -65 100 1023 > test.out 3< /dev/null
+test $? -eq 0 || fail
+
+# nfds excludes the higher descriptors
+test_fd_set 65 63 64 100 >> test.out 3< /dev/null
+test $? -eq 0 || fail
+
+test_fd_set 3 63 64 >> test.out 3< /dev/null
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,85 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="rmdir ENOTEMPTY, large directory"
+. test_prelude
+
+#
+# Counting stops after 1000 entries.
+#
+cat > test.ok << 'fubar'
+rmdir(pathname = "a") failed, Directory not empty (ENOTEMPTY) because
+pathname is not an empty directory; that is, it contains entries other than
+"." and ".." (1000+); note that pathname still exists
+fubar
+test $? -eq 0 || no_result
+
+mkdir a
+test $? -eq 0 || no_result
+
+# 1200 files, without a program per file
+for i in 0 1 2 3 4 5 6 7 8 9 10 11
+do
+    for j in 0 1 2 3 4 5 6 7 8 9
+    do
+        echo a/f$i$j-0 a/f$i$j-1 a/f$i$j-2 a/f$i$j-3 a/f$i$j-4 \
+            a/f$i$j-5 a/f$i$j-6 a/f$i$j-7 a/f$i$j-8 a/f$i$j-9
+    done
+done | xargs touch
+test $? -eq 0 || no_result
+
+test_rmdir a > test.out 2>&1
+if test $? -ne 1
+then
+    echo expected to fail
+    test -f test.out && cat test.out
+    fail
+fi
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Exactly 1000 entries are counted exactly.
+#
+cat > test.ok << 'fubar'
+rmdir(pathname = "a") failed, Directory not empty (ENOTEMPTY) because
+pathname is not an empty directory; that is, it contains entries other than
+"." and ".." (1000); note that pathname still exists
+fubar
+test $? -eq 0 || no_result
+
+rm a/f10?-? a/f11?-?
+test $? -eq 0 || no_result
+
+test_rmdir a > test.out 2>&1
+if test $? -ne 1
+then
+    echo expected to fail
+    test -f test.out && cat test.out
+    fail
+fi
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,64 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="execve ENOEXEC file format"
+. test_prelude
+
+EXPLAIN_OPTIONS="$EXPLAIN_OPTIONS, dialect-specific"
+export EXPLAIN_OPTIONS
+
+printf '#!/bin/sh\r\nexit 42\r\n' > crlf
+test $? -eq 0 || no_result
+printf 'exit 42\n' > noshebang
+test $? -eq 0 || no_result
+: > empty
+test $? -eq 0 || no_result
+printf '!<arch>\n' > archive
+test $? -eq 0 || no_result
+
+# a 32-bit big-endian SPARC executable header
+printf '\177ELF\1\2\1\0\0\0\0\0\0\0\0\0\0\2\0\2\0\0\0\1' > sparc
+test $? -eq 0 || no_result
+
+cat > test.ok << 'fubar'
+(script, interpreter "/bin/sh", with CRLF line terminators)
+(text, with no "#!" line)
+(empty)
+(current ar archive)
+(ELF 32-bit MSB executable, SPARC, version 1 (SYSV))
+fubar
+test $? -eq 0 || no_result
+
+for f in crlf noshebang empty archive sparc
+do
+    explain -e ENOEXEC execve $f > test.out2
+    test $? -eq 0 || fail
+    # keep the parenthesised description at the end
+    tr '\n' ' ' < test.out2 |
+        sed -e 's|.*cannot be executed (|(|' -e 's| $||' >> test.out
+    echo >> test.out
+done
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
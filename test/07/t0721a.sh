@@ -0,0 +1,89 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="iconv_open EINVAL, name normalization"
+. test_prelude
+
+#
+# The names come from this file, not the host's gconv modules.
+#
+cat > test.modules << 'fubar'
+# a gconv-modules file, in miniature
+alias   UTF8//          UTF-8//
+alias   LATIN1//        ISO-8859-1//
+alias   ISO88591//      ISO-8859-1//
+module  ISO-8859-1//    INTERNAL    ISO8859-1   1
+module  INTERNAL        ISO-8859-1// ISO8859-1  1
+module  KOI8-R//        INTERNAL    KOI8-R      1
+fubar
+test $? -eq 0 || no_result
+
+#
+# Case, and options such as //TRANSLIT, don't stop a name from being
+# recognised.
+#
+cat > test.ok << 'fubar'
+iconv_open(tocode = "utf-8//TRANSLIT", fromcode = "nosuchcharset") failed,
+Invalid argument (EINVAL) because the fromcode argument is not a known
+locale name
+fubar
+test $? -eq 0 || no_result
+
+test_iconv_names -f test.modules utf-8//TRANSLIT nosuchcharset > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# A similar name is suggested.
+#
+cat > test.ok << 'fubar'
+iconv_open(tocode = "latin2", fromcode = "koi8-r") failed, Invalid argument
+(EINVAL) because the tocode argument is not a known locale name; did you
+mean the "LATIN1" locale instead?
+fubar
+test $? -eq 0 || no_result
+
+test_iconv_names -f test.modules latin2 koi8-r > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Both names are known.
+#
+cat > test.ok << 'fubar'
+iconv_open(tocode = "Latin1", fromcode = "koi8-r") failed, Invalid argument
+(EINVAL) because The conversion from fromcode to tocode is not supported by
+the implementation
+fubar
+test $? -eq 0 || no_result
+
+test_iconv_names -f test.modules Latin1 koi8-r > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="test_bench baseline"
+. test_prelude
+
+#
+# Write a baseline, and check the results against it.  The latency
+# tolerance is huge, because the test machine may be busy.
+#
+test_bench -n 5 -w baseline access chdir dup > test.out
+test $? -eq 0 || fail
+
+test_bench -n 5 -t 1000000 -b baseline access chdir dup > test.out
+test $? -eq 0 || fail
+
+#
+# The system calls can only be counted on some systems.
+#
+grep '^access  *EACCES .* -$' baseline > /dev/null && pass
+
+#
+# One more system call than the baseline is a regression.
+#
+sed '/^access  *EACCES /s/ [0-9][0-9]*$/ 0/' baseline > baseline.2
+test $? -eq 0 || no_result
+
+test_bench -n 5 -t 1000000 -b baseline.2 access chdir dup > test.out \
+    2> test.err
+test $? -ne 0 || fail
+
+grep 'access EACCES: system calls went from 0 to' test.err > /dev/null
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="statistics option"
+. test_prelude
+
+#
+# The times vary, but the number of probes does not.  Looking for
+# similar names in the current directory is one directory scan.
+#
+cat > test.ok << 'fubar'
+libexplain: statistics: lsof: 0 probes
+libexplain: statistics: proc: 0 probes
+libexplain: statistics: dev: 0 probes
+libexplain: statistics: mount: 0 probes
+libexplain: statistics: dns: 0 probes
+libexplain: statistics: dir: 1 probe
+libexplain: statistics: mincore: 0 probes
+fubar
+test $? -eq 0 || no_result
+
+EXPLAIN_OPTIONS="$EXPLAIN_OPTIONS, statistics"
+export EXPLAIN_OPTIONS
+
+explain -eENOENT open nosuchdir/x > test.out 2> test.err
+test $? -eq 0 || fail
+
+sed 's/, [0-9.]* ms$//' test.err > test.out
+test $? -eq 0 || no_result
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,97 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="LD_PRELOAD library"
+. test_prelude
+
+#
+# The preload library is only built where interposition is supported.
+#
+so=$here/$arch/libexplain_preload/.libs/libexplain_preload.so
+if test ! -r $so
+then
+    echo "    no $so, test skipped"
+    pass
+fi
+
+#
+# A plain chdir is explained by the preloaded chdir wrapper.
+#
+cat > test.ok << 'fubar'
+chdir(pathname = "nosuchdir") failed, No such file or directory (ENOENT)
+because there is no "nosuchdir" directory in the current directory
+fubar
+test $? -eq 0 || no_result
+
+LD_PRELOAD=$so test_chdir -r nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# The failure of the chdir made by explain_chdir_or_die is left for it
+# to explain, so it is explained once, not twice.  The failures of the
+# probes libexplain makes while it builds the explanation (the lstat of
+# "nosuchdir", say) are libexplain's own, and are not explained either.
+#
+LD_PRELOAD=$so test_chdir nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+EXPLAIN_PRELOAD_FUNCTIONS=chdir
+export EXPLAIN_PRELOAD_FUNCTIONS
+
+LD_PRELOAD=$so test_chdir -r nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+LD_PRELOAD=$so test_chdir nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Failures with other errno values are not explained by the wrapper,
+# explain_chdir_or_die still explains its own.
+#
+EXPLAIN_PRELOAD_ERRNOS=EACCES
+export EXPLAIN_PRELOAD_ERRNOS
+
+LD_PRELOAD=$so test_chdir -r nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff /dev/null test.out
+test $? -eq 0 || fail
+
+LD_PRELOAD=$so test_chdir nosuchdir > test.out 2>&1
+test $? -eq 1 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain_output_sample"
+. test_prelude
+
+cat > test.ok << 'fubar'
+close(fildes = -1) failed, Bad file descriptor (EBADF) because the fildes
+argument is outside the allowed range for file descriptors; this is more
+likely to be a software error (a bug) than it is to be a user error
+fubar
+test $? -eq 0 || no_result
+
+#
+# one in N: the 1st, 5th and 9th failures
+#
+cat test.ok test.ok test.ok > test.ok2
+test $? -eq 0 || no_result
+
+test_sample -n 10 -p 1/4 > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok2 test.out
+test $? -eq 0 || fail
+
+#
+# first N, then summarise, set from the environment
+#
+cat test.ok > test.ok2
+test $? -eq 0 || no_result
+echo "close: EBADF: 4 more failures not explained" >> test.ok2
+test $? -eq 0 || no_result
+
+EXPLAIN_OPTIONS="$EXPLAIN_OPTIONS, sample=first:1 close EBADF" \
+    test_sample -n 5 > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok2 test.out
+test $? -eq 0 || fail
+
+#
+# a policy for another error does not apply
+#
+cat test.ok test.ok > test.ok2
+test $? -eq 0 || no_result
+
+EXPLAIN_OPTIONS="$EXPLAIN_OPTIONS, sample=first:1 close EINTR" \
+    test_sample -n 2 > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok2 test.out
+test $? -eq 0 || fail
+
+#
+# a token bucket: a burst of 2, and nothing like 2 per second elapses
+#
+cat test.ok test.ok > test.ok2
+test $? -eq 0 || no_result
+
+test_sample -n 50 -p rate:0.001/2 > test.out 2>&1
+test $? -eq 0 || fail
+
+diff test.ok2 test.out
+test $? -eq 0 || fail
+
+#
+# an explain_*_or_die failure is always explained, even when the
+# policy (and a filter) would have suppressed it
+#
+cat test.ok test.ok > test.ok2
+test $? -eq 0 || no_result
+
+EXPLAIN_OPTIONS="$EXPLAIN_OPTIONS, sample=first:1 close EBADF" \
+    test_sample -n 3 -d > test.out 2>&1
+test $? -eq 1 || fail
+
+head -6 test.out > test.out2
+test $? -eq 0 || no_result
+
+diff test.ok2 test.out2
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
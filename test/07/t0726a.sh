@@ -0,0 +1,50 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="test_bench locale throughput"
+. test_prelude
+
+#
+# The C locale is always available, so comparing it with itself
+# exercises the throughput code everywhere.
+#
+test_bench -n 5 -l C access chdir > test.out
+test $? -eq 0 || fail
+
+grep '^# C  *[0-9][0-9]*$' test.out > test.out.2
+test $? -eq 0 || fail
+
+test `wc -l < test.out.2` -eq 2 || fail
+
+grep '^# ratio  *[0-9.]*$' test.out > /dev/null
+test $? -eq 0 || fail
+
+#
+# An unknown locale is an error.
+#
+test_bench -n 5 -l no-such-locale access > test.out 2> test.err
+test $? -ne 0 || fail
+
+grep 'locale "no-such-locale" unknown' test.err > /dev/null
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,78 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="gettext cache and locale changes"
+. test_prelude
+
+#
+# A catalogue translating the message that glues every explanation
+# together, so that the test needs neither msgfmt(1) nor the installed
+# translations.
+#
+mkdir -p locale/xx/LC_MESSAGES
+test $? -eq 0 || no_result
+
+test_gettext -m locale/xx/LC_MESSAGES/libexplain.mo
+test $? -eq 0 || no_result
+
+test_gettext -d `pwd`/locale > test.out
+test $? -eq 0 || fail
+
+if test "`cat test.out`" = "no UTF-8 locale"
+then
+    echo "    no UTF-8 locale, test skipped"
+    pass
+fi
+
+#
+# The translation must follow the locale from one explanation to the
+# next, whether it is changed with setlocale or uselocale, rather than
+# sticking to the cached translation.
+#
+cat > test.ok << 'fubar'
+C:
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+setlocale:
+close(fildes = 99) FAILED, Bad file descriptor (EBADF) BECAUSE the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+C:
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+uselocale:
+close(fildes = 99) FAILED, Bad file descriptor (EBADF) BECAUSE the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+C:
+close(fildes = 99) failed, Bad file descriptor (EBADF) because the fildes
+argument does not refer to an open file; this is more likely to be a
+software error (a bug) than it is to be a user error
+fubar
+test $? -eq 0 || no_result
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,78 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="lsof of a directory name with a space"
+. test_prelude
+
+lsof -v > /dev/null 2>&1
+if test $? -ne 0
+then
+    echo
+    echo "      The lsof(1) command is not available."
+    echo "      This test is declared to pass by default."
+    echo
+    pass
+fi
+
+mkdir "my dir"
+test $? -eq 0 || no_result
+
+#
+# the name is passed to lsof(1) as a single argument, it must not be
+# broken into words
+#
+echo "not in use" > test.ok
+test $? -eq 0 || no_result
+
+test_fileinfo -d "`pwd`/my dir" > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# a process with its current directory in there
+#
+cd "my dir"
+test $? -eq 0 || no_result
+sleep 30 &
+sleeper=$!
+cd ..
+test $? -eq 0 || { kill $sleeper; no_result; }
+
+echo "in use" > test.ok
+test $? -eq 0 || { kill $sleeper; no_result; }
+
+test_fileinfo -d "`pwd`/my dir" > test.out
+test $? -eq 0 || { kill $sleeper; fail; }
+
+kill $sleeper
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Only definite negatives are possible.
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim:ts=8:sw=4:et
@@ -0,0 +1,72 @@
+#!/bin/sh
+#
+# libexplain - a library of system-call-specific strerror replacements
+# Copyright (C) 2013 Peter Miller
+# Written by Peter Miller <pmiller@opensource.org.au>
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 3 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program. If not, see <http://www.gnu.org/licenses/>.
+#
+
+TEST_SUBJECT="explain_parse_bits_register"
+. test_prelude
+
+#
+# A registered table is indexed whatever its size; names are found
+# without regard to case, and values are taken apart bit by bit.
+#
+cat > test.ok << 'fubar'
+beta = 2
+Gamma = 4
+delta: not found
+5 = ALPHA | GAMMA
+11 = ALPHA | BETA | 0x8
+fubar
+test $? -eq 0 || no_result
+
+test_parse_bits beta Gamma delta 5 11 > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# A table that has been changed, and registered again, is indexed
+# again, even though its size and its first and last members are the
+# same as before.
+#
+cat > test.ok << 'fubar'
+beta = 2
+delta: not found
+3 = ALPHA | BETA
+changed
+beta: not found
+delta = 2
+3 = ALPHA | DELTA
+fubar
+test $? -eq 0 || no_result
+
+test_parse_bits -c beta delta 3 > test.out
+test $? -eq 0 || fail
+
+diff test.ok test.out
+test $? -eq 0 || fail
+
+#
+# Only definite negatives are possible.
+# The functionality exercised by this test appears to work,
+# no other guarantees are made.
+#
+pass
+
+# vim:ts=8:sw=4:et
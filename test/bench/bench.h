@@ -0,0 +1,89 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_BENCH_BENCH_H
+#define TEST_BENCH_BENCH_H
+
+#include <libexplain/ac/dirent.h>
+#include <libexplain/ac/stddef.h>
+#include <libexplain/ac/stdio.h>
+
+/**
+  * The bench_args_t struct is used to represent the arguments passed
+  * to the explain_message_errno_* functions.  The driver prepares them
+  * to match the errno being explained, so that, for example, ENOENT
+  * is explained using a path that really does not exist.
+  */
+typedef struct bench_args_t bench_args_t;
+struct bench_args_t
+{
+    /** pathname arguments */
+    const char      *path;
+
+    /** the second pathname of link, rename, symlink etc */
+    const char      *path2;
+
+    /** file descriptor arguments */
+    int             fildes;
+
+    /** FILE * arguments */
+    FILE            *fp;
+
+    /** DIR * arguments */
+    DIR             *dir;
+
+    /** argument vectors (argv, envp) */
+    char *const     *argv;
+
+    /** all other pointers: a zeroed, suitably aligned buffer */
+    void            *data;
+
+    /** size arguments, no larger than the data buffer */
+    size_t          data_size;
+};
+
+typedef void (*bench_func_t)(char *message, int message_size, int errnum,
+    const bench_args_t *args);
+
+typedef struct bench_table_t bench_table_t;
+struct bench_table_t
+{
+    /** the name of the function, e.g. "open" */
+    const char      *name;
+
+    /** calls explain_message_errno_<name> with the arguments */
+    bench_func_t    func;
+
+    /**
+      * The space separated names of the errno values explained
+      * specifically, or the empty string if the explanation is
+      * delegated to another function.
+      */
+    const char      *errnos;
+};
+
+/**
+  * The bench_table array is generated from the catalogue, see
+  * "codegen --bench-table".
+  */
+extern const bench_table_t bench_table[];
+extern const size_t bench_table_size;
+
+#endif /* TEST_BENCH_BENCH_H */
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,833 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/limits.h> /* for PATH_MAX on Solaris */
+#include <libexplain/ac/locale.h>
+#include <libexplain/ac/signal.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/param.h> /* for PATH_MAX except Solaris */
+#include <libexplain/ac/sys/ptrace.h>
+#include <libexplain/ac/sys/socket.h>
+#include <libexplain/ac/sys/wait.h>
+#include <libexplain/ac/time.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/errno_info.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fopen.h>
+#include <libexplain/malloc.h>
+#include <libexplain/mkdir.h>
+#include <libexplain/mkdtemp.h>
+#include <libexplain/open.h>
+#include <libexplain/opendir.h>
+#include <libexplain/output.h>
+#include <libexplain/pipe.h>
+#include <libexplain/program_name.h>
+#include <libexplain/realloc.h>
+#include <libexplain/socket.h>
+#include <libexplain/symlink.h>
+#include <libexplain/version_print.h>
+
+#include <test/bench/bench.h>
+
+/*
+ * The system calls made by an explanation are counted by tracing a
+ * child process, which is only implemented for Linux.
+ */
+#if defined(__linux__) && defined(HAVE_SYS_PTRACE_H) && defined(PT_SYSCALL)
+#define BENCH_COUNT_SYSCALLS 1
+#endif
+
+/*
+ * The errno values used for functions that delegate their explanation
+ * to another function, and so have no specific errno cases.
+ */
+#define DEFAULT_ERRNOS "EACCES EBADF EINVAL EIO ENOENT ENOMEM"
+
+
+static void
+usage(void)
+{
+    const char      *prog;
+
+    prog = explain_program_name_get();
+    fprintf(stderr, "Usage: %s [ <option>... ][ <function>... ]\n", prog);
+    fprintf(stderr, "       %s -V\n", prog);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -b <file>  compare against a baseline file\n");
+    fprintf(stderr, "  -l <name>  compare throughput with the C locale\n");
+    fprintf(stderr, "  -n <num>   maximum iterations per errno\n");
+    fprintf(stderr, "  -s         do not count system calls\n");
+    fprintf(stderr, "  -t <pct>   p99 latency tolerance, in percent\n");
+    fprintf(stderr, "  -w <file>  write the results as a baseline file\n");
+    exit(EXIT_FAILURE);
+}
+
+
+typedef struct row_t row_t;
+struct row_t
+{
+    const bench_table_t *tp;
+    char            function[64];
+    char            errname[32];
+    int             errnum;
+    double          p50;
+    double          p99;
+    double          max;
+
+    /* -1 if not counted */
+    long            syscalls;
+
+    /* non-zero if the explanation crashed */
+    int             crashed;
+};
+
+static row_t    *rows;
+static size_t   rows_length;
+static size_t   rows_maximum;
+
+static int      iterations = 100;
+static int      count_syscalls = 1;
+
+/*
+ * No errno is measured for longer than this, so that explanations
+ * which run lsof(1) do not dominate the run time.
+ */
+static double   budget_usec = 100000;
+
+/* the scenario resources, created once */
+static char     tmpdir[100];
+static char     file_path[PATH_MAX];
+static char     dir_path[PATH_MAX];
+static char     missing_path[PATH_MAX];
+static char     missing_path2[PATH_MAX];
+static char     notdir_path[PATH_MAX];
+static char     loop_path[PATH_MAX];
+static char     long_path[PATH_MAX + 100];
+static int      file_fildes;
+static int      closed_fildes;
+static int      socket_fildes;
+static int      pipe_fildes;
+static FILE     *file_fp;
+static DIR      *dir_dp;
+static char     *bench_argv[] = { (char *)"bench", 0 };
+static double   data_buffer[4096 / sizeof(double)];
+
+
+static double
+now_usec(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+#endif
+    {
+        struct timeval  tv;
+
+        gettimeofday(&tv, 0);
+        return tv.tv_sec * 1e6 + tv.tv_usec;
+    }
+}
+
+
+static void
+create_resources(void)
+{
+    int             fildes[2];
+    int             fd;
+
+    snprintf(tmpdir, sizeof(tmpdir), "/tmp/bench.XXXXXX");
+    explain_mkdtemp_or_die(tmpdir);
+    snprintf(file_path, sizeof(file_path), "%s/file", tmpdir);
+    snprintf(dir_path, sizeof(dir_path), "%s/dir", tmpdir);
+    snprintf(missing_path, sizeof(missing_path), "%s/missing", tmpdir);
+    snprintf(missing_path2, sizeof(missing_path2), "%s/missing2", tmpdir);
+    snprintf(notdir_path, sizeof(notdir_path), "%s/file/x", tmpdir);
+    snprintf(loop_path, sizeof(loop_path), "%s/loop", tmpdir);
+    memset(long_path, 'x', sizeof(long_path) - 1);
+    long_path[0] = '/';
+    long_path[sizeof(long_path) - 1] = '\0';
+
+    file_fildes = explain_open_or_die(file_path, O_RDWR | O_CREAT, 0644);
+    explain_mkdir_or_die(dir_path, 0755);
+    explain_symlink_or_die(loop_path, loop_path);
+
+    fd = dup(file_fildes);
+    close(fd);
+    closed_fildes = fd;
+
+    socket_fildes = explain_socket_or_die(AF_UNIX, SOCK_STREAM, 0);
+    explain_pipe_or_die(fildes);
+    pipe_fildes = fildes[0];
+
+    file_fp = explain_fopen_or_die(file_path, "r+");
+    dir_dp = explain_opendir_or_die(dir_path);
+}
+
+
+static void
+remove_resources(void)
+{
+    unlink(loop_path);
+    rmdir(dir_path);
+    unlink(file_path);
+    rmdir(tmpdir);
+}
+
+
+static int
+has_errno(const char *errnos, const char *name)
+{
+    size_t          len;
+
+    len = strlen(name);
+    for (;;)
+    {
+        errnos += strspn(errnos, " ");
+        if (!*errnos)
+            return 0;
+        if
+        (
+            0 == memcmp(errnos, name, len)
+        &&
+            (errnos[len] == ' ' || errnos[len] == '\0')
+        )
+            return 1;
+        errnos += strcspn(errnos, " ");
+    }
+}
+
+
+/**
+  * The scenario function is used to choose the arguments to match the
+  * errno being explained, so that the explanation takes the same code
+  * path (and makes the same system calls) as it would for real.
+  */
+static void
+scenario(const bench_table_t *tp, const char *errname, bench_args_t *a)
+{
+    a->path = file_path;
+    a->path2 = missing_path2;
+    a->fildes = file_fildes;
+    a->fp = file_fp;
+    a->dir = dir_dp;
+    a->argv = bench_argv;
+    a->data = data_buffer;
+    a->data_size = 64;
+
+    if (has_errno(tp->errnos, "ENOTSOCK"))
+        a->fildes = socket_fildes;
+
+    if (0 == strcmp(errname, "ENOENT"))
+        a->path = missing_path;
+    else if (0 == strcmp(errname, "ENOTDIR"))
+        a->path = notdir_path;
+    else if (0 == strcmp(errname, "EISDIR"))
+        a->path = dir_path;
+    else if (0 == strcmp(errname, "ELOOP"))
+        a->path = loop_path;
+    else if (0 == strcmp(errname, "ENAMETOOLONG"))
+        a->path = long_path;
+    else if (0 == strcmp(errname, "EEXIST"))
+        a->path2 = file_path;
+    else if (0 == strcmp(errname, "EBADF"))
+        a->fildes = closed_fildes;
+    else if (0 == strcmp(errname, "ENOTSOCK"))
+        a->fildes = file_fildes;
+    else if (0 == strcmp(errname, "ESPIPE"))
+        a->fildes = pipe_fildes;
+}
+
+
+static int
+compare_double(const void *va, const void *vb)
+{
+    const double    *a;
+    const double    *b;
+
+    a = va;
+    b = vb;
+    return (*a < *b ? -1 : *a > *b);
+}
+
+
+/**
+  * The run_child function is used to explain the error once in a
+  * child process.  This finds explanations that crash, without taking
+  * down the benchmark, and when possible counts the system calls of
+  * one (warm) explanation.
+  *
+  * @returns
+  *     the number of system calls, -1 if not counted, or -2 if the
+  *     child crashed
+  */
+static long
+run_child(const bench_table_t *tp, int errnum, const bench_args_t *a)
+{
+    char            message[3000];
+    pid_t           pid;
+    int             status;
+    long            stops;
+    int             sig;
+    int             traced;
+
+    fflush(stdout);
+    fflush(stderr);
+    pid = fork();
+    if (pid < 0)
+    {
+        explain_output_error_and_die("fork: %s", strerror(errno));
+    }
+    if (pid == 0)
+    {
+        /* warm up any caches, they are not what is being measured */
+        tp->func(message, sizeof(message), errnum, a);
+
+#ifdef BENCH_COUNT_SYSCALLS
+        if (count_syscalls && ptrace(PTRACE_TRACEME, 0, 0, 0) == 0)
+            raise(SIGSTOP);
+#endif
+        tp->func(message, sizeof(message), errnum, a);
+        _exit(0);
+    }
+
+    stops = 0;
+    sig = 0;
+    traced = 0;
+    for (;;)
+    {
+        if (waitpid(pid, &status, 0) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            explain_output_error_and_die("waitpid: %s", strerror(errno));
+        }
+        if (WIFEXITED(status))
+            break;
+        if (WIFSIGNALED(status))
+            return -2;
+#ifdef BENCH_COUNT_SYSCALLS
+        if (WIFSTOPPED(status))
+        {
+            if (WSTOPSIG(status) == (SIGTRAP | 0x80))
+            {
+                ++stops;
+                sig = 0;
+            }
+            else if (WSTOPSIG(status) == SIGSTOP && !traced)
+            {
+                /* the first stop, the child is ready to be traced */
+                ptrace
+                (
+                    PTRACE_SETOPTIONS,
+                    pid,
+                    0,
+                    (void *)(long)PTRACE_O_TRACESYSGOOD
+                );
+                traced = 1;
+                sig = 0;
+            }
+            else
+                sig = WSTOPSIG(status);
+            ptrace(PTRACE_SYSCALL, pid, 0, (void *)(long)sig);
+        }
+#endif
+    }
+    if (WEXITSTATUS(status) != 0 || !traced)
+        return -1;
+
+    /*
+     * Each system call stops on entry and on exit, except the
+     * _exit at the end, which only stops on entry.
+     */
+    return (stops + 1) / 2 - 1;
+}
+
+
+static void
+measure(const bench_table_t *tp, const char *errname)
+{
+    const explain_errno_info_t *eip;
+    bench_args_t    args;
+    row_t           *rp;
+    double          *sample;
+    double          start;
+    int             nsamples;
+    char            message[3000];
+
+    eip = explain_errno_info_by_name(errname);
+    if (!eip)
+        return;
+    scenario(tp, errname, &args);
+
+    if (rows_length >= rows_maximum)
+    {
+        rows_maximum = rows_maximum * 2 + 64;
+        rows = explain_realloc_or_die(rows, rows_maximum * sizeof(row_t));
+    }
+    rp = &rows[rows_length++];
+    memset(rp, 0, sizeof(*rp));
+    rp->tp = tp;
+    snprintf(rp->function, sizeof(rp->function), "%s", tp->name);
+    snprintf(rp->errname, sizeof(rp->errname), "%s", errname);
+    rp->errnum = eip->error_number;
+
+    rp->syscalls = run_child(tp, eip->error_number, &args);
+    if (rp->syscalls == -2)
+    {
+        rp->crashed = 1;
+        rp->syscalls = -1;
+        return;
+    }
+
+    /* warm up */
+    tp->func(message, sizeof(message), eip->error_number, &args);
+
+    sample = explain_malloc_or_die(iterations * sizeof(double));
+    start = now_usec();
+    for (nsamples = 0; nsamples < iterations; ++nsamples)
+    {
+        double          t0;
+
+        if (nsamples >= 5 && now_usec() - start > budget_usec)
+            break;
+        t0 = now_usec();
+        tp->func(message, sizeof(message), eip->error_number, &args);
+        sample[nsamples] = now_usec() - t0;
+    }
+    qsort(sample, nsamples, sizeof(double), compare_double);
+    rp->p50 = sample[nsamples / 2];
+    rp->p99 = sample[(nsamples * 99) / 100];
+    rp->max = sample[nsamples - 1];
+    free(sample);
+}
+
+
+static void
+measure_function(const bench_table_t *tp)
+{
+    const char      *errnos;
+
+    errnos = (*tp->errnos ? tp->errnos : DEFAULT_ERRNOS);
+    for (;;)
+    {
+        char            errname[32];
+        size_t          len;
+
+        errnos += strspn(errnos, " ");
+        if (!*errnos)
+            break;
+        len = strcspn(errnos, " ");
+        if (len >= sizeof(errname))
+            len = sizeof(errname) - 1;
+        memcpy(errname, errnos, len);
+        errname[len] = '\0';
+        errnos += len;
+
+        measure(tp, errname);
+    }
+}
+
+
+static void
+print_rows(FILE *fp)
+{
+    size_t          j;
+
+    fprintf
+    (
+        fp,
+        "# %-20s %-15s %9s %9s %9s %s\n",
+        "function",
+        "errno",
+        "p50/us",
+        "p99/us",
+        "max/us",
+        "syscalls"
+    );
+    for (j = 0; j < rows_length; ++j)
+    {
+        const row_t     *rp;
+
+        rp = &rows[j];
+        if (rp->crashed)
+        {
+            fprintf(fp, "%-22s %-15s crashed\n", rp->function, rp->errname);
+            continue;
+        }
+        fprintf
+        (
+            fp,
+            "%-22s %-15s %9.1f %9.1f %9.1f ",
+            rp->function,
+            rp->errname,
+            rp->p50,
+            rp->p99,
+            rp->max
+        );
+        if (rp->syscalls < 0)
+            fprintf(fp, "-\n");
+        else
+            fprintf(fp, "%ld\n", rp->syscalls);
+    }
+}
+
+
+/**
+  * The throughput function is used to time the explanations of all of
+  * the rows measured (except those that crashed), in the current
+  * locale.
+  *
+  * @param counts
+  *     The number of times to explain each row.  When first is true,
+  *     they are set, within the same time budget as the latency
+  *     measurements, so that a second pass repeats the same work.
+  * @param first
+  *     true (non-zero) for the first pass
+  * @returns
+  *     explanations per second
+  */
+static double
+throughput(long *counts, int first)
+{
+    double          total_usec;
+    long            total;
+    size_t          j;
+    char            message[3000];
+
+    total_usec = 0;
+    total = 0;
+    for (j = 0; j < rows_length; ++j)
+    {
+        const row_t     *rp;
+        bench_args_t    args;
+        double          start;
+        long            n;
+
+        rp = &rows[j];
+        if (rp->crashed)
+            continue;
+        scenario(rp->tp, rp->errname, &args);
+
+        /* warm up, e.g. load the message catalogue */
+        rp->tp->func(message, sizeof(message), rp->errnum, &args);
+
+        start = now_usec();
+        if (first)
+        {
+            for (n = 0; n < iterations; ++n)
+            {
+                if (n >= 5 && now_usec() - start > budget_usec)
+                    break;
+                rp->tp->func(message, sizeof(message), rp->errnum, &args);
+            }
+            counts[j] = n;
+        }
+        else
+        {
+            for (n = 0; n < counts[j]; ++n)
+                rp->tp->func(message, sizeof(message), rp->errnum, &args);
+        }
+        total_usec += now_usec() - start;
+        total += counts[j];
+    }
+    if (total_usec <= 0)
+        return 0;
+    return total * 1e6 / total_usec;
+}
+
+
+/**
+  * The compare_locale function is used to compare the throughput of
+  * explanations in the C locale, where no translation is done, with
+  * that in the named locale, where every message fragment is looked
+  * up in the message catalogue.
+  */
+static void
+compare_locale(const char *name)
+{
+    long            *counts;
+    double          c_rate;
+    double          rate;
+
+    counts = explain_malloc_or_die((rows_length + 1) * sizeof(long));
+    setlocale(LC_ALL, "C");
+    c_rate = throughput(counts, 1);
+    if (!setlocale(LC_ALL, name))
+    {
+        remove_resources();
+        explain_output_error_and_die("locale \"%s\" unknown", name);
+    }
+    rate = throughput(counts, 0);
+    setlocale(LC_ALL, "C");
+    free(counts);
+
+    printf("# %-20s %12s\n", "locale", "explained/s");
+    printf("# %-20s %12.0f\n", "C", c_rate);
+    printf("# %-20s %12.0f\n", name, rate);
+    if (rate > 0)
+        printf("# %-20s %12.2f\n", "ratio", c_rate / rate);
+}
+
+
+static const row_t *
+find_row(const char *function, const char *errname)
+{
+    size_t          j;
+
+    for (j = 0; j < rows_length; ++j)
+    {
+        if
+        (
+            0 == strcmp(rows[j].function, function)
+        &&
+            0 == strcmp(rows[j].errname, errname)
+        )
+            return &rows[j];
+    }
+    return 0;
+}
+
+
+/**
+  * The compare_baseline function is used to compare the results with
+  * a baseline file, as written by the -w option.  System call counts
+  * must not grow at all, the p99 latency may grow by the tolerance (a
+  * percentage) plus a few microseconds of timer noise.
+  *
+  * @returns
+  *     the number of regressions
+  */
+static int
+compare_baseline(const char *filename, double tolerance)
+{
+    FILE            *fp;
+    char            line[1000];
+    int             linum;
+    int             regressions;
+
+    fp = explain_fopen_or_die(filename, "r");
+    linum = 0;
+    regressions = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        char            function[64];
+        char            errname[32];
+        char            syscalls[32];
+        double          p50;
+        double          p99;
+        double          max;
+        const row_t     *rp;
+        long            base_syscalls;
+
+        ++linum;
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+        if
+        (
+            6
+        !=
+            sscanf
+            (
+                line,
+                "%63s %31s %lf %lf %lf %31s",
+                function,
+                errname,
+                &p50,
+                &p99,
+                &max,
+                syscalls
+            )
+        )
+            continue;
+        rp = find_row(function, errname);
+        if (!rp || rp->crashed)
+            continue;
+
+        base_syscalls = (syscalls[0] == '-' ? -1 : atol(syscalls));
+        if (rp->syscalls >= 0 && base_syscalls >= 0)
+        {
+            if (rp->syscalls > base_syscalls)
+            {
+                explain_output_error
+                (
+                    "%s: %d: %s %s: system calls went from %ld to %ld",
+                    filename,
+                    linum,
+                    function,
+                    errname,
+                    base_syscalls,
+                    rp->syscalls
+                );
+                ++regressions;
+            }
+        }
+        if (rp->p99 > p99 * (1 + tolerance / 100) + 5)
+        {
+            explain_output_error
+            (
+                "%s: %d: %s %s: p99 latency went from %.1fus to %.1fus",
+                filename,
+                linum,
+                function,
+                errname,
+                p99,
+                rp->p99
+            );
+            ++regressions;
+        }
+    }
+    explain_fclose_or_die(fp);
+    return regressions;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char      *baseline;
+    const char      *write_baseline;
+    const char      *locale_name;
+    double          tolerance;
+    size_t          j;
+    int             failures;
+
+    baseline = 0;
+    write_baseline = 0;
+    locale_name = 0;
+    tolerance = 50;
+    for (;;)
+    {
+        int             c;
+
+        c = getopt(argc, argv, "b:l:n:st:Vw:");
+        if (c < 0)
+            break;
+        switch (c)
+        {
+        case 'b':
+            baseline = optarg;
+            break;
+
+        case 'l':
+            locale_name = optarg;
+            break;
+
+        case 'n':
+            iterations = atoi(optarg);
+            if (iterations < 1)
+                usage();
+            break;
+
+        case 's':
+            count_syscalls = 0;
+            break;
+
+        case 't':
+            tolerance = atof(optarg);
+            break;
+
+        case 'V':
+            explain_version_print();
+            return EXIT_SUCCESS;
+
+        case 'w':
+            write_baseline = optarg;
+            break;
+
+        default:
+            usage();
+        }
+    }
+
+    create_resources();
+    if (optind < argc)
+    {
+        for (; optind < argc; ++optind)
+        {
+            for (j = 0; j < bench_table_size; ++j)
+                if (0 == strcmp(bench_table[j].name, argv[optind]))
+                    break;
+            if (j >= bench_table_size)
+            {
+                remove_resources();
+                explain_output_error_and_die
+                (
+                    "function \"%s\" unknown",
+                    argv[optind]
+                );
+            }
+            measure_function(&bench_table[j]);
+        }
+    }
+    else
+    {
+        for (j = 0; j < bench_table_size; ++j)
+            measure_function(&bench_table[j]);
+    }
+    print_rows(stdout);
+    if (locale_name)
+        compare_locale(locale_name);
+    remove_resources();
+
+    if (write_baseline)
+    {
+        FILE            *fp;
+
+        fp = explain_fopen_or_die(write_baseline, "w");
+        print_rows(fp);
+        explain_fclose_or_die(fp);
+    }
+
+    failures = 0;
+    for (j = 0; j < rows_length; ++j)
+    {
+        if (rows[j].crashed)
+        {
+            explain_output_error
+            (
+                "%s %s: the explanation crashed",
+                rows[j].function,
+                rows[j].errname
+            );
+            ++failures;
+        }
+    }
+    if (baseline)
+        failures += compare_baseline(baseline, tolerance);
+    if (failures > 0)
+    {
+        explain_output_error_and_die
+        (
+            "found %d regression%s",
+            failures,
+            (failures == 1 ? "" : "s")
+        );
+    }
+    return EXIT_SUCCESS;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,3363 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This file is generated from the catalogue/ entries
+ * by "codegen --bench-table".  Do not edit it, regenerate it.
+ */
+
+#include <libexplain/ac/stddef.h>
+
+#include <libexplain/accept.h>
+#include <libexplain/accept4.h>
+#include <libexplain/access.h>
+#include <libexplain/acct.h>
+#include <libexplain/acl_from_text.h>
+#include <libexplain/acl_get_fd.h>
+#include <libexplain/acl_get_file.h>
+#include <libexplain/acl_set_fd.h>
+#include <libexplain/acl_set_file.h>
+#include <libexplain/acl_to_text.h>
+#include <libexplain/adjtime.h>
+#include <libexplain/adjtimex.h>
+#include <libexplain/asprintf.h>
+#include <libexplain/bind.h>
+#include <libexplain/calloc.h>
+#include <libexplain/chdir.h>
+#include <libexplain/chmod.h>
+#include <libexplain/chown.h>
+#include <libexplain/chroot.h>
+#include <libexplain/close.h>
+#include <libexplain/closedir.h>
+#include <libexplain/connect.h>
+#include <libexplain/creat.h>
+#include <libexplain/dirfd.h>
+#include <libexplain/dup.h>
+#include <libexplain/dup2.h>
+#include <libexplain/endgrent.h>
+#include <libexplain/eventfd.h>
+#include <libexplain/execlp.h>
+#include <libexplain/execv.h>
+#include <libexplain/execve.h>
+#include <libexplain/execvp.h>
+#include <libexplain/fchdir.h>
+#include <libexplain/fchmod.h>
+#include <libexplain/fchown.h>
+#include <libexplain/fchownat.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fcntl.h>
+#include <libexplain/fdopen.h>
+#include <libexplain/fdopendir.h>
+#include <libexplain/feof.h>
+#include <libexplain/ferror.h>
+#include <libexplain/fflush.h>
+#include <libexplain/fgetc.h>
+#include <libexplain/fgetpos.h>
+#include <libexplain/fgets.h>
+#include <libexplain/fileno.h>
+#include <libexplain/flock.h>
+#include <libexplain/fopen.h>
+#include <libexplain/fork.h>
+#include <libexplain/fpathconf.h>
+#include <libexplain/fprintf.h>
+#include <libexplain/fpurge.h>
+#include <libexplain/fputc.h>
+#include <libexplain/fputs.h>
+#include <libexplain/fread.h>
+#include <libexplain/freopen.h>
+#include <libexplain/fseek.h>
+#include <libexplain/fseeko.h>
+#include <libexplain/fsetpos.h>
+#include <libexplain/fstat.h>
+#include <libexplain/fstatat.h>
+#include <libexplain/fstatfs.h>
+#include <libexplain/fstatvfs.h>
+#include <libexplain/fsync.h>
+#include <libexplain/ftell.h>
+#include <libexplain/ftello.h>
+#include <libexplain/ftime.h>
+#include <libexplain/ftruncate.h>
+#include <libexplain/futimens.h>
+#include <libexplain/futimes.h>
+#include <libexplain/futimesat.h>
+#include <libexplain/fwrite.h>
+#include <libexplain/getc.h>
+#include <libexplain/getchar.h>
+#include <libexplain/getcwd.h>
+#include <libexplain/getdomainname.h>
+#include <libexplain/getgrouplist.h>
+#include <libexplain/getgroups.h>
+#include <libexplain/gethostbyname.h>
+#include <libexplain/gethostid.h>
+#include <libexplain/gethostname.h>
+#include <libexplain/getpeername.h>
+#include <libexplain/getpgid.h>
+#include <libexplain/getpgrp.h>
+#include <libexplain/getpriority.h>
+#include <libexplain/getresgid.h>
+#include <libexplain/getresuid.h>
+#include <libexplain/getrlimit.h>
+#include <libexplain/getrusage.h>
+#include <libexplain/getsockname.h>
+#include <libexplain/getsockopt.h>
+#include <libexplain/gettimeofday.h>
+#include <libexplain/getw.h>
+#include <libexplain/iconv.h>
+#include <libexplain/iconv_close.h>
+#include <libexplain/iconv_open.h>
+#include <libexplain/ioctl.h>
+#include <libexplain/kill.h>
+#include <libexplain/lchmod.h>
+#include <libexplain/lchown.h>
+#include <libexplain/lchownat.h>
+#include <libexplain/link.h>
+#include <libexplain/linkat.h>
+#include <libexplain/listen.h>
+#include <libexplain/lseek.h>
+#include <libexplain/lstat.h>
+#include <libexplain/lutimes.h>
+#include <libexplain/malloc.h>
+#include <libexplain/mkdir.h>
+#include <libexplain/mkdtemp.h>
+#include <libexplain/mknod.h>
+#include <libexplain/mkostemp.h>
+#include <libexplain/mkstemp.h>
+#include <libexplain/mktemp.h>
+#include <libexplain/mmap.h>
+#include <libexplain/mount.h>
+#include <libexplain/munmap.h>
+#include <libexplain/nanosleep.h>
+#include <libexplain/nice.h>
+#include <libexplain/open.h>
+#include <libexplain/openat.h>
+#include <libexplain/opendir.h>
+#include <libexplain/pathconf.h>
+#include <libexplain/pclose.h>
+#include <libexplain/pipe.h>
+#include <libexplain/pipe2.h>
+#include <libexplain/poll.h>
+#include <libexplain/popen.h>
+#include <libexplain/pread.h>
+#include <libexplain/printf.h>
+#include <libexplain/ptrace.h>
+#include <libexplain/putc.h>
+#include <libexplain/putchar.h>
+#include <libexplain/putenv.h>
+#include <libexplain/puts.h>
+#include <libexplain/putw.h>
+#include <libexplain/pwrite.h>
+#include <libexplain/raise.h>
+#include <libexplain/read.h>
+#include <libexplain/readdir.h>
+#include <libexplain/readlink.h>
+#include <libexplain/readv.h>
+#include <libexplain/realloc.h>
+#include <libexplain/realpath.h>
+#include <libexplain/remove.h>
+#include <libexplain/rename.h>
+#include <libexplain/rmdir.h>
+#include <libexplain/select.h>
+#include <libexplain/setbuf.h>
+#include <libexplain/setbuffer.h>
+#include <libexplain/setdomainname.h>
+#include <libexplain/setenv.h>
+#include <libexplain/setgid.h>
+#include <libexplain/setgrent.h>
+#include <libexplain/setgroups.h>
+#include <libexplain/sethostname.h>
+#include <libexplain/setlinebuf.h>
+#include <libexplain/setpgid.h>
+#include <libexplain/setpgrp.h>
+#include <libexplain/setpriority.h>
+#include <libexplain/setregid.h>
+#include <libexplain/setresgid.h>
+#include <libexplain/setresuid.h>
+#include <libexplain/setreuid.h>
+#include <libexplain/setsid.h>
+#include <libexplain/setsockopt.h>
+#include <libexplain/settimeofday.h>
+#include <libexplain/setuid.h>
+#include <libexplain/setvbuf.h>
+#include <libexplain/shmat.h>
+#include <libexplain/shmctl.h>
+#include <libexplain/signalfd.h>
+#include <libexplain/sleep.h>
+#include <libexplain/snprintf.h>
+#include <libexplain/socket.h>
+#include <libexplain/socketpair.h>
+#include <libexplain/sprintf.h>
+#include <libexplain/stat.h>
+#include <libexplain/statfs.h>
+#include <libexplain/statvfs.h>
+#include <libexplain/stime.h>
+#include <libexplain/strcoll.h>
+#include <libexplain/strdup.h>
+#include <libexplain/strndup.h>
+#include <libexplain/strtod.h>
+#include <libexplain/strtof.h>
+#include <libexplain/strtol.h>
+#include <libexplain/strtold.h>
+#include <libexplain/strtoll.h>
+#include <libexplain/strtoul.h>
+#include <libexplain/strtoull.h>
+#include <libexplain/symlink.h>
+#include <libexplain/system.h>
+#include <libexplain/tcdrain.h>
+#include <libexplain/tcflow.h>
+#include <libexplain/tcflush.h>
+#include <libexplain/tcgetattr.h>
+#include <libexplain/tcsendbreak.h>
+#include <libexplain/tcsetattr.h>
+#include <libexplain/telldir.h>
+#include <libexplain/tempnam.h>
+#include <libexplain/time.h>
+#include <libexplain/timerfd_create.h>
+#include <libexplain/tmpfile.h>
+#include <libexplain/tmpnam.h>
+#include <libexplain/truncate.h>
+#include <libexplain/uname.h>
+#include <libexplain/ungetc.h>
+#include <libexplain/unlink.h>
+#include <libexplain/unsetenv.h>
+#include <libexplain/usleep.h>
+#include <libexplain/ustat.h>
+#include <libexplain/utime.h>
+#include <libexplain/utimens.h>
+#include <libexplain/utimensat.h>
+#include <libexplain/utimes.h>
+#include <libexplain/vasprintf.h>
+#include <libexplain/vfork.h>
+#include <libexplain/vfprintf.h>
+#include <libexplain/vprintf.h>
+#include <libexplain/vsnprintf.h>
+#include <libexplain/vsprintf.h>
+#include <libexplain/wait.h>
+#include <libexplain/wait3.h>
+#include <libexplain/wait4.h>
+#include <libexplain/waitpid.h>
+#include <libexplain/write.h>
+#include <libexplain/writev.h>
+
+#include <test/bench/bench.h>
+
+
+static void
+invoke_accept(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_accept(message, message_size, errnum, a->fildes,
+        a->data, a->data);
+}
+
+
+static void
+invoke_accept4(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_accept4(message, message_size, errnum, a->fildes,
+        a->data, a->data, 0);
+}
+
+
+static void
+invoke_access(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_access(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_acct(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acct(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_acl_from_text(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_from_text(message, message_size, errnum,
+        a->data);
+}
+
+
+static void
+invoke_acl_get_fd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_get_fd(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_acl_get_file(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_get_file(message, message_size, errnum, a->path,
+        0);
+}
+
+
+static void
+invoke_acl_set_fd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_set_fd(message, message_size, errnum, a->fildes,
+        0);
+}
+
+
+static void
+invoke_acl_set_file(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_set_file(message, message_size, errnum, a->path,
+        0, 0);
+}
+
+
+static void
+invoke_acl_to_text(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_acl_to_text(message, message_size, errnum, 0,
+        a->data);
+}
+
+
+static void
+invoke_adjtime(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_adjtime(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_adjtimex(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_adjtimex(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_asprintf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_asprintf(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_bind(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_bind(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_calloc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_calloc(message, message_size, errnum, 0,
+        a->data_size);
+}
+
+
+static void
+invoke_chdir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_chdir(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_chmod(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_chmod(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_chown(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_chown(message, message_size, errnum, a->path, 0, 0);
+}
+
+
+static void
+invoke_chroot(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_chroot(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_close(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_close(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_closedir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_closedir(message, message_size, errnum, a->dir);
+}
+
+
+static void
+invoke_connect(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_connect(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_creat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_creat(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_dirfd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_dirfd(message, message_size, errnum, a->dir);
+}
+
+
+static void
+invoke_dup(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_dup(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_dup2(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_dup2(message, message_size, errnum, a->fildes,
+        a->fildes);
+}
+
+
+static void
+invoke_endgrent(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_endgrent(message, message_size, errnum);
+}
+
+
+static void
+invoke_eventfd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_eventfd(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_execlp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_execlp(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_execv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_execv(message, message_size, errnum, a->path,
+        a->argv);
+}
+
+
+static void
+invoke_execve(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_execve(message, message_size, errnum, a->path,
+        a->argv, a->argv);
+}
+
+
+static void
+invoke_execvp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_execvp(message, message_size, errnum, a->path,
+        a->argv);
+}
+
+
+static void
+invoke_fchdir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fchdir(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_fchmod(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fchmod(message, message_size, errnum, a->fildes, 0);
+}
+
+
+static void
+invoke_fchown(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fchown(message, message_size, errnum, a->fildes, 0,
+        0);
+}
+
+
+static void
+invoke_fchownat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fchownat(message, message_size, errnum, a->fildes,
+        a->path, 0, 0, 0);
+}
+
+
+static void
+invoke_fclose(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fclose(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_fcntl(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fcntl(message, message_size, errnum, a->fildes, 0,
+        0);
+}
+
+
+static void
+invoke_fdopen(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fdopen(message, message_size, errnum, a->fildes,
+        "r");
+}
+
+
+static void
+invoke_fdopendir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fdopendir(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_feof(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_feof(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_ferror(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ferror(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_fflush(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fflush(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_fgetc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fgetc(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_fgetpos(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fgetpos(message, message_size, errnum, a->fp,
+        a->data);
+}
+
+
+static void
+invoke_fgets(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fgets(message, message_size, errnum, a->data,
+        a->data_size, a->fp);
+}
+
+
+static void
+invoke_fileno(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fileno(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_flock(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_flock(message, message_size, errnum, a->fildes, 0);
+}
+
+
+static void
+invoke_fopen(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fopen(message, message_size, errnum, a->path, "r");
+}
+
+
+static void
+invoke_fork(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_fork(message, message_size, errnum);
+}
+
+
+static void
+invoke_fpathconf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fpathconf(message, message_size, errnum, a->fildes,
+        0);
+}
+
+
+static void
+invoke_fprintf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fprintf(message, message_size, errnum, a->fp,
+        a->data);
+}
+
+
+static void
+invoke_fpurge(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fpurge(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_fputc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fputc(message, message_size, errnum, 0, a->fp);
+}
+
+
+static void
+invoke_fputs(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fputs(message, message_size, errnum, a->data, a->fp);
+}
+
+
+static void
+invoke_fread(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fread(message, message_size, errnum, a->data,
+        a->data_size, 0, a->fp);
+}
+
+
+static void
+invoke_freopen(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_freopen(message, message_size, errnum, a->path, "r",
+        a->fp);
+}
+
+
+static void
+invoke_fseek(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fseek(message, message_size, errnum, a->fp, 0, 0);
+}
+
+
+static void
+invoke_fseeko(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fseeko(message, message_size, errnum, a->fp, 0, 0);
+}
+
+
+static void
+invoke_fsetpos(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fsetpos(message, message_size, errnum, a->fp,
+        a->data);
+}
+
+
+static void
+invoke_fstat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fstat(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_fstatat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fstatat(message, message_size, errnum, a->fildes,
+        a->path, a->data, 0);
+}
+
+
+static void
+invoke_fstatfs(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fstatfs(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_fstatvfs(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fstatvfs(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_fsync(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fsync(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_ftell(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ftell(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_ftello(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ftello(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_ftime(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ftime(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_ftruncate(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ftruncate(message, message_size, errnum, a->fildes,
+        0);
+}
+
+
+static void
+invoke_futimens(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_futimens(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_futimes(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_futimes(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_futimesat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_futimesat(message, message_size, errnum, a->fildes,
+        a->path, a->data);
+}
+
+
+static void
+invoke_fwrite(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_fwrite(message, message_size, errnum, a->data,
+        a->data_size, 0, a->fp);
+}
+
+
+static void
+invoke_getc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getc(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_getchar(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_getchar(message, message_size, errnum);
+}
+
+
+static void
+invoke_getcwd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getcwd(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_getdomainname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getdomainname(message, message_size, errnum,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_getgrouplist(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getgrouplist(message, message_size, errnum, a->data,
+        0, a->data, a->data);
+}
+
+
+static void
+invoke_getgroups(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getgroups(message, message_size, errnum,
+        a->data_size, a->data);
+}
+
+
+static void
+invoke_gethostbyname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_gethostbyname(message, message_size, errnum,
+        a->data);
+}
+
+
+static void
+invoke_gethostid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_gethostid(message, message_size, errnum);
+}
+
+
+static void
+invoke_gethostname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_gethostname(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_getpeername(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getpeername(message, message_size, errnum,
+        a->fildes, a->data, a->data);
+}
+
+
+static void
+invoke_getpgid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_getpgid(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_getpgrp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_getpgrp(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_getpriority(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_getpriority(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_getresgid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getresgid(message, message_size, errnum, a->data,
+        a->data, a->data);
+}
+
+
+static void
+invoke_getresuid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getresuid(message, message_size, errnum, a->data,
+        a->data, a->data);
+}
+
+
+static void
+invoke_getrlimit(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getrlimit(message, message_size, errnum, 0, a->data);
+}
+
+
+static void
+invoke_getrusage(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getrusage(message, message_size, errnum, 0, a->data);
+}
+
+
+static void
+invoke_getsockname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getsockname(message, message_size, errnum,
+        a->fildes, a->data, a->data);
+}
+
+
+static void
+invoke_getsockopt(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getsockopt(message, message_size, errnum, a->fildes,
+        0, 0, a->data, a->data);
+}
+
+
+static void
+invoke_gettimeofday(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_gettimeofday(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_getw(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_getw(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_iconv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_iconv(message, message_size, errnum, 0, a->data,
+        a->data, a->data, a->data);
+}
+
+
+static void
+invoke_iconv_close(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_iconv_close(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_iconv_open(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_iconv_open(message, message_size, errnum, "UTF-8",
+        "UTF-8");
+}
+
+
+static void
+invoke_ioctl(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ioctl(message, message_size, errnum, a->fildes, 0,
+        a->data);
+}
+
+
+static void
+invoke_kill(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_kill(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_lchmod(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lchmod(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_lchown(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lchown(message, message_size, errnum, a->path, 0, 0);
+}
+
+
+static void
+invoke_lchownat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lchownat(message, message_size, errnum, a->fildes,
+        a->path, 0, 0);
+}
+
+
+static void
+invoke_link(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_link(message, message_size, errnum, a->path,
+        a->path2);
+}
+
+
+static void
+invoke_linkat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_linkat(message, message_size, errnum, a->fildes,
+        a->path, a->fildes, a->path2, 0);
+}
+
+
+static void
+invoke_listen(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_listen(message, message_size, errnum, a->fildes, 0);
+}
+
+
+static void
+invoke_lseek(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lseek(message, message_size, errnum, a->fildes, 0,
+        0);
+}
+
+
+static void
+invoke_lstat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lstat(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_lutimes(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_lutimes(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_malloc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_malloc(message, message_size, errnum, a->data_size);
+}
+
+
+static void
+invoke_mkdir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mkdir(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_mkdtemp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mkdtemp(message, message_size, errnum,
+        (char *)a->path);
+}
+
+
+static void
+invoke_mknod(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mknod(message, message_size, errnum, a->path, 0, 0);
+}
+
+
+static void
+invoke_mkostemp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mkostemp(message, message_size, errnum,
+        (char *)a->path, 0);
+}
+
+
+static void
+invoke_mkstemp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mkstemp(message, message_size, errnum,
+        (char *)a->path);
+}
+
+
+static void
+invoke_mktemp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mktemp(message, message_size, errnum,
+        (char *)a->path);
+}
+
+
+static void
+invoke_mmap(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mmap(message, message_size, errnum, a->data,
+        a->data_size, 0, 0, a->fildes, 0);
+}
+
+
+static void
+invoke_mount(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_mount(message, message_size, errnum, a->path,
+        a->path2, a->data, 0, a->data);
+}
+
+
+static void
+invoke_munmap(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_munmap(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_nanosleep(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_nanosleep(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_nice(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_nice(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_open(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_open(message, message_size, errnum, a->path, 0, 0);
+}
+
+
+static void
+invoke_openat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_openat(message, message_size, errnum, a->fildes,
+        a->path, 0, 0);
+}
+
+
+static void
+invoke_opendir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_opendir(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_pathconf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pathconf(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_pclose(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pclose(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_pipe(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pipe(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_pipe2(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pipe2(message, message_size, errnum, a->data, 0);
+}
+
+
+static void
+invoke_poll(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_poll(message, message_size, errnum, a->data,
+        a->data_size, 0);
+}
+
+
+static void
+invoke_popen(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_popen(message, message_size, errnum, a->data, "r");
+}
+
+
+static void
+invoke_pread(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pread(message, message_size, errnum, a->fildes,
+        a->data, a->data_size, 0);
+}
+
+
+static void
+invoke_printf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_printf(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_ptrace(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ptrace(message, message_size, errnum, 0, 0, a->data,
+        a->data);
+}
+
+
+static void
+invoke_putc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_putc(message, message_size, errnum, 0, a->fp);
+}
+
+
+static void
+invoke_putchar(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_putchar(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_putenv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_putenv(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_puts(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_puts(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_putw(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_putw(message, message_size, errnum, 0, a->fp);
+}
+
+
+static void
+invoke_pwrite(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_pwrite(message, message_size, errnum, a->fildes,
+        a->data, a->data_size, 0);
+}
+
+
+static void
+invoke_raise(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_raise(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_read(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_read(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_readdir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_readdir(message, message_size, errnum, a->dir);
+}
+
+
+static void
+invoke_readlink(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_readlink(message, message_size, errnum, a->path,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_readv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_readv(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_realloc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_realloc(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_realpath(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_realpath(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_remove(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_remove(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_rename(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_rename(message, message_size, errnum, a->path,
+        a->path2);
+}
+
+
+static void
+invoke_rmdir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_rmdir(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_select(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_select(message, message_size, errnum, 0, a->data,
+        a->data, a->data, a->data);
+}
+
+
+static void
+invoke_setbuf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setbuf(message, message_size, errnum, a->fp,
+        a->data);
+}
+
+
+static void
+invoke_setbuffer(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setbuffer(message, message_size, errnum, a->fp,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_setdomainname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setdomainname(message, message_size, errnum,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_setenv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setenv(message, message_size, errnum, a->data,
+        a->data, 0);
+}
+
+
+static void
+invoke_setgid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setgid(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_setgrent(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setgrent(message, message_size, errnum);
+}
+
+
+static void
+invoke_setgroups(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setgroups(message, message_size, errnum,
+        a->data_size, a->data);
+}
+
+
+static void
+invoke_sethostname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_sethostname(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_setlinebuf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setlinebuf(message, message_size, errnum, a->fp);
+}
+
+
+static void
+invoke_setpgid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setpgid(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_setpgrp(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setpgrp(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_setpriority(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setpriority(message, message_size, errnum, 0, 0, 0);
+}
+
+
+static void
+invoke_setregid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setregid(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_setresgid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setresgid(message, message_size, errnum, 0, 0, 0);
+}
+
+
+static void
+invoke_setresuid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setresuid(message, message_size, errnum, 0, 0, 0);
+}
+
+
+static void
+invoke_setreuid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setreuid(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_setsid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setsid(message, message_size, errnum);
+}
+
+
+static void
+invoke_setsockopt(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setsockopt(message, message_size, errnum, a->fildes,
+        0, 0, a->data, a->data_size);
+}
+
+
+static void
+invoke_settimeofday(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_settimeofday(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_setuid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_setuid(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_setvbuf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_setvbuf(message, message_size, errnum, a->fp,
+        a->data, 0, a->data_size);
+}
+
+
+static void
+invoke_shmat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_shmat(message, message_size, errnum, 0, a->data, 0);
+}
+
+
+static void
+invoke_shmctl(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_shmctl(message, message_size, errnum, 0, 0, a->data);
+}
+
+
+static void
+invoke_signalfd(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_signalfd(message, message_size, errnum, a->fildes,
+        a->data, 0);
+}
+
+
+static void
+invoke_sleep(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_sleep(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_snprintf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_snprintf(message, message_size, errnum, a->data,
+        a->data_size, a->data);
+}
+
+
+static void
+invoke_socket(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_socket(message, message_size, errnum, 0, 0, 0);
+}
+
+
+static void
+invoke_socketpair(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_socketpair(message, message_size, errnum, 0, 0, 0,
+        a->data);
+}
+
+
+static void
+invoke_sprintf(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_sprintf(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_stat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_stat(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_statfs(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_statfs(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_statvfs(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_statvfs(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_stime(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_stime(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_strcoll(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strcoll(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_strdup(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strdup(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_strndup(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strndup(message, message_size, errnum, a->data,
+        a->data_size);
+}
+
+
+static void
+invoke_strtod(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtod(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_strtof(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtof(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_strtol(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtol(message, message_size, errnum, a->data,
+        a->data, 0);
+}
+
+
+static void
+invoke_strtold(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtold(message, message_size, errnum, a->data,
+        a->data);
+}
+
+
+static void
+invoke_strtoll(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtoll(message, message_size, errnum, a->data,
+        a->data, 0);
+}
+
+
+static void
+invoke_strtoul(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtoul(message, message_size, errnum, a->data,
+        a->data, 0);
+}
+
+
+static void
+invoke_strtoull(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_strtoull(message, message_size, errnum, a->data,
+        a->data, 0);
+}
+
+
+static void
+invoke_symlink(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_symlink(message, message_size, errnum, a->path,
+        a->path2);
+}
+
+
+static void
+invoke_system(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_system(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_tcdrain(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcdrain(message, message_size, errnum, a->fildes);
+}
+
+
+static void
+invoke_tcflow(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcflow(message, message_size, errnum, a->fildes, 0);
+}
+
+
+static void
+invoke_tcflush(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcflush(message, message_size, errnum, a->fildes, 0);
+}
+
+
+static void
+invoke_tcgetattr(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcgetattr(message, message_size, errnum, a->fildes,
+        a->data);
+}
+
+
+static void
+invoke_tcsendbreak(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcsendbreak(message, message_size, errnum,
+        a->fildes, 0);
+}
+
+
+static void
+invoke_tcsetattr(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tcsetattr(message, message_size, errnum, a->fildes,
+        0, a->data);
+}
+
+
+static void
+invoke_telldir(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_telldir(message, message_size, errnum, a->dir);
+}
+
+
+static void
+invoke_tempnam(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tempnam(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_time(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_time(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_timerfd_create(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_timerfd_create(message, message_size, errnum, 0, 0);
+}
+
+
+static void
+invoke_tmpfile(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_tmpfile(message, message_size, errnum);
+}
+
+
+static void
+invoke_tmpnam(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_tmpnam(message, message_size, errnum,
+        (char *)a->path);
+}
+
+
+static void
+invoke_truncate(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_truncate(message, message_size, errnum, a->path, 0);
+}
+
+
+static void
+invoke_uname(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_uname(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_ungetc(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ungetc(message, message_size, errnum, 0, a->fp);
+}
+
+
+static void
+invoke_unlink(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_unlink(message, message_size, errnum, a->path);
+}
+
+
+static void
+invoke_unsetenv(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_unsetenv(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_usleep(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_usleep(message, message_size, errnum, 0);
+}
+
+
+static void
+invoke_ustat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_ustat(message, message_size, errnum, 0, a->data);
+}
+
+
+static void
+invoke_utime(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_utime(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_utimens(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_utimens(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_utimensat(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_utimensat(message, message_size, errnum, a->fildes,
+        a->path, a->data, 0);
+}
+
+
+static void
+invoke_utimes(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_utimes(message, message_size, errnum, a->path,
+        a->data);
+}
+
+
+static void
+invoke_vfork(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    (void)a;
+    explain_message_errno_vfork(message, message_size, errnum);
+}
+
+
+static void
+invoke_wait(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_wait(message, message_size, errnum, a->data);
+}
+
+
+static void
+invoke_wait3(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_wait3(message, message_size, errnum, a->data, 0,
+        a->data);
+}
+
+
+static void
+invoke_wait4(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_wait4(message, message_size, errnum, 0, a->data, 0,
+        a->data);
+}
+
+
+static void
+invoke_waitpid(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_waitpid(message, message_size, errnum, 0, a->data,
+        0);
+}
+
+
+static void
+invoke_write(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_write(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+static void
+invoke_writev(char *message, int message_size, int errnum,
+    const bench_args_t *a)
+{
+    explain_message_errno_writev(message, message_size, errnum, a->fildes,
+        a->data, a->data_size);
+}
+
+
+const bench_table_t bench_table[] =
+{
+    {
+        "accept",
+        invoke_accept,
+        "EAGAIN EWOULDBLOCK EBADF ECONNABORTED EFAULT EHOSTDOWN EHOSTUNREACH "
+        "EINTR EINVAL EMFILE ENETDOWN ENETUNREACH ENFILE ENOBUFS ENOMEM "
+        "ENONET ENOPROTOOPT ENOTSOCK ENOSYS EOPNOTSUPP ENOSR EPERM EPROTO "
+        "EPROTONOSUPPORT ERESTART ESOCKTNOSUPPORT ETIMEDOUT"
+    },
+    {
+        "accept4",
+        invoke_accept4,
+        "EAGAIN EWOULDBLOCK EBADF ECONNABORTED EFAULT EHOSTDOWN EHOSTUNREACH "
+        "EINTR EINVAL EMFILE ENETDOWN ENETUNREACH ENFILE ENOBUFS ENOMEM "
+        "ENONET ENOPROTOOPT ENOTSOCK ENOSYS EOPNOTSUPP ENOSR EPERM EPROTO "
+        "EPROTONOSUPPORT ERESTART ESOCKTNOSUPPORT ETIMEDOUT"
+    },
+    {
+        "access",
+        invoke_access,
+        "EACCES ELOOP EMLINK ENAMETOOLONG ENOENT ENOTDIR EROFS EFAULT EINVAL "
+        "EIO ENOMEM ETXTBSY"
+    },
+    {
+        "acct",
+        invoke_acct,
+        "EACCES EFAULT EIO EISDIR ELOOP ENAMETOOLONG ENFILE ENOENT ENOMEM "
+        "EUSERS ENOSYS EOPNOTSUPP ENOTDIR EPERM EROFS"
+    },
+    {
+        "acl_from_text",
+        invoke_acl_from_text,
+        "EINVAL ENOMEM"
+    },
+    {
+        "acl_get_fd",
+        invoke_acl_get_fd,
+        "EBADF ENOMEM ENOTSUP ENOSYS EOPNOTSUP"
+    },
+    {
+        "acl_get_file",
+        invoke_acl_get_file,
+        "EFAULT EACCES EINVAL ENAMETOOLONG ENOENT ENOMEM ENOTDIR ELOOP EMLINK "
+        "ENOTSUP ENOSYS EOPNOTSUP"
+    },
+    {
+        "acl_set_fd",
+        invoke_acl_set_fd,
+        "EBADF EINVAL ENOSPC ENOSYS ENOTSUP EOPNOTSUP EPERM EROFS"
+    },
+    {
+        "acl_set_file",
+        invoke_acl_set_file,
+        "EFAULT EACCES EINVAL ENAMETOOLONG ENOENT ENOSPC ENOTDIR ENOTSUP "
+        "ENOSYS EOPNOTSUP EPERM EROFS"
+    },
+    {
+        "acl_to_text",
+        invoke_acl_to_text,
+        "EINVAL ENOMEM"
+    },
+    {
+        "adjtime",
+        invoke_adjtime,
+        "EFAULT EINVAL EPERM"
+    },
+    {
+        "adjtimex",
+        invoke_adjtimex,
+        "EFAULT EINVAL ENOSYS EPERM"
+    },
+    {
+        "asprintf",
+        invoke_asprintf,
+        "ERANGE ENOMEM EINVAL EBADF"
+    },
+    {
+        "bind",
+        invoke_bind,
+        "EACCES EADDRINUSE EBADF EAFNOSUPPORT EINVAL ENOTSOCK EADDRNOTAVAIL "
+        "EFAULT ELOOP ENAMETOOLONG ENOENT ENOMEM ENOTDIR EROFS"
+    },
+    {
+        "calloc",
+        invoke_calloc,
+        ""
+    },
+    {
+        "chdir",
+        invoke_chdir,
+        "EACCES EFAULT EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM ENOTDIR"
+    },
+    {
+        "chmod",
+        invoke_chmod,
+        "EACCES EFAULT EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM ENOTDIR "
+        "EPERM EROFS"
+    },
+    {
+        "chown",
+        invoke_chown,
+        "EACCES EFAULT EIO EINVAL ELOOP ENAMETOOLONG ENOENT ENOMEM ENOTDIR "
+        "EPERM EROFS EBADF"
+    },
+    {
+        "chroot",
+        invoke_chroot,
+        "EACCES EFAULT EIO ELOOP ENAMETOOLONG ENOENT ENOMEM ENOTDIR EPERM"
+    },
+    {
+        "close",
+        invoke_close,
+        "EBADF EINTR EIO EAGAIN EWOULDBLOCK"
+    },
+    {
+        "closedir",
+        invoke_closedir,
+        ""
+    },
+    {
+        "connect",
+        invoke_connect,
+        "EACCES EPERM EADDRINUSE EAFNOSUPPORT EAGAIN EALREADY EBADF "
+        "ECONNREFUSED EFAULT EINPROGRESS EINTR EISCONN ENETUNREACH ENOTSOCK "
+        "ETIMEDOUT"
+    },
+    {
+        "creat",
+        invoke_creat,
+        ""
+    },
+    {
+        "dirfd",
+        invoke_dirfd,
+        "EFAULT EBADF EINVAL ENOSYS EOPNOTSUPP"
+    },
+    {
+        "dup",
+        invoke_dup,
+        "EBADF EBUSY EINTR EMFILE"
+    },
+    {
+        "dup2",
+        invoke_dup2,
+        "EBADF EINVAL EBUSY EINTR EMFILE"
+    },
+    {
+        "endgrent",
+        invoke_endgrent,
+        ""
+    },
+    {
+        "eventfd",
+        invoke_eventfd,
+        "EINVAL EMFILE ENFILE ENODEV ENOMEM ENOSYS"
+    },
+    {
+        "execlp",
+        invoke_execlp,
+        ""
+    },
+    {
+        "execv",
+        invoke_execv,
+        ""
+    },
+    {
+        "execve",
+        invoke_execve,
+        "E2BIG EACCES EFAULT EINTR EINVAL EIO EISDIR ELIBBAD ELOOP EMFILE "
+        "ENAMETOOLONG ENFILE ENOENT ENOEXEC ENOMEM ENOTDIR EPERM ETXTBSY"
+    },
+    {
+        "execvp",
+        invoke_execvp,
+        "EACCES ENOENT ESTALE ENOTDIR ENODEV ETIMEDOUT"
+    },
+    {
+        "fchdir",
+        invoke_fchdir,
+        "EBADF ENOTDIR EACCES"
+    },
+    {
+        "fchmod",
+        invoke_fchmod,
+        "EIO ENOMEM EPERM EROFS EBADF"
+    },
+    {
+        "fchown",
+        invoke_fchown,
+        ""
+    },
+    {
+        "fchownat",
+        invoke_fchownat,
+        "EBADF EINVAL ENOTDIR ENOMEM"
+    },
+    {
+        "fclose",
+        invoke_fclose,
+        "EFAULT EFBIG EINVAL ENOSPC EPIPE EBADF EINTR EIO"
+    },
+    {
+        "fcntl",
+        invoke_fcntl,
+        "EACCES EAGAIN EBADF EDEADLK EFAULT EINTR EINVAL EMFILE ENOLCK EPERM"
+    },
+    {
+        "fdopen",
+        invoke_fdopen,
+        "EINVAL ENOMEM"
+    },
+    {
+        "fdopendir",
+        invoke_fdopendir,
+        "EBADF ENOMEM ENOTDIR EINVAL ENOSYS"
+    },
+    {
+        "feof",
+        invoke_feof,
+        "EBADF EINVAL"
+    },
+    {
+        "ferror",
+        invoke_ferror,
+        "EAGAIN EBADF EFAULT EFBIG EINTR EINVAL EIO ENOSPC EPIPE EISDIR"
+    },
+    {
+        "fflush",
+        invoke_fflush,
+        "EBADF EINVAL"
+    },
+    {
+        "fgetc",
+        invoke_fgetc,
+        ""
+    },
+    {
+        "fgetpos",
+        invoke_fgetpos,
+        "EBADF EINVAL"
+    },
+    {
+        "fgets",
+        invoke_fgets,
+        ""
+    },
+    {
+        "fileno",
+        invoke_fileno,
+        "EINVAL EBADF"
+    },
+    {
+        "flock",
+        invoke_flock,
+        "EBADF EINTR EINVAL ENOLCK EAGAIN EWOULDBLOCK"
+    },
+    {
+        "fopen",
+        invoke_fopen,
+        "EINVAL ENOMEM"
+    },
+    {
+        "fork",
+        invoke_fork,
+        "EAGAIN ENOMEM"
+    },
+    {
+        "fpathconf",
+        invoke_fpathconf,
+        "EBADF EINVAL"
+    },
+    {
+        "fprintf",
+        invoke_fprintf,
+        ""
+    },
+    {
+        "fpurge",
+        invoke_fpurge,
+        "EBADF"
+    },
+    {
+        "fputc",
+        invoke_fputc,
+        ""
+    },
+    {
+        "fputs",
+        invoke_fputs,
+        ""
+    },
+    {
+        "fread",
+        invoke_fread,
+        ""
+    },
+    {
+        "freopen",
+        invoke_freopen,
+        "EFAULT EFBIG ENOSPC EPIPE EBADF EINTR EIO"
+    },
+    {
+        "fseek",
+        invoke_fseek,
+        "EBADF"
+    },
+    {
+        "fseeko",
+        invoke_fseeko,
+        "EBADF"
+    },
+    {
+        "fsetpos",
+        invoke_fsetpos,
+        "EBADF EIO EINVAL"
+    },
+    {
+        "fstat",
+        invoke_fstat,
+        "EBADF ENOMEM"
+    },
+    {
+        "fstatat",
+        invoke_fstatat,
+        "EBADF EINVAL ENOTDIR"
+    },
+    {
+        "fstatfs",
+        invoke_fstatfs,
+        "EBADF EFAULT EINTR EIO ENOMEM ENOSYS EOVERFLOW"
+    },
+    {
+        "fstatvfs",
+        invoke_fstatvfs,
+        "EBADF EFAULT EINTR EIO ENOMEM ENOSYS EOPNOTSUPP ENOTSUP EOVERFLOW"
+    },
+    {
+        "fsync",
+        invoke_fsync,
+        "EBADF EIO EROFS EINVAL ENOSYS EOPNOTSUPP ENOTSUP"
+    },
+    {
+        "ftell",
+        invoke_ftell,
+        "EBADF EINVAL"
+    },
+    {
+        "ftello",
+        invoke_ftello,
+        "EBADF EINVAL"
+    },
+    {
+        "ftime",
+        invoke_ftime,
+        "EFAULT"
+    },
+    {
+        "ftruncate",
+        invoke_ftruncate,
+        "EACCES EBADF EFBIG EINTR EINVAL EIO EISDIR EPERM EROFS ETXTBSY"
+    },
+    {
+        "futimens",
+        invoke_futimens,
+        "EACCES EBADF EFAULT EINVAL EPERM EROFS"
+    },
+    {
+        "futimes",
+        invoke_futimes,
+        "EBADF EFAULT EACCES EPERM EROFS"
+    },
+    {
+        "futimesat",
+        invoke_futimesat,
+        "EBADF ENOTDIR"
+    },
+    {
+        "fwrite",
+        invoke_fwrite,
+        ""
+    },
+    {
+        "getc",
+        invoke_getc,
+        ""
+    },
+    {
+        "getchar",
+        invoke_getchar,
+        ""
+    },
+    {
+        "getcwd",
+        invoke_getcwd,
+        "EINVAL ERANGE EACCES ENOMEM EFAULT ENOENT"
+    },
+    {
+        "getdomainname",
+        invoke_getdomainname,
+        "EFAULT EINVAL ENAMETOOLONG ENOSYS"
+    },
+    {
+        "getgrouplist",
+        invoke_getgrouplist,
+        "ERANGE"
+    },
+    {
+        "getgroups",
+        invoke_getgroups,
+        "EFAULT EINVAL"
+    },
+    {
+        "gethostbyname",
+        invoke_gethostbyname,
+        ""
+    },
+    {
+        "gethostid",
+        invoke_gethostid,
+        ""
+    },
+    {
+        "gethostname",
+        invoke_gethostname,
+        "EFAULT EINVAL ENAMETOOLONG ENOSYS"
+    },
+    {
+        "getpeername",
+        invoke_getpeername,
+        "EBADF EFAULT EINVAL ENOBUFS ENOTCONN ENOTSOCK"
+    },
+    {
+        "getpgid",
+        invoke_getpgid,
+        "EINVAL ESRCH"
+    },
+    {
+        "getpgrp",
+        invoke_getpgrp,
+        "EINVAL ESRCH"
+    },
+    {
+        "getpriority",
+        invoke_getpriority,
+        "EINVAL ESRCH EPERM"
+    },
+    {
+        "getresgid",
+        invoke_getresgid,
+        "EFAULT"
+    },
+    {
+        "getresuid",
+        invoke_getresuid,
+        "EFAULT"
+    },
+    {
+        "getrlimit",
+        invoke_getrlimit,
+        "EFAULT EINVAL"
+    },
+    {
+        "getrusage",
+        invoke_getrusage,
+        "EFAULT EINVAL"
+    },
+    {
+        "getsockname",
+        invoke_getsockname,
+        "EBADF EFAULT EINVAL ENOBUFS ENOTCONN ENOTSOCK"
+    },
+    {
+        "getsockopt",
+        invoke_getsockopt,
+        "EBADF EFAULT EINVAL ENOPROTOOPT ENOTSOCK"
+    },
+    {
+        "gettimeofday",
+        invoke_gettimeofday,
+        "EFAULT"
+    },
+    {
+        "getw",
+        invoke_getw,
+        ""
+    },
+    {
+        "iconv",
+        invoke_iconv,
+        "EBADF E2BIG EILSEQ EINVAL"
+    },
+    {
+        "iconv_close",
+        invoke_iconv_close,
+        "EBADF"
+    },
+    {
+        "iconv_open",
+        invoke_iconv_open,
+        "EINVAL"
+    },
+    {
+        "ioctl",
+        invoke_ioctl,
+        ""
+    },
+    {
+        "kill",
+        invoke_kill,
+        "EINVAL EPERM ESRCH"
+    },
+    {
+        "lchmod",
+        invoke_lchmod,
+        ""
+    },
+    {
+        "lchown",
+        invoke_lchown,
+        ""
+    },
+    {
+        "lchownat",
+        invoke_lchownat,
+        ""
+    },
+    {
+        "link",
+        invoke_link,
+        "EACCES EEXIST EFAULT EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM "
+        "ENOSPC ENOTDIR EPERM EROFS EXDEV"
+    },
+    {
+        "linkat",
+        invoke_linkat,
+        "EBADF ENOTDIR EACCES EEXIST EFAULT EIO ELOOP EMLINK ENAMETOOLONG "
+        "ENOENT ENOMEM ENOSPC EPERM EROFS EXDEV"
+    },
+    {
+        "listen",
+        invoke_listen,
+        "EADDRINUSE EBADF ENOTSOCK EOPNOTSUPP EDESTADDRREQ EINVAL"
+    },
+    {
+        "lseek",
+        invoke_lseek,
+        "EINVAL ENOSYS EBADF ENXIO EOVERFLOW ESPIPE EOPNOTSUPP"
+    },
+    {
+        "lstat",
+        invoke_lstat,
+        "EACCES EFAULT ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM ENOTDIR"
+    },
+    {
+        "lutimes",
+        invoke_lutimes,
+        "EACCES EFAULT ELOOP EMLINK ENAMETOOLONG ENOENT ENOTDIR EPERM EROFS "
+        "EINVAL ENOSYS EOPNOTSUPP ENOTSUP"
+    },
+    {
+        "malloc",
+        invoke_malloc,
+        "ENOMEM"
+    },
+    {
+        "mkdir",
+        invoke_mkdir,
+        "EACCES EEXIST EFAULT EMLINK ELOOP ENAMETOOLONG ENOENT ENOMEM ENOSPC "
+        "ENOTDIR EPERM EROFS"
+    },
+    {
+        "mkdtemp",
+        invoke_mkdtemp,
+        "EFAULT EINVAL EEXIST"
+    },
+    {
+        "mknod",
+        invoke_mknod,
+        "EEXIST EACCES EFAULT ELOOP ENAMETOOLONG ENOENT ENOMEM ENOSPC ENOTDIR "
+        "EPERM EROFS EINVAL"
+    },
+    {
+        "mkostemp",
+        invoke_mkostemp,
+        "EINVAL EEXIST"
+    },
+    {
+        "mkstemp",
+        invoke_mkstemp,
+        "EFAULT EINVAL EEXIST"
+    },
+    {
+        "mktemp",
+        invoke_mktemp,
+        "EFAULT EINVAL EEXIST"
+    },
+    {
+        "mmap",
+        invoke_mmap,
+        "EACCES EAGAIN EWOULDBLOCK EBADF EINVAL ENFILE ENOTSUP EOPNOTSUP "
+        "ENODEV ENOMEM EPERM ETXTBSY"
+    },
+    {
+        "mount",
+        invoke_mount,
+        "EACCES EBUSY EFAULT EINVAL ELOOP EMFILE ENAMETOOLONG ENODEV ENOENT "
+        "ENOMEM ENOTBLK ENOTDIR ENXIO EPERM"
+    },
+    {
+        "munmap",
+        invoke_munmap,
+        "EINVAL"
+    },
+    {
+        "nanosleep",
+        invoke_nanosleep,
+        "EFAULT EINTR EINVAL"
+    },
+    {
+        "nice",
+        invoke_nice,
+        "EPERM EINVAL"
+    },
+    {
+        "open",
+        invoke_open,
+        "EACCES EINVAL EEXIST EFAULT EFBIG EOVERFLOW EISDIR ELOOP EMLINK "
+        "EMFILE ENAMETOOLONG ENFILE ENOENT ENOMEDIUM ENOMEM ENOSPC ENOTDIR "
+        "ENXIO EPERM EROFS ETXTBSY EWOULDBLOCK ENODEV"
+    },
+    {
+        "openat",
+        invoke_openat,
+        "EBADF ENOTDIR ENOMEM"
+    },
+    {
+        "opendir",
+        invoke_opendir,
+        "ENOMEM"
+    },
+    {
+        "pathconf",
+        invoke_pathconf,
+        "ELOOP EACCES EINVAL ENOSYS EOPNOTSUPP ENAMETOOLONG ENOENT ENOTDIR"
+    },
+    {
+        "pclose",
+        invoke_pclose,
+        ""
+    },
+    {
+        "pipe",
+        invoke_pipe,
+        ""
+    },
+    {
+        "pipe2",
+        invoke_pipe2,
+        "EFAULT EINVAL EMFILE ENFILE"
+    },
+    {
+        "poll",
+        invoke_poll,
+        "EFAULT EINTR EINVAL ENOMEM EBADF"
+    },
+    {
+        "popen",
+        invoke_popen,
+        "EINVAL EMFILE ENFILE ENOMEM"
+    },
+    {
+        "pread",
+        invoke_pread,
+        "EBADF ESPIPE ENOSYS EOPNOTSUPP EINVAL"
+    },
+    {
+        "printf",
+        invoke_printf,
+        ""
+    },
+    {
+        "ptrace",
+        invoke_ptrace,
+        "EBUSY EFAULT EINVAL EIO EPERM ESRCH"
+    },
+    {
+        "putc",
+        invoke_putc,
+        ""
+    },
+    {
+        "putchar",
+        invoke_putchar,
+        ""
+    },
+    {
+        "putenv",
+        invoke_putenv,
+        "ENOMEM"
+    },
+    {
+        "puts",
+        invoke_puts,
+        ""
+    },
+    {
+        "putw",
+        invoke_putw,
+        ""
+    },
+    {
+        "pwrite",
+        invoke_pwrite,
+        "EBADF ESPIPE ENOSYS EOPNOTSUPP EINVAL"
+    },
+    {
+        "raise",
+        invoke_raise,
+        ""
+    },
+    {
+        "read",
+        invoke_read,
+        "EAGAIN EBADF EFAULT EINTR EINVAL EIO EISDIR ENOENT EOVERFLOW"
+    },
+    {
+        "readdir",
+        invoke_readdir,
+        "EBADF EFAULT EINVAL EIO ENOTDIR"
+    },
+    {
+        "readlink",
+        invoke_readlink,
+        "EACCES EFAULT EINVAL EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM "
+        "ENOTDIR ERANGE"
+    },
+    {
+        "readv",
+        invoke_readv,
+        "EFAULT EINTR EINVAL ENOSYS EOPNOTSUPP"
+    },
+    {
+        "realloc",
+        invoke_realloc,
+        "ENOMEM"
+    },
+    {
+        "realpath",
+        invoke_realpath,
+        "EACCES EINVAL EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOTDIR"
+    },
+    {
+        "remove",
+        invoke_remove,
+        ""
+    },
+    {
+        "rename",
+        invoke_rename,
+        "EACCES EBUSY EFAULT EINVAL EISDIR ELOOP EMLINK ENAMETOOLONG ENOENT "
+        "ENOMEM ENOSPC ENOTDIR ENOTEMPTY EEXIST EPERM EROFS EXDEV"
+    },
+    {
+        "rmdir",
+        invoke_rmdir,
+        "EACCES EBUSY EFAULT EINVAL ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM "
+        "ENOTDIR EEXIST ENOTEMPTY EPERM EROFS"
+    },
+    {
+        "select",
+        invoke_select,
+        "EBADF EFAULT EINTR EINVAL ENOMEM"
+    },
+    {
+        "setbuf",
+        invoke_setbuf,
+        ""
+    },
+    {
+        "setbuffer",
+        invoke_setbuffer,
+        ""
+    },
+    {
+        "setdomainname",
+        invoke_setdomainname,
+        "EFAULT EINVAL EPERM"
+    },
+    {
+        "setenv",
+        invoke_setenv,
+        "EINVAL ENOMEM EFAULT"
+    },
+    {
+        "setgid",
+        invoke_setgid,
+        "EPERM"
+    },
+    {
+        "setgrent",
+        invoke_setgrent,
+        ""
+    },
+    {
+        "setgroups",
+        invoke_setgroups,
+        "EFAULT EINVAL ENOMEM EPERM"
+    },
+    {
+        "sethostname",
+        invoke_sethostname,
+        "EFAULT EINVAL ENAMETOOLONG EOVERFLOW EPERM"
+    },
+    {
+        "setlinebuf",
+        invoke_setlinebuf,
+        ""
+    },
+    {
+        "setpgid",
+        invoke_setpgid,
+        "EACCES EINVAL EPERM ESRCH"
+    },
+    {
+        "setpgrp",
+        invoke_setpgrp,
+        ""
+    },
+    {
+        "setpriority",
+        invoke_setpriority,
+        "EINVAL ESRCH EACCES EPERM"
+    },
+    {
+        "setregid",
+        invoke_setregid,
+        ""
+    },
+    {
+        "setresgid",
+        invoke_setresgid,
+        "EPERM"
+    },
+    {
+        "setresuid",
+        invoke_setresuid,
+        "EAGAIN EWOULDBLOCK EPERM"
+    },
+    {
+        "setreuid",
+        invoke_setreuid,
+        ""
+    },
+    {
+        "setsid",
+        invoke_setsid,
+        "EPERM"
+    },
+    {
+        "setsockopt",
+        invoke_setsockopt,
+        "EBADF EFAULT EINVAL ENOPROTOOPT ENOTSOCK"
+    },
+    {
+        "settimeofday",
+        invoke_settimeofday,
+        "EFAULT EINVAL EPERM"
+    },
+    {
+        "setuid",
+        invoke_setuid,
+        "EAGAIN EWOULDBLOCK EPERM"
+    },
+    {
+        "setvbuf",
+        invoke_setvbuf,
+        "EINVAL EBADF ENOMEM"
+    },
+    {
+        "shmat",
+        invoke_shmat,
+        "EACCES EPERM EINVAL ENOMEM EMFILE"
+    },
+    {
+        "shmctl",
+        invoke_shmctl,
+        "EFAULT EIDRM EINVAL ENOMEM EOVERFLOW EACCES EPERM"
+    },
+    {
+        "signalfd",
+        invoke_signalfd,
+        "EBADF EFAULT EINVAL EMFILE ENFILE ENODEV ENOMEM ENOSYS"
+    },
+    {
+        "sleep",
+        invoke_sleep,
+        ""
+    },
+    {
+        "snprintf",
+        invoke_snprintf,
+        ""
+    },
+    {
+        "socket",
+        invoke_socket,
+        "EACCES EPERM EAFNOSUPPORT EINVAL EMFILE ENFILE ENOMEM ENOBUFS "
+        "EPROTONOSUPPORT"
+    },
+    {
+        "socketpair",
+        invoke_socketpair,
+        "EFAULT"
+    },
+    {
+        "sprintf",
+        invoke_sprintf,
+        ""
+    },
+    {
+        "stat",
+        invoke_stat,
+        "EACCES EFAULT ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM ENOTDIR"
+    },
+    {
+        "statfs",
+        invoke_statfs,
+        "EACCES EFAULT EINTR EIO ELOOP ENAMETOOLONG ENOENT ENOMEM ENOSYS "
+        "EOPNOTSUPP ENOTDIR EOVERFLOW"
+    },
+    {
+        "statvfs",
+        invoke_statvfs,
+        "EACCES EFAULT EINTR EIO ELOOP ENAMETOOLONG ENOENT ENOMEM ENOSYS "
+        "EOPNOTSUPP ENOTSUP ENOTDIR EOVERFLOW"
+    },
+    {
+        "stime",
+        invoke_stime,
+        "EFAULT EPERM"
+    },
+    {
+        "strcoll",
+        invoke_strcoll,
+        ""
+    },
+    {
+        "strdup",
+        invoke_strdup,
+        ""
+    },
+    {
+        "strndup",
+        invoke_strndup,
+        ""
+    },
+    {
+        "strtod",
+        invoke_strtod,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtof",
+        invoke_strtof,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtol",
+        invoke_strtol,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtold",
+        invoke_strtold,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtoll",
+        invoke_strtoll,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtoul",
+        invoke_strtoul,
+        "EINVAL ERANGE"
+    },
+    {
+        "strtoull",
+        invoke_strtoull,
+        "EINVAL ERANGE"
+    },
+    {
+        "symlink",
+        invoke_symlink,
+        "EACCES EEXIST EFAULT EIO ELOOP EMLINK ENAMETOOLONG ENOENT ENOMEM "
+        "ENOSPC ENOTDIR EPERM EROFS"
+    },
+    {
+        "system",
+        invoke_system,
+        "EAGAIN ENOMEM ECHILD EINTR EINVAL"
+    },
+    {
+        "tcdrain",
+        invoke_tcdrain,
+        "EBADF ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "tcflow",
+        invoke_tcflow,
+        "EBADF EINVAL ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "tcflush",
+        invoke_tcflush,
+        "EBADF EINVAL ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "tcgetattr",
+        invoke_tcgetattr,
+        "EBADF EINVAL EFAULT ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "tcsendbreak",
+        invoke_tcsendbreak,
+        "EBADF EINVAL ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "tcsetattr",
+        invoke_tcsetattr,
+        "EBADF EINVAL ENOTTY ENOSYS EOPNOTSUPP ENOIOCTLCMD ENONOIOCTL"
+    },
+    {
+        "telldir",
+        invoke_telldir,
+        "EBADF EFAULT"
+    },
+    {
+        "tempnam",
+        invoke_tempnam,
+        "EFAULT EINVAL ENOMEM EEXIST"
+    },
+    {
+        "time",
+        invoke_time,
+        "EFAULT"
+    },
+    {
+        "timerfd_create",
+        invoke_timerfd_create,
+        "EINVAL EMFILE ENFILE ENODEV ENOMEM ENOSYS EOPNOTSUPP"
+    },
+    {
+        "tmpfile",
+        invoke_tmpfile,
+        ""
+    },
+    {
+        "tmpnam",
+        invoke_tmpnam,
+        "EFAULT EEXIST EINVAL"
+    },
+    {
+        "truncate",
+        invoke_truncate,
+        "EACCES EFAULT EFBIG EINTR EINVAL EIO EISDIR ELOOP EMLINK "
+        "ENAMETOOLONG ENOENT ENOTDIR EPERM EROFS ETXTBSY"
+    },
+    {
+        "uname",
+        invoke_uname,
+        "EFAULT"
+    },
+    {
+        "ungetc",
+        invoke_ungetc,
+        "EBADF EINVAL ENOMEM"
+    },
+    {
+        "unlink",
+        invoke_unlink,
+        "EACCES EBUSY EFAULT EIO EISDIR ELOOP EMLINK ENAMETOOLONG ENOENT "
+        "ENOMEM ENOTDIR EPERM EROFS"
+    },
+    {
+        "unsetenv",
+        invoke_unsetenv,
+        "EINVAL ENOMEM"
+    },
+    {
+        "usleep",
+        invoke_usleep,
+        "EINTR EINVAL"
+    },
+    {
+        "ustat",
+        invoke_ustat,
+        "EFAULT EINVAL ENOSYS EOPNOTSUPP"
+    },
+    {
+        "utime",
+        invoke_utime,
+        "EACCES EFAULT ELOOP EMLINK ENAMETOOLONG ENOENT ENOTDIR EPERM EROFS"
+    },
+    {
+        "utimens",
+        invoke_utimens,
+        ""
+    },
+    {
+        "utimensat",
+        invoke_utimensat,
+        "EINVAL EACCES EBADF EFAULT ELOOP EMLINK ENAMETOOLONG ENOENT ENOTDIR "
+        "EPERM EROFS ESRCH"
+    },
+    {
+        "utimes",
+        invoke_utimes,
+        ""
+    },
+    {
+        "vfork",
+        invoke_vfork,
+        ""
+    },
+    {
+        "wait",
+        invoke_wait,
+        "ECHILD EFAULT EINTR"
+    },
+    {
+        "wait3",
+        invoke_wait3,
+        ""
+    },
+    {
+        "wait4",
+        invoke_wait4,
+        "EFAULT"
+    },
+    {
+        "waitpid",
+        invoke_waitpid,
+        "ECHILD EFAULT EINTR EINVAL"
+    },
+    {
+        "write",
+        invoke_write,
+        "EAGAIN EBADF EFAULT EFBIG EINTR EINVAL EIO ENOSPC EPIPE ENOENT"
+    },
+    {
+        "writev",
+        invoke_writev,
+        "EFAULT EINTR EINVAL ENOSYS EOPNOTSUPP"
+    },
+};
+
+const size_t bench_table_size = sizeof(bench_table) / sizeof(bench_table[0]);
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -39,15 +39,22 @@ int
 main(int argc, char **argv)
 {
     const char      *path;
+    int             raw;
 
     path = 0;
+    raw = 0;
     for (;;)
     {
-        int c = getopt(argc, argv, "sV");
+        int c = getopt(argc, argv, "rsV");
         if (c == EOF)
             break;
         switch (c)
         {
+        case 'r':
+            /* plain chdir, any explanation is the LD_PRELOAD library's */
+            raw = 1;
+            break;
+
         case 's':
             explain_output_register
             (
@@ -71,6 +78,8 @@ main(int argc, char **argv)
         usage();
     path = argv[optind];
 
+    if (raw)
+        return (chdir(path) < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
     explain_chdir_or_die(path);
     return 0;
 }
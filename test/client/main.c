@@ -0,0 +1,107 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/client.h>
+#include <libexplain/strtol.h>
+#include <libexplain/version_print.h>
+#include <libexplain/wrap_and_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_client -s <socket> <errno> <function> "
+        "[ <arg>... ]\n");
+    fprintf(stderr, "       test_client -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char      *socket_path;
+    int             errnum;
+    char            message[3000];
+
+    socket_path = 0;
+    for (;;)
+    {
+        int c = getopt(argc, argv, "s:V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 's':
+            socket_path = optarg;
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind + 2 > argc)
+        usage();
+    errnum = explain_strtol_or_die(argv[optind], 0, 0);
+
+    /*
+     * Ask twice, so that the second request reuses the connection.
+     */
+    if
+    (
+        explain_client_message
+        (
+            message,
+            sizeof(message),
+            socket_path,
+            errnum,
+            argv[optind + 1],
+            argc - optind - 2,
+            (const char *const *)argv + optind + 2
+        )
+    ||
+        explain_client_message
+        (
+            message,
+            sizeof(message),
+            socket_path,
+            errnum,
+            argv[optind + 1],
+            argc - optind - 2,
+            (const char *const *)argv + optind + 2
+        )
+    )
+    {
+        printf("unavailable\n");
+        return EXIT_FAILURE;
+    }
+    explain_wrap_and_print(stdout, message);
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
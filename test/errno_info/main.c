@@ -0,0 +1,118 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/errno_info/table.h>
+#include <libexplain/version_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_errno_info\n");
+    fprintf(stderr, "       test_errno_info -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+/**
+  * The round_trip function is used to look up an errno name, and
+  * report when the entry found does not have that name.
+  *
+  * @param original
+  *     The name, as it appears in the table.
+  * @param name
+  *     The name to look up.
+  * @returns
+  *     zero if the name was found, non-zero if not.
+  */
+static int
+round_trip(const char *original, const char *name)
+{
+    const explain_errno_info_t *tp;
+
+    tp = explain_errno_info_by_name(name);
+    if (!tp)
+    {
+        printf("%s: not found\n", name);
+        return 1;
+    }
+    if (0 != strcmp(tp->name, original))
+    {
+        printf("%s: found %s\n", name, tp->name);
+        return 1;
+    }
+    return 0;
+}
+
+
+int
+main(int argc, char **argv)
+{
+    size_t          j;
+    int             errors;
+
+    for (;;)
+    {
+        int c = getopt(argc, argv, "V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    /*
+     * Every name in the table must be found by name, whatever its
+     * case, or the generated name hash is out of date.
+     */
+    errors = 0;
+    for (j = 0; j < explain_errno_info_size; ++j)
+    {
+        const char      *name;
+        char            lower[100];
+        size_t          k;
+
+        name = explain_errno_info[j].name;
+        errors += round_trip(name, name);
+        for (k = 0; name[k] && k + 1 < sizeof(lower); ++k)
+            lower[k] = tolower((unsigned char)name[k]);
+        lower[k] = '\0';
+        errors += round_trip(name, lower);
+    }
+    if (errors)
+        return EXIT_FAILURE;
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,112 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/fcntl.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/sys/select.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/buffer/fd_set.h>
+#include <libexplain/explanation.h>
+#include <libexplain/open.h>
+#include <libexplain/strtol.h>
+#include <libexplain/version_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_fd_set <nfds> <fildes>...\n");
+    fprintf(stderr, "       test_fd_set -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    int             nfds;
+    int             fildes;
+    int             j;
+    fd_set          fds;
+    explain_explanation_t exp;
+    char            text[4000];
+    explain_string_buffer_t sb;
+
+    for (;;)
+    {
+        int c = getopt(argc, argv, "V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind + 1 > argc)
+        usage();
+    nfds = explain_strtol_or_die(argv[optind], 0, 0);
+
+    /*
+     * Each file descriptor named on the command line is put in the
+     * set.  A positive one refers to /dev/null, a negative one is put
+     * in the set but left closed.
+     */
+    FD_ZERO(&fds);
+    fildes = explain_open_or_die("/dev/null", O_RDONLY, 0);
+    for (j = optind + 1; j < argc; ++j)
+    {
+        int             n;
+
+        n = explain_strtol_or_die(argv[j], 0, 0);
+        if (n < 0)
+        {
+            n = -n;
+            close(n);
+        }
+        else if (n != fildes)
+            dup2(fildes, n);
+        FD_SET(n, &fds);
+    }
+
+    /*
+     * Twice, closing the first file descriptor in between, to show
+     * the names are not stale.
+     */
+    explain_explanation_init(&exp, 0);
+    explain_string_buffer_init(&sb, text, sizeof(text));
+    explain_buffer_fd_set(&sb, nfds, &fds);
+    printf("%s\n", text);
+    if (optind + 1 < argc)
+        close(explain_strtol_or_die(argv[optind + 1], 0, 0));
+    explain_explanation_init(&exp, 0);
+    explain_string_buffer_init(&sb, text, sizeof(text));
+    explain_buffer_fd_set(&sb, nfds, &fds);
+    printf("%s\n", text);
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -35,7 +35,7 @@ getopt2(int argc, char **argv)
 {
     int             c;
 
-    c = getopt(argc, argv, "cef:p:sV");
+    c = getopt(argc, argv, "cd:ef:p:sV");
     if (c < 0 && optind < argc)
     {
         optarg = argv[optind++];
@@ -51,6 +51,7 @@ usage(void)
     const char *prog;
     prog = explain_program_name_get();
     fprintf(stderr, "Usage: %s ( -s | -p<pid> )( -c | -e | -f<fd> )\n", prog);
+    fprintf(stderr, "       %s -d <dir>\n", prog);
     fprintf(stderr, "       %s -V\n", prog);
     exit(EXIT_FAILURE);
 }
@@ -81,6 +82,20 @@ main(int argc, char **argv)
         pid = explain_strtol_or_die(optarg, 0, 0);
         break;
 
+    case 'd':
+        /* directory in use */
+        {
+            const char      *dirpath;
+
+            dirpath = optarg;
+            must_be_end_of_cmdline(argc, argv);
+            if (explain_fileinfo_dir_tree_in_use(dirpath) > 0)
+                printf("in use\n");
+            else
+                printf("not in use\n");
+        }
+        return 0;
+
     case 'V':
         must_be_end_of_cmdline(argc, argv);
         explain_version_print();
@@ -0,0 +1,220 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/libintl.h>
+#include <libexplain/ac/locale.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/close.h>
+#include <libexplain/fclose.h>
+#include <libexplain/fopen.h>
+#include <libexplain/fwrite.h>
+#include <libexplain/version_print.h>
+#include <libexplain/wrap_and_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_gettext -m <file>\n");
+    fprintf(stderr, "       test_gettext -d <localedir> [ -l <language> ]\n");
+    fprintf(stderr, "       test_gettext -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+/*
+ * The one message translated by the test catalogue, the one that glues
+ * every explanation together.
+ */
+static const char *const msgid[2] =
+{
+    "",
+    "%s failed, %s because %s",
+};
+static const char *const msgstr[2] =
+{
+    "Content-Type: text/plain; charset=UTF-8\n",
+    "%s FAILED, %s BECAUSE %s",
+};
+
+
+static void
+put_word(FILE *fp, unsigned long n)
+{
+    unsigned int    word;
+
+    word = n;
+    explain_fwrite_or_die(&word, sizeof(word), 1, fp);
+}
+
+
+/**
+  * The write_catalogue function is used to write a GNU message catalogue
+  * (see msgfmt(1)) translating the above message, so that the test does
+  * not depend on msgfmt(1) or on the installed translations.
+  */
+static void
+write_catalogue(const char *path)
+{
+    FILE            *fp;
+    unsigned long   strings;
+    unsigned long   offset;
+    size_t          j;
+
+    fp = explain_fopen_or_die(path, "wb");
+
+    /* magic, revision, count, originals, translations, no hash table */
+    put_word(fp, 0x950412DEuL);
+    put_word(fp, 0);
+    put_word(fp, 2);
+    put_word(fp, 28);
+    put_word(fp, 28 + 2 * 8);
+    put_word(fp, 0);
+    put_word(fp, 28 + 4 * 8);
+
+    /* the (length, offset) pairs, the originals sorted */
+    strings = 28 + 4 * 8;
+    offset = strings;
+    for (j = 0; j < 2; ++j)
+    {
+        put_word(fp, strlen(msgid[j]));
+        put_word(fp, offset);
+        offset += strlen(msgid[j]) + 1;
+    }
+    for (j = 0; j < 2; ++j)
+    {
+        put_word(fp, strlen(msgstr[j]));
+        put_word(fp, offset);
+        offset += strlen(msgstr[j]) + 1;
+    }
+    for (j = 0; j < 2; ++j)
+        explain_fwrite_or_die(msgid[j], strlen(msgid[j]) + 1, 1, fp);
+    for (j = 0; j < 2; ++j)
+        explain_fwrite_or_die(msgstr[j], strlen(msgstr[j]) + 1, 1, fp);
+    explain_fclose_or_die(fp);
+}
+
+
+static void
+step(const char *caption)
+{
+    printf("%s:\n", caption);
+    explain_wrap_and_print(stdout, explain_errno_close(EBADF, 99));
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char      *catalogue;
+    const char      *localedir;
+    const char      *language;
+    const char      *utf8;
+
+    catalogue = 0;
+    localedir = 0;
+    language = "xx";
+    for (;;)
+    {
+        int c = getopt(argc, argv, "d:l:m:V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'd':
+            localedir = optarg;
+            break;
+
+        case 'l':
+            language = optarg;
+            break;
+
+        case 'm':
+            catalogue = optarg;
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+    if (catalogue)
+    {
+        write_catalogue(catalogue);
+        return 0;
+    }
+    if (!localedir)
+        usage();
+
+    /*
+     * The LANGUAGE variable is ignored in the C locale, so switching
+     * between it and a UTF-8 locale switches the translation on and off.
+     */
+    utf8 = setlocale(LC_ALL, "C.UTF-8");
+    if (!utf8)
+        utf8 = setlocale(LC_ALL, "C.utf8");
+    if (!utf8)
+    {
+        printf("no UTF-8 locale\n");
+        return 0;
+    }
+    utf8 = strdup(utf8);
+    setenv("LANGUAGE", language, 1);
+    bindtextdomain("libexplain", localedir);
+
+    /*
+     * Each explanation must reflect the locale of the moment, not the
+     * translations cached by the one before it.
+     */
+    setlocale(LC_ALL, "C");
+    step("C");
+    setlocale(LC_ALL, utf8);
+    step("setlocale");
+    setlocale(LC_ALL, "C");
+    step("C");
+#ifdef HAVE_USELOCALE
+    {
+        locale_t        loc;
+
+        loc = newlocale(LC_ALL_MASK, utf8, (locale_t)0);
+        if (loc)
+        {
+            uselocale(loc);
+            step("uselocale");
+            uselocale(LC_GLOBAL_LOCALE);
+            step("C");
+            freelocale(loc);
+        }
+    }
+#endif
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
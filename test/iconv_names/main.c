@@ -0,0 +1,83 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/iconv_names.h>
+#include <libexplain/iconv_open.h>
+#include <libexplain/version_print.h>
+#include <libexplain/wrap_and_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_iconv_names -f <gconv-modules> <tocode> "
+        "<fromcode>\n");
+    fprintf(stderr, "       test_iconv_names -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    const char      *modules;
+
+    modules = 0;
+    for (;;)
+    {
+        int c = getopt(argc, argv, "f:V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'f':
+            modules = optarg;
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (!modules || optind + 2 != argc)
+        usage();
+
+    /*
+     * The names come from the given file, not the host's gconv
+     * modules, so that the results are the same everywhere.
+     */
+    explain_iconv_names_read(modules);
+    explain_wrap_and_print
+    (
+        stdout,
+        explain_errno_iconv_open(EINVAL, argv[optind], argv[optind + 1])
+    );
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
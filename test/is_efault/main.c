@@ -0,0 +1,161 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/sys/mman.h>
+#include <libexplain/ac/sys/uio.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/is_efault.h>
+#include <libexplain/version_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_is_efault\n");
+    fprintf(stderr, "       test_is_efault -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+static void
+check(const char *caption, const void *data, size_t data_size)
+{
+    printf
+    (
+        "%s: %s\n",
+        caption,
+        (explain_is_efault_pointer(data, data_size) ? "bad" : "ok")
+    );
+}
+
+
+int
+main(int argc, char **argv)
+{
+    char            stack[100];
+    char            *heap;
+    char            *pages;
+    size_t          page_size;
+    struct iovec    iov[5];
+    unsigned char   verdict[5];
+    int             j;
+
+    for (;;)
+    {
+        int c = getopt(argc, argv, "V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    /*
+     * Map three pages, and unmap the last one, so that there is a
+     * known hole immediately after the second page.
+     */
+    page_size = getpagesize();
+    pages =
+        mmap
+        (
+            0,
+            3 * page_size,
+            PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS,
+            -1,
+            0
+        );
+    if (pages == MAP_FAILED)
+    {
+        perror("mmap");
+        return EXIT_FAILURE;
+    }
+    munmap(pages + 2 * page_size, page_size);
+
+    heap = malloc(1000);
+    if (!heap)
+        return EXIT_FAILURE;
+    memset(stack, 0, sizeof(stack));
+
+    check("null", 0, 1);
+    check("stack", stack, sizeof(stack));
+    check("heap", heap, 1000);
+    check("pages", pages, 2 * page_size);
+    check("last byte", pages + 2 * page_size - 1, 1);
+    check("hole", pages + 2 * page_size, 1);
+    check("straddle", pages + page_size, 2 * page_size);
+    check("wrap", heap, (size_t)-1);
+
+    /*
+     * All of the buffers of an I/O vector are checked at once.
+     */
+    iov[0].iov_base = stack;
+    iov[0].iov_len = sizeof(stack);
+    iov[1].iov_base = pages + page_size;
+    iov[1].iov_len = 2 * page_size;
+    iov[2].iov_base = 0;
+    iov[2].iov_len = 0;
+    iov[3].iov_base = heap;
+    iov[3].iov_len = 1000;
+    iov[4].iov_base = pages + 2 * page_size;
+    iov[4].iov_len = 1;
+    printf("iovec: first bad %d\n", explain_is_efault_iovec(iov, 5, 0));
+    explain_is_efault_iovec(iov, 5, verdict);
+    printf("iovec:");
+    for (j = 0; j < 5; ++j)
+        printf(" %s", (verdict[j] ? "bad" : "ok"));
+    printf("\n");
+
+    /*
+     * The first element of an array that runs into the hole.
+     */
+    j = explain_is_efault_array(pages, 2 * page_size / 8 + 3, 8);
+    if (j == (int)(2 * page_size / 8))
+        printf("array: first bad at the hole\n");
+    else
+        printf("array: first bad %d\n", j);
+    printf("array: first bad %d\n", explain_is_efault_array(pages, 10, 8));
+
+    /*
+     * The second page goes away in the middle of an explanation; a
+     * fresh snapshot is needed to see it.
+     */
+    munmap(pages + page_size, page_size);
+    explain_is_efault_maps_invalidate();
+    check("unmapped", pages + page_size, 1);
+    check("first page", pages, page_size);
+
+    free(heap);
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
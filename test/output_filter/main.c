@@ -0,0 +1,130 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/errno.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/string.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/output.h>
+#include <libexplain/strtol.h>
+#include <libexplain/version_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_output_filter [ <option>... ]\n");
+    fprintf(stderr, "       test_output_filter -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    int             window;
+    int             rate;
+    int             burst;
+    int             keyed;
+    char            line[1000];
+
+    window = 30;
+    rate = 0;
+    burst = 1;
+    keyed = 0;
+    for (;;)
+    {
+        int c = getopt(argc, argv, "b:kr:Vw:");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'b':
+            burst = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
+        case 'k':
+            keyed = 1;
+            break;
+
+        case 'r':
+            rate = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        case 'w':
+            window = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
+        default:
+            usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    explain_output_register
+    (
+        explain_output_filter_new4
+        (
+            explain_output_stderr_new(),
+            window,
+            rate,
+            burst
+        )
+    );
+
+    /*
+     * Each line of the standard input is a message.  In keyed mode,
+     * each line is a file descriptor number, and the message is only
+     * built if the filter says it will not be suppressed.
+     */
+    while (fgets(line, sizeof(line), stdin))
+    {
+        size_t          len;
+
+        len = strlen(line);
+        if (len > 0 && line[len - 1] == '\n')
+            line[--len] = '\0';
+        if (keyed)
+        {
+            int             fildes;
+
+            fildes = explain_strtol_or_die(line, 0, 0);
+            if (!explain_output_suppress("test", EIO, fildes))
+                explain_output_error("fildes %d failed", fildes);
+        }
+        else
+            explain_output_message(line);
+    }
+
+    /*
+     * Destroying the filter flushes any pending repeat counts.
+     */
+    explain_output_register(0);
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
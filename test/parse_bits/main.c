@@ -0,0 +1,129 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/ctype.h>
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/parse_bits.h>
+#include <libexplain/string_buffer.h>
+#include <libexplain/version_print.h>
+
+
+/*
+ * Fewer members than are usually worth indexing, so that it is only
+ * indexed because it is registered.
+ */
+static explain_parse_bits_table_t table[] =
+{
+    { "ALPHA", 1 },
+    { "BETA", 2 },
+    { "GAMMA", 4 },
+};
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_parse_bits [ -c ] <name-or-value>...\n");
+    fprintf(stderr, "       test_parse_bits -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+static void
+look_up(int argc, char **argv)
+{
+    int             j;
+
+    for (j = 0; j < argc; ++j)
+    {
+        const char      *arg;
+
+        arg = argv[j];
+        if (isdigit((unsigned char)arg[0]))
+        {
+            char            text[100];
+            explain_string_buffer_t sb;
+
+            explain_string_buffer_init(&sb, text, sizeof(text));
+            explain_parse_bits_print(&sb, atoi(arg), table, SIZEOF(table));
+            printf("%s = %s\n", arg, text);
+        }
+        else
+        {
+            const explain_parse_bits_table_t *tp;
+
+            tp = explain_parse_bits_find_by_name(arg, table, SIZEOF(table));
+            if (tp)
+                printf("%s = %d\n", arg, tp->value);
+            else
+                printf("%s: not found\n", arg);
+        }
+    }
+}
+
+
+int
+main(int argc, char **argv)
+{
+    int             change;
+
+    change = 0;
+    for (;;)
+    {
+        int c = getopt(argc, argv, "cV");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'c':
+            change = 1;
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind >= argc)
+        usage();
+
+    explain_parse_bits_register(table, SIZEOF(table));
+    look_up(argc - optind, argv + optind);
+    if (change)
+    {
+        /*
+         * The size, and the first and last members, are unchanged, so
+         * only registering the table again makes the change known.
+         */
+        table[1].name = "DELTA";
+        explain_parse_bits_register(table, SIZEOF(table));
+        printf("changed\n");
+        look_up(argc - optind, argv + optind);
+    }
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */
@@ -0,0 +1,110 @@
+/*
+ * libexplain - Explain errno values returned by libc functions
+ * Copyright (C) 2013 Peter Miller
+ * Written by Peter Miller <pmiller@opensource.org.au>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <libexplain/ac/stdio.h>
+#include <libexplain/ac/stdlib.h>
+#include <libexplain/ac/unistd.h>
+
+#include <libexplain/close.h>
+#include <libexplain/output.h>
+#include <libexplain/strtol.h>
+#include <libexplain/version_print.h>
+
+
+static void
+usage(void)
+{
+    fprintf(stderr, "Usage: test_sample [ <option>... ]\n");
+    fprintf(stderr, "       test_sample -V\n");
+    exit(EXIT_FAILURE);
+}
+
+
+int
+main(int argc, char **argv)
+{
+    long            count;
+    long            j;
+    int             fildes;
+    int             or_die;
+
+    count = 1;
+    fildes = -1;
+    or_die = 0;
+    for (;;)
+    {
+        int c = getopt(argc, argv, "df:n:p:V");
+        if (c == EOF)
+            break;
+        switch (c)
+        {
+        case 'd':
+            or_die = 1;
+            break;
+
+        case 'f':
+            fildes = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
+        case 'n':
+            count = explain_strtol_or_die(optarg, 0, 0);
+            break;
+
+        case 'p':
+            if (explain_output_sample("close", 0, optarg) < 0)
+            {
+                fprintf(stderr, "policy \"%s\" malformed\n", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+
+        case 'V':
+            explain_version_print();
+            return 0;
+
+        default:
+            usage();
+        }
+    }
+    if (optind != argc)
+        usage();
+
+    /*
+     * Each close fails (with EBADF), the sampling policy decides which
+     * failures are explained.
+     */
+    for (j = 0; j < count; ++j)
+    {
+        int             result;
+
+        result = explain_close_on_error(fildes);
+        (void)result;
+    }
+
+    /*
+     * The failure that ends the program is explained, whatever the
+     * policy.
+     */
+    if (or_die)
+        explain_close_or_die(fildes);
+    return 0;
+}
+
+
+/* vim: set ts=8 sw=4 et : */